@@ -11,15 +11,21 @@
  */
 
 #include "xz_private.h"
+#ifdef __rtems__
+#include <rtems/crc.h>
+#endif /* __rtems__ */
 
 #ifndef STATIC_RW_DATA
 #	define STATIC_RW_DATA static
 #endif
 
+#ifndef __rtems__
 STATIC_RW_DATA uint64_t xz_crc64_table[256];
+#endif /* __rtems__ */
 
 XZ_EXTERN void xz_crc64_init(void)
 {
+#ifndef __rtems__
 	const uint64_t poly = 0xC96C5795D7870F42;
 
 	uint32_t i;
@@ -33,12 +39,17 @@ XZ_EXTERN void xz_crc64_init(void)
 
 		xz_crc64_table[i] = r;
 	}
+#endif /* __rtems__ */
 
 	return;
 }
 
 XZ_EXTERN uint64_t xz_crc64(const uint8_t *buf, size_t size, uint64_t crc)
 {
+#ifdef __rtems__
+	return _CRC64_Sequence_update(crc ^ CRC64_SEED, buf, size) ^
+	    CRC64_FINAL_XOR;
+#else /* __rtems__ */
 	crc = ~crc;
 
 	while (size != 0) {
@@ -47,4 +58,5 @@ XZ_EXTERN uint64_t xz_crc64(const uint8_t *buf, size_t size, uint64_t crc)
 	}
 
 	return ~crc;
+#endif /* __rtems__ */
 }
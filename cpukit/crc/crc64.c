@@ -0,0 +1,1133 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplCRC
+ *
+ * @brief This source file contains the implementation of
+ *   _CRC64_Update() and _CRC64_Sequence_update().
+ *
+ * The CRC-64 cyclic redundancy checksum uses the reflected ECMA-182
+ * polynomial 0x42f0e1eba9ea3693.  It is used for example by xz.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <rtems/crc.h>
+#include <rtems/endian.h>
+
+/*
+ * The tables are used to process eight bytes in one step (slicing-by-8).
+ * _CRC64_Table[ 0 ] is the usual byte-wise table.  The entry i of
+ * _CRC64_Table[ k ] is the CRC-64 state of the byte i followed by k zero
+ * bytes.
+ */
+static const uint64_t _CRC64_Table[8][256] = {
+  {
+    UINT64_C(0x0000000000000000), UINT64_C(0xB32E4CBE03A75F6F),
+    UINT64_C(0xF4843657A840A05B), UINT64_C(0x47AA7AE9ABE7FF34),
+    UINT64_C(0x7BD0C384FF8F5E33), UINT64_C(0xC8FE8F3AFC28015C),
+    UINT64_C(0x8F54F5D357CFFE68), UINT64_C(0x3C7AB96D5468A107),
+    UINT64_C(0xF7A18709FF1EBC66), UINT64_C(0x448FCBB7FCB9E309),
+    UINT64_C(0x0325B15E575E1C3D), UINT64_C(0xB00BFDE054F94352),
+    UINT64_C(0x8C71448D0091E255), UINT64_C(0x3F5F08330336BD3A),
+    UINT64_C(0x78F572DAA8D1420E), UINT64_C(0xCBDB3E64AB761D61),
+    UINT64_C(0x7D9BA13851336649), UINT64_C(0xCEB5ED8652943926),
+    UINT64_C(0x891F976FF973C612), UINT64_C(0x3A31DBD1FAD4997D),
+    UINT64_C(0x064B62BCAEBC387A), UINT64_C(0xB5652E02AD1B6715),
+    UINT64_C(0xF2CF54EB06FC9821), UINT64_C(0x41E11855055BC74E),
+    UINT64_C(0x8A3A2631AE2DDA2F), UINT64_C(0x39146A8FAD8A8540),
+    UINT64_C(0x7EBE1066066D7A74), UINT64_C(0xCD905CD805CA251B),
+    UINT64_C(0xF1EAE5B551A2841C), UINT64_C(0x42C4A90B5205DB73),
+    UINT64_C(0x056ED3E2F9E22447), UINT64_C(0xB6409F5CFA457B28),
+    UINT64_C(0xFB374270A266CC92), UINT64_C(0x48190ECEA1C193FD),
+    UINT64_C(0x0FB374270A266CC9), UINT64_C(0xBC9D3899098133A6),
+    UINT64_C(0x80E781F45DE992A1), UINT64_C(0x33C9CD4A5E4ECDCE),
+    UINT64_C(0x7463B7A3F5A932FA), UINT64_C(0xC74DFB1DF60E6D95),
+    UINT64_C(0x0C96C5795D7870F4), UINT64_C(0xBFB889C75EDF2F9B),
+    UINT64_C(0xF812F32EF538D0AF), UINT64_C(0x4B3CBF90F69F8FC0),
+    UINT64_C(0x774606FDA2F72EC7), UINT64_C(0xC4684A43A15071A8),
+    UINT64_C(0x83C230AA0AB78E9C), UINT64_C(0x30EC7C140910D1F3),
+    UINT64_C(0x86ACE348F355AADB), UINT64_C(0x3582AFF6F0F2F5B4),
+    UINT64_C(0x7228D51F5B150A80), UINT64_C(0xC10699A158B255EF),
+    UINT64_C(0xFD7C20CC0CDAF4E8), UINT64_C(0x4E526C720F7DAB87),
+    UINT64_C(0x09F8169BA49A54B3), UINT64_C(0xBAD65A25A73D0BDC),
+    UINT64_C(0x710D64410C4B16BD), UINT64_C(0xC22328FF0FEC49D2),
+    UINT64_C(0x85895216A40BB6E6), UINT64_C(0x36A71EA8A7ACE989),
+    UINT64_C(0x0ADDA7C5F3C4488E), UINT64_C(0xB9F3EB7BF06317E1),
+    UINT64_C(0xFE5991925B84E8D5), UINT64_C(0x4D77DD2C5823B7BA),
+    UINT64_C(0x64B62BCAEBC387A1), UINT64_C(0xD7986774E864D8CE),
+    UINT64_C(0x90321D9D438327FA), UINT64_C(0x231C512340247895),
+    UINT64_C(0x1F66E84E144CD992), UINT64_C(0xAC48A4F017EB86FD),
+    UINT64_C(0xEBE2DE19BC0C79C9), UINT64_C(0x58CC92A7BFAB26A6),
+    UINT64_C(0x9317ACC314DD3BC7), UINT64_C(0x2039E07D177A64A8),
+    UINT64_C(0x67939A94BC9D9B9C), UINT64_C(0xD4BDD62ABF3AC4F3),
+    UINT64_C(0xE8C76F47EB5265F4), UINT64_C(0x5BE923F9E8F53A9B),
+    UINT64_C(0x1C4359104312C5AF), UINT64_C(0xAF6D15AE40B59AC0),
+    UINT64_C(0x192D8AF2BAF0E1E8), UINT64_C(0xAA03C64CB957BE87),
+    UINT64_C(0xEDA9BCA512B041B3), UINT64_C(0x5E87F01B11171EDC),
+    UINT64_C(0x62FD4976457FBFDB), UINT64_C(0xD1D305C846D8E0B4),
+    UINT64_C(0x96797F21ED3F1F80), UINT64_C(0x2557339FEE9840EF),
+    UINT64_C(0xEE8C0DFB45EE5D8E), UINT64_C(0x5DA24145464902E1),
+    UINT64_C(0x1A083BACEDAEFDD5), UINT64_C(0xA9267712EE09A2BA),
+    UINT64_C(0x955CCE7FBA6103BD), UINT64_C(0x267282C1B9C65CD2),
+    UINT64_C(0x61D8F8281221A3E6), UINT64_C(0xD2F6B4961186FC89),
+    UINT64_C(0x9F8169BA49A54B33), UINT64_C(0x2CAF25044A02145C),
+    UINT64_C(0x6B055FEDE1E5EB68), UINT64_C(0xD82B1353E242B407),
+    UINT64_C(0xE451AA3EB62A1500), UINT64_C(0x577FE680B58D4A6F),
+    UINT64_C(0x10D59C691E6AB55B), UINT64_C(0xA3FBD0D71DCDEA34),
+    UINT64_C(0x6820EEB3B6BBF755), UINT64_C(0xDB0EA20DB51CA83A),
+    UINT64_C(0x9CA4D8E41EFB570E), UINT64_C(0x2F8A945A1D5C0861),
+    UINT64_C(0x13F02D374934A966), UINT64_C(0xA0DE61894A93F609),
+    UINT64_C(0xE7741B60E174093D), UINT64_C(0x545A57DEE2D35652),
+    UINT64_C(0xE21AC88218962D7A), UINT64_C(0x5134843C1B317215),
+    UINT64_C(0x169EFED5B0D68D21), UINT64_C(0xA5B0B26BB371D24E),
+    UINT64_C(0x99CA0B06E7197349), UINT64_C(0x2AE447B8E4BE2C26),
+    UINT64_C(0x6D4E3D514F59D312), UINT64_C(0xDE6071EF4CFE8C7D),
+    UINT64_C(0x15BB4F8BE788911C), UINT64_C(0xA6950335E42FCE73),
+    UINT64_C(0xE13F79DC4FC83147), UINT64_C(0x521135624C6F6E28),
+    UINT64_C(0x6E6B8C0F1807CF2F), UINT64_C(0xDD45C0B11BA09040),
+    UINT64_C(0x9AEFBA58B0476F74), UINT64_C(0x29C1F6E6B3E0301B),
+    UINT64_C(0xC96C5795D7870F42), UINT64_C(0x7A421B2BD420502D),
+    UINT64_C(0x3DE861C27FC7AF19), UINT64_C(0x8EC62D7C7C60F076),
+    UINT64_C(0xB2BC941128085171), UINT64_C(0x0192D8AF2BAF0E1E),
+    UINT64_C(0x4638A2468048F12A), UINT64_C(0xF516EEF883EFAE45),
+    UINT64_C(0x3ECDD09C2899B324), UINT64_C(0x8DE39C222B3EEC4B),
+    UINT64_C(0xCA49E6CB80D9137F), UINT64_C(0x7967AA75837E4C10),
+    UINT64_C(0x451D1318D716ED17), UINT64_C(0xF6335FA6D4B1B278),
+    UINT64_C(0xB199254F7F564D4C), UINT64_C(0x02B769F17CF11223),
+    UINT64_C(0xB4F7F6AD86B4690B), UINT64_C(0x07D9BA1385133664),
+    UINT64_C(0x4073C0FA2EF4C950), UINT64_C(0xF35D8C442D53963F),
+    UINT64_C(0xCF273529793B3738), UINT64_C(0x7C0979977A9C6857),
+    UINT64_C(0x3BA3037ED17B9763), UINT64_C(0x888D4FC0D2DCC80C),
+    UINT64_C(0x435671A479AAD56D), UINT64_C(0xF0783D1A7A0D8A02),
+    UINT64_C(0xB7D247F3D1EA7536), UINT64_C(0x04FC0B4DD24D2A59),
+    UINT64_C(0x3886B22086258B5E), UINT64_C(0x8BA8FE9E8582D431),
+    UINT64_C(0xCC0284772E652B05), UINT64_C(0x7F2CC8C92DC2746A),
+    UINT64_C(0x325B15E575E1C3D0), UINT64_C(0x8175595B76469CBF),
+    UINT64_C(0xC6DF23B2DDA1638B), UINT64_C(0x75F16F0CDE063CE4),
+    UINT64_C(0x498BD6618A6E9DE3), UINT64_C(0xFAA59ADF89C9C28C),
+    UINT64_C(0xBD0FE036222E3DB8), UINT64_C(0x0E21AC88218962D7),
+    UINT64_C(0xC5FA92EC8AFF7FB6), UINT64_C(0x76D4DE52895820D9),
+    UINT64_C(0x317EA4BB22BFDFED), UINT64_C(0x8250E80521188082),
+    UINT64_C(0xBE2A516875702185), UINT64_C(0x0D041DD676D77EEA),
+    UINT64_C(0x4AAE673FDD3081DE), UINT64_C(0xF9802B81DE97DEB1),
+    UINT64_C(0x4FC0B4DD24D2A599), UINT64_C(0xFCEEF8632775FAF6),
+    UINT64_C(0xBB44828A8C9205C2), UINT64_C(0x086ACE348F355AAD),
+    UINT64_C(0x34107759DB5DFBAA), UINT64_C(0x873E3BE7D8FAA4C5),
+    UINT64_C(0xC094410E731D5BF1), UINT64_C(0x73BA0DB070BA049E),
+    UINT64_C(0xB86133D4DBCC19FF), UINT64_C(0x0B4F7F6AD86B4690),
+    UINT64_C(0x4CE50583738CB9A4), UINT64_C(0xFFCB493D702BE6CB),
+    UINT64_C(0xC3B1F050244347CC), UINT64_C(0x709FBCEE27E418A3),
+    UINT64_C(0x3735C6078C03E797), UINT64_C(0x841B8AB98FA4B8F8),
+    UINT64_C(0xADDA7C5F3C4488E3), UINT64_C(0x1EF430E13FE3D78C),
+    UINT64_C(0x595E4A08940428B8), UINT64_C(0xEA7006B697A377D7),
+    UINT64_C(0xD60ABFDBC3CBD6D0), UINT64_C(0x6524F365C06C89BF),
+    UINT64_C(0x228E898C6B8B768B), UINT64_C(0x91A0C532682C29E4),
+    UINT64_C(0x5A7BFB56C35A3485), UINT64_C(0xE955B7E8C0FD6BEA),
+    UINT64_C(0xAEFFCD016B1A94DE), UINT64_C(0x1DD181BF68BDCBB1),
+    UINT64_C(0x21AB38D23CD56AB6), UINT64_C(0x9285746C3F7235D9),
+    UINT64_C(0xD52F0E859495CAED), UINT64_C(0x6601423B97329582),
+    UINT64_C(0xD041DD676D77EEAA), UINT64_C(0x636F91D96ED0B1C5),
+    UINT64_C(0x24C5EB30C5374EF1), UINT64_C(0x97EBA78EC690119E),
+    UINT64_C(0xAB911EE392F8B099), UINT64_C(0x18BF525D915FEFF6),
+    UINT64_C(0x5F1528B43AB810C2), UINT64_C(0xEC3B640A391F4FAD),
+    UINT64_C(0x27E05A6E926952CC), UINT64_C(0x94CE16D091CE0DA3),
+    UINT64_C(0xD3646C393A29F297), UINT64_C(0x604A2087398EADF8),
+    UINT64_C(0x5C3099EA6DE60CFF), UINT64_C(0xEF1ED5546E415390),
+    UINT64_C(0xA8B4AFBDC5A6ACA4), UINT64_C(0x1B9AE303C601F3CB),
+    UINT64_C(0x56ED3E2F9E224471), UINT64_C(0xE5C372919D851B1E),
+    UINT64_C(0xA26908783662E42A), UINT64_C(0x114744C635C5BB45),
+    UINT64_C(0x2D3DFDAB61AD1A42), UINT64_C(0x9E13B115620A452D),
+    UINT64_C(0xD9B9CBFCC9EDBA19), UINT64_C(0x6A978742CA4AE576),
+    UINT64_C(0xA14CB926613CF817), UINT64_C(0x1262F598629BA778),
+    UINT64_C(0x55C88F71C97C584C), UINT64_C(0xE6E6C3CFCADB0723),
+    UINT64_C(0xDA9C7AA29EB3A624), UINT64_C(0x69B2361C9D14F94B),
+    UINT64_C(0x2E184CF536F3067F), UINT64_C(0x9D36004B35545910),
+    UINT64_C(0x2B769F17CF112238), UINT64_C(0x9858D3A9CCB67D57),
+    UINT64_C(0xDFF2A94067518263), UINT64_C(0x6CDCE5FE64F6DD0C),
+    UINT64_C(0x50A65C93309E7C0B), UINT64_C(0xE388102D33392364),
+    UINT64_C(0xA4226AC498DEDC50), UINT64_C(0x170C267A9B79833F),
+    UINT64_C(0xDCD7181E300F9E5E), UINT64_C(0x6FF954A033A8C131),
+    UINT64_C(0x28532E49984F3E05), UINT64_C(0x9B7D62F79BE8616A),
+    UINT64_C(0xA707DB9ACF80C06D), UINT64_C(0x14299724CC279F02),
+    UINT64_C(0x5383EDCD67C06036), UINT64_C(0xE0ADA17364673F59)
+  },
+  {
+    UINT64_C(0x0000000000000000), UINT64_C(0x54E979925CD0F10D),
+    UINT64_C(0xA9D2F324B9A1E21A), UINT64_C(0xFD3B8AB6E5711317),
+    UINT64_C(0xC17D4962DC4DDAB1), UINT64_C(0x959430F0809D2BBC),
+    UINT64_C(0x68AFBA4665EC38AB), UINT64_C(0x3C46C3D4393CC9A6),
+    UINT64_C(0x10223DEE1795ABE7), UINT64_C(0x44CB447C4B455AEA),
+    UINT64_C(0xB9F0CECAAE3449FD), UINT64_C(0xED19B758F2E4B8F0),
+    UINT64_C(0xD15F748CCBD87156), UINT64_C(0x85B60D1E9708805B),
+    UINT64_C(0x788D87A87279934C), UINT64_C(0x2C64FE3A2EA96241),
+    UINT64_C(0x20447BDC2F2B57CE), UINT64_C(0x74AD024E73FBA6C3),
+    UINT64_C(0x899688F8968AB5D4), UINT64_C(0xDD7FF16ACA5A44D9),
+    UINT64_C(0xE13932BEF3668D7F), UINT64_C(0xB5D04B2CAFB67C72),
+    UINT64_C(0x48EBC19A4AC76F65), UINT64_C(0x1C02B80816179E68),
+    UINT64_C(0x3066463238BEFC29), UINT64_C(0x648F3FA0646E0D24),
+    UINT64_C(0x99B4B516811F1E33), UINT64_C(0xCD5DCC84DDCFEF3E),
+    UINT64_C(0xF11B0F50E4F32698), UINT64_C(0xA5F276C2B823D795),
+    UINT64_C(0x58C9FC745D52C482), UINT64_C(0x0C2085E60182358F),
+    UINT64_C(0x4088F7B85E56AF9C), UINT64_C(0x14618E2A02865E91),
+    UINT64_C(0xE95A049CE7F74D86), UINT64_C(0xBDB37D0EBB27BC8B),
+    UINT64_C(0x81F5BEDA821B752D), UINT64_C(0xD51CC748DECB8420),
+    UINT64_C(0x28274DFE3BBA9737), UINT64_C(0x7CCE346C676A663A),
+    UINT64_C(0x50AACA5649C3047B), UINT64_C(0x0443B3C41513F576),
+    UINT64_C(0xF9783972F062E661), UINT64_C(0xAD9140E0ACB2176C),
+    UINT64_C(0x91D78334958EDECA), UINT64_C(0xC53EFAA6C95E2FC7),
+    UINT64_C(0x380570102C2F3CD0), UINT64_C(0x6CEC098270FFCDDD),
+    UINT64_C(0x60CC8C64717DF852), UINT64_C(0x3425F5F62DAD095F),
+    UINT64_C(0xC91E7F40C8DC1A48), UINT64_C(0x9DF706D2940CEB45),
+    UINT64_C(0xA1B1C506AD3022E3), UINT64_C(0xF558BC94F1E0D3EE),
+    UINT64_C(0x086336221491C0F9), UINT64_C(0x5C8A4FB0484131F4),
+    UINT64_C(0x70EEB18A66E853B5), UINT64_C(0x2407C8183A38A2B8),
+    UINT64_C(0xD93C42AEDF49B1AF), UINT64_C(0x8DD53B3C839940A2),
+    UINT64_C(0xB193F8E8BAA58904), UINT64_C(0xE57A817AE6757809),
+    UINT64_C(0x18410BCC03046B1E), UINT64_C(0x4CA8725E5FD49A13),
+    UINT64_C(0x8111EF70BCAD5F38), UINT64_C(0xD5F896E2E07DAE35),
+    UINT64_C(0x28C31C54050CBD22), UINT64_C(0x7C2A65C659DC4C2F),
+    UINT64_C(0x406CA61260E08589), UINT64_C(0x1485DF803C307484),
+    UINT64_C(0xE9BE5536D9416793), UINT64_C(0xBD572CA48591969E),
+    UINT64_C(0x9133D29EAB38F4DF), UINT64_C(0xC5DAAB0CF7E805D2),
+    UINT64_C(0x38E121BA129916C5), UINT64_C(0x6C0858284E49E7C8),
+    UINT64_C(0x504E9BFC77752E6E), UINT64_C(0x04A7E26E2BA5DF63),
+    UINT64_C(0xF99C68D8CED4CC74), UINT64_C(0xAD75114A92043D79),
+    UINT64_C(0xA15594AC938608F6), UINT64_C(0xF5BCED3ECF56F9FB),
+    UINT64_C(0x088767882A27EAEC), UINT64_C(0x5C6E1E1A76F71BE1),
+    UINT64_C(0x6028DDCE4FCBD247), UINT64_C(0x34C1A45C131B234A),
+    UINT64_C(0xC9FA2EEAF66A305D), UINT64_C(0x9D135778AABAC150),
+    UINT64_C(0xB177A9428413A311), UINT64_C(0xE59ED0D0D8C3521C),
+    UINT64_C(0x18A55A663DB2410B), UINT64_C(0x4C4C23F46162B006),
+    UINT64_C(0x700AE020585E79A0), UINT64_C(0x24E399B2048E88AD),
+    UINT64_C(0xD9D81304E1FF9BBA), UINT64_C(0x8D316A96BD2F6AB7),
+    UINT64_C(0xC19918C8E2FBF0A4), UINT64_C(0x9570615ABE2B01A9),
+    UINT64_C(0x684BEBEC5B5A12BE), UINT64_C(0x3CA2927E078AE3B3),
+    UINT64_C(0x00E451AA3EB62A15), UINT64_C(0x540D28386266DB18),
+    UINT64_C(0xA936A28E8717C80F), UINT64_C(0xFDDFDB1CDBC73902),
+    UINT64_C(0xD1BB2526F56E5B43), UINT64_C(0x85525CB4A9BEAA4E),
+    UINT64_C(0x7869D6024CCFB959), UINT64_C(0x2C80AF90101F4854),
+    UINT64_C(0x10C66C44292381F2), UINT64_C(0x442F15D675F370FF),
+    UINT64_C(0xB9149F60908263E8), UINT64_C(0xEDFDE6F2CC5292E5),
+    UINT64_C(0xE1DD6314CDD0A76A), UINT64_C(0xB5341A8691005667),
+    UINT64_C(0x480F903074714570), UINT64_C(0x1CE6E9A228A1B47D),
+    UINT64_C(0x20A02A76119D7DDB), UINT64_C(0x744953E44D4D8CD6),
+    UINT64_C(0x8972D952A83C9FC1), UINT64_C(0xDD9BA0C0F4EC6ECC),
+    UINT64_C(0xF1FF5EFADA450C8D), UINT64_C(0xA51627688695FD80),
+    UINT64_C(0x582DADDE63E4EE97), UINT64_C(0x0CC4D44C3F341F9A),
+    UINT64_C(0x308217980608D63C), UINT64_C(0x646B6E0A5AD82731),
+    UINT64_C(0x9950E4BCBFA93426), UINT64_C(0xCDB99D2EE379C52B),
+    UINT64_C(0x90FB71CAD654A0F5), UINT64_C(0xC41208588A8451F8),
+    UINT64_C(0x392982EE6FF542EF), UINT64_C(0x6DC0FB7C3325B3E2),
+    UINT64_C(0x518638A80A197A44), UINT64_C(0x056F413A56C98B49),
+    UINT64_C(0xF854CB8CB3B8985E), UINT64_C(0xACBDB21EEF686953),
+    UINT64_C(0x80D94C24C1C10B12), UINT64_C(0xD43035B69D11FA1F),
+    UINT64_C(0x290BBF007860E908), UINT64_C(0x7DE2C69224B01805),
+    UINT64_C(0x41A405461D8CD1A3), UINT64_C(0x154D7CD4415C20AE),
+    UINT64_C(0xE876F662A42D33B9), UINT64_C(0xBC9F8FF0F8FDC2B4),
+    UINT64_C(0xB0BF0A16F97FF73B), UINT64_C(0xE4567384A5AF0636),
+    UINT64_C(0x196DF93240DE1521), UINT64_C(0x4D8480A01C0EE42C),
+    UINT64_C(0x71C2437425322D8A), UINT64_C(0x252B3AE679E2DC87),
+    UINT64_C(0xD810B0509C93CF90), UINT64_C(0x8CF9C9C2C0433E9D),
+    UINT64_C(0xA09D37F8EEEA5CDC), UINT64_C(0xF4744E6AB23AADD1),
+    UINT64_C(0x094FC4DC574BBEC6), UINT64_C(0x5DA6BD4E0B9B4FCB),
+    UINT64_C(0x61E07E9A32A7866D), UINT64_C(0x350907086E777760),
+    UINT64_C(0xC8328DBE8B066477), UINT64_C(0x9CDBF42CD7D6957A),
+    UINT64_C(0xD073867288020F69), UINT64_C(0x849AFFE0D4D2FE64),
+    UINT64_C(0x79A1755631A3ED73), UINT64_C(0x2D480CC46D731C7E),
+    UINT64_C(0x110ECF10544FD5D8), UINT64_C(0x45E7B682089F24D5),
+    UINT64_C(0xB8DC3C34EDEE37C2), UINT64_C(0xEC3545A6B13EC6CF),
+    UINT64_C(0xC051BB9C9F97A48E), UINT64_C(0x94B8C20EC3475583),
+    UINT64_C(0x698348B826364694), UINT64_C(0x3D6A312A7AE6B799),
+    UINT64_C(0x012CF2FE43DA7E3F), UINT64_C(0x55C58B6C1F0A8F32),
+    UINT64_C(0xA8FE01DAFA7B9C25), UINT64_C(0xFC177848A6AB6D28),
+    UINT64_C(0xF037FDAEA72958A7), UINT64_C(0xA4DE843CFBF9A9AA),
+    UINT64_C(0x59E50E8A1E88BABD), UINT64_C(0x0D0C771842584BB0),
+    UINT64_C(0x314AB4CC7B648216), UINT64_C(0x65A3CD5E27B4731B),
+    UINT64_C(0x989847E8C2C5600C), UINT64_C(0xCC713E7A9E159101),
+    UINT64_C(0xE015C040B0BCF340), UINT64_C(0xB4FCB9D2EC6C024D),
+    UINT64_C(0x49C73364091D115A), UINT64_C(0x1D2E4AF655CDE057),
+    UINT64_C(0x216889226CF129F1), UINT64_C(0x7581F0B03021D8FC),
+    UINT64_C(0x88BA7A06D550CBEB), UINT64_C(0xDC53039489803AE6),
+    UINT64_C(0x11EA9EBA6AF9FFCD), UINT64_C(0x4503E72836290EC0),
+    UINT64_C(0xB8386D9ED3581DD7), UINT64_C(0xECD1140C8F88ECDA),
+    UINT64_C(0xD097D7D8B6B4257C), UINT64_C(0x847EAE4AEA64D471),
+    UINT64_C(0x794524FC0F15C766), UINT64_C(0x2DAC5D6E53C5366B),
+    UINT64_C(0x01C8A3547D6C542A), UINT64_C(0x5521DAC621BCA527),
+    UINT64_C(0xA81A5070C4CDB630), UINT64_C(0xFCF329E2981D473D),
+    UINT64_C(0xC0B5EA36A1218E9B), UINT64_C(0x945C93A4FDF17F96),
+    UINT64_C(0x6967191218806C81), UINT64_C(0x3D8E608044509D8C),
+    UINT64_C(0x31AEE56645D2A803), UINT64_C(0x65479CF41902590E),
+    UINT64_C(0x987C1642FC734A19), UINT64_C(0xCC956FD0A0A3BB14),
+    UINT64_C(0xF0D3AC04999F72B2), UINT64_C(0xA43AD596C54F83BF),
+    UINT64_C(0x59015F20203E90A8), UINT64_C(0x0DE826B27CEE61A5),
+    UINT64_C(0x218CD888524703E4), UINT64_C(0x7565A11A0E97F2E9),
+    UINT64_C(0x885E2BACEBE6E1FE), UINT64_C(0xDCB7523EB73610F3),
+    UINT64_C(0xE0F191EA8E0AD955), UINT64_C(0xB418E878D2DA2858),
+    UINT64_C(0x492362CE37AB3B4F), UINT64_C(0x1DCA1B5C6B7BCA42),
+    UINT64_C(0x5162690234AF5051), UINT64_C(0x058B1090687FA15C),
+    UINT64_C(0xF8B09A268D0EB24B), UINT64_C(0xAC59E3B4D1DE4346),
+    UINT64_C(0x901F2060E8E28AE0), UINT64_C(0xC4F659F2B4327BED),
+    UINT64_C(0x39CDD344514368FA), UINT64_C(0x6D24AAD60D9399F7),
+    UINT64_C(0x414054EC233AFBB6), UINT64_C(0x15A92D7E7FEA0ABB),
+    UINT64_C(0xE892A7C89A9B19AC), UINT64_C(0xBC7BDE5AC64BE8A1),
+    UINT64_C(0x803D1D8EFF772107), UINT64_C(0xD4D4641CA3A7D00A),
+    UINT64_C(0x29EFEEAA46D6C31D), UINT64_C(0x7D0697381A063210),
+    UINT64_C(0x712612DE1B84079F), UINT64_C(0x25CF6B4C4754F692),
+    UINT64_C(0xD8F4E1FAA225E585), UINT64_C(0x8C1D9868FEF51488),
+    UINT64_C(0xB05B5BBCC7C9DD2E), UINT64_C(0xE4B2222E9B192C23),
+    UINT64_C(0x1989A8987E683F34), UINT64_C(0x4D60D10A22B8CE39),
+    UINT64_C(0x61042F300C11AC78), UINT64_C(0x35ED56A250C15D75),
+    UINT64_C(0xC8D6DC14B5B04E62), UINT64_C(0x9C3FA586E960BF6F),
+    UINT64_C(0xA0796652D05C76C9), UINT64_C(0xF4901FC08C8C87C4),
+    UINT64_C(0x09AB957669FD94D3), UINT64_C(0x5D42ECE4352D65DE)
+  },
+  {
+    UINT64_C(0x0000000000000000), UINT64_C(0x3F0BE14A916A6DCB),
+    UINT64_C(0x7E17C29522D4DB96), UINT64_C(0x411C23DFB3BEB65D),
+    UINT64_C(0xFC2F852A45A9B72C), UINT64_C(0xC3246460D4C3DAE7),
+    UINT64_C(0x823847BF677D6CBA), UINT64_C(0xBD33A6F5F6170171),
+    UINT64_C(0x6A87A57F245D70DD), UINT64_C(0x558C4435B5371D16),
+    UINT64_C(0x149067EA0689AB4B), UINT64_C(0x2B9B86A097E3C680),
+    UINT64_C(0x96A8205561F4C7F1), UINT64_C(0xA9A3C11FF09EAA3A),
+    UINT64_C(0xE8BFE2C043201C67), UINT64_C(0xD7B4038AD24A71AC),
+    UINT64_C(0xD50F4AFE48BAE1BA), UINT64_C(0xEA04ABB4D9D08C71),
+    UINT64_C(0xAB18886B6A6E3A2C), UINT64_C(0x94136921FB0457E7),
+    UINT64_C(0x2920CFD40D135696), UINT64_C(0x162B2E9E9C793B5D),
+    UINT64_C(0x57370D412FC78D00), UINT64_C(0x683CEC0BBEADE0CB),
+    UINT64_C(0xBF88EF816CE79167), UINT64_C(0x80830ECBFD8DFCAC),
+    UINT64_C(0xC19F2D144E334AF1), UINT64_C(0xFE94CC5EDF59273A),
+    UINT64_C(0x43A76AAB294E264B), UINT64_C(0x7CAC8BE1B8244B80),
+    UINT64_C(0x3DB0A83E0B9AFDDD), UINT64_C(0x02BB49749AF09016),
+    UINT64_C(0x38C63AD73E7BDDF1), UINT64_C(0x07CDDB9DAF11B03A),
+    UINT64_C(0x46D1F8421CAF0667), UINT64_C(0x79DA19088DC56BAC),
+    UINT64_C(0xC4E9BFFD7BD26ADD), UINT64_C(0xFBE25EB7EAB80716),
+    UINT64_C(0xBAFE7D685906B14B), UINT64_C(0x85F59C22C86CDC80),
+    UINT64_C(0x52419FA81A26AD2C), UINT64_C(0x6D4A7EE28B4CC0E7),
+    UINT64_C(0x2C565D3D38F276BA), UINT64_C(0x135DBC77A9981B71),
+    UINT64_C(0xAE6E1A825F8F1A00), UINT64_C(0x9165FBC8CEE577CB),
+    UINT64_C(0xD079D8177D5BC196), UINT64_C(0xEF72395DEC31AC5D),
+    UINT64_C(0xEDC9702976C13C4B), UINT64_C(0xD2C29163E7AB5180),
+    UINT64_C(0x93DEB2BC5415E7DD), UINT64_C(0xACD553F6C57F8A16),
+    UINT64_C(0x11E6F50333688B67), UINT64_C(0x2EED1449A202E6AC),
+    UINT64_C(0x6FF1379611BC50F1), UINT64_C(0x50FAD6DC80D63D3A),
+    UINT64_C(0x874ED556529C4C96), UINT64_C(0xB845341CC3F6215D),
+    UINT64_C(0xF95917C370489700), UINT64_C(0xC652F689E122FACB),
+    UINT64_C(0x7B61507C1735FBBA), UINT64_C(0x446AB136865F9671),
+    UINT64_C(0x057692E935E1202C), UINT64_C(0x3A7D73A3A48B4DE7),
+    UINT64_C(0x718C75AE7CF7BBE2), UINT64_C(0x4E8794E4ED9DD629),
+    UINT64_C(0x0F9BB73B5E236074), UINT64_C(0x30905671CF490DBF),
+    UINT64_C(0x8DA3F084395E0CCE), UINT64_C(0xB2A811CEA8346105),
+    UINT64_C(0xF3B432111B8AD758), UINT64_C(0xCCBFD35B8AE0BA93),
+    UINT64_C(0x1B0BD0D158AACB3F), UINT64_C(0x2400319BC9C0A6F4),
+    UINT64_C(0x651C12447A7E10A9), UINT64_C(0x5A17F30EEB147D62),
+    UINT64_C(0xE72455FB1D037C13), UINT64_C(0xD82FB4B18C6911D8),
+    UINT64_C(0x9933976E3FD7A785), UINT64_C(0xA6387624AEBDCA4E),
+    UINT64_C(0xA4833F50344D5A58), UINT64_C(0x9B88DE1AA5273793),
+    UINT64_C(0xDA94FDC5169981CE), UINT64_C(0xE59F1C8F87F3EC05),
+    UINT64_C(0x58ACBA7A71E4ED74), UINT64_C(0x67A75B30E08E80BF),
+    UINT64_C(0x26BB78EF533036E2), UINT64_C(0x19B099A5C25A5B29),
+    UINT64_C(0xCE049A2F10102A85), UINT64_C(0xF10F7B65817A474E),
+    UINT64_C(0xB01358BA32C4F113), UINT64_C(0x8F18B9F0A3AE9CD8),
+    UINT64_C(0x322B1F0555B99DA9), UINT64_C(0x0D20FE4FC4D3F062),
+    UINT64_C(0x4C3CDD90776D463F), UINT64_C(0x73373CDAE6072BF4),
+    UINT64_C(0x494A4F79428C6613), UINT64_C(0x7641AE33D3E60BD8),
+    UINT64_C(0x375D8DEC6058BD85), UINT64_C(0x08566CA6F132D04E),
+    UINT64_C(0xB565CA530725D13F), UINT64_C(0x8A6E2B19964FBCF4),
+    UINT64_C(0xCB7208C625F10AA9), UINT64_C(0xF479E98CB49B6762),
+    UINT64_C(0x23CDEA0666D116CE), UINT64_C(0x1CC60B4CF7BB7B05),
+    UINT64_C(0x5DDA28934405CD58), UINT64_C(0x62D1C9D9D56FA093),
+    UINT64_C(0xDFE26F2C2378A1E2), UINT64_C(0xE0E98E66B212CC29),
+    UINT64_C(0xA1F5ADB901AC7A74), UINT64_C(0x9EFE4CF390C617BF),
+    UINT64_C(0x9C4505870A3687A9), UINT64_C(0xA34EE4CD9B5CEA62),
+    UINT64_C(0xE252C71228E25C3F), UINT64_C(0xDD592658B98831F4),
+    UINT64_C(0x606A80AD4F9F3085), UINT64_C(0x5F6161E7DEF55D4E),
+    UINT64_C(0x1E7D42386D4BEB13), UINT64_C(0x2176A372FC2186D8),
+    UINT64_C(0xF6C2A0F82E6BF774), UINT64_C(0xC9C941B2BF019ABF),
+    UINT64_C(0x88D5626D0CBF2CE2), UINT64_C(0xB7DE83279DD54129),
+    UINT64_C(0x0AED25D26BC24058), UINT64_C(0x35E6C498FAA82D93),
+    UINT64_C(0x74FAE74749169BCE), UINT64_C(0x4BF1060DD87CF605),
+    UINT64_C(0xE318EB5CF9EF77C4), UINT64_C(0xDC130A1668851A0F),
+    UINT64_C(0x9D0F29C9DB3BAC52), UINT64_C(0xA204C8834A51C199),
+    UINT64_C(0x1F376E76BC46C0E8), UINT64_C(0x203C8F3C2D2CAD23),
+    UINT64_C(0x6120ACE39E921B7E), UINT64_C(0x5E2B4DA90FF876B5),
+    UINT64_C(0x899F4E23DDB20719), UINT64_C(0xB694AF694CD86AD2),
+    UINT64_C(0xF7888CB6FF66DC8F), UINT64_C(0xC8836DFC6E0CB144),
+    UINT64_C(0x75B0CB09981BB035), UINT64_C(0x4ABB2A430971DDFE),
+    UINT64_C(0x0BA7099CBACF6BA3), UINT64_C(0x34ACE8D62BA50668),
+    UINT64_C(0x3617A1A2B155967E), UINT64_C(0x091C40E8203FFBB5),
+    UINT64_C(0x4800633793814DE8), UINT64_C(0x770B827D02EB2023),
+    UINT64_C(0xCA382488F4FC2152), UINT64_C(0xF533C5C265964C99),
+    UINT64_C(0xB42FE61DD628FAC4), UINT64_C(0x8B2407574742970F),
+    UINT64_C(0x5C9004DD9508E6A3), UINT64_C(0x639BE59704628B68),
+    UINT64_C(0x2287C648B7DC3D35), UINT64_C(0x1D8C270226B650FE),
+    UINT64_C(0xA0BF81F7D0A1518F), UINT64_C(0x9FB460BD41CB3C44),
+    UINT64_C(0xDEA84362F2758A19), UINT64_C(0xE1A3A228631FE7D2),
+    UINT64_C(0xDBDED18BC794AA35), UINT64_C(0xE4D530C156FEC7FE),
+    UINT64_C(0xA5C9131EE54071A3), UINT64_C(0x9AC2F254742A1C68),
+    UINT64_C(0x27F154A1823D1D19), UINT64_C(0x18FAB5EB135770D2),
+    UINT64_C(0x59E69634A0E9C68F), UINT64_C(0x66ED777E3183AB44),
+    UINT64_C(0xB15974F4E3C9DAE8), UINT64_C(0x8E5295BE72A3B723),
+    UINT64_C(0xCF4EB661C11D017E), UINT64_C(0xF045572B50776CB5),
+    UINT64_C(0x4D76F1DEA6606DC4), UINT64_C(0x727D1094370A000F),
+    UINT64_C(0x3361334B84B4B652), UINT64_C(0x0C6AD20115DEDB99),
+    UINT64_C(0x0ED19B758F2E4B8F), UINT64_C(0x31DA7A3F1E442644),
+    UINT64_C(0x70C659E0ADFA9019), UINT64_C(0x4FCDB8AA3C90FDD2),
+    UINT64_C(0xF2FE1E5FCA87FCA3), UINT64_C(0xCDF5FF155BED9168),
+    UINT64_C(0x8CE9DCCAE8532735), UINT64_C(0xB3E23D8079394AFE),
+    UINT64_C(0x64563E0AAB733B52), UINT64_C(0x5B5DDF403A195699),
+    UINT64_C(0x1A41FC9F89A7E0C4), UINT64_C(0x254A1DD518CD8D0F),
+    UINT64_C(0x9879BB20EEDA8C7E), UINT64_C(0xA7725A6A7FB0E1B5),
+    UINT64_C(0xE66E79B5CC0E57E8), UINT64_C(0xD96598FF5D643A23),
+    UINT64_C(0x92949EF28518CC26), UINT64_C(0xAD9F7FB81472A1ED),
+    UINT64_C(0xEC835C67A7CC17B0), UINT64_C(0xD388BD2D36A67A7B),
+    UINT64_C(0x6EBB1BD8C0B17B0A), UINT64_C(0x51B0FA9251DB16C1),
+    UINT64_C(0x10ACD94DE265A09C), UINT64_C(0x2FA73807730FCD57),
+    UINT64_C(0xF8133B8DA145BCFB), UINT64_C(0xC718DAC7302FD130),
+    UINT64_C(0x8604F9188391676D), UINT64_C(0xB90F185212FB0AA6),
+    UINT64_C(0x043CBEA7E4EC0BD7), UINT64_C(0x3B375FED7586661C),
+    UINT64_C(0x7A2B7C32C638D041), UINT64_C(0x45209D785752BD8A),
+    UINT64_C(0x479BD40CCDA22D9C), UINT64_C(0x789035465CC84057),
+    UINT64_C(0x398C1699EF76F60A), UINT64_C(0x0687F7D37E1C9BC1),
+    UINT64_C(0xBBB45126880B9AB0), UINT64_C(0x84BFB06C1961F77B),
+    UINT64_C(0xC5A393B3AADF4126), UINT64_C(0xFAA872F93BB52CED),
+    UINT64_C(0x2D1C7173E9FF5D41), UINT64_C(0x121790397895308A),
+    UINT64_C(0x530BB3E6CB2B86D7), UINT64_C(0x6C0052AC5A41EB1C),
+    UINT64_C(0xD133F459AC56EA6D), UINT64_C(0xEE3815133D3C87A6),
+    UINT64_C(0xAF2436CC8E8231FB), UINT64_C(0x902FD7861FE85C30),
+    UINT64_C(0xAA52A425BB6311D7), UINT64_C(0x9559456F2A097C1C),
+    UINT64_C(0xD44566B099B7CA41), UINT64_C(0xEB4E87FA08DDA78A),
+    UINT64_C(0x567D210FFECAA6FB), UINT64_C(0x6976C0456FA0CB30),
+    UINT64_C(0x286AE39ADC1E7D6D), UINT64_C(0x176102D04D7410A6),
+    UINT64_C(0xC0D5015A9F3E610A), UINT64_C(0xFFDEE0100E540CC1),
+    UINT64_C(0xBEC2C3CFBDEABA9C), UINT64_C(0x81C922852C80D757),
+    UINT64_C(0x3CFA8470DA97D626), UINT64_C(0x03F1653A4BFDBBED),
+    UINT64_C(0x42ED46E5F8430DB0), UINT64_C(0x7DE6A7AF6929607B),
+    UINT64_C(0x7F5DEEDBF3D9F06D), UINT64_C(0x40560F9162B39DA6),
+    UINT64_C(0x014A2C4ED10D2BFB), UINT64_C(0x3E41CD0440674630),
+    UINT64_C(0x83726BF1B6704741), UINT64_C(0xBC798ABB271A2A8A),
+    UINT64_C(0xFD65A96494A49CD7), UINT64_C(0xC26E482E05CEF11C),
+    UINT64_C(0x15DA4BA4D78480B0), UINT64_C(0x2AD1AAEE46EEED7B),
+    UINT64_C(0x6BCD8931F5505B26), UINT64_C(0x54C6687B643A36ED),
+    UINT64_C(0xE9F5CE8E922D379C), UINT64_C(0xD6FE2FC403475A57),
+    UINT64_C(0x97E20C1BB0F9EC0A), UINT64_C(0xA8E9ED51219381C1)
+  },
+  {
+    UINT64_C(0x0000000000000000), UINT64_C(0x1DEE8A5E222CA1DC),
+    UINT64_C(0x3BDD14BC445943B8), UINT64_C(0x26339EE26675E264),
+    UINT64_C(0x77BA297888B28770), UINT64_C(0x6A54A326AA9E26AC),
+    UINT64_C(0x4C673DC4CCEBC4C8), UINT64_C(0x5189B79AEEC76514),
+    UINT64_C(0xEF7452F111650EE0), UINT64_C(0xF29AD8AF3349AF3C),
+    UINT64_C(0xD4A9464D553C4D58), UINT64_C(0xC947CC137710EC84),
+    UINT64_C(0x98CE7B8999D78990), UINT64_C(0x8520F1D7BBFB284C),
+    UINT64_C(0xA3136F35DD8ECA28), UINT64_C(0xBEFDE56BFFA26BF4),
+    UINT64_C(0x4C300AC98DC40345), UINT64_C(0x51DE8097AFE8A299),
+    UINT64_C(0x77ED1E75C99D40FD), UINT64_C(0x6A03942BEBB1E121),
+    UINT64_C(0x3B8A23B105768435), UINT64_C(0x2664A9EF275A25E9),
+    UINT64_C(0x0057370D412FC78D), UINT64_C(0x1DB9BD5363036651),
+    UINT64_C(0xA34458389CA10DA5), UINT64_C(0xBEAAD266BE8DAC79),
+    UINT64_C(0x98994C84D8F84E1D), UINT64_C(0x8577C6DAFAD4EFC1),
+    UINT64_C(0xD4FE714014138AD5), UINT64_C(0xC910FB1E363F2B09),
+    UINT64_C(0xEF2365FC504AC96D), UINT64_C(0xF2CDEFA2726668B1),
+    UINT64_C(0x986015931B88068A), UINT64_C(0x858E9FCD39A4A756),
+    UINT64_C(0xA3BD012F5FD14532), UINT64_C(0xBE538B717DFDE4EE),
+    UINT64_C(0xEFDA3CEB933A81FA), UINT64_C(0xF234B6B5B1162026),
+    UINT64_C(0xD4072857D763C242), UINT64_C(0xC9E9A209F54F639E),
+    UINT64_C(0x771447620AED086A), UINT64_C(0x6AFACD3C28C1A9B6),
+    UINT64_C(0x4CC953DE4EB44BD2), UINT64_C(0x5127D9806C98EA0E),
+    UINT64_C(0x00AE6E1A825F8F1A), UINT64_C(0x1D40E444A0732EC6),
+    UINT64_C(0x3B737AA6C606CCA2), UINT64_C(0x269DF0F8E42A6D7E),
+    UINT64_C(0xD4501F5A964C05CF), UINT64_C(0xC9BE9504B460A413),
+    UINT64_C(0xEF8D0BE6D2154677), UINT64_C(0xF26381B8F039E7AB),
+    UINT64_C(0xA3EA36221EFE82BF), UINT64_C(0xBE04BC7C3CD22363),
+    UINT64_C(0x9837229E5AA7C107), UINT64_C(0x85D9A8C0788B60DB),
+    UINT64_C(0x3B244DAB87290B2F), UINT64_C(0x26CAC7F5A505AAF3),
+    UINT64_C(0x00F95917C3704897), UINT64_C(0x1D17D349E15CE94B),
+    UINT64_C(0x4C9E64D30F9B8C5F), UINT64_C(0x5170EE8D2DB72D83),
+    UINT64_C(0x7743706F4BC2CFE7), UINT64_C(0x6AADFA3169EE6E3B),
+    UINT64_C(0xA218840D981E1391), UINT64_C(0xBFF60E53BA32B24D),
+    UINT64_C(0x99C590B1DC475029), UINT64_C(0x842B1AEFFE6BF1F5),
+    UINT64_C(0xD5A2AD7510AC94E1), UINT64_C(0xC84C272B3280353D),
+    UINT64_C(0xEE7FB9C954F5D759), UINT64_C(0xF391339776D97685),
+    UINT64_C(0x4D6CD6FC897B1D71), UINT64_C(0x50825CA2AB57BCAD),
+    UINT64_C(0x76B1C240CD225EC9), UINT64_C(0x6B5F481EEF0EFF15),
+    UINT64_C(0x3AD6FF8401C99A01), UINT64_C(0x273875DA23E53BDD),
+    UINT64_C(0x010BEB384590D9B9), UINT64_C(0x1CE5616667BC7865),
+    UINT64_C(0xEE288EC415DA10D4), UINT64_C(0xF3C6049A37F6B108),
+    UINT64_C(0xD5F59A785183536C), UINT64_C(0xC81B102673AFF2B0),
+    UINT64_C(0x9992A7BC9D6897A4), UINT64_C(0x847C2DE2BF443678),
+    UINT64_C(0xA24FB300D931D41C), UINT64_C(0xBFA1395EFB1D75C0),
+    UINT64_C(0x015CDC3504BF1E34), UINT64_C(0x1CB2566B2693BFE8),
+    UINT64_C(0x3A81C88940E65D8C), UINT64_C(0x276F42D762CAFC50),
+    UINT64_C(0x76E6F54D8C0D9944), UINT64_C(0x6B087F13AE213898),
+    UINT64_C(0x4D3BE1F1C854DAFC), UINT64_C(0x50D56BAFEA787B20),
+    UINT64_C(0x3A78919E8396151B), UINT64_C(0x27961BC0A1BAB4C7),
+    UINT64_C(0x01A58522C7CF56A3), UINT64_C(0x1C4B0F7CE5E3F77F),
+    UINT64_C(0x4DC2B8E60B24926B), UINT64_C(0x502C32B8290833B7),
+    UINT64_C(0x761FAC5A4F7DD1D3), UINT64_C(0x6BF126046D51700F),
+    UINT64_C(0xD50CC36F92F31BFB), UINT64_C(0xC8E24931B0DFBA27),
+    UINT64_C(0xEED1D7D3D6AA5843), UINT64_C(0xF33F5D8DF486F99F),
+    UINT64_C(0xA2B6EA171A419C8B), UINT64_C(0xBF586049386D3D57),
+    UINT64_C(0x996BFEAB5E18DF33), UINT64_C(0x848574F57C347EEF),
+    UINT64_C(0x76489B570E52165E), UINT64_C(0x6BA611092C7EB782),
+    UINT64_C(0x4D958FEB4A0B55E6), UINT64_C(0x507B05B56827F43A),
+    UINT64_C(0x01F2B22F86E0912E), UINT64_C(0x1C1C3871A4CC30F2),
+    UINT64_C(0x3A2FA693C2B9D296), UINT64_C(0x27C12CCDE095734A),
+    UINT64_C(0x993CC9A61F3718BE), UINT64_C(0x84D243F83D1BB962),
+    UINT64_C(0xA2E1DD1A5B6E5B06), UINT64_C(0xBF0F57447942FADA),
+    UINT64_C(0xEE86E0DE97859FCE), UINT64_C(0xF3686A80B5A93E12),
+    UINT64_C(0xD55BF462D3DCDC76), UINT64_C(0xC8B57E3CF1F07DAA),
+    UINT64_C(0xD6E9A7309F3239A7), UINT64_C(0xCB072D6EBD1E987B),
+    UINT64_C(0xED34B38CDB6B7A1F), UINT64_C(0xF0DA39D2F947DBC3),
+    UINT64_C(0xA1538E481780BED7), UINT64_C(0xBCBD041635AC1F0B),
+    UINT64_C(0x9A8E9AF453D9FD6F), UINT64_C(0x876010AA71F55CB3),
+    UINT64_C(0x399DF5C18E573747), UINT64_C(0x24737F9FAC7B969B),
+    UINT64_C(0x0240E17DCA0E74FF), UINT64_C(0x1FAE6B23E822D523),
+    UINT64_C(0x4E27DCB906E5B037), UINT64_C(0x53C956E724C911EB),
+    UINT64_C(0x75FAC80542BCF38F), UINT64_C(0x6814425B60905253),
+    UINT64_C(0x9AD9ADF912F63AE2), UINT64_C(0x873727A730DA9B3E),
+    UINT64_C(0xA104B94556AF795A), UINT64_C(0xBCEA331B7483D886),
+    UINT64_C(0xED6384819A44BD92), UINT64_C(0xF08D0EDFB8681C4E),
+    UINT64_C(0xD6BE903DDE1DFE2A), UINT64_C(0xCB501A63FC315FF6),
+    UINT64_C(0x75ADFF0803933402), UINT64_C(0x6843755621BF95DE),
+    UINT64_C(0x4E70EBB447CA77BA), UINT64_C(0x539E61EA65E6D666),
+    UINT64_C(0x0217D6708B21B372), UINT64_C(0x1FF95C2EA90D12AE),
+    UINT64_C(0x39CAC2CCCF78F0CA), UINT64_C(0x24244892ED545116),
+    UINT64_C(0x4E89B2A384BA3F2D), UINT64_C(0x536738FDA6969EF1),
+    UINT64_C(0x7554A61FC0E37C95), UINT64_C(0x68BA2C41E2CFDD49),
+    UINT64_C(0x39339BDB0C08B85D), UINT64_C(0x24DD11852E241981),
+    UINT64_C(0x02EE8F674851FBE5), UINT64_C(0x1F0005396A7D5A39),
+    UINT64_C(0xA1FDE05295DF31CD), UINT64_C(0xBC136A0CB7F39011),
+    UINT64_C(0x9A20F4EED1867275), UINT64_C(0x87CE7EB0F3AAD3A9),
+    UINT64_C(0xD647C92A1D6DB6BD), UINT64_C(0xCBA943743F411761),
+    UINT64_C(0xED9ADD965934F505), UINT64_C(0xF07457C87B1854D9),
+    UINT64_C(0x02B9B86A097E3C68), UINT64_C(0x1F5732342B529DB4),
+    UINT64_C(0x3964ACD64D277FD0), UINT64_C(0x248A26886F0BDE0C),
+    UINT64_C(0x7503911281CCBB18), UINT64_C(0x68ED1B4CA3E01AC4),
+    UINT64_C(0x4EDE85AEC595F8A0), UINT64_C(0x53300FF0E7B9597C),
+    UINT64_C(0xEDCDEA9B181B3288), UINT64_C(0xF02360C53A379354),
+    UINT64_C(0xD610FE275C427130), UINT64_C(0xCBFE74797E6ED0EC),
+    UINT64_C(0x9A77C3E390A9B5F8), UINT64_C(0x879949BDB2851424),
+    UINT64_C(0xA1AAD75FD4F0F640), UINT64_C(0xBC445D01F6DC579C),
+    UINT64_C(0x74F1233D072C2A36), UINT64_C(0x691FA96325008BEA),
+    UINT64_C(0x4F2C37814375698E), UINT64_C(0x52C2BDDF6159C852),
+    UINT64_C(0x034B0A458F9EAD46), UINT64_C(0x1EA5801BADB20C9A),
+    UINT64_C(0x38961EF9CBC7EEFE), UINT64_C(0x257894A7E9EB4F22),
+    UINT64_C(0x9B8571CC164924D6), UINT64_C(0x866BFB923465850A),
+    UINT64_C(0xA05865705210676E), UINT64_C(0xBDB6EF2E703CC6B2),
+    UINT64_C(0xEC3F58B49EFBA3A6), UINT64_C(0xF1D1D2EABCD7027A),
+    UINT64_C(0xD7E24C08DAA2E01E), UINT64_C(0xCA0CC656F88E41C2),
+    UINT64_C(0x38C129F48AE82973), UINT64_C(0x252FA3AAA8C488AF),
+    UINT64_C(0x031C3D48CEB16ACB), UINT64_C(0x1EF2B716EC9DCB17),
+    UINT64_C(0x4F7B008C025AAE03), UINT64_C(0x52958AD220760FDF),
+    UINT64_C(0x74A614304603EDBB), UINT64_C(0x69489E6E642F4C67),
+    UINT64_C(0xD7B57B059B8D2793), UINT64_C(0xCA5BF15BB9A1864F),
+    UINT64_C(0xEC686FB9DFD4642B), UINT64_C(0xF186E5E7FDF8C5F7),
+    UINT64_C(0xA00F527D133FA0E3), UINT64_C(0xBDE1D8233113013F),
+    UINT64_C(0x9BD246C15766E35B), UINT64_C(0x863CCC9F754A4287),
+    UINT64_C(0xEC9136AE1CA42CBC), UINT64_C(0xF17FBCF03E888D60),
+    UINT64_C(0xD74C221258FD6F04), UINT64_C(0xCAA2A84C7AD1CED8),
+    UINT64_C(0x9B2B1FD69416ABCC), UINT64_C(0x86C59588B63A0A10),
+    UINT64_C(0xA0F60B6AD04FE874), UINT64_C(0xBD188134F26349A8),
+    UINT64_C(0x03E5645F0DC1225C), UINT64_C(0x1E0BEE012FED8380),
+    UINT64_C(0x383870E3499861E4), UINT64_C(0x25D6FABD6BB4C038),
+    UINT64_C(0x745F4D278573A52C), UINT64_C(0x69B1C779A75F04F0),
+    UINT64_C(0x4F82599BC12AE694), UINT64_C(0x526CD3C5E3064748),
+    UINT64_C(0xA0A13C6791602FF9), UINT64_C(0xBD4FB639B34C8E25),
+    UINT64_C(0x9B7C28DBD5396C41), UINT64_C(0x8692A285F715CD9D),
+    UINT64_C(0xD71B151F19D2A889), UINT64_C(0xCAF59F413BFE0955),
+    UINT64_C(0xECC601A35D8BEB31), UINT64_C(0xF1288BFD7FA74AED),
+    UINT64_C(0x4FD56E9680052119), UINT64_C(0x523BE4C8A22980C5),
+    UINT64_C(0x74087A2AC45C62A1), UINT64_C(0x69E6F074E670C37D),
+    UINT64_C(0x386F47EE08B7A669), UINT64_C(0x2581CDB02A9B07B5),
+    UINT64_C(0x03B253524CEEE5D1), UINT64_C(0x1E5CD90C6EC2440D)
+  },
+  {
+    UINT64_C(0x0000000000000000), UINT64_C(0x5C2D776033C4205E),
+    UINT64_C(0xB85AEEC0678840BC), UINT64_C(0xE47799A0544C60E2),
+    UINT64_C(0xE26D72AB601E9FFD), UINT64_C(0xBE4005CB53DABFA3),
+    UINT64_C(0x5A379C6B0796DF41), UINT64_C(0x061AEB0B3452FF1F),
+    UINT64_C(0x56024A7D6F33217F), UINT64_C(0x0A2F3D1D5CF70121),
+    UINT64_C(0xEE58A4BD08BB61C3), UINT64_C(0xB275D3DD3B7F419D),
+    UINT64_C(0xB46F38D60F2DBE82), UINT64_C(0xE8424FB63CE99EDC),
+    UINT64_C(0x0C35D61668A5FE3E), UINT64_C(0x5018A1765B61DE60),
+    UINT64_C(0xAC0494FADE6642FE), UINT64_C(0xF029E39AEDA262A0),
+    UINT64_C(0x145E7A3AB9EE0242), UINT64_C(0x48730D5A8A2A221C),
+    UINT64_C(0x4E69E651BE78DD03), UINT64_C(0x124491318DBCFD5D),
+    UINT64_C(0xF6330891D9F09DBF), UINT64_C(0xAA1E7FF1EA34BDE1),
+    UINT64_C(0xFA06DE87B1556381), UINT64_C(0xA62BA9E7829143DF),
+    UINT64_C(0x425C3047D6DD233D), UINT64_C(0x1E714727E5190363),
+    UINT64_C(0x186BAC2CD14BFC7C), UINT64_C(0x4446DB4CE28FDC22),
+    UINT64_C(0xA03142ECB6C3BCC0), UINT64_C(0xFC1C358C85079C9E),
+    UINT64_C(0xCAD186DE13C29B79), UINT64_C(0x96FCF1BE2006BB27),
+    UINT64_C(0x728B681E744ADBC5), UINT64_C(0x2EA61F7E478EFB9B),
+    UINT64_C(0x28BCF47573DC0484), UINT64_C(0x74918315401824DA),
+    UINT64_C(0x90E61AB514544438), UINT64_C(0xCCCB6DD527906466),
+    UINT64_C(0x9CD3CCA37CF1BA06), UINT64_C(0xC0FEBBC34F359A58),
+    UINT64_C(0x248922631B79FABA), UINT64_C(0x78A4550328BDDAE4),
+    UINT64_C(0x7EBEBE081CEF25FB), UINT64_C(0x2293C9682F2B05A5),
+    UINT64_C(0xC6E450C87B676547), UINT64_C(0x9AC927A848A34519),
+    UINT64_C(0x66D51224CDA4D987), UINT64_C(0x3AF86544FE60F9D9),
+    UINT64_C(0xDE8FFCE4AA2C993B), UINT64_C(0x82A28B8499E8B965),
+    UINT64_C(0x84B8608FADBA467A), UINT64_C(0xD89517EF9E7E6624),
+    UINT64_C(0x3CE28E4FCA3206C6), UINT64_C(0x60CFF92FF9F62698),
+    UINT64_C(0x30D75859A297F8F8), UINT64_C(0x6CFA2F399153D8A6),
+    UINT64_C(0x888DB699C51FB844), UINT64_C(0xD4A0C1F9F6DB981A),
+    UINT64_C(0xD2BA2AF2C2896705), UINT64_C(0x8E975D92F14D475B),
+    UINT64_C(0x6AE0C432A50127B9), UINT64_C(0x36CDB35296C507E7),
+    UINT64_C(0x077BA297888B2877), UINT64_C(0x5B56D5F7BB4F0829),
+    UINT64_C(0xBF214C57EF0368CB), UINT64_C(0xE30C3B37DCC74895),
+    UINT64_C(0xE516D03CE895B78A), UINT64_C(0xB93BA75CDB5197D4),
+    UINT64_C(0x5D4C3EFC8F1DF736), UINT64_C(0x0161499CBCD9D768),
+    UINT64_C(0x5179E8EAE7B80908), UINT64_C(0x0D549F8AD47C2956),
+    UINT64_C(0xE923062A803049B4), UINT64_C(0xB50E714AB3F469EA),
+    UINT64_C(0xB3149A4187A696F5), UINT64_C(0xEF39ED21B462B6AB),
+    UINT64_C(0x0B4E7481E02ED649), UINT64_C(0x576303E1D3EAF617),
+    UINT64_C(0xAB7F366D56ED6A89), UINT64_C(0xF752410D65294AD7),
+    UINT64_C(0x1325D8AD31652A35), UINT64_C(0x4F08AFCD02A10A6B),
+    UINT64_C(0x491244C636F3F574), UINT64_C(0x153F33A60537D52A),
+    UINT64_C(0xF148AA06517BB5C8), UINT64_C(0xAD65DD6662BF9596),
+    UINT64_C(0xFD7D7C1039DE4BF6), UINT64_C(0xA1500B700A1A6BA8),
+    UINT64_C(0x452792D05E560B4A), UINT64_C(0x190AE5B06D922B14),
+    UINT64_C(0x1F100EBB59C0D40B), UINT64_C(0x433D79DB6A04F455),
+    UINT64_C(0xA74AE07B3E4894B7), UINT64_C(0xFB67971B0D8CB4E9),
+    UINT64_C(0xCDAA24499B49B30E), UINT64_C(0x91875329A88D9350),
+    UINT64_C(0x75F0CA89FCC1F3B2), UINT64_C(0x29DDBDE9CF05D3EC),
+    UINT64_C(0x2FC756E2FB572CF3), UINT64_C(0x73EA2182C8930CAD),
+    UINT64_C(0x979DB8229CDF6C4F), UINT64_C(0xCBB0CF42AF1B4C11),
+    UINT64_C(0x9BA86E34F47A9271), UINT64_C(0xC7851954C7BEB22F),
+    UINT64_C(0x23F280F493F2D2CD), UINT64_C(0x7FDFF794A036F293),
+    UINT64_C(0x79C51C9F94640D8C), UINT64_C(0x25E86BFFA7A02DD2),
+    UINT64_C(0xC19FF25FF3EC4D30), UINT64_C(0x9DB2853FC0286D6E),
+    UINT64_C(0x61AEB0B3452FF1F0), UINT64_C(0x3D83C7D376EBD1AE),
+    UINT64_C(0xD9F45E7322A7B14C), UINT64_C(0x85D9291311639112),
+    UINT64_C(0x83C3C21825316E0D), UINT64_C(0xDFEEB57816F54E53),
+    UINT64_C(0x3B992CD842B92EB1), UINT64_C(0x67B45BB8717D0EEF),
+    UINT64_C(0x37ACFACE2A1CD08F), UINT64_C(0x6B818DAE19D8F0D1),
+    UINT64_C(0x8FF6140E4D949033), UINT64_C(0xD3DB636E7E50B06D),
+    UINT64_C(0xD5C188654A024F72), UINT64_C(0x89ECFF0579C66F2C),
+    UINT64_C(0x6D9B66A52D8A0FCE), UINT64_C(0x31B611C51E4E2F90),
+    UINT64_C(0x0EF7452F111650EE), UINT64_C(0x52DA324F22D270B0),
+    UINT64_C(0xB6ADABEF769E1052), UINT64_C(0xEA80DC8F455A300C),
+    UINT64_C(0xEC9A37847108CF13), UINT64_C(0xB0B740E442CCEF4D),
+    UINT64_C(0x54C0D94416808FAF), UINT64_C(0x08EDAE242544AFF1),
+    UINT64_C(0x58F50F527E257191), UINT64_C(0x04D878324DE151CF),
+    UINT64_C(0xE0AFE19219AD312D), UINT64_C(0xBC8296F22A691173),
+    UINT64_C(0xBA987DF91E3BEE6C), UINT64_C(0xE6B50A992DFFCE32),
+    UINT64_C(0x02C2933979B3AED0), UINT64_C(0x5EEFE4594A778E8E),
+    UINT64_C(0xA2F3D1D5CF701210), UINT64_C(0xFEDEA6B5FCB4324E),
+    UINT64_C(0x1AA93F15A8F852AC), UINT64_C(0x468448759B3C72F2),
+    UINT64_C(0x409EA37EAF6E8DED), UINT64_C(0x1CB3D41E9CAAADB3),
+    UINT64_C(0xF8C44DBEC8E6CD51), UINT64_C(0xA4E93ADEFB22ED0F),
+    UINT64_C(0xF4F19BA8A043336F), UINT64_C(0xA8DCECC893871331),
+    UINT64_C(0x4CAB7568C7CB73D3), UINT64_C(0x10860208F40F538D),
+    UINT64_C(0x169CE903C05DAC92), UINT64_C(0x4AB19E63F3998CCC),
+    UINT64_C(0xAEC607C3A7D5EC2E), UINT64_C(0xF2EB70A39411CC70),
+    UINT64_C(0xC426C3F102D4CB97), UINT64_C(0x980BB4913110EBC9),
+    UINT64_C(0x7C7C2D31655C8B2B), UINT64_C(0x20515A515698AB75),
+    UINT64_C(0x264BB15A62CA546A), UINT64_C(0x7A66C63A510E7434),
+    UINT64_C(0x9E115F9A054214D6), UINT64_C(0xC23C28FA36863488),
+    UINT64_C(0x9224898C6DE7EAE8), UINT64_C(0xCE09FEEC5E23CAB6),
+    UINT64_C(0x2A7E674C0A6FAA54), UINT64_C(0x7653102C39AB8A0A),
+    UINT64_C(0x7049FB270DF97515), UINT64_C(0x2C648C473E3D554B),
+    UINT64_C(0xC81315E76A7135A9), UINT64_C(0x943E628759B515F7),
+    UINT64_C(0x6822570BDCB28969), UINT64_C(0x340F206BEF76A937),
+    UINT64_C(0xD078B9CBBB3AC9D5), UINT64_C(0x8C55CEAB88FEE98B),
+    UINT64_C(0x8A4F25A0BCAC1694), UINT64_C(0xD66252C08F6836CA),
+    UINT64_C(0x3215CB60DB245628), UINT64_C(0x6E38BC00E8E07676),
+    UINT64_C(0x3E201D76B381A816), UINT64_C(0x620D6A1680458848),
+    UINT64_C(0x867AF3B6D409E8AA), UINT64_C(0xDA5784D6E7CDC8F4),
+    UINT64_C(0xDC4D6FDDD39F37EB), UINT64_C(0x806018BDE05B17B5),
+    UINT64_C(0x6417811DB4177757), UINT64_C(0x383AF67D87D35709),
+    UINT64_C(0x098CE7B8999D7899), UINT64_C(0x55A190D8AA5958C7),
+    UINT64_C(0xB1D60978FE153825), UINT64_C(0xEDFB7E18CDD1187B),
+    UINT64_C(0xEBE19513F983E764), UINT64_C(0xB7CCE273CA47C73A),
+    UINT64_C(0x53BB7BD39E0BA7D8), UINT64_C(0x0F960CB3ADCF8786),
+    UINT64_C(0x5F8EADC5F6AE59E6), UINT64_C(0x03A3DAA5C56A79B8),
+    UINT64_C(0xE7D443059126195A), UINT64_C(0xBBF93465A2E23904),
+    UINT64_C(0xBDE3DF6E96B0C61B), UINT64_C(0xE1CEA80EA574E645),
+    UINT64_C(0x05B931AEF13886A7), UINT64_C(0x599446CEC2FCA6F9),
+    UINT64_C(0xA588734247FB3A67), UINT64_C(0xF9A50422743F1A39),
+    UINT64_C(0x1DD29D8220737ADB), UINT64_C(0x41FFEAE213B75A85),
+    UINT64_C(0x47E501E927E5A59A), UINT64_C(0x1BC87689142185C4),
+    UINT64_C(0xFFBFEF29406DE526), UINT64_C(0xA392984973A9C578),
+    UINT64_C(0xF38A393F28C81B18), UINT64_C(0xAFA74E5F1B0C3B46),
+    UINT64_C(0x4BD0D7FF4F405BA4), UINT64_C(0x17FDA09F7C847BFA),
+    UINT64_C(0x11E74B9448D684E5), UINT64_C(0x4DCA3CF47B12A4BB),
+    UINT64_C(0xA9BDA5542F5EC459), UINT64_C(0xF590D2341C9AE407),
+    UINT64_C(0xC35D61668A5FE3E0), UINT64_C(0x9F701606B99BC3BE),
+    UINT64_C(0x7B078FA6EDD7A35C), UINT64_C(0x272AF8C6DE138302),
+    UINT64_C(0x213013CDEA417C1D), UINT64_C(0x7D1D64ADD9855C43),
+    UINT64_C(0x996AFD0D8DC93CA1), UINT64_C(0xC5478A6DBE0D1CFF),
+    UINT64_C(0x955F2B1BE56CC29F), UINT64_C(0xC9725C7BD6A8E2C1),
+    UINT64_C(0x2D05C5DB82E48223), UINT64_C(0x7128B2BBB120A27D),
+    UINT64_C(0x773259B085725D62), UINT64_C(0x2B1F2ED0B6B67D3C),
+    UINT64_C(0xCF68B770E2FA1DDE), UINT64_C(0x9345C010D13E3D80),
+    UINT64_C(0x6F59F59C5439A11E), UINT64_C(0x337482FC67FD8140),
+    UINT64_C(0xD7031B5C33B1E1A2), UINT64_C(0x8B2E6C3C0075C1FC),
+    UINT64_C(0x8D34873734273EE3), UINT64_C(0xD119F05707E31EBD),
+    UINT64_C(0x356E69F753AF7E5F), UINT64_C(0x69431E97606B5E01),
+    UINT64_C(0x395BBFE13B0A8061), UINT64_C(0x6576C88108CEA03F),
+    UINT64_C(0x810151215C82C0DD), UINT64_C(0xDD2C26416F46E083),
+    UINT64_C(0xDB36CD4A5B141F9C), UINT64_C(0x871BBA2A68D03FC2),
+    UINT64_C(0x636C238A3C9C5F20), UINT64_C(0x3F4154EA0F587F7E)
+  },
+  {
+    UINT64_C(0x0000000000000000), UINT64_C(0x6184D55F721267C6),
+    UINT64_C(0xC309AABEE424CF8C), UINT64_C(0xA28D7FE19636A84A),
+    UINT64_C(0x14CBFA566747819D), UINT64_C(0x754F2F091555E65B),
+    UINT64_C(0xD7C250E883634E11), UINT64_C(0xB64685B7F17129D7),
+    UINT64_C(0x2997F4ACCE8F033A), UINT64_C(0x481321F3BC9D64FC),
+    UINT64_C(0xEA9E5E122AABCCB6), UINT64_C(0x8B1A8B4D58B9AB70),
+    UINT64_C(0x3D5C0EFAA9C882A7), UINT64_C(0x5CD8DBA5DBDAE561),
+    UINT64_C(0xFE55A4444DEC4D2B), UINT64_C(0x9FD1711B3FFE2AED),
+    UINT64_C(0x532FE9599D1E0674), UINT64_C(0x32AB3C06EF0C61B2),
+    UINT64_C(0x902643E7793AC9F8), UINT64_C(0xF1A296B80B28AE3E),
+    UINT64_C(0x47E4130FFA5987E9), UINT64_C(0x2660C650884BE02F),
+    UINT64_C(0x84EDB9B11E7D4865), UINT64_C(0xE5696CEE6C6F2FA3),
+    UINT64_C(0x7AB81DF55391054E), UINT64_C(0x1B3CC8AA21836288),
+    UINT64_C(0xB9B1B74BB7B5CAC2), UINT64_C(0xD8356214C5A7AD04),
+    UINT64_C(0x6E73E7A334D684D3), UINT64_C(0x0FF732FC46C4E315),
+    UINT64_C(0xAD7A4D1DD0F24B5F), UINT64_C(0xCCFE9842A2E02C99),
+    UINT64_C(0xA65FD2B33A3C0CE8), UINT64_C(0xC7DB07EC482E6B2E),
+    UINT64_C(0x6556780DDE18C364), UINT64_C(0x04D2AD52AC0AA4A2),
+    UINT64_C(0xB29428E55D7B8D75), UINT64_C(0xD310FDBA2F69EAB3),
+    UINT64_C(0x719D825BB95F42F9), UINT64_C(0x10195704CB4D253F),
+    UINT64_C(0x8FC8261FF4B30FD2), UINT64_C(0xEE4CF34086A16814),
+    UINT64_C(0x4CC18CA11097C05E), UINT64_C(0x2D4559FE6285A798),
+    UINT64_C(0x9B03DC4993F48E4F), UINT64_C(0xFA870916E1E6E989),
+    UINT64_C(0x580A76F777D041C3), UINT64_C(0x398EA3A805C22605),
+    UINT64_C(0xF5703BEAA7220A9C), UINT64_C(0x94F4EEB5D5306D5A),
+    UINT64_C(0x367991544306C510), UINT64_C(0x57FD440B3114A2D6),
+    UINT64_C(0xE1BBC1BCC0658B01), UINT64_C(0x803F14E3B277ECC7),
+    UINT64_C(0x22B26B022441448D), UINT64_C(0x4336BE5D5653234B),
+    UINT64_C(0xDCE7CF4669AD09A6), UINT64_C(0xBD631A191BBF6E60),
+    UINT64_C(0x1FEE65F88D89C62A), UINT64_C(0x7E6AB0A7FF9BA1EC),
+    UINT64_C(0xC82C35100EEA883B), UINT64_C(0xA9A8E04F7CF8EFFD),
+    UINT64_C(0x0B259FAEEACE47B7), UINT64_C(0x6AA14AF198DC2071),
+    UINT64_C(0xDE670A4DDB760755), UINT64_C(0xBFE3DF12A9646093),
+    UINT64_C(0x1D6EA0F33F52C8D9), UINT64_C(0x7CEA75AC4D40AF1F),
+    UINT64_C(0xCAACF01BBC3186C8), UINT64_C(0xAB282544CE23E10E),
+    UINT64_C(0x09A55AA558154944), UINT64_C(0x68218FFA2A072E82),
+    UINT64_C(0xF7F0FEE115F9046F), UINT64_C(0x96742BBE67EB63A9),
+    UINT64_C(0x34F9545FF1DDCBE3), UINT64_C(0x557D810083CFAC25),
+    UINT64_C(0xE33B04B772BE85F2), UINT64_C(0x82BFD1E800ACE234),
+    UINT64_C(0x2032AE09969A4A7E), UINT64_C(0x41B67B56E4882DB8),
+    UINT64_C(0x8D48E31446680121), UINT64_C(0xECCC364B347A66E7),
+    UINT64_C(0x4E4149AAA24CCEAD), UINT64_C(0x2FC59CF5D05EA96B),
+    UINT64_C(0x99831942212F80BC), UINT64_C(0xF807CC1D533DE77A),
+    UINT64_C(0x5A8AB3FCC50B4F30), UINT64_C(0x3B0E66A3B71928F6),
+    UINT64_C(0xA4DF17B888E7021B), UINT64_C(0xC55BC2E7FAF565DD),
+    UINT64_C(0x67D6BD066CC3CD97), UINT64_C(0x065268591ED1AA51),
+    UINT64_C(0xB014EDEEEFA08386), UINT64_C(0xD19038B19DB2E440),
+    UINT64_C(0x731D47500B844C0A), UINT64_C(0x1299920F79962BCC),
+    UINT64_C(0x7838D8FEE14A0BBD), UINT64_C(0x19BC0DA193586C7B),
+    UINT64_C(0xBB317240056EC431), UINT64_C(0xDAB5A71F777CA3F7),
+    UINT64_C(0x6CF322A8860D8A20), UINT64_C(0x0D77F7F7F41FEDE6),
+    UINT64_C(0xAFFA8816622945AC), UINT64_C(0xCE7E5D49103B226A),
+    UINT64_C(0x51AF2C522FC50887), UINT64_C(0x302BF90D5DD76F41),
+    UINT64_C(0x92A686ECCBE1C70B), UINT64_C(0xF32253B3B9F3A0CD),
+    UINT64_C(0x4564D6044882891A), UINT64_C(0x24E0035B3A90EEDC),
+    UINT64_C(0x866D7CBAACA64696), UINT64_C(0xE7E9A9E5DEB42150),
+    UINT64_C(0x2B1731A77C540DC9), UINT64_C(0x4A93E4F80E466A0F),
+    UINT64_C(0xE81E9B199870C245), UINT64_C(0x899A4E46EA62A583),
+    UINT64_C(0x3FDCCBF11B138C54), UINT64_C(0x5E581EAE6901EB92),
+    UINT64_C(0xFCD5614FFF3743D8), UINT64_C(0x9D51B4108D25241E),
+    UINT64_C(0x0280C50BB2DB0EF3), UINT64_C(0x63041054C0C96935),
+    UINT64_C(0xC1896FB556FFC17F), UINT64_C(0xA00DBAEA24EDA6B9),
+    UINT64_C(0x164B3F5DD59C8F6E), UINT64_C(0x77CFEA02A78EE8A8),
+    UINT64_C(0xD54295E331B840E2), UINT64_C(0xB4C640BC43AA2724),
+    UINT64_C(0x2E16BBB019E2102F), UINT64_C(0x4F926EEF6BF077E9),
+    UINT64_C(0xED1F110EFDC6DFA3), UINT64_C(0x8C9BC4518FD4B865),
+    UINT64_C(0x3ADD41E67EA591B2), UINT64_C(0x5B5994B90CB7F674),
+    UINT64_C(0xF9D4EB589A815E3E), UINT64_C(0x98503E07E89339F8),
+    UINT64_C(0x07814F1CD76D1315), UINT64_C(0x66059A43A57F74D3),
+    UINT64_C(0xC488E5A23349DC99), UINT64_C(0xA50C30FD415BBB5F),
+    UINT64_C(0x134AB54AB02A9288), UINT64_C(0x72CE6015C238F54E),
+    UINT64_C(0xD0431FF4540E5D04), UINT64_C(0xB1C7CAAB261C3AC2),
+    UINT64_C(0x7D3952E984FC165B), UINT64_C(0x1CBD87B6F6EE719D),
+    UINT64_C(0xBE30F85760D8D9D7), UINT64_C(0xDFB42D0812CABE11),
+    UINT64_C(0x69F2A8BFE3BB97C6), UINT64_C(0x08767DE091A9F000),
+    UINT64_C(0xAAFB0201079F584A), UINT64_C(0xCB7FD75E758D3F8C),
+    UINT64_C(0x54AEA6454A731561), UINT64_C(0x352A731A386172A7),
+    UINT64_C(0x97A70CFBAE57DAED), UINT64_C(0xF623D9A4DC45BD2B),
+    UINT64_C(0x40655C132D3494FC), UINT64_C(0x21E1894C5F26F33A),
+    UINT64_C(0x836CF6ADC9105B70), UINT64_C(0xE2E823F2BB023CB6),
+    UINT64_C(0x8849690323DE1CC7), UINT64_C(0xE9CDBC5C51CC7B01),
+    UINT64_C(0x4B40C3BDC7FAD34B), UINT64_C(0x2AC416E2B5E8B48D),
+    UINT64_C(0x9C82935544999D5A), UINT64_C(0xFD06460A368BFA9C),
+    UINT64_C(0x5F8B39EBA0BD52D6), UINT64_C(0x3E0FECB4D2AF3510),
+    UINT64_C(0xA1DE9DAFED511FFD), UINT64_C(0xC05A48F09F43783B),
+    UINT64_C(0x62D737110975D071), UINT64_C(0x0353E24E7B67B7B7),
+    UINT64_C(0xB51567F98A169E60), UINT64_C(0xD491B2A6F804F9A6),
+    UINT64_C(0x761CCD476E3251EC), UINT64_C(0x179818181C20362A),
+    UINT64_C(0xDB66805ABEC01AB3), UINT64_C(0xBAE25505CCD27D75),
+    UINT64_C(0x186F2AE45AE4D53F), UINT64_C(0x79EBFFBB28F6B2F9),
+    UINT64_C(0xCFAD7A0CD9879B2E), UINT64_C(0xAE29AF53AB95FCE8),
+    UINT64_C(0x0CA4D0B23DA354A2), UINT64_C(0x6D2005ED4FB13364),
+    UINT64_C(0xF2F174F6704F1989), UINT64_C(0x9375A1A9025D7E4F),
+    UINT64_C(0x31F8DE48946BD605), UINT64_C(0x507C0B17E679B1C3),
+    UINT64_C(0xE63A8EA017089814), UINT64_C(0x87BE5BFF651AFFD2),
+    UINT64_C(0x2533241EF32C5798), UINT64_C(0x44B7F141813E305E),
+    UINT64_C(0xF071B1FDC294177A), UINT64_C(0x91F564A2B08670BC),
+    UINT64_C(0x33781B4326B0D8F6), UINT64_C(0x52FCCE1C54A2BF30),
+    UINT64_C(0xE4BA4BABA5D396E7), UINT64_C(0x853E9EF4D7C1F121),
+    UINT64_C(0x27B3E11541F7596B), UINT64_C(0x4637344A33E53EAD),
+    UINT64_C(0xD9E645510C1B1440), UINT64_C(0xB862900E7E097386),
+    UINT64_C(0x1AEFEFEFE83FDBCC), UINT64_C(0x7B6B3AB09A2DBC0A),
+    UINT64_C(0xCD2DBF076B5C95DD), UINT64_C(0xACA96A58194EF21B),
+    UINT64_C(0x0E2415B98F785A51), UINT64_C(0x6FA0C0E6FD6A3D97),
+    UINT64_C(0xA35E58A45F8A110E), UINT64_C(0xC2DA8DFB2D9876C8),
+    UINT64_C(0x6057F21ABBAEDE82), UINT64_C(0x01D32745C9BCB944),
+    UINT64_C(0xB795A2F238CD9093), UINT64_C(0xD61177AD4ADFF755),
+    UINT64_C(0x749C084CDCE95F1F), UINT64_C(0x1518DD13AEFB38D9),
+    UINT64_C(0x8AC9AC0891051234), UINT64_C(0xEB4D7957E31775F2),
+    UINT64_C(0x49C006B67521DDB8), UINT64_C(0x2844D3E90733BA7E),
+    UINT64_C(0x9E02565EF64293A9), UINT64_C(0xFF8683018450F46F),
+    UINT64_C(0x5D0BFCE012665C25), UINT64_C(0x3C8F29BF60743BE3),
+    UINT64_C(0x562E634EF8A81B92), UINT64_C(0x37AAB6118ABA7C54),
+    UINT64_C(0x9527C9F01C8CD41E), UINT64_C(0xF4A31CAF6E9EB3D8),
+    UINT64_C(0x42E599189FEF9A0F), UINT64_C(0x23614C47EDFDFDC9),
+    UINT64_C(0x81EC33A67BCB5583), UINT64_C(0xE068E6F909D93245),
+    UINT64_C(0x7FB997E2362718A8), UINT64_C(0x1E3D42BD44357F6E),
+    UINT64_C(0xBCB03D5CD203D724), UINT64_C(0xDD34E803A011B0E2),
+    UINT64_C(0x6B726DB451609935), UINT64_C(0x0AF6B8EB2372FEF3),
+    UINT64_C(0xA87BC70AB54456B9), UINT64_C(0xC9FF1255C756317F),
+    UINT64_C(0x05018A1765B61DE6), UINT64_C(0x64855F4817A47A20),
+    UINT64_C(0xC60820A98192D26A), UINT64_C(0xA78CF5F6F380B5AC),
+    UINT64_C(0x11CA704102F19C7B), UINT64_C(0x704EA51E70E3FBBD),
+    UINT64_C(0xD2C3DAFFE6D553F7), UINT64_C(0xB3470FA094C73431),
+    UINT64_C(0x2C967EBBAB391EDC), UINT64_C(0x4D12ABE4D92B791A),
+    UINT64_C(0xEF9FD4054F1DD150), UINT64_C(0x8E1B015A3D0FB696),
+    UINT64_C(0x385D84EDCC7E9F41), UINT64_C(0x59D951B2BE6CF887),
+    UINT64_C(0xFB542E53285A50CD), UINT64_C(0x9AD0FB0C5A48370B)
+  },
+  {
+    UINT64_C(0x0000000000000000), UINT64_C(0x22EF0D5934F964EC),
+    UINT64_C(0x45DE1AB269F2C9D8), UINT64_C(0x673117EB5D0BAD34),
+    UINT64_C(0x8BBC3564D3E593B0), UINT64_C(0xA953383DE71CF75C),
+    UINT64_C(0xCE622FD6BA175A68), UINT64_C(0xEC8D228F8EEE3E84),
+    UINT64_C(0x85A0C5E208C539E5), UINT64_C(0xA74FC8BB3C3C5D09),
+    UINT64_C(0xC07EDF506137F03D), UINT64_C(0xE291D20955CE94D1),
+    UINT64_C(0x0E1CF086DB20AA55), UINT64_C(0x2CF3FDDFEFD9CEB9),
+    UINT64_C(0x4BC2EA34B2D2638D), UINT64_C(0x692DE76D862B0761),
+    UINT64_C(0x999924EFBE846D4F), UINT64_C(0xBB7629B68A7D09A3),
+    UINT64_C(0xDC473E5DD776A497), UINT64_C(0xFEA83304E38FC07B),
+    UINT64_C(0x1225118B6D61FEFF), UINT64_C(0x30CA1CD259989A13),
+    UINT64_C(0x57FB0B3904933727), UINT64_C(0x75140660306A53CB),
+    UINT64_C(0x1C39E10DB64154AA), UINT64_C(0x3ED6EC5482B83046),
+    UINT64_C(0x59E7FBBFDFB39D72), UINT64_C(0x7B08F6E6EB4AF99E),
+    UINT64_C(0x9785D46965A4C71A), UINT64_C(0xB56AD930515DA3F6),
+    UINT64_C(0xD25BCEDB0C560EC2), UINT64_C(0xF0B4C38238AF6A2E),
+    UINT64_C(0xA1EAE6F4D206C41B), UINT64_C(0x8305EBADE6FFA0F7),
+    UINT64_C(0xE434FC46BBF40DC3), UINT64_C(0xC6DBF11F8F0D692F),
+    UINT64_C(0x2A56D39001E357AB), UINT64_C(0x08B9DEC9351A3347),
+    UINT64_C(0x6F88C92268119E73), UINT64_C(0x4D67C47B5CE8FA9F),
+    UINT64_C(0x244A2316DAC3FDFE), UINT64_C(0x06A52E4FEE3A9912),
+    UINT64_C(0x619439A4B3313426), UINT64_C(0x437B34FD87C850CA),
+    UINT64_C(0xAFF6167209266E4E), UINT64_C(0x8D191B2B3DDF0AA2),
+    UINT64_C(0xEA280CC060D4A796), UINT64_C(0xC8C70199542DC37A),
+    UINT64_C(0x3873C21B6C82A954), UINT64_C(0x1A9CCF42587BCDB8),
+    UINT64_C(0x7DADD8A90570608C), UINT64_C(0x5F42D5F031890460),
+    UINT64_C(0xB3CFF77FBF673AE4), UINT64_C(0x9120FA268B9E5E08),
+    UINT64_C(0xF611EDCDD695F33C), UINT64_C(0xD4FEE094E26C97D0),
+    UINT64_C(0xBDD307F9644790B1), UINT64_C(0x9F3C0AA050BEF45D),
+    UINT64_C(0xF80D1D4B0DB55969), UINT64_C(0xDAE21012394C3D85),
+    UINT64_C(0x366F329DB7A20301), UINT64_C(0x14803FC4835B67ED),
+    UINT64_C(0x73B1282FDE50CAD9), UINT64_C(0x515E2576EAA9AE35),
+    UINT64_C(0xD10D62C20B0396B3), UINT64_C(0xF3E26F9B3FFAF25F),
+    UINT64_C(0x94D3787062F15F6B), UINT64_C(0xB63C752956083B87),
+    UINT64_C(0x5AB157A6D8E60503), UINT64_C(0x785E5AFFEC1F61EF),
+    UINT64_C(0x1F6F4D14B114CCDB), UINT64_C(0x3D80404D85EDA837),
+    UINT64_C(0x54ADA72003C6AF56), UINT64_C(0x7642AA79373FCBBA),
+    UINT64_C(0x1173BD926A34668E), UINT64_C(0x339CB0CB5ECD0262),
+    UINT64_C(0xDF119244D0233CE6), UINT64_C(0xFDFE9F1DE4DA580A),
+    UINT64_C(0x9ACF88F6B9D1F53E), UINT64_C(0xB82085AF8D2891D2),
+    UINT64_C(0x4894462DB587FBFC), UINT64_C(0x6A7B4B74817E9F10),
+    UINT64_C(0x0D4A5C9FDC753224), UINT64_C(0x2FA551C6E88C56C8),
+    UINT64_C(0xC32873496662684C), UINT64_C(0xE1C77E10529B0CA0),
+    UINT64_C(0x86F669FB0F90A194), UINT64_C(0xA41964A23B69C578),
+    UINT64_C(0xCD3483CFBD42C219), UINT64_C(0xEFDB8E9689BBA6F5),
+    UINT64_C(0x88EA997DD4B00BC1), UINT64_C(0xAA059424E0496F2D),
+    UINT64_C(0x4688B6AB6EA751A9), UINT64_C(0x6467BBF25A5E3545),
+    UINT64_C(0x0356AC1907559871), UINT64_C(0x21B9A14033ACFC9D),
+    UINT64_C(0x70E78436D90552A8), UINT64_C(0x5208896FEDFC3644),
+    UINT64_C(0x35399E84B0F79B70), UINT64_C(0x17D693DD840EFF9C),
+    UINT64_C(0xFB5BB1520AE0C118), UINT64_C(0xD9B4BC0B3E19A5F4),
+    UINT64_C(0xBE85ABE0631208C0), UINT64_C(0x9C6AA6B957EB6C2C),
+    UINT64_C(0xF54741D4D1C06B4D), UINT64_C(0xD7A84C8DE5390FA1),
+    UINT64_C(0xB0995B66B832A295), UINT64_C(0x9276563F8CCBC679),
+    UINT64_C(0x7EFB74B00225F8FD), UINT64_C(0x5C1479E936DC9C11),
+    UINT64_C(0x3B256E026BD73125), UINT64_C(0x19CA635B5F2E55C9),
+    UINT64_C(0xE97EA0D967813FE7), UINT64_C(0xCB91AD8053785B0B),
+    UINT64_C(0xACA0BA6B0E73F63F), UINT64_C(0x8E4FB7323A8A92D3),
+    UINT64_C(0x62C295BDB464AC57), UINT64_C(0x402D98E4809DC8BB),
+    UINT64_C(0x271C8F0FDD96658F), UINT64_C(0x05F38256E96F0163),
+    UINT64_C(0x6CDE653B6F440602), UINT64_C(0x4E3168625BBD62EE),
+    UINT64_C(0x29007F8906B6CFDA), UINT64_C(0x0BEF72D0324FAB36),
+    UINT64_C(0xE762505FBCA195B2), UINT64_C(0xC58D5D068858F15E),
+    UINT64_C(0xA2BC4AEDD5535C6A), UINT64_C(0x805347B4E1AA3886),
+    UINT64_C(0x30C26AAFB90933E3), UINT64_C(0x122D67F68DF0570F),
+    UINT64_C(0x751C701DD0FBFA3B), UINT64_C(0x57F37D44E4029ED7),
+    UINT64_C(0xBB7E5FCB6AECA053), UINT64_C(0x999152925E15C4BF),
+    UINT64_C(0xFEA04579031E698B), UINT64_C(0xDC4F482037E70D67),
+    UINT64_C(0xB562AF4DB1CC0A06), UINT64_C(0x978DA21485356EEA),
+    UINT64_C(0xF0BCB5FFD83EC3DE), UINT64_C(0xD253B8A6ECC7A732),
+    UINT64_C(0x3EDE9A29622999B6), UINT64_C(0x1C31977056D0FD5A),
+    UINT64_C(0x7B00809B0BDB506E), UINT64_C(0x59EF8DC23F223482),
+    UINT64_C(0xA95B4E40078D5EAC), UINT64_C(0x8BB4431933743A40),
+    UINT64_C(0xEC8554F26E7F9774), UINT64_C(0xCE6A59AB5A86F398),
+    UINT64_C(0x22E77B24D468CD1C), UINT64_C(0x0008767DE091A9F0),
+    UINT64_C(0x67396196BD9A04C4), UINT64_C(0x45D66CCF89636028),
+    UINT64_C(0x2CFB8BA20F486749), UINT64_C(0x0E1486FB3BB103A5),
+    UINT64_C(0x6925911066BAAE91), UINT64_C(0x4BCA9C495243CA7D),
+    UINT64_C(0xA747BEC6DCADF4F9), UINT64_C(0x85A8B39FE8549015),
+    UINT64_C(0xE299A474B55F3D21), UINT64_C(0xC076A92D81A659CD),
+    UINT64_C(0x91288C5B6B0FF7F8), UINT64_C(0xB3C781025FF69314),
+    UINT64_C(0xD4F696E902FD3E20), UINT64_C(0xF6199BB036045ACC),
+    UINT64_C(0x1A94B93FB8EA6448), UINT64_C(0x387BB4668C1300A4),
+    UINT64_C(0x5F4AA38DD118AD90), UINT64_C(0x7DA5AED4E5E1C97C),
+    UINT64_C(0x148849B963CACE1D), UINT64_C(0x366744E05733AAF1),
+    UINT64_C(0x5156530B0A3807C5), UINT64_C(0x73B95E523EC16329),
+    UINT64_C(0x9F347CDDB02F5DAD), UINT64_C(0xBDDB718484D63941),
+    UINT64_C(0xDAEA666FD9DD9475), UINT64_C(0xF8056B36ED24F099),
+    UINT64_C(0x08B1A8B4D58B9AB7), UINT64_C(0x2A5EA5EDE172FE5B),
+    UINT64_C(0x4D6FB206BC79536F), UINT64_C(0x6F80BF5F88803783),
+    UINT64_C(0x830D9DD0066E0907), UINT64_C(0xA1E2908932976DEB),
+    UINT64_C(0xC6D387626F9CC0DF), UINT64_C(0xE43C8A3B5B65A433),
+    UINT64_C(0x8D116D56DD4EA352), UINT64_C(0xAFFE600FE9B7C7BE),
+    UINT64_C(0xC8CF77E4B4BC6A8A), UINT64_C(0xEA207ABD80450E66),
+    UINT64_C(0x06AD58320EAB30E2), UINT64_C(0x2442556B3A52540E),
+    UINT64_C(0x437342806759F93A), UINT64_C(0x619C4FD953A09DD6),
+    UINT64_C(0xE1CF086DB20AA550), UINT64_C(0xC320053486F3C1BC),
+    UINT64_C(0xA41112DFDBF86C88), UINT64_C(0x86FE1F86EF010864),
+    UINT64_C(0x6A733D0961EF36E0), UINT64_C(0x489C30505516520C),
+    UINT64_C(0x2FAD27BB081DFF38), UINT64_C(0x0D422AE23CE49BD4),
+    UINT64_C(0x646FCD8FBACF9CB5), UINT64_C(0x4680C0D68E36F859),
+    UINT64_C(0x21B1D73DD33D556D), UINT64_C(0x035EDA64E7C43181),
+    UINT64_C(0xEFD3F8EB692A0F05), UINT64_C(0xCD3CF5B25DD36BE9),
+    UINT64_C(0xAA0DE25900D8C6DD), UINT64_C(0x88E2EF003421A231),
+    UINT64_C(0x78562C820C8EC81F), UINT64_C(0x5AB921DB3877ACF3),
+    UINT64_C(0x3D883630657C01C7), UINT64_C(0x1F673B695185652B),
+    UINT64_C(0xF3EA19E6DF6B5BAF), UINT64_C(0xD10514BFEB923F43),
+    UINT64_C(0xB6340354B6999277), UINT64_C(0x94DB0E0D8260F69B),
+    UINT64_C(0xFDF6E960044BF1FA), UINT64_C(0xDF19E43930B29516),
+    UINT64_C(0xB828F3D26DB93822), UINT64_C(0x9AC7FE8B59405CCE),
+    UINT64_C(0x764ADC04D7AE624A), UINT64_C(0x54A5D15DE35706A6),
+    UINT64_C(0x3394C6B6BE5CAB92), UINT64_C(0x117BCBEF8AA5CF7E),
+    UINT64_C(0x4025EE99600C614B), UINT64_C(0x62CAE3C054F505A7),
+    UINT64_C(0x05FBF42B09FEA893), UINT64_C(0x2714F9723D07CC7F),
+    UINT64_C(0xCB99DBFDB3E9F2FB), UINT64_C(0xE976D6A487109617),
+    UINT64_C(0x8E47C14FDA1B3B23), UINT64_C(0xACA8CC16EEE25FCF),
+    UINT64_C(0xC5852B7B68C958AE), UINT64_C(0xE76A26225C303C42),
+    UINT64_C(0x805B31C9013B9176), UINT64_C(0xA2B43C9035C2F59A),
+    UINT64_C(0x4E391E1FBB2CCB1E), UINT64_C(0x6CD613468FD5AFF2),
+    UINT64_C(0x0BE704ADD2DE02C6), UINT64_C(0x290809F4E627662A),
+    UINT64_C(0xD9BCCA76DE880C04), UINT64_C(0xFB53C72FEA7168E8),
+    UINT64_C(0x9C62D0C4B77AC5DC), UINT64_C(0xBE8DDD9D8383A130),
+    UINT64_C(0x5200FF120D6D9FB4), UINT64_C(0x70EFF24B3994FB58),
+    UINT64_C(0x17DEE5A0649F566C), UINT64_C(0x3531E8F950663280),
+    UINT64_C(0x5C1C0F94D64D35E1), UINT64_C(0x7EF302CDE2B4510D),
+    UINT64_C(0x19C21526BFBFFC39), UINT64_C(0x3B2D187F8B4698D5),
+    UINT64_C(0xD7A03AF005A8A651), UINT64_C(0xF54F37A93151C2BD),
+    UINT64_C(0x927E20426C5A6F89), UINT64_C(0xB0912D1B58A30B65)
+  },
+  {
+    UINT64_C(0x0000000000000000), UINT64_C(0xDABE95AFC7875F40),
+    UINT64_C(0x27A584742000A005), UINT64_C(0xFD1B11DBE787FF45),
+    UINT64_C(0x4F4B08E84001400A), UINT64_C(0x95F59D4787861F4A),
+    UINT64_C(0x68EE8C9C6001E00F), UINT64_C(0xB2501933A786BF4F),
+    UINT64_C(0x9E9611D080028014), UINT64_C(0x4428847F4785DF54),
+    UINT64_C(0xB93395A4A0022011), UINT64_C(0x638D000B67857F51),
+    UINT64_C(0xD1DD1938C003C01E), UINT64_C(0x0B638C9707849F5E),
+    UINT64_C(0xF6789D4CE003601B), UINT64_C(0x2CC608E327843F5B),
+    UINT64_C(0xAFF48C8AAF0B1EAD), UINT64_C(0x754A1925688C41ED),
+    UINT64_C(0x885108FE8F0BBEA8), UINT64_C(0x52EF9D51488CE1E8),
+    UINT64_C(0xE0BF8462EF0A5EA7), UINT64_C(0x3A0111CD288D01E7),
+    UINT64_C(0xC71A0016CF0AFEA2), UINT64_C(0x1DA495B9088DA1E2),
+    UINT64_C(0x31629D5A2F099EB9), UINT64_C(0xEBDC08F5E88EC1F9),
+    UINT64_C(0x16C7192E0F093EBC), UINT64_C(0xCC798C81C88E61FC),
+    UINT64_C(0x7E2995B26F08DEB3), UINT64_C(0xA497001DA88F81F3),
+    UINT64_C(0x598C11C64F087EB6), UINT64_C(0x83328469888F21F6),
+    UINT64_C(0xCD31B63EF11823DF), UINT64_C(0x178F2391369F7C9F),
+    UINT64_C(0xEA94324AD11883DA), UINT64_C(0x302AA7E5169FDC9A),
+    UINT64_C(0x827ABED6B11963D5), UINT64_C(0x58C42B79769E3C95),
+    UINT64_C(0xA5DF3AA29119C3D0), UINT64_C(0x7F61AF0D569E9C90),
+    UINT64_C(0x53A7A7EE711AA3CB), UINT64_C(0x89193241B69DFC8B),
+    UINT64_C(0x7402239A511A03CE), UINT64_C(0xAEBCB635969D5C8E),
+    UINT64_C(0x1CECAF06311BE3C1), UINT64_C(0xC6523AA9F69CBC81),
+    UINT64_C(0x3B492B72111B43C4), UINT64_C(0xE1F7BEDDD69C1C84),
+    UINT64_C(0x62C53AB45E133D72), UINT64_C(0xB87BAF1B99946232),
+    UINT64_C(0x4560BEC07E139D77), UINT64_C(0x9FDE2B6FB994C237),
+    UINT64_C(0x2D8E325C1E127D78), UINT64_C(0xF730A7F3D9952238),
+    UINT64_C(0x0A2BB6283E12DD7D), UINT64_C(0xD0952387F995823D),
+    UINT64_C(0xFC532B64DE11BD66), UINT64_C(0x26EDBECB1996E226),
+    UINT64_C(0xDBF6AF10FE111D63), UINT64_C(0x01483ABF39964223),
+    UINT64_C(0xB318238C9E10FD6C), UINT64_C(0x69A6B6235997A22C),
+    UINT64_C(0x94BDA7F8BE105D69), UINT64_C(0x4E03325779970229),
+    UINT64_C(0x08BBC3564D3E593B), UINT64_C(0xD20556F98AB9067B),
+    UINT64_C(0x2F1E47226D3EF93E), UINT64_C(0xF5A0D28DAAB9A67E),
+    UINT64_C(0x47F0CBBE0D3F1931), UINT64_C(0x9D4E5E11CAB84671),
+    UINT64_C(0x60554FCA2D3FB934), UINT64_C(0xBAEBDA65EAB8E674),
+    UINT64_C(0x962DD286CD3CD92F), UINT64_C(0x4C9347290ABB866F),
+    UINT64_C(0xB18856F2ED3C792A), UINT64_C(0x6B36C35D2ABB266A),
+    UINT64_C(0xD966DA6E8D3D9925), UINT64_C(0x03D84FC14ABAC665),
+    UINT64_C(0xFEC35E1AAD3D3920), UINT64_C(0x247DCBB56ABA6660),
+    UINT64_C(0xA74F4FDCE2354796), UINT64_C(0x7DF1DA7325B218D6),
+    UINT64_C(0x80EACBA8C235E793), UINT64_C(0x5A545E0705B2B8D3),
+    UINT64_C(0xE8044734A234079C), UINT64_C(0x32BAD29B65B358DC),
+    UINT64_C(0xCFA1C3408234A799), UINT64_C(0x151F56EF45B3F8D9),
+    UINT64_C(0x39D95E0C6237C782), UINT64_C(0xE367CBA3A5B098C2),
+    UINT64_C(0x1E7CDA7842376787), UINT64_C(0xC4C24FD785B038C7),
+    UINT64_C(0x769256E422368788), UINT64_C(0xAC2CC34BE5B1D8C8),
+    UINT64_C(0x5137D2900236278D), UINT64_C(0x8B89473FC5B178CD),
+    UINT64_C(0xC58A7568BC267AE4), UINT64_C(0x1F34E0C77BA125A4),
+    UINT64_C(0xE22FF11C9C26DAE1), UINT64_C(0x389164B35BA185A1),
+    UINT64_C(0x8AC17D80FC273AEE), UINT64_C(0x507FE82F3BA065AE),
+    UINT64_C(0xAD64F9F4DC279AEB), UINT64_C(0x77DA6C5B1BA0C5AB),
+    UINT64_C(0x5B1C64B83C24FAF0), UINT64_C(0x81A2F117FBA3A5B0),
+    UINT64_C(0x7CB9E0CC1C245AF5), UINT64_C(0xA6077563DBA305B5),
+    UINT64_C(0x14576C507C25BAFA), UINT64_C(0xCEE9F9FFBBA2E5BA),
+    UINT64_C(0x33F2E8245C251AFF), UINT64_C(0xE94C7D8B9BA245BF),
+    UINT64_C(0x6A7EF9E2132D6449), UINT64_C(0xB0C06C4DD4AA3B09),
+    UINT64_C(0x4DDB7D96332DC44C), UINT64_C(0x9765E839F4AA9B0C),
+    UINT64_C(0x2535F10A532C2443), UINT64_C(0xFF8B64A594AB7B03),
+    UINT64_C(0x0290757E732C8446), UINT64_C(0xD82EE0D1B4ABDB06),
+    UINT64_C(0xF4E8E832932FE45D), UINT64_C(0x2E567D9D54A8BB1D),
+    UINT64_C(0xD34D6C46B32F4458), UINT64_C(0x09F3F9E974A81B18),
+    UINT64_C(0xBBA3E0DAD32EA457), UINT64_C(0x611D757514A9FB17),
+    UINT64_C(0x9C0664AEF32E0452), UINT64_C(0x46B8F10134A95B12),
+    UINT64_C(0x117786AC9A7CB276), UINT64_C(0xCBC913035DFBED36),
+    UINT64_C(0x36D202D8BA7C1273), UINT64_C(0xEC6C97777DFB4D33),
+    UINT64_C(0x5E3C8E44DA7DF27C), UINT64_C(0x84821BEB1DFAAD3C),
+    UINT64_C(0x79990A30FA7D5279), UINT64_C(0xA3279F9F3DFA0D39),
+    UINT64_C(0x8FE1977C1A7E3262), UINT64_C(0x555F02D3DDF96D22),
+    UINT64_C(0xA84413083A7E9267), UINT64_C(0x72FA86A7FDF9CD27),
+    UINT64_C(0xC0AA9F945A7F7268), UINT64_C(0x1A140A3B9DF82D28),
+    UINT64_C(0xE70F1BE07A7FD26D), UINT64_C(0x3DB18E4FBDF88D2D),
+    UINT64_C(0xBE830A263577ACDB), UINT64_C(0x643D9F89F2F0F39B),
+    UINT64_C(0x99268E5215770CDE), UINT64_C(0x43981BFDD2F0539E),
+    UINT64_C(0xF1C802CE7576ECD1), UINT64_C(0x2B769761B2F1B391),
+    UINT64_C(0xD66D86BA55764CD4), UINT64_C(0x0CD3131592F11394),
+    UINT64_C(0x20151BF6B5752CCF), UINT64_C(0xFAAB8E5972F2738F),
+    UINT64_C(0x07B09F8295758CCA), UINT64_C(0xDD0E0A2D52F2D38A),
+    UINT64_C(0x6F5E131EF5746CC5), UINT64_C(0xB5E086B132F33385),
+    UINT64_C(0x48FB976AD574CCC0), UINT64_C(0x924502C512F39380),
+    UINT64_C(0xDC4630926B6491A9), UINT64_C(0x06F8A53DACE3CEE9),
+    UINT64_C(0xFBE3B4E64B6431AC), UINT64_C(0x215D21498CE36EEC),
+    UINT64_C(0x930D387A2B65D1A3), UINT64_C(0x49B3ADD5ECE28EE3),
+    UINT64_C(0xB4A8BC0E0B6571A6), UINT64_C(0x6E1629A1CCE22EE6),
+    UINT64_C(0x42D02142EB6611BD), UINT64_C(0x986EB4ED2CE14EFD),
+    UINT64_C(0x6575A536CB66B1B8), UINT64_C(0xBFCB30990CE1EEF8),
+    UINT64_C(0x0D9B29AAAB6751B7), UINT64_C(0xD725BC056CE00EF7),
+    UINT64_C(0x2A3EADDE8B67F1B2), UINT64_C(0xF08038714CE0AEF2),
+    UINT64_C(0x73B2BC18C46F8F04), UINT64_C(0xA90C29B703E8D044),
+    UINT64_C(0x5417386CE46F2F01), UINT64_C(0x8EA9ADC323E87041),
+    UINT64_C(0x3CF9B4F0846ECF0E), UINT64_C(0xE647215F43E9904E),
+    UINT64_C(0x1B5C3084A46E6F0B), UINT64_C(0xC1E2A52B63E9304B),
+    UINT64_C(0xED24ADC8446D0F10), UINT64_C(0x379A386783EA5050),
+    UINT64_C(0xCA8129BC646DAF15), UINT64_C(0x103FBC13A3EAF055),
+    UINT64_C(0xA26FA520046C4F1A), UINT64_C(0x78D1308FC3EB105A),
+    UINT64_C(0x85CA2154246CEF1F), UINT64_C(0x5F74B4FBE3EBB05F),
+    UINT64_C(0x19CC45FAD742EB4D), UINT64_C(0xC372D05510C5B40D),
+    UINT64_C(0x3E69C18EF7424B48), UINT64_C(0xE4D7542130C51408),
+    UINT64_C(0x56874D129743AB47), UINT64_C(0x8C39D8BD50C4F407),
+    UINT64_C(0x7122C966B7430B42), UINT64_C(0xAB9C5CC970C45402),
+    UINT64_C(0x875A542A57406B59), UINT64_C(0x5DE4C18590C73419),
+    UINT64_C(0xA0FFD05E7740CB5C), UINT64_C(0x7A4145F1B0C7941C),
+    UINT64_C(0xC8115CC217412B53), UINT64_C(0x12AFC96DD0C67413),
+    UINT64_C(0xEFB4D8B637418B56), UINT64_C(0x350A4D19F0C6D416),
+    UINT64_C(0xB638C9707849F5E0), UINT64_C(0x6C865CDFBFCEAAA0),
+    UINT64_C(0x919D4D04584955E5), UINT64_C(0x4B23D8AB9FCE0AA5),
+    UINT64_C(0xF973C1983848B5EA), UINT64_C(0x23CD5437FFCFEAAA),
+    UINT64_C(0xDED645EC184815EF), UINT64_C(0x0468D043DFCF4AAF),
+    UINT64_C(0x28AED8A0F84B75F4), UINT64_C(0xF2104D0F3FCC2AB4),
+    UINT64_C(0x0F0B5CD4D84BD5F1), UINT64_C(0xD5B5C97B1FCC8AB1),
+    UINT64_C(0x67E5D048B84A35FE), UINT64_C(0xBD5B45E77FCD6ABE),
+    UINT64_C(0x4040543C984A95FB), UINT64_C(0x9AFEC1935FCDCABB),
+    UINT64_C(0xD4FDF3C4265AC892), UINT64_C(0x0E43666BE1DD97D2),
+    UINT64_C(0xF35877B0065A6897), UINT64_C(0x29E6E21FC1DD37D7),
+    UINT64_C(0x9BB6FB2C665B8898), UINT64_C(0x41086E83A1DCD7D8),
+    UINT64_C(0xBC137F58465B289D), UINT64_C(0x66ADEAF781DC77DD),
+    UINT64_C(0x4A6BE214A6584886), UINT64_C(0x90D577BB61DF17C6),
+    UINT64_C(0x6DCE66608658E883), UINT64_C(0xB770F3CF41DFB7C3),
+    UINT64_C(0x0520EAFCE659088C), UINT64_C(0xDF9E7F5321DE57CC),
+    UINT64_C(0x22856E88C659A889), UINT64_C(0xF83BFB2701DEF7C9),
+    UINT64_C(0x7B097F4E8951D63F), UINT64_C(0xA1B7EAE14ED6897F),
+    UINT64_C(0x5CACFB3AA951763A), UINT64_C(0x86126E956ED6297A),
+    UINT64_C(0x344277A6C9509635), UINT64_C(0xEEFCE2090ED7C975),
+    UINT64_C(0x13E7F3D2E9503630), UINT64_C(0xC959667D2ED76970),
+    UINT64_C(0xE59F6E9E0953562B), UINT64_C(0x3F21FB31CED4096B),
+    UINT64_C(0xC23AEAEA2953F62E), UINT64_C(0x18847F45EED4A96E),
+    UINT64_C(0xAAD4667649521621), UINT64_C(0x706AF3D98ED54961),
+    UINT64_C(0x8D71E2026952B624), UINT64_C(0x57CF77ADAED5E964)
+  }
+};
+
+static inline uint64_t _CRC64_Do_update( uint64_t crc, uint8_t byte )
+{
+  return ( crc >> 8 ) ^ _CRC64_Table[ 0 ][ ( crc ^ byte ) & 0xff ];
+}
+
+uint64_t _CRC64_Update( uint64_t crc, uint8_t byte )
+{
+  return _CRC64_Do_update( crc, byte );
+}
+
+uint64_t _CRC64_Sequence_update(
+  uint64_t    crc,
+  const void *bytes,
+  size_t      size_in_bytes
+)
+{
+  const uint8_t *p = bytes;
+
+  while ( size_in_bytes >= 8 ) {
+    uint64_t v;
+
+    v = crc ^ rtems_uint64_from_little_endian( p );
+    crc = _CRC64_Table[ 7 ][ v & 0xff ] ^
+      _CRC64_Table[ 6 ][ ( v >> 8 ) & 0xff ] ^
+      _CRC64_Table[ 5 ][ ( v >> 16 ) & 0xff ] ^
+      _CRC64_Table[ 4 ][ ( v >> 24 ) & 0xff ] ^
+      _CRC64_Table[ 3 ][ ( v >> 32 ) & 0xff ] ^
+      _CRC64_Table[ 2 ][ ( v >> 40 ) & 0xff ] ^
+      _CRC64_Table[ 1 ][ ( v >> 48 ) & 0xff ] ^
+      _CRC64_Table[ 0 ][ v >> 56 ];
+    p += 8;
+    size_in_bytes -= 8;
+  }
+
+  while ( size_in_bytes > 0 ) {
+    crc = _CRC64_Do_update( crc, *p );
+    ++p;
+    --size_in_bytes;
+  }
+
+  return crc;
+}
@@ -47,7 +47,7 @@ extern "C" {
  *
  * The Block Device Buffer Management implements a cache between the disk
  * devices and file systems.  The code provides read-ahead and write queuing to
- * the drivers and fast cache look-up using an AVL tree.
+ * the drivers and fast cache look-up using a hash table.
  *
  * The block size used by a file system can be set at runtime and must be a
  * multiple of the disk device block size.  The disk device's physical block
@@ -132,7 +132,8 @@ extern "C" {
  * Empty or cached buffers are added to the LRU list and removed from this
  * queue when a caller requests a buffer.  This is referred to as getting a
  * buffer in the code and the event get in the state diagram.  The buffer is
- * assigned to a block and inserted to the AVL based on the block/device key.
+ * assigned to a block and inserted to the hash table based on the block/device
+ * key.
  * If the block is to be read by the user and not in the cache it is transfered
  * from the disk into memory.  If no buffers are on the LRU list the modified
  * list is checked.  If buffers are on the modified the swap out task will be
@@ -160,9 +161,20 @@ extern "C" {
  * most-resent read-ahead transfer.  The read-ahead works per disk, but all
  * transfers are issued by the read-ahead task.
  *
+ * The swap out task writes the buffers due of one disk in ascending block
+ * order.  Gaps between the due buffers and the end of each run of consecutive
+ * blocks are filled with modified buffers which are not due yet, as long as
+ * the run does not exceed the maximum write transfer block count.  Runs with
+ * buffers to be synchronized or with waiting users are written first.
+ *
  * The cache has the following lists of buffers:
  *  - LRU: Accessed or transfered buffers released in least recently used
- *  order.  Empty buffers will be placed to the front.
+ *  order.  Empty buffers will be placed to the front.  Buffers are recycled
+ *  with the CLOCK algorithm.  A cached buffer hit by a look-up is referenced
+ *  and gets a second chance, this means the recycle scan moves it to the end
+ *  of the list once instead of recycling it.  This keeps frequently used
+ *  buffers in the cache during sequential transfers of more blocks than the
+ *  cache can hold.
  *  - Modified: Buffers waiting to be written to disk.
  *  - Sync: Buffers to be synchronized with the disk.
  *
@@ -181,11 +193,11 @@ extern "C" {
  * @brief State of a buffer of the cache.
  *
  * The state has several implications.  Depending on the state a buffer can be
- * in the AVL tree, in a list, in use by an entity and a group user or not.
+ * in the hash table, in a list, in use by an entity and a group user or not.
  *
  * <table>
  *   <tr>
- *     <th>State</th><th>Valid Data</th><th>AVL Tree</th>
+ *     <th>State</th><th>Valid Data</th><th>Hash Table</th>
  *     <th>LRU List</th><th>Modified List</th><th>Synchronization List</th>
  *     <th>Group User</th><th>External User</th>
  *   </tr>
@@ -302,20 +314,15 @@ typedef struct rtems_bdbuf_group rtems_bdbuf_group;
 /**
  * To manage buffers we using buffer descriptors (BD). A BD holds a buffer plus
  * a range of other information related to managing the buffer in the cache. To
- * speed-up buffer lookup descriptors are organized in AVL-Tree. The fields
+ * speed-up buffer lookup descriptors are organized in a hash table. The fields
  * 'dd' and 'block' are search keys.
  */
 typedef struct rtems_bdbuf_buffer
 {
   rtems_chain_node link;       /**< Link the BD onto a number of lists. */
 
-  struct rtems_bdbuf_avl_node
-  {
-    struct rtems_bdbuf_buffer* left;   /**< Left Child */
-    struct rtems_bdbuf_buffer* right;  /**< Right Child */
-    signed char                cache;  /**< Cache */
-    signed char                bal;    /**< The balance of the sub-tree */
-  } avl;
+  struct rtems_bdbuf_buffer* hash_next; /**< Next BD of the hash table
+                                         * bucket. */
 
   rtems_disk_device *dd;        /**< disk device */
 
@@ -325,6 +332,9 @@ typedef struct rtems_bdbuf_buffer
 
   rtems_bdbuf_buf_state state;           /**< State of the buffer. */
 
+  bool referenced;               /**< The buffer was hit by a look-up since
+                                  * the last recycle scan passed it. */
+
   uint32_t waiters;              /**< The number of threads waiting on this
                                   * buffer. */
   rtems_bdbuf_group* group;      /**< Pointer to the group of BDs this BD is
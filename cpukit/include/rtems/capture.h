@@ -257,21 +257,34 @@ typedef void (*rtems_capture_timestamp)(rtems_capture_time* time);
 /**
  * @brief Capture record lock context.
  *
- * This structure is used to lock a per CPU buffer when opeining recording. The
+ * This structure is used to lock a per CPU buffer when opening recording. The
  * per CPU buffer is held locked until the record close is called. Locking
  * masks interrupts so use this lock only when needed and do not hold it for
  * long.
  *
- * The lock first masks the CPU interrupt before taking the interrupt
- * lock. This stops a thread context taking the lock and then an interrupt on
- * the same CPU attempting to take the lock so creating a deadlock.
- *
+ * Only the owner CPU writes to its buffer so the lock masks the interrupts of
+ * the current CPU and takes no spin lock. The processor is determined after
+ * the interrupts are masked so the thread cannot migrate in between. The
+ * reader synchronizes with the writer through the buffer indices only.
  */
 typedef struct {
-  rtems_interrupt_lock_context lock_context;
-  rtems_interrupt_lock*        lock;
+  rtems_interrupt_level level;
+  uint32_t              cpu;
 } rtems_capture_record_lock_context;
 
+/**
+ * @brief Capture record span.
+ *
+ * A span is a block of contiguous records recorded by one CPU. It is returned
+ * by rtems_capture_read_batch.
+ */
+typedef struct {
+  uint32_t    cpu;     /**< The CPU which recorded the records. */
+  uint32_t    count;   /**< The number of records in the span. */
+  size_t      size;    /**< The size of the records in bytes. */
+  const void* records; /**< The first record of the span. */
+} rtems_capture_record_span;
+
 /**
  * @brief Capture open
  *
@@ -553,6 +566,8 @@ rtems_capture_clear_trigger (rtems_name                 from_name,
  * rtems_capture_release. Calls this function without a release will
  * result in at least the same number of records being released.
  *
+ * The records can be read while capture control is enabled.
+ *
  * @param[in]  cpu The cpu number that the records were recorded on
  * @param[out] read will contain the number of records read
  * @param[out] recs The capture records that are read.
@@ -579,6 +594,53 @@ rtems_status_code rtems_capture_read (uint32_t     cpu,
  */
 rtems_status_code rtems_capture_release (uint32_t cpu, uint32_t count);
 
+/**
+ * @brief Capture read records of all CPUs in time order.
+ *
+ * This function reads the records of all CPUs and merges them by time. The
+ * records are returned as spans. A span is a block of contiguous records of
+ * one CPU so the records can be processed in place. The spans are in time
+ * order and the records of a span are in time order.
+ *
+ * Less records than available are returned if the spans are used up or if
+ * the records of a CPU wrap in the capture buffer. Read again after the
+ * release to get the remaining records.
+ *
+ * The user must release the spans with rtems_capture_release_batch. This
+ * ends the read on all CPUs, even if no span was returned.
+ *
+ * @param[out] spans The spans of records that are read.
+ * @param[in]  max_spans The maximum number of spans to return.
+ * @param[out] count will contain the number of spans read
+ *
+ * @retval This method returns RTEMS_SUCCESSFUL if there was not an
+ *         error. Otherwise, a status code is returned indicating the
+ *         source of the error.
+ */
+rtems_status_code
+rtems_capture_read_batch (rtems_capture_record_span* spans,
+                          size_t                     max_spans,
+                          size_t*                    count);
+
+/**
+ * @brief Capture release spans of records.
+ *
+ * This function releases the records of spans in the order returned by
+ * rtems_capture_read_batch and ends the read on all CPUs. The record count
+ * of a span may be lowered to release less records. The spans following a
+ * partly released span of the same CPU are not released.
+ *
+ * @param[in] spans The spans of records to release.
+ * @param[in] count The number of spans.
+ *
+ * @retval This method returns RTEMS_SUCCESSFUL if there was not an
+ *         error. Otherwise, a status code is returned indicating the
+ *         source of the error.
+ */
+rtems_status_code
+rtems_capture_release_batch (const rtems_capture_record_span* spans,
+                             size_t                           count);
+
 /**
  * @brief Capture filter
  *
@@ -94,6 +94,16 @@
   #error "Stack checker is disabled but a custom reporter is configured"
 #endif
 
+#if !defined(CONFIGURE_STACK_CHECKER_ENABLED) \
+  && defined(CONFIGURE_STACK_CHECKER_SWITCH_SAMPLING)
+  #error "Stack checker is disabled but switch sampling is configured"
+#endif
+
+#if defined(CONFIGURE_STACK_CHECKER_SCAN_WORDS) \
+  && CONFIGURE_STACK_CHECKER_SCAN_WORDS < 1
+  #error "CONFIGURE_STACK_CHECKER_SCAN_WORDS shall be greater than zero"
+#endif
+
 #ifdef CONFIGURE_STACK_CHECKER_ENABLED
   #include <rtems/stackchk.h>
 #endif
@@ -219,6 +229,18 @@ extern "C" {
     const Stack_checker_Reporter_handler Stack_checker_Reporter =
       rtems_stack_checker_reporter_quiet;
   #endif
+
+  #ifndef CONFIGURE_STACK_CHECKER_SCAN_WORDS
+    #define CONFIGURE_STACK_CHECKER_SCAN_WORDS 64
+  #endif
+
+  const uint32_t Stack_checker_Scan_words = CONFIGURE_STACK_CHECKER_SCAN_WORDS;
+
+  #ifdef CONFIGURE_STACK_CHECKER_SWITCH_SAMPLING
+    const bool Stack_checker_Switch_sampling = true;
+  #else
+    const bool Stack_checker_Switch_sampling = false;
+  #endif
 #endif
 
 #ifdef __cplusplus
@@ -276,6 +276,8 @@ static const IMFS_mknod_controls IMFS_root_mknod_controls = {
   #endif
   #ifdef CONFIGURE_IMFS_DISABLE_MKNOD_FILE
     &IMFS_mknod_control_enosys,
+  #elif defined(CONFIGURE_IMFS_ENABLE_EXTENT_FILES)
+    &IMFS_mknod_control_extfile,
   #else
     &IMFS_mknod_control_memfile,
   #endif
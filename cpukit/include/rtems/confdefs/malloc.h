@@ -50,10 +50,17 @@
 #define _CONFIGURE_HEAP_EXTEND_VIA_SBRK
 #endif
 
-#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) || defined(CONFIGURE_MALLOC_DIRTY)
+#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) || \
+  defined(CONFIGURE_MALLOC_DIRTY) || \
+  defined(CONFIGURE_MALLOC_PER_CPU_CACHE) || \
+  defined(CONFIGURE_MALLOC_SEGREGATED_FIT)
 #include <rtems/malloc.h>
 #endif
 
+#ifdef CONFIGURE_MALLOC_SEGREGATED_FIT
+#include <rtems/sysinit.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,6 +75,19 @@ rtems_malloc_dirtier_t rtems_malloc_dirty_helper =
   rtems_malloc_dirty_memory;
 #endif
 
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE
+const Malloc_Cache_handler * const _Malloc_Cache_handler =
+  &_Malloc_Per_CPU_cache_handler;
+#endif
+
+#ifdef CONFIGURE_MALLOC_SEGREGATED_FIT
+RTEMS_SYSINIT_ITEM(
+  _Malloc_Enable_segregated_fit,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_LAST
+);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -56,6 +56,11 @@
 #include <rtems/score/percpu.h>
 #include <rtems/score/smp.h>
 
+#ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+  #include <rtems/score/watchdogimpl.h>
+  #include <rtems/sysinit.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -108,6 +113,18 @@ RTEMS_DEFINE_GLOBAL_SYMBOL(
     + _CONFIGURE_INTERRUPT_STACK_AREA_SIZE
 );
 
+/* Watchdog timing wheel configuration */
+
+#ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+  Watchdog_Wheel _Watchdog_Wheel_table[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  RTEMS_SYSINIT_ITEM(
+    _Watchdog_Wheel_initialize,
+    RTEMS_SYSINIT_DATA_STRUCTURES,
+    RTEMS_SYSINIT_ORDER_LAST
+  );
+#endif
+
 /* Thread stack size configuration */
 
 #ifndef CONFIGURE_MINIMUM_TASK_STACK_SIZE
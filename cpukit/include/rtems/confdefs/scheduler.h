@@ -54,7 +54,8 @@
   && !defined(CONFIGURE_SCHEDULER_SIMPLE) \
   && !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) \
   && !defined(CONFIGURE_SCHEDULER_STRONG_APA) \
-  && !defined(CONFIGURE_SCHEDULER_USER)
+  && !defined(CONFIGURE_SCHEDULER_USER) \
+  && !defined(CONFIGURE_SCHEDULER_WS_SMP)
   #if defined(RTEMS_SMP) && _CONFIGURE_MAXIMUM_PROCESSORS > 1
     #define CONFIGURE_SCHEDULER_EDF_SMP
   #else
@@ -86,6 +87,25 @@ extern "C" {
   #error "CONFIGURE_SCHEDULER_PRIORITY must be less than or equal to the architecture defined maximum priority"
 #endif
 
+/*
+ * Use the priority bucket thread queue operations if there is exactly one
+ * scheduler with the default priority mapping and the count of thread
+ * priorities is small enough, so that the per thread storage of the buckets
+ * is acceptable.  A user provided scheduler table may contain more than one
+ * scheduler.  The buckets are sized by CONFIGURE_MAXIMUM_PRIORITY, so only
+ * the schedulers which use this maximum priority are accepted.  The simple
+ * and Strong APA schedulers have a fixed maximum priority of 255.
+ */
+#if !defined(CONFIGURE_DISABLE_THREAD_QUEUE_PRIORITY_BUCKETS) \
+  && !defined(CONFIGURE_SCHEDULER_TABLE_ENTRIES) \
+  && ( defined(CONFIGURE_SCHEDULER_PRIORITY) \
+    || defined(CONFIGURE_SCHEDULER_PRIORITY_SMP) \
+    || defined(CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP) \
+    || defined(CONFIGURE_SCHEDULER_WS_SMP) ) \
+  && CONFIGURE_MAXIMUM_PRIORITY <= 63
+  #define _CONFIGURE_THREAD_QUEUE_PRIORITY_BUCKETS
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_PRIORITY
   #ifndef CONFIGURE_SCHEDULER_NAME
     #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'U', 'P', 'D', ' ' )
@@ -157,6 +177,23 @@ extern "C" {
   #endif
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_WS_SMP
+  #ifndef CONFIGURE_SCHEDULER_NAME
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'M', 'W', 'S', ' ' )
+  #endif
+
+  #ifndef CONFIGURE_SCHEDULER_TABLE_ENTRIES
+    #define CONFIGURE_SCHEDULER \
+      RTEMS_SCHEDULER_WS_SMP( \
+        dflt, \
+        CONFIGURE_MAXIMUM_PRIORITY + 1 \
+      )
+
+    #define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+      RTEMS_SCHEDULER_TABLE_WS_SMP( dflt, CONFIGURE_SCHEDULER_NAME )
+  #endif
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_SIMPLE
   #ifndef CONFIGURE_SCHEDULER_NAME
     #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'U', 'P', 'S', ' ' )
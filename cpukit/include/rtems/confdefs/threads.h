@@ -49,6 +49,7 @@
 #include <rtems/confdefs/scheduler.h>
 #include <rtems/confdefs/unlimited.h>
 #include <rtems/score/thread.h>
+#include <rtems/score/threadqops.h>
 #include <rtems/rtems/tasksdata.h>
 
 #ifdef RTEMS_POSIX_API
@@ -127,6 +128,9 @@ typedef union {
   #ifdef CONFIGURE_SCHEDULER_STRONG_APA
     Scheduler_strong_APA_Node Strong_APA;
   #endif
+  #ifdef CONFIGURE_SCHEDULER_WS_SMP
+    Scheduler_WS_SMP_Node WS_SMP;
+  #endif
   #ifdef CONFIGURE_SCHEDULER_USER_PER_THREAD
     CONFIGURE_SCHEDULER_USER_PER_THREAD User;
   #endif
@@ -217,21 +221,55 @@ const Thread_Control_add_on _Thread_Control_add_ons[] = {
 const size_t _Thread_Control_add_on_count =
   RTEMS_ARRAY_SIZE( _Thread_Control_add_ons );
 
-#ifdef RTEMS_SMP
-  struct Thread_queue_Configured_heads {
+struct Thread_queue_Configured_heads {
 /*
  * This was put in to address the following warning.
  * warning: invalid use of structure with flexible array member
  */
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpedantic"
-    Thread_queue_Heads Heads;
+  Thread_queue_Heads Heads;
 #pragma GCC diagnostic pop
-      Thread_queue_Priority_queue Priority[ _CONFIGURE_SCHEDULER_COUNT ];
-  };
+  #ifdef RTEMS_SMP
+    Thread_queue_Priority_queue Priority[ _CONFIGURE_SCHEDULER_COUNT ];
+  #endif
+  #ifdef _CONFIGURE_THREAD_QUEUE_PRIORITY_BUCKETS
+    struct {
+      Priority_bit_map_Control Bit_map;
+      Chain_Control Fifo[ CONFIGURE_MAXIMUM_PRIORITY + 1 ];
+    } Buckets;
+  #endif
+};
+
+const size_t _Thread_queue_Heads_size =
+  sizeof( Thread_queue_Configured_heads );
 
-  const size_t _Thread_queue_Heads_size =
-    sizeof( Thread_queue_Configured_heads );
+#ifdef _CONFIGURE_THREAD_QUEUE_PRIORITY_BUCKETS
+  RTEMS_STATIC_ASSERT(
+    offsetof( Thread_queue_Configured_heads, Buckets ) ==
+      sizeof( Thread_queue_Heads )
+  #ifdef RTEMS_SMP
+      + sizeof( Thread_queue_Priority_queue )
+  #endif
+      ,
+    _Thread_queue_Priority_buckets
+  );
+
+  const Thread_queue_Operations _Thread_queue_Operations_priority = {
+    _Thread_queue_Priority_bucket_priority_actions,
+    _Thread_queue_Priority_bucket_enqueue,
+    _Thread_queue_Priority_bucket_extract,
+    _Thread_queue_Priority_bucket_surrender,
+    _Thread_queue_Priority_bucket_first
+  };
+#else
+  const Thread_queue_Operations _Thread_queue_Operations_priority = {
+    _Thread_queue_Priority_priority_actions,
+    _Thread_queue_Priority_enqueue,
+    _Thread_queue_Priority_extract,
+    _Thread_queue_Priority_surrender,
+    _Thread_queue_Priority_first
+  };
 #endif
 
 const size_t _Thread_Initial_thread_count =
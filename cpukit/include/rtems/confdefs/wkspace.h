@@ -44,8 +44,10 @@
 #ifdef CONFIGURE_INIT
 
 #include <rtems/confdefs/bdbuf.h>
+#include <rtems/confdefs/extensions.h>
 #include <rtems/confdefs/inittask.h>
 #include <rtems/confdefs/initthread.h>
+#include <rtems/confdefs/objectsclassic.h>
 #include <rtems/confdefs/objectsposix.h>
 #include <rtems/confdefs/percpu.h>
 #include <rtems/confdefs/threads.h>
@@ -53,7 +55,9 @@
 #include <rtems/score/coremsg.h>
 #include <rtems/score/context.h>
 #include <rtems/score/memory.h>
+#include <rtems/score/objectimpl.h>
 #include <rtems/score/stack.h>
+#include <rtems/score/wkspace.h>
 #include <rtems/sysinit.h>
 
 #if CPU_STACK_ALIGNMENT > CPU_HEAP_ALIGNMENT
@@ -106,10 +110,91 @@
 #define _CONFIGURE_HEAP_HANDLER_OVERHEAD \
   _Configure_Align_up( HEAP_BLOCK_HEADER_SIZE, CPU_HEAP_ALIGNMENT )
 
+#ifdef CONFIGURE_WORKSPACE_SEGREGATED_FIT
+  #define _CONFIGURE_HEAP_SEGREGATED_FIT_OVERHEAD \
+    _Configure_From_workspace( sizeof( Heap_Segregated_index ) )
+#else
+  #define _CONFIGURE_HEAP_SEGREGATED_FIT_OVERHEAD 0
+#endif
+
+#ifdef CONFIGURE_OBJECTS_NAME_INDEX
+  #ifndef CONFIGURE_MAXIMUM_BARRIERS
+    #define CONFIGURE_MAXIMUM_BARRIERS 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_MESSAGE_QUEUES
+    #define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_PARTITIONS
+    #define CONFIGURE_MAXIMUM_PARTITIONS 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_PERIODS
+    #define CONFIGURE_MAXIMUM_PERIODS 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_PORTS
+    #define CONFIGURE_MAXIMUM_PORTS 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_REGIONS
+    #define CONFIGURE_MAXIMUM_REGIONS 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_SEMAPHORES
+    #define CONFIGURE_MAXIMUM_SEMAPHORES 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_TIMERS
+    #define CONFIGURE_MAXIMUM_TIMERS 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES
+    #define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_POSIX_SEMAPHORES
+    #define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES 0
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_POSIX_SHMS
+    #define CONFIGURE_MAXIMUM_POSIX_SHMS 0
+  #endif
+
+  #define _Configure_Name_index( _max ) \
+    ( _Configure_Zero_or_one( _max ) * _Configure_From_workspace( \
+      OBJECTS_NAME_INDEX_SIZE( rtems_resource_maximum_per_allocation( _max ) ) \
+    ) )
+
+  /*
+   * The name index is allocated for Classic API classes and classes with
+   * string names, see _Objects_Name_index_initialize().
+   */
+  #define _CONFIGURE_MEMORY_FOR_OBJECTS_NAME_INDEX \
+    ( _Configure_Name_index( _CONFIGURE_TASKS ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_BARRIERS ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_MESSAGE_QUEUES ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_PARTITIONS ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_PERIODS ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_PORTS ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_REGIONS ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_SEMAPHORES ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_TIMERS ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_USER_EXTENSIONS ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_POSIX_SEMAPHORES ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_POSIX_SHMS ) )
+#else
+  #define _CONFIGURE_MEMORY_FOR_OBJECTS_NAME_INDEX 0
+#endif
+
 #define CONFIGURE_EXECUTIVE_RAM_SIZE \
   ( _CONFIGURE_MEMORY_FOR_POSIX_OBJECTS \
     + CONFIGURE_MESSAGE_BUFFER_MEMORY \
     + 1024 * CONFIGURE_MEMORY_OVERHEAD \
+    + _CONFIGURE_HEAP_SEGREGATED_FIT_OVERHEAD \
+    + _CONFIGURE_MEMORY_FOR_OBJECTS_NAME_INDEX \
     + _CONFIGURE_HEAP_HANDLER_OVERHEAD )
 
 #if defined(CONFIGURE_IDLE_TASK_STORAGE_SIZE) || \
@@ -158,6 +243,10 @@ const uintptr_t _Workspace_Size = CONFIGURE_EXECUTIVE_RAM_SIZE;
     _Workspace_Malloc_initialize_unified;
 #endif
 
+#ifdef CONFIGURE_OBJECTS_NAME_INDEX
+  const bool _Objects_Name_index_is_enabled = true;
+#endif
+
 uint32_t rtems_minimum_stack_size = CONFIGURE_MINIMUM_TASK_STACK_SIZE;
 
 const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
@@ -257,6 +346,14 @@ const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
 const Stack_Allocator_allocate_for_idle _Stack_Allocator_allocate_for_idle =
   CONFIGURE_TASK_STACK_ALLOCATOR_FOR_IDLE;
 
+#ifdef CONFIGURE_WORKSPACE_SEGREGATED_FIT
+  RTEMS_SYSINIT_ITEM(
+    _Workspace_Enable_segregated_fit,
+    RTEMS_SYSINIT_WORKSPACE,
+    RTEMS_SYSINIT_ORDER_LAST
+  );
+#endif
+
 #ifdef CONFIGURE_DIRTY_MEMORY
   RTEMS_SYSINIT_ITEM(
     _Memory_Dirty_free_areas,
@@ -55,6 +55,11 @@
 #ifndef _RTEMS_CPUUSE_H
 #define _RTEMS_CPUUSE_H
 
+#include <stddef.h>
+#include <stdint.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -221,6 +226,266 @@ void rtems_cpu_usage_top( void );
  */
 void rtems_cpu_usage_top_with_plugin( const struct rtems_printer *printer );
 
+/**
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief This type represents an incremental CPU usage sampler.
+ *
+ * The sampler records the CPU usage of each thread in each sample period into
+ * a history of fixed size.  The threads are sampled in batches so that the
+ * object allocator lock is held only for short intervals.  The queries use
+ * the recorded history only and do not visit the threads.
+ */
+typedef struct rtems_cpu_usage_sampler rtems_cpu_usage_sampler;
+
+/**
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief This structure configures an incremental CPU usage sampler.
+ */
+typedef struct {
+  /**
+   * @brief This member defines the sample period in clock ticks.
+   *
+   * If the period is zero, then no sampler task is created and the threads
+   * are only sampled by rtems_cpu_usage_sampler_sample().
+   */
+  rtems_interval period;
+
+  /**
+   * @brief This member defines the count of samples kept for each thread.
+   *
+   * If the count is zero, then a default of 16 samples is used.
+   */
+  uint32_t history;
+
+  /**
+   * @brief This member defines the count of thread objects sampled while the
+   *   object allocator lock is held.
+   *
+   * If the count is zero, then a default of 16 thread objects is used.
+   */
+  uint32_t batch;
+
+  /**
+   * @brief This member defines the priority of the sampler task.
+   *
+   * If the priority is zero, then the current priority of the calling task is
+   * used.
+   */
+  rtems_task_priority priority;
+} rtems_cpu_usage_sampler_config;
+
+/**
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief This structure provides the CPU usage statistics of a thread.
+ *
+ * The CPU usage values are in units of 0.001 percent of the sample period,
+ * so a fully used period has a usage of 100000.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the thread identifier.
+   */
+  rtems_id id;
+
+  /**
+   * @brief This member contains the count of samples in the history.
+   */
+  uint32_t samples;
+
+  /**
+   * @brief This member contains the CPU usage of the last sample period.
+   */
+  uint32_t current;
+
+  /**
+   * @brief This member contains the moving average of the CPU usage over
+   *   the history.
+   */
+  uint32_t average;
+
+  /**
+   * @brief This member contains the maximum CPU usage in the history.
+   */
+  uint32_t maximum;
+
+  /**
+   * @brief This member contains the requested percentile of the CPU usage in
+   *   the history.
+   */
+  uint32_t percentile;
+} rtems_cpu_usage_thread_stats;
+
+/**
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief This enumeration defines the orders of the top threads.
+ */
+typedef enum {
+  /**
+   * @brief Order by the CPU usage of the last sample period.
+   */
+  RTEMS_CPU_USAGE_SAMPLER_ORDER_CURRENT,
+
+  /**
+   * @brief Order by the moving average of the CPU usage.
+   */
+  RTEMS_CPU_USAGE_SAMPLER_ORDER_AVERAGE
+} rtems_cpu_usage_sampler_order;
+
+/**
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief Creates an incremental CPU usage sampler.
+ *
+ * @param config is the sampler configuration.
+ *
+ * @param[out] sampler is the pointer to an object pointer.  When the
+ *   directive call is successful, the pointer to the created sampler will be
+ *   stored in this object.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``config`` or ``sampler`` parameter was
+ *   NULL.
+ *
+ * @retval ::RTEMS_NO_MEMORY There was not enough memory to allocate the
+ *   sampler.
+ *
+ * @return Other status codes are returned if the sampler task could not be
+ *   created or started.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may obtain and release the object allocator mutex.  This may
+ *   cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_cpu_usage_sampler_create(
+  const rtems_cpu_usage_sampler_config  *config,
+  rtems_cpu_usage_sampler              **sampler
+);
+
+/**
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief Deletes the CPU usage sampler.
+ *
+ * @param sampler is the sampler to delete.  The sampler task is stopped
+ *   before the sampler is freed.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive waits for the sampler task to stop.  This may cause the
+ *   calling task to be blocked and unblocked.
+ * @endparblock
+ */
+void rtems_cpu_usage_sampler_delete( rtems_cpu_usage_sampler *sampler );
+
+/**
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief Samples the CPU usage of all threads.
+ *
+ * @param sampler is the sampler.
+ *
+ * @par Notes
+ * The sampler task calls this directive once in each sample period.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may obtain and release the object allocator mutex.  This may
+ *   cause the calling task to be preempted.
+ * @endparblock
+ */
+void rtems_cpu_usage_sampler_sample( rtems_cpu_usage_sampler *sampler );
+
+/**
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief Gets the threads with the highest CPU usage.
+ *
+ * @param sampler is the sampler.
+ *
+ * @param order is the order of the threads.
+ *
+ * @param percent is the percentile of the history to return in the
+ *   statistics.
+ *
+ * @param[out] top is the array of at least ``n`` elements to store the
+ *   statistics of the threads.  The threads are stored in descending order.
+ *
+ * @param n is the maximum count of threads to return.
+ *
+ * @return Returns the count of threads stored in ``top``.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive does not visit the threads and does not obtain the object
+ *   allocator mutex.
+ * @endparblock
+ */
+size_t rtems_cpu_usage_sampler_top(
+  rtems_cpu_usage_sampler       *sampler,
+  rtems_cpu_usage_sampler_order  order,
+  uint32_t                       percent,
+  rtems_cpu_usage_thread_stats  *top,
+  size_t                         n
+);
+
+/**
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief Gets the CPU usage statistics of a thread.
+ *
+ * @param sampler is the sampler.
+ *
+ * @param id is the thread identifier.
+ *
+ * @param percent is the percentile of the history to return in the
+ *   statistics.
+ *
+ * @param[out] stats is the object to store the statistics.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID The thread was not seen by the sampler.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive does not visit the threads and does not obtain the object
+ *   allocator mutex.
+ * @endparblock
+ */
+rtems_status_code rtems_cpu_usage_sampler_get(
+  rtems_cpu_usage_sampler      *sampler,
+  rtems_id                      id,
+  uint32_t                      percent,
+  rtems_cpu_usage_thread_stats *stats
+);
+
 #ifdef __cplusplus
 }
 #endif
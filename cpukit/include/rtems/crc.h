@@ -97,6 +97,214 @@ uint32_t _CRC24Q_Sequence_update(
   size_t      size_in_bytes
 );
 
+/**
+ * @brief This constant represents the default CRC-8 seed state.
+ *
+ * The CRC-8 uses the polynomial 0x07 without reflection and without a final
+ * exclusive or (CRC-8/SMBUS).
+ */
+#define CRC8_SEED 0U
+
+/**
+ * @brief Updates the CRC-8 state using a byte.
+ *
+ * @param crc is the input CRC-8 state.
+ *
+ * @param byte is the byte updating the input CRC-8 state.
+ *
+ * @return Returns the updated CRC-8 state.
+ */
+uint8_t _CRC8_Update( uint8_t crc, uint8_t byte );
+
+/**
+ * @brief Updates the CRC-8 state using a sequence of bytes.
+ *
+ * @param crc is the input CRC-8 state.
+ *
+ * @param bytes[in] is the sequence of bytes updating the input CRC-8 state.
+ *
+ * @param size_in_bytes is the size in bytes of the byte sequence.
+ *
+ * @return Returns the updated CRC-8 state.
+ */
+uint8_t _CRC8_Sequence_update(
+  uint8_t     crc,
+  const void *bytes,
+  size_t      size_in_bytes
+);
+
+/**
+ * @brief This constant represents the default CRC-16 seed state.
+ *
+ * The CRC-16 uses the CCITT polynomial 0x1021 without reflection and without
+ * a final exclusive or (CRC-16/CCITT-FALSE).  Use a seed of zero to get the
+ * CRC-16/XMODEM variant.
+ */
+#define CRC16_SEED 0xffffU
+
+/**
+ * @brief Updates the CRC-16 state using a byte.
+ *
+ * @param crc is the input CRC-16 state.
+ *
+ * @param byte is the byte updating the input CRC-16 state.
+ *
+ * @return Returns the updated CRC-16 state.
+ */
+uint16_t _CRC16_Update( uint16_t crc, uint8_t byte );
+
+/**
+ * @brief Updates the CRC-16 state using a sequence of bytes.
+ *
+ * @param crc is the input CRC-16 state.
+ *
+ * @param bytes[in] is the sequence of bytes updating the input CRC-16 state.
+ *
+ * @param size_in_bytes is the size in bytes of the byte sequence.
+ *
+ * @return Returns the updated CRC-16 state.
+ */
+uint16_t _CRC16_Sequence_update(
+  uint16_t    crc,
+  const void *bytes,
+  size_t      size_in_bytes
+);
+
+/**
+ * @brief This constant represents the default CRC-32 seed state.
+ *
+ * The CRC-32 uses the reflected IEEE 802.3 polynomial 0x04c11db7.  The
+ * implementation uses the ARMv8 CRC32 instructions if available.
+ */
+#define CRC32_SEED 0xffffffffU
+
+/**
+ * @brief This constant shall be exclusive or combined with the state returned
+ *   by _CRC32_Update() and _CRC32_Sequence_update() to get a valid CRC-32
+ *   value.
+ */
+#define CRC32_FINAL_XOR 0xffffffffU
+
+/**
+ * @brief Updates the CRC-32 state using a byte.
+ *
+ * @param crc is the input CRC-32 state.
+ *
+ * @param byte is the byte updating the input CRC-32 state.
+ *
+ * @return Returns the updated CRC-32 state.  Use the #CRC32_FINAL_XOR to get a
+ *   valid CRC-32 value.
+ */
+uint32_t _CRC32_Update( uint32_t crc, uint8_t byte );
+
+/**
+ * @brief Updates the CRC-32 state using a sequence of bytes.
+ *
+ * @param crc is the input CRC-32 state.
+ *
+ * @param bytes[in] is the sequence of bytes updating the input CRC-32 state.
+ *
+ * @param size_in_bytes is the size in bytes of the byte sequence.
+ *
+ * @return Returns the updated CRC-32 state.  Use the #CRC32_FINAL_XOR to get a
+ *   valid CRC-32 value.
+ */
+uint32_t _CRC32_Sequence_update(
+  uint32_t    crc,
+  const void *bytes,
+  size_t      size_in_bytes
+);
+
+/**
+ * @brief This constant represents the default CRC-32C seed state.
+ *
+ * The CRC-32C uses the reflected Castagnoli polynomial 0x1edc6f41.  The
+ * implementation uses the ARMv8 CRC32 or the SSE4.2 instructions if available.
+ */
+#define CRC32C_SEED 0xffffffffU
+
+/**
+ * @brief This constant shall be exclusive or combined with the state returned
+ *   by _CRC32C_Update() and _CRC32C_Sequence_update() to get a valid CRC-32C
+ *   value.
+ */
+#define CRC32C_FINAL_XOR 0xffffffffU
+
+/**
+ * @brief Updates the CRC-32C state using a byte.
+ *
+ * @param crc is the input CRC-32C state.
+ *
+ * @param byte is the byte updating the input CRC-32C state.
+ *
+ * @return Returns the updated CRC-32C state.  Use the #CRC32C_FINAL_XOR to
+ *   get a valid CRC-32C value.
+ */
+uint32_t _CRC32C_Update( uint32_t crc, uint8_t byte );
+
+/**
+ * @brief Updates the CRC-32C state using a sequence of bytes.
+ *
+ * @param crc is the input CRC-32C state.
+ *
+ * @param bytes[in] is the sequence of bytes updating the input CRC-32C state.
+ *
+ * @param size_in_bytes is the size in bytes of the byte sequence.
+ *
+ * @return Returns the updated CRC-32C state.  Use the #CRC32C_FINAL_XOR to
+ *   get a valid CRC-32C value.
+ */
+uint32_t _CRC32C_Sequence_update(
+  uint32_t    crc,
+  const void *bytes,
+  size_t      size_in_bytes
+);
+
+/**
+ * @brief This constant represents the default CRC-64 seed state.
+ *
+ * The CRC-64 uses the reflected ECMA-182 polynomial 0x42f0e1eba9ea3693
+ * (CRC-64/XZ).
+ */
+#define CRC64_SEED UINT64_C( 0xffffffffffffffff )
+
+/**
+ * @brief This constant shall be exclusive or combined with the state returned
+ *   by _CRC64_Update() and _CRC64_Sequence_update() to get a valid CRC-64
+ *   value.
+ */
+#define CRC64_FINAL_XOR UINT64_C( 0xffffffffffffffff )
+
+/**
+ * @brief Updates the CRC-64 state using a byte.
+ *
+ * @param crc is the input CRC-64 state.
+ *
+ * @param byte is the byte updating the input CRC-64 state.
+ *
+ * @return Returns the updated CRC-64 state.  Use the #CRC64_FINAL_XOR to get a
+ *   valid CRC-64 value.
+ */
+uint64_t _CRC64_Update( uint64_t crc, uint8_t byte );
+
+/**
+ * @brief Updates the CRC-64 state using a sequence of bytes.
+ *
+ * @param crc is the input CRC-64 state.
+ *
+ * @param bytes[in] is the sequence of bytes updating the input CRC-64 state.
+ *
+ * @param size_in_bytes is the size in bytes of the byte sequence.
+ *
+ * @return Returns the updated CRC-64 state.  Use the #CRC64_FINAL_XOR to get a
+ *   valid CRC-64 value.
+ */
+uint64_t _CRC64_Sequence_update(
+  uint64_t    crc,
+  const void *bytes,
+  size_t      size_in_bytes
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,198 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIDecompress
+ *
+ * @brief This header file provides the interfaces of the parallel decompression
+ *   service.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_DECOMPRESS_H
+#define _RTEMS_DECOMPRESS_H
+
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSAPIDecompress Parallel Decompression
+ *
+ * @ingroup RTEMSAPI
+ *
+ * @brief The parallel decompression service decodes independent blocks of a
+ *   compressed image in worker tasks and delivers the output in order.
+ *
+ * The following formats are supported:
+ *
+ * - xz streams, see <xz.h>.  The blocks of each stream are located through
+ *   the stream index.  Each block is decoded independently.  Only streams
+ *   with a CRC32 or no integrity check are supported.  Multi-block streams
+ *   are produced for example by the xz tool with the --block-size or
+ *   --threads options.  Concatenated streams are supported.
+ *
+ * - gzip files, see <zlib.h>.  Each member of a multi-member gzip file is
+ *   decoded independently.  Members are produced for example by a
+ *   concatenation of separately compressed files.  The member boundaries are
+ *   not recorded in the format, so each potential member header is decoded
+ *   speculatively.  Decodes of headers which turn out to be inside a member
+ *   are discarded.
+ *
+ * - zlib streams, see <zlib.h>.  A zlib stream is decoded as one block.
+ *
+ * The compressed image must be completely available in memory.  The
+ * uncompressed output of at most the configured window of blocks is held in
+ * memory.  The task reading the output decodes a block itself if no worker
+ * task started to decode it yet.
+ *
+ * @{
+ */
+
+/**
+ * @brief This structure defines the parallel decompression configuration.
+ */
+typedef struct {
+  /**
+   * @brief This member defines the count of worker tasks.
+   *
+   * If zero, the blocks are decoded by the task reading the output.
+   */
+  uint32_t worker_count;
+
+  /**
+   * @brief This member defines the priority of the worker tasks.
+   *
+   * If zero, the priority of the task creating the context is used.
+   */
+  rtems_task_priority worker_priority;
+
+  /**
+   * @brief This member defines the count of blocks which may be decoded
+   *   ahead of the block currently read.
+   *
+   * The window includes the block currently read.  It limits the memory
+   * used for the uncompressed output.  If zero, a window of twice the worker
+   * count plus one is used.
+   */
+  size_t window;
+} rtems_decompress_config;
+
+/**
+ * @brief This type represents a parallel decompression context.
+ */
+typedef struct rtems_decompress_context rtems_decompress_context;
+
+/**
+ * @brief Creates a parallel decompression context.
+ *
+ * The format of the compressed image is detected by its magic bytes.  Each
+ * worker task needs a task object and a task stack of twice the minimum task
+ * stack size.
+ *
+ * @param begin is the begin of the compressed image.  The image shall remain
+ *   unchanged until the context is destroyed.
+ *
+ * @param size is the size in bytes of the compressed image.
+ *
+ * @param config is the configuration.
+ *
+ * @param[out] context is the pointer to an rtems_decompress_context object
+ *   pointer.  When the directive call is successful, the pointer to the
+ *   created context will be stored in this object.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``begin``, ``config``, or ``context``
+ *   parameter was NULL.
+ *
+ * @retval ::RTEMS_NOT_IMPLEMENTED The format of the compressed image is not
+ *   supported.
+ *
+ * @retval ::RTEMS_IO_ERROR The xz stream structure was corrupt.
+ *
+ * @retval ::RTEMS_NO_MEMORY There was not enough memory to create the
+ *   context.
+ *
+ * @retval ::RTEMS_TOO_MANY There were not enough task objects available to
+ *   create the worker tasks.
+ */
+rtems_status_code rtems_decompress_create(
+  const void                     *begin,
+  size_t                          size,
+  const rtems_decompress_config  *config,
+  rtems_decompress_context      **context
+);
+
+/**
+ * @brief Reads the uncompressed output in order.
+ *
+ * @param context is the parallel decompression context.
+ *
+ * @param[out] buffer is the buffer for the uncompressed output.
+ *
+ * @param size is the size in bytes of the buffer.
+ *
+ * @param[out] count is the pointer to a size_t object.  When the directive
+ *   call is successful, the count of bytes stored in the buffer will be
+ *   stored in this object.  The count is less than the buffer size only at
+ *   the end of the output.  A count of zero indicates the end of the output.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_IO_ERROR The compressed image was corrupt.  All following
+ *   reads return this status.
+ *
+ * @retval ::RTEMS_NO_MEMORY There was not enough memory to decode a block.
+ *   All following reads return this status.
+ */
+rtems_status_code rtems_decompress_read(
+  rtems_decompress_context *context,
+  void                     *buffer,
+  size_t                    size,
+  size_t                   *count
+);
+
+/**
+ * @brief Stops the worker tasks and destroys the parallel decompression
+ *   context.
+ *
+ * @param context is the parallel decompression context.
+ */
+void rtems_decompress_destroy( rtems_decompress_context *context );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_DECOMPRESS_H */
@@ -164,6 +164,15 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Count of modified blocks merged into write transfers.
+   *
+   * The swapout task fills gaps between and extends runs of blocks due for
+   * write with adjacent modified blocks to issue fewer and larger write
+   * transfers.
+   */
+  uint32_t write_merges;
 } rtems_blkdev_stats;
 
 /**
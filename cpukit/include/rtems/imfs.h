@@ -112,6 +112,29 @@ typedef block_p *block_ptr;
 #define IMFS_MEMFILE_MAXIMUM_SIZE \
   (LAST_TRIPLY_INDIRECT * IMFS_MEMFILE_BYTES_PER_BLOCK)
 
+/**
+ *  IMFS "extfile" information
+ *
+ *  The in-memory "extfiles" store the file data in a small, fixed number of
+ *  extents.  Extent k covers the bytes starting at
+ *  IMFS_EXTFILE_FIRST_EXTENT_SIZE * (2^k - 1) and has a size of
+ *  IMFS_EXTFILE_FIRST_EXTENT_SIZE * 2^k, so the extent of an offset is
+ *  computed and not looked up.  A file of size n needs about log2(n)
+ *  allocations and reads and writes copy whole extents with one memcpy().
+ *  At most half of the allocated memory is unused.
+ *
+ *  The root IMFS creates extfiles instead of memfiles if the application
+ *  defines CONFIGURE_IMFS_ENABLE_EXTENT_FILES.  Other IMFS instances use
+ *  them through IMFS_mknod_control_extfile in their IMFS_mknod_controls.
+ */
+#define IMFS_EXTFILE_FIRST_EXTENT_SIZE 256
+
+#define IMFS_EXTFILE_EXTENT_COUNT 24
+
+#define IMFS_EXTFILE_MAXIMUM_SIZE \
+  ((((off_t) 1 << IMFS_EXTFILE_EXTENT_COUNT) - 1) * \
+    IMFS_EXTFILE_FIRST_EXTENT_SIZE)
+
 /** @} */
 
 /**
@@ -321,6 +344,11 @@ typedef struct {
   block_p         direct;           /* pointer to file image */
 } IMFS_linearfile_t;
 
+typedef struct {
+  IMFS_filebase_t File;
+  block_p         extents[ IMFS_EXTFILE_EXTENT_COUNT ];
+} IMFS_extfile_t;
+
 /* Support copy on write for linear files */
 typedef union {
   IMFS_jnode_t      Node;
@@ -397,6 +425,7 @@ extern const IMFS_mknod_control IMFS_mknod_control_dir_default;
 extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal;
 extern const IMFS_mknod_control IMFS_mknod_control_device;
 extern const IMFS_mknod_control IMFS_mknod_control_memfile;
+extern const IMFS_mknod_control IMFS_mknod_control_extfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
 extern const IMFS_mknod_control IMFS_mknod_control_fifo;
 extern const IMFS_mknod_control IMFS_mknod_control_enosys;
@@ -70,6 +70,79 @@ extern Heap_Control *RTEMS_Malloc_Heap;
 
 void _Malloc_Initialize( void );
 
+/**
+ * @brief Enables the segregated fit method for the C program heap.
+ *
+ * This function is used by the application configuration option
+ * ``CONFIGURE_MALLOC_SEGREGATED_FIT``.  In case there is not enough memory
+ * available for the segregated fit index, then a fatal error occurs.
+ */
+void _Malloc_Enable_segregated_fit( void );
+
+/**
+ * @brief The C program heap cache handler.
+ *
+ * A cache handler may satisfy allocation requests without alignment and
+ * boundary constraints and deallocation requests in the
+ * MALLOC_SYSTEM_STATE_NORMAL system state without the allocator lock.
+ */
+typedef struct {
+  /**
+   * @brief Tries to allocate a memory area of the specified size from the
+   *   cache.
+   *
+   * @param size is the memory area size in bytes.  It may be zero.
+   *
+   * @retval NULL The cache could not satisfy the request.  The caller shall
+   *   use the heap.
+   *
+   * @retval otherwise The begin address of the allocated memory area.
+   */
+  void *( *allocate )( size_t size );
+
+  /**
+   * @brief Tries to deallocate the memory area to the cache.
+   *
+   * @param ptr is the begin address of the memory area.
+   *
+   * @return Returns true, if the memory area was put into the cache,
+   *   otherwise false.  In the latter case, the caller shall free the memory
+   *   area to the heap.
+   */
+  bool ( *free )( void *ptr );
+
+  /**
+   * @brief Gets the cache information.
+   *
+   * @param[out] info is the cache information.
+   */
+  void ( *get_information )( Heap_Cache_information *info );
+} Malloc_Cache_handler;
+
+/**
+ * @brief The C program heap cache handler in use or NULL.
+ *
+ * The default is NULL.  The application configuration option
+ * ``CONFIGURE_MALLOC_PER_CPU_CACHE`` sets it to
+ * &_Malloc_Per_CPU_cache_handler.
+ */
+extern const Malloc_Cache_handler * const _Malloc_Cache_handler;
+
+/**
+ * @brief The per-processor small object cache handler.
+ *
+ * Each processor has a free list for a fixed set of small size classes up to
+ * 256 bytes.  Access to these free lists is protected by disabling thread
+ * dispatching on the current processor.  Empty free lists are refilled in
+ * batches from the heap and full free lists are drained in batches to the
+ * heap.  In both cases, the allocator lock is obtained once per batch.
+ *
+ * The memory held by the caches is not available to allocations of other size
+ * classes or to other processors.  The cache depth per size class and
+ * processor is bounded.
+ */
+extern const Malloc_Cache_handler _Malloc_Per_CPU_cache_handler;
+
 typedef void *(*rtems_heap_extend_handler)(
   Heap_Control *heap,
   size_t alloc_size
@@ -76,6 +76,7 @@ extern "C" {
 typedef struct {
    Objects_Control             Object;
    CORE_message_queue_Control  Message_queue;
+   CORE_message_queue_Buckets  Pending_buckets;
    bool                        linked;
    uint32_t                    open_count;
    struct sigevent             notification;
@@ -0,0 +1,216 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef _RTEMS_RECORDDRAIN_H
+#define _RTEMS_RECORDDRAIN_H
+
+#include <rtems/record.h>
+#include <rtems.h>
+
+#include <zlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSRecord
+ *
+ * @{
+ */
+
+/**
+ * @brief The record drain configuration.
+ */
+typedef struct {
+  /**
+   * @brief The file descriptor to write the record stream to.
+   *
+   * The record drain does not close the file descriptor.
+   */
+  int fd;
+
+  /**
+   * @brief The priority of the drain and writer tasks.
+   */
+  rtems_task_priority priority;
+
+  /**
+   * @brief The drain period in clock ticks.
+   */
+  rtems_interval period;
+
+  /**
+   * @brief The size in bytes of each of the two stream buffers.
+   *
+   * A value of zero selects a default size.
+   */
+  size_t buffer_size;
+
+  /**
+   * @brief If true, then the record stream is compressed with zlib,
+   *   otherwise the record stream is written as is.
+   */
+  bool compress;
+} rtems_record_drain_config;
+
+/**
+ * @brief The record drain statistics.
+ */
+typedef struct {
+  /**
+   * @brief The count of items fetched from the record buffers.
+   */
+  uint64_t item_count;
+
+  /**
+   * @brief The count of bytes written to the file descriptor.
+   */
+  uint64_t byte_count;
+
+  /**
+   * @brief The count of full stream buffers which had to wait for the writer
+   *   task.
+   */
+  uint32_t writer_waits;
+
+  /**
+   * @brief The error number of the first failed write, otherwise zero.
+   *
+   * After a write error, the record stream is still fetched, but no longer
+   * written.
+   */
+  int write_error;
+} rtems_record_drain_statistics;
+
+/**
+ * @brief The record drain control.
+ *
+ * The members are private.  Use the record drain functions to access them.
+ */
+typedef struct {
+  rtems_record_drain_config     config;
+  rtems_record_drain_statistics stats;
+  rtems_record_data             overflow[ CPU_MAXIMUM_PROCESSORS ];
+  rtems_id                      drain;
+  rtems_id                      writer;
+  rtems_id                      stopper;
+  rtems_id                      timer;
+  bool                          stop;
+  bool                          header_done;
+  bool                          writer_busy;
+  unsigned char                *buffers[ 2 ];
+  size_t                        current;
+  size_t                        used;
+  const unsigned char          *pending_data;
+  size_t                        pending;
+  rtems_record_item            *items;
+  size_t                        item_count;
+  z_stream                      stream;
+} rtems_record_drain_control;
+
+/**
+ * @brief Starts a record drain.
+ *
+ * A record drain continuously fetches the items of all processors and writes
+ * them together with a stream header and the thread names to a file
+ * descriptor.  The stream has the same format as the one produced by
+ * rtems_record_server().  If compression is enabled, then it is a zlib
+ * stream with the zlib header and the Adler-32 trailer, so it may be
+ * decompressed with inflateInit().
+ *
+ * The drain task fills one stream buffer while a writer task writes the other
+ * one, so that slow writes do not delay the fetching of items.  The producers
+ * are never stopped.  Items lost because the drain could not keep up are
+ * accounted per processor, see rtems_record_drain_get_overflow().
+ *
+ * The record drain uses two tasks and one timer which shall be accounted for
+ * in the application configuration.  The compression needs about 48KiB of
+ * heap memory.
+ *
+ * @param[out] control is the record drain control.  It shall be valid until
+ *   rtems_record_drain_stop() returns.
+ *
+ * @param config is the record drain configuration.
+ *
+ * @retval RTEMS_SUCCESSFUL The record drain was started.
+ *
+ * @retval RTEMS_NO_MEMORY There was not enough memory for the buffers.
+ *
+ * @return Other status codes of rtems_task_create() and rtems_timer_create()
+ *   may be returned.
+ */
+rtems_status_code rtems_record_drain_start(
+  rtems_record_drain_control      *control,
+  const rtems_record_drain_config *config
+);
+
+/**
+ * @brief Stops a record drain.
+ *
+ * The items available at the time of the call are fetched and written.  The
+ * compressed stream is finished.  This function returns after the last write.
+ *
+ * @param[in, out] control is the record drain control.
+ */
+void rtems_record_drain_stop( rtems_record_drain_control *control );
+
+/**
+ * @brief Gets the record drain statistics.
+ *
+ * @param control is the record drain control.
+ *
+ * @param[out] stats is the statistics.
+ */
+void rtems_record_drain_get_statistics(
+  const rtems_record_drain_control *control,
+  rtems_record_drain_statistics    *stats
+);
+
+/**
+ * @brief Gets the count of items lost on a processor.
+ *
+ * @param control is the record drain control.
+ *
+ * @param cpu_index is the processor index.
+ *
+ * @return Returns the count of items of the processor which were overwritten
+ *   before the record drain fetched them.
+ */
+rtems_record_data rtems_record_drain_get_overflow(
+  const rtems_record_drain_control *control,
+  uint32_t                          cpu_index
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_RECORDDRAIN_H */
@@ -572,7 +572,9 @@ int rtems_fdt_node_offset_by_prop_value (rtems_fdt_handle* handle,
 /**
  * Find the node with a given phandle returning the offset of the node which
  * has the given phandle value. If there is more than one node in the tree
- * with the given phandle (an invalid tree), results are undefined.
+ * with the given phandle (an invalid tree), results are undefined. The
+ * phandles are hashed when the blob is loaded so the lookup does not walk
+ * the tree.
  *
  * @param handle The FDT handle to the current blob.
  * @param phandle The phandle value.
@@ -616,6 +618,9 @@ int rtems_fdt_node_check_compatible (rtems_fdt_handle* handle,
  * the function will never locate the root node, even if it matches the
  * criterion.
  *
+ * The nodes of each compatible string are indexed when the blob is loaded so
+ * the lookup does not walk the tree.
+ *
  * @param handle The FDT handle to the current blob.
  * @param startoffset Only find nodes after this offset.
  * @param compatible The 'compatible' string to match against.
@@ -297,6 +297,22 @@ typedef uint32_t rtems_attribute;
  */
 #define RTEMS_PRIORITY_CEILING 0x00000080
 
+/* Generated from spec:/rtems/attr/if/segregated-fit */
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that the Classic API region
+ *   created by rtems_region_create() shall use the segregated fit allocation
+ *   method.
+ *
+ * @par Notes
+ * The segregated fit method provides segment allocations without alignment
+ * constraints and segment deallocations in constant time.  The index
+ * required for this method is allocated from the region memory area.
+ */
+#define RTEMS_SEGREGATED_FIT 0x00000400
+
 /* Generated from spec:/rtems/attr/if/semaphore-class */
 
 /**
@@ -146,6 +146,20 @@ static inline bool _Attributes_Is_priority(
    return ( attribute_set & RTEMS_PRIORITY ) ? true : false;
 }
 
+/**
+ *  @brief Checks if the segregated fit attribute is enabled in the
+ *  attribute_set.
+ *
+ *  This function returns TRUE if the segregated fit attribute is
+ *  enabled in the attribute_set and FALSE otherwise.
+ */
+static inline bool _Attributes_Is_segregated_fit(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_SEGREGATED_FIT ) ? true : false;
+}
+
 /**
  *  @brief Checks if the binary semaphore attribute is
  *  enabled in the attribute_set.
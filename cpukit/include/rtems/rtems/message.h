@@ -896,6 +896,237 @@ rtems_status_code rtems_message_queue_get_number_pending(
  */
 rtems_status_code rtems_message_queue_flush( rtems_id id, uint32_t *count );
 
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Gets a message buffer from the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the pointer to a ``void`` pointer object.  When the
+ *   directive call is successful, the begin address of the message content
+ *   area of the obtained message buffer will be stored in this object.
+ *
+ * This directive obtains a message buffer from the message buffer pool of the
+ * queue specified by ``id``.  The message content area of the message buffer
+ * can hold a message of the maximum length of the queue as defined by
+ * rtems_message_queue_create() or rtems_message_queue_construct().  The
+ * calling task may fill in the message in place and send it with
+ * rtems_message_queue_send_buffer().  This avoids the copy of the message
+ * content performed by rtems_message_queue_send().
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote
+ *   node.
+ *
+ * @retval ::RTEMS_TOO_MANY There was no free message buffer available.
+ *
+ * @par Notes
+ * An obtained message buffer shall be either sent with
+ * rtems_message_queue_send_buffer() or given back with
+ * rtems_message_queue_return_buffer().  While a message buffer is obtained,
+ * it is not available for pending messages.
+ *
+ * The buffer directives shall not be used while a POSIX message queue
+ * operation blocks on the same message queue.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_get_buffer( rtems_id id, void **buffer );
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts the message buffer at the rear of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the message content area of a message
+ *   buffer obtained by rtems_message_queue_get_buffer() or
+ *   rtems_message_queue_receive_buffer() from this queue.
+ *
+ * @param size is the size in bytes of the message.
+ *
+ * This directive sends the message contained in the message buffer
+ * ``buffer`` of ``size`` bytes in length to the queue specified by ``id``.
+ * If a task is waiting at the queue with rtems_message_queue_receive_buffer(),
+ * then the message buffer is handed over to the waiting task and the task is
+ * unblocked.  If a task is waiting at the queue with
+ * rtems_message_queue_receive(), then the message is copied to the waiting
+ * task's buffer, the message buffer is given back to the message buffer pool,
+ * and the task is unblocked.  If no tasks are waiting at the queue, then the
+ * message buffer is placed at the rear of the queue.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was not the begin
+ *   address of the message content area of a message buffer obtained from the
+ *   queue.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote
+ *   node.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The size of the message exceeded the maximum
+ *   message size of the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct().  The calling task keeps the message
+ *   buffer.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may unblock a task.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id id,
+  void    *buffer,
+  size_t   size
+);
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Receives a message buffer from the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the pointer to a ``void`` pointer object.  When the
+ *   directive call is successful, the begin address of the message content
+ *   area of the received message buffer will be stored in this object.
+ *
+ * @param[out] size is the pointer to a size_t object.  When the directive call
+ *   is successful, the size in bytes of the received messages will be stored
+ *   in this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive receives a message from the queue specified by ``id`` in the
+ * same way as rtems_message_queue_receive().  Instead of a copy of the
+ * message, the message buffer itself is handed over to the calling task.  The
+ * calling task may access the message in place.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``size`` parameter was NULL.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote
+ *   node.
+ *
+ * @retval ::RTEMS_UNSATISFIED The queue was empty.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to receive a message
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to receive a message.
+ *
+ * @par Notes
+ * A received message buffer shall be either given back with
+ * rtems_message_queue_return_buffer() or sent again with
+ * rtems_message_queue_send_buffer().  A message sent with
+ * rtems_message_queue_send() or rtems_message_queue_broadcast() to a task
+ * waiting in this directive needs a free message buffer.  If no free message
+ * buffer is available, then the task is not unblocked and the send fails with
+ * the ::RTEMS_TOO_MANY status.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * * The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id       id,
+  void         **buffer,
+  size_t        *size,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Returns a message buffer to the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the message content area of a message
+ *   buffer obtained by rtems_message_queue_get_buffer() or
+ *   rtems_message_queue_receive_buffer() from this queue.
+ *
+ * This directive gives the message buffer back to the message buffer pool of
+ * the queue specified by ``id``.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was not the begin
+ *   address of the message content area of a message buffer obtained from the
+ *   queue.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote
+ *   node.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_return_buffer(
+  rtems_id id,
+  void    *buffer
+);
+
 /* Generated from spec:/rtems/message/if/buffer */
 
 /**
@@ -555,6 +555,68 @@
     RTEMS_SCHEDULER_TABLE_STRONG_APA( name, obj_name )
 #endif
 
+/**
+ * @brief Defines a Work Stealing SMP Scheduler context name based on the
+ *   instantiation name.
+ *
+ * @param name is the scheduler instantiation name.
+ */
+#define SCHEDULER_WS_SMP_CONTEXT_NAME( name ) \
+  SCHEDULER_CONTEXT_NAME( WS_SMP_ ## name )
+
+/**
+ * @ingroup RTEMSApplConfigGeneralSchedulerConfiguration
+ *
+ * @brief Defines a Work Stealing SMP Scheduler instantiation.
+ *
+ * Each processor has a ready queue with one chain per priority.
+ *
+ * @param name is the scheduler instantiation name.
+ *
+ * @param prio_count is the count of priorities supported by the scheduler
+ *   instance.
+ */
+#define RTEMS_SCHEDULER_WS_SMP( name, prio_count ) \
+  static struct { \
+    Scheduler_WS_SMP_Context Base; \
+    Scheduler_WS_SMP_CPU CPU[ CONFIGURE_MAXIMUM_PROCESSORS ]; \
+    Chain_Control Ready[ CONFIGURE_MAXIMUM_PROCESSORS * ( prio_count ) ]; \
+  } SCHEDULER_WS_SMP_CONTEXT_NAME( name )
+
+/**
+ * @ingroup RTEMSApplConfigGeneralSchedulerConfiguration
+ *
+ * @brief Defines a Work Stealing SMP Scheduler entry for the scheduler table.
+ *
+ * Use this macro to define an entry for the
+ * @ref CONFIGURE_SCHEDULER_TABLE_ENTRIES application configuration option.
+ *
+ * @param name is the scheduler instantiation name.
+ *
+ * @param name is the scheduler object name.
+ */
+#define RTEMS_SCHEDULER_TABLE_WS_SMP( name, obj_name ) \
+  { \
+    &SCHEDULER_WS_SMP_CONTEXT_NAME( name ).Base.Base.Base, \
+    SCHEDULER_WS_SMP_ENTRY_POINTS, \
+    RTEMS_ARRAY_SIZE( SCHEDULER_WS_SMP_CONTEXT_NAME( name ).Ready ) \
+      / CONFIGURE_MAXIMUM_PROCESSORS - 1, \
+    ( obj_name ) \
+    SCHEDULER_CONTROL_IS_NON_PREEMPT_MODE_SUPPORTED( false ) \
+  }
+
+#ifdef CONFIGURE_SCHEDULER_WS_SMP
+  #ifndef RTEMS_SMP
+    #error "CONFIGURE_SCHEDULER_WS_SMP cannot be used if RTEMS_SMP is disabled"
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_PROCESSORS
+    #error "CONFIGURE_MAXIMUM_PROCESSORS must be defined to configure the Work Stealing SMP Scheduler"
+  #endif
+
+  #include <rtems/score/schedulerwssmp.h>
+#endif
+
 /**
  * @brief Defines a Simple Scheduler context name based on the instantiation
  *   name.
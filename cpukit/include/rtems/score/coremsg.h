@@ -40,6 +40,7 @@
 
 #include <rtems/score/coremsgbuffer.h>
 #include <rtems/score/isrlock.h>
+#include <rtems/score/prioritybitmap.h>
 #include <rtems/score/threadq.h>
 #include <rtems/score/watchdog.h>
 
@@ -75,6 +76,37 @@ extern "C" {
  */
 #define RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  /**
+   *  This is the count of message priorities which have a dedicated pending
+   *  message bucket.  It covers the POSIX message priorities from zero up to
+   *  and including MQ_PRIO_MAX.
+   */
+  #define CORE_MESSAGE_QUEUE_PRIORITY_COUNT 33
+
+  /**
+   *  @brief The pending message buckets of a message queue.
+   *
+   *  Only message queues which receive messages with a message priority need
+   *  the buckets, see _CORE_message_queue_Enable_buckets().  The storage is
+   *  provided by the API object, so that other message queues do not pay for
+   *  it.
+   */
+  typedef struct {
+    /** This bit map indicates which pending message buckets are not empty.
+     *  The bit map priority zero corresponds to the most important message
+     *  priority.
+     */
+    Priority_bit_map_Control         Map;
+    /** These chains are the pending message buckets.  Each bucket contains
+     *  the pending messages of one message priority in FIFO order.
+     */
+    Chain_Control                    Buckets[
+      CORE_MESSAGE_QUEUE_PRIORITY_COUNT
+    ];
+  } CORE_message_queue_Buckets;
+#endif
+
 typedef struct CORE_message_queue_Control CORE_message_queue_Control;
 
 /**
@@ -132,10 +164,17 @@ struct CORE_message_queue_Control {
    *  sent via this queue.
    */
   size_t                             maximum_message_size;
-  /** This chain is the set of pending messages.  It may be ordered by
-   *  message priority or in FIFO order.
+  /** This chain is the set of pending messages submitted by send and
+   *  urgent requests.  Urgent messages are prepended and sent messages are
+   *  appended.
    */
   Chain_Control                      Pending_messages;
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    /** This member references the pending message buckets.  It is NULL if
+     *  the message queue receives no messages with a message priority.
+     */
+    CORE_message_queue_Buckets      *Pending_buckets;
+  #endif
   /** This is the address of the memory allocated for message buffers.
    *  It is allocated are part of message queue initialization and freed
    *  as part of destroying it.
@@ -42,6 +42,7 @@
 #include <rtems/score/coremsg.h>
 #include <rtems/score/status.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/prioritybitmapimpl.h>
 #include <rtems/score/threaddispatch.h>
 #include <rtems/score/threadqimpl.h>
 
@@ -74,6 +75,18 @@ extern "C" {
  */
 #define  CORE_MESSAGE_QUEUE_URGENT_REQUEST INT_MIN
 
+/**
+ *  @brief This thread wait option indicates that the receiver provided a
+ *  buffer to which the message content is copied.
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_COPY 0
+
+/**
+ *  @brief This thread wait option indicates that the receiver takes over the
+ *  message buffer of the received message.
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_BUFFER 1
+
 /**
  *  @brief The modes in which a message may be submitted to a message queue.
  *
@@ -334,6 +347,95 @@ Status_Control _CORE_message_queue_Seize(
   Thread_queue_Context       *queue_context
 );
 
+/**
+ * @brief Seizes a message buffer from the message queue.
+ *
+ * In contrast to _CORE_message_queue_Seize(), the message content is not
+ * copied.  The ownership of the message buffer is transferred to the caller.
+ * The caller shall give it back to the message queue with
+ * _CORE_message_queue_Submit_buffer() or
+ * _CORE_message_queue_Free_message_buffer().
+ *
+ * This function shall not be used for message queues with blocking senders.
+ *
+ * @param[in, out] the_message_queue The message queue to seize a message
+ *   buffer from.
+ * @param executing The executing thread.
+ * @param[out] buffer The pointer to the message content of the seized
+ *   message buffer is stored in this object.
+ * @param[out] size_p The size of the message is stored in this object.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if the message queue is empty.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message buffer was successfully seized from
+ *   the message queue.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no
+ *   pending message.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control  *the_message_queue,
+  Thread_Control              *executing,
+  void                       **buffer,
+  size_t                      *size_p,
+  bool                         wait,
+  Thread_queue_Context        *queue_context
+);
+
+/**
+ * @brief Submits a message buffer owned by the caller to the message queue.
+ *
+ * The message content shall be already present in the message buffer.  If a
+ * thread waits to receive a message buffer, then the ownership of the message
+ * buffer is transferred to this thread.  If a thread waits to receive a copy
+ * of the message, then the message content is copied and the message buffer
+ * is freed.  Otherwise, the message buffer is inserted into the message queue
+ * according to the submit type.
+ *
+ * This function shall not be used for message queues with blocking senders.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param[in, out] the_message The message buffer to submit.
+ * @param size The size of the message.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message buffer was successfully submitted to
+ *   the message queue.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size was too big.  The
+ *   caller retains the ownership of the message buffer.
+ */
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control      *the_message_queue,
+  CORE_message_queue_Buffer       *the_message,
+  size_t                           size,
+  CORE_message_queue_Submit_types  submit_type,
+  Thread_queue_Context            *queue_context
+);
+
+/**
+ * @brief Inserts a message buffer into the message queue.
+ *
+ * Inserts the message into the message queue according to the submit type.
+ * The message content shall be already present in the message buffer.
+ *
+ * @param[in, out] the_message_queue The message queue to insert a message in.
+ * @param[in, out] the_message The message to insert in the message queue.
+ * @param content_size The message content size in bytes.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ */
+void _CORE_message_queue_Insert_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer         *the_message,
+  size_t                             content_size,
+  CORE_message_queue_Submit_types    submit_type
+);
+
 /**
  * @brief Inserts a message into the message queue.
  *
@@ -525,6 +627,75 @@ static inline void _CORE_message_queue_Free_message_buffer (
   _Chain_Append_unprotected( &the_message_queue->Inactive_messages, &the_message->Node );
 }
 
+/**
+ * @brief Lends a message buffer from the inactive message buffer chain.
+ *
+ * The message buffer is marked as lent through an off chain node.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ *
+ * @retval pointer The lent message buffer.
+ * @retval NULL The inactive message buffer chain is empty.
+ */
+static inline CORE_message_queue_Buffer *_CORE_message_queue_Lend_buffer(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  CORE_message_queue_Buffer *the_message;
+
+  the_message =
+    _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+
+  if ( the_message != NULL ) {
+    _Chain_Set_off_chain( &the_message->Node );
+  }
+
+  return the_message;
+}
+
+/**
+ * @brief Gets the lent message buffer associated with the message content.
+ *
+ * @param the_message_queue The message queue to operate upon.
+ * @param buffer The begin address of the message content.
+ *
+ * @retval pointer The lent message buffer of the message content.
+ * @retval NULL The address is not the begin of the message content of a
+ *   message buffer of the message queue or the message buffer is not lent.
+ */
+static inline CORE_message_queue_Buffer *_CORE_message_queue_Get_lent_buffer(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  CORE_message_queue_Buffer *the_message;
+  uintptr_t                  offset;
+  size_t                     buffer_size;
+
+  buffer_size = RTEMS_ALIGN_UP(
+    the_message_queue->maximum_message_size,
+    sizeof( uintptr_t )
+  ) + sizeof( CORE_message_queue_Buffer );
+  offset = (uintptr_t) buffer - sizeof( CORE_message_queue_Buffer ) -
+    (uintptr_t) the_message_queue->message_buffers;
+
+  if (
+    offset % buffer_size != 0 ||
+      offset / buffer_size >= the_message_queue->maximum_pending_messages
+  ) {
+    return NULL;
+  }
+
+  the_message = (CORE_message_queue_Buffer *)
+    ( (uintptr_t) the_message_queue->message_buffers + offset );
+
+  if ( !_Chain_Is_node_off_chain( &the_message->Node ) ) {
+    return NULL;
+  }
+
+  return the_message;
+}
+
 /**
  * @brief Gets message priority.
  *
@@ -549,11 +720,87 @@ static inline int _CORE_message_queue_Get_message_priority (
   #endif
 }
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+/**
+ * @brief Enables the pending message buckets of the message queue.
+ *
+ * This function shall be called right after a successful
+ * _CORE_message_queue_Initialize() for message queues which receive messages
+ * with a message priority.
+ *
+ * @param[in, out] the_message_queue The message queue to enable the pending
+ *   message buckets for.
+ *
+ * @param[out] buckets The storage area for the pending message buckets.  It
+ *   shall be valid for the lifetime of the message queue.
+ */
+static inline void _CORE_message_queue_Enable_buckets(
+  CORE_message_queue_Control *the_message_queue,
+  CORE_message_queue_Buckets *buckets
+)
+{
+  size_t i;
+
+  _Priority_bit_map_Initialize( &buckets->Map );
+
+  for ( i = 0; i < CORE_MESSAGE_QUEUE_PRIORITY_COUNT; ++i ) {
+    _Chain_Initialize_empty( &buckets->Buckets[ i ] );
+  }
+
+  the_message_queue->Pending_buckets = buckets;
+}
+
+/**
+ * @brief Gets the pending message bucket index of the message priority.
+ *
+ * @param priority The message priority.  It shall be in the range of
+ *   -(CORE_MESSAGE_QUEUE_PRIORITY_COUNT - 1) up to and including zero.
+ *
+ * @return The pending message bucket index.  The most important message
+ *   priority has the bucket index zero.
+ */
+static inline unsigned int _CORE_message_queue_Get_bucket_index(
+  int priority
+)
+{
+  _Assert( priority <= 0 );
+  _Assert( priority > -CORE_MESSAGE_QUEUE_PRIORITY_COUNT );
+
+  return (unsigned int) ( priority + CORE_MESSAGE_QUEUE_PRIORITY_COUNT - 1 );
+}
+
+/**
+ * @brief Checks if the first message of the pending messages chain is an
+ *   urgent message.
+ *
+ * @param the_message_queue The message queue to check.
+ *
+ * @retval true The first message is an urgent message.
+ * @retval false Otherwise.
+ */
+static inline bool _CORE_message_queue_Is_urgent_pending(
+  const CORE_message_queue_Control *the_message_queue
+)
+{
+  const Chain_Control *pending;
+
+  pending = &the_message_queue->Pending_messages;
+
+  return !_Chain_Is_empty( pending ) &&
+    _CORE_message_queue_Get_message_priority(
+      (const CORE_message_queue_Buffer *) _Chain_Immutable_first( pending )
+    ) == CORE_MESSAGE_QUEUE_URGENT_REQUEST;
+}
+#endif
+
 /**
  * @brief Gets first message of message queue and removes it.
  *
  * This function removes the first message from the_message_queue
- * and returns a pointer to it.
+ * and returns a pointer to it.  Urgent messages precede the messages of the
+ * pending message buckets which precede the sent messages.  The highest
+ * priority non-empty bucket is determined through the bit map, so the
+ * operation has a constant execution time.
  *
  * @param[in, out] the_message_queue The message queue to get the first message from.
  *
@@ -565,8 +812,42 @@ static inline
   CORE_message_queue_Control *the_message_queue
 )
 {
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  CORE_message_queue_Buckets   *buckets;
+  Priority_bit_map_Information  bit_map_info;
+  Chain_Control                *bucket;
+  Chain_Node                   *node;
+  unsigned int                  index;
+
+  buckets = the_message_queue->Pending_buckets;
+
+  if (
+    buckets == NULL ||
+      _Priority_bit_map_Is_empty( &buckets->Map ) ||
+      _CORE_message_queue_Is_urgent_pending( the_message_queue )
+  ) {
+    return (CORE_message_queue_Buffer *)
+      _Chain_Get_unprotected( &the_message_queue->Pending_messages );
+  }
+
+  index = _Priority_bit_map_Get_highest( &buckets->Map );
+  bucket = &buckets->Buckets[ index ];
+  node = _Chain_Get_first_unprotected( bucket );
+
+  if ( _Chain_Is_empty( bucket ) ) {
+    _Priority_bit_map_Initialize_information(
+      &buckets->Map,
+      &bit_map_info,
+      index
+    );
+    _Priority_bit_map_Remove( &buckets->Map, &bit_map_info );
+  }
+
+  return (CORE_message_queue_Buffer *) node;
+#else
   return (CORE_message_queue_Buffer *)
     _Chain_Get_unprotected( &the_message_queue->Pending_messages );
+#endif
 }
 
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
@@ -635,8 +916,9 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
   Thread_queue_Context            *queue_context
 )
 {
-  Thread_queue_Heads *heads;
-  Thread_Control     *the_thread;
+  Thread_queue_Heads        *heads;
+  Thread_Control            *the_thread;
+  CORE_message_queue_Buffer *the_message;
 
   /*
    *  If there are pending messages, then there can't be threads
@@ -659,6 +941,22 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
     return NULL;
   }
 
+  /*
+   *  A thread waiting to receive a message buffer needs a message buffer
+   *  from the inactive message buffer chain.  If none is available, then the
+   *  message queue is effectively full.
+   */
+  the_thread = ( *the_message_queue->operations->first )( heads );
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_BUFFER ) {
+    the_message = _CORE_message_queue_Lend_buffer( the_message_queue );
+
+    if ( the_message == NULL ) {
+      return NULL;
+    }
+  } else {
+    the_message = NULL;
+  }
+
   the_thread = ( *the_message_queue->operations->surrender )(
     &the_message_queue->Wait_queue.Queue,
     heads,
@@ -669,11 +967,21 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
    *(size_t *) the_thread->Wait.return_argument = size;
    the_thread->Wait.count = (uint32_t) submit_type;
 
-  _CORE_message_queue_Copy_buffer(
-    buffer,
-    the_thread->Wait.return_argument_second.mutable_object,
-    size
-  );
+  if ( the_message != NULL ) {
+    the_message->size = size;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    the_message->priority = submit_type;
+#endif
+    _CORE_message_queue_Copy_buffer( buffer, the_message->buffer, size );
+    *(void **) the_thread->Wait.return_argument_second.mutable_object =
+      the_message->buffer;
+  } else {
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+  }
 
   _Thread_queue_Resume(
     &the_message_queue->Wait_queue.Queue,
@@ -0,0 +1,248 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreFutex
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreFutex which extend the futex operations defined by Newlib
+ *   in <sys/lock.h>.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_FUTEX_H
+#define _RTEMS_SCORE_FUTEX_H
+
+#include <sys/lock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSScoreFutex
+ *
+ * @{
+ */
+
+/**
+ * @brief This futex operation sets the futex state to the operation argument.
+ */
+#define FUTEX_OP_SET 0
+
+/**
+ * @brief This futex operation adds the operation argument to the futex state.
+ */
+#define FUTEX_OP_ADD 1
+
+/**
+ * @brief This futex operation performs a bitwise or of the futex state and
+ *   the operation argument.
+ */
+#define FUTEX_OP_OR 2
+
+/**
+ * @brief This futex operation performs a bitwise and of the futex state and
+ *   the complement of the operation argument.
+ */
+#define FUTEX_OP_ANDN 3
+
+/**
+ * @brief This futex operation performs a bitwise exclusive or of the futex
+ *   state and the operation argument.
+ */
+#define FUTEX_OP_XOR 4
+
+/**
+ * @brief If this flag is set in the futex operation, then the operation
+ *   argument is ( 1 << operation argument ).
+ */
+#define FUTEX_OP_OPARG_SHIFT 8
+
+/**
+ * @brief This comparison is true, if the previous futex state is
+ *   equal to the comparison argument.
+ */
+#define FUTEX_OP_CMP_EQ 0
+
+/**
+ * @brief This comparison is true, if the previous futex state is
+ *   not equal to the comparison argument.
+ */
+#define FUTEX_OP_CMP_NE 1
+
+/**
+ * @brief This comparison is true, if the previous futex state is
+ *   less than the comparison argument.
+ */
+#define FUTEX_OP_CMP_LT 2
+
+/**
+ * @brief This comparison is true, if the previous futex state is
+ *   less than or equal to the comparison argument.
+ */
+#define FUTEX_OP_CMP_LE 3
+
+/**
+ * @brief This comparison is true, if the previous futex state is
+ *   greater than the comparison argument.
+ */
+#define FUTEX_OP_CMP_GT 4
+
+/**
+ * @brief This comparison is true, if the previous futex state is
+ *   greater than or equal to the comparison argument.
+ */
+#define FUTEX_OP_CMP_GE 5
+
+/**
+ * @brief Encodes the operation for _Futex_Wake_op().
+ *
+ * The encoding is compatible with the ``FUTEX_OP()`` macro provided by Linux.
+ *
+ * @param op is the futex operation, for example #FUTEX_OP_ADD.
+ *
+ * @param oparg is the 12-bit operation argument.
+ *
+ * @param cmp is the comparison, for example #FUTEX_OP_CMP_GT.
+ *
+ * @param cmparg is the 12-bit comparison argument.
+ */
+#define FUTEX_OP( op, oparg, cmp, cmparg ) \
+  ( ( ( ( op ) & 0xf ) << 28 ) | ( ( ( cmp ) & 0xf ) << 24 ) | \
+    ( ( ( oparg ) & 0xfff ) << 12 ) | ( ( cmparg ) & 0xfff ) )
+
+/**
+ * @brief Performs the ``FUTEX_REQUEUE`` operation.
+ *
+ * Wakes up at most the specified count of threads waiting on the first futex
+ * object and moves at most the specified count of the remaining waiting
+ * threads to the second futex object without waking them up.
+ *
+ * @param[in, out] _futex is the futex object.
+ *
+ * @param[in, out] _futex2 is the futex object to receive the moved threads.
+ *
+ * @param wake_count is the maximum count of threads to wake up.
+ *
+ * @param requeue_count is the maximum count of threads to move.
+ *
+ * @return Returns the count of woken up threads.
+ */
+int _Futex_Requeue(
+  struct _Futex_Control *_futex,
+  struct _Futex_Control *_futex2,
+  int                    wake_count,
+  int                    requeue_count
+);
+
+/**
+ * @brief Performs the ``FUTEX_CMP_REQUEUE`` operation.
+ *
+ * This is a variant of _Futex_Requeue() which checks that the futex state is
+ * equal to the expected value before the threads are woken up and moved.
+ *
+ * @param[in, out] _futex is the futex object.
+ *
+ * @param[in, out] _futex2 is the futex object to receive the moved threads.
+ *
+ * @param[in] uaddr is the address to the futex state.
+ *
+ * @param val is the expected futex state value.
+ *
+ * @param wake_count is the maximum count of threads to wake up.
+ *
+ * @param requeue_count is the maximum count of threads to move.
+ *
+ * @param[out] count is the pointer to an int object.  If the operation was
+ *   performed, then the count of woken up and moved threads is stored in this
+ *   object.
+ *
+ * @retval 0 The operation was performed.
+ *
+ * @retval EAGAIN The futex state was not equal to the expected value.
+ */
+int _Futex_Cmp_requeue(
+  struct _Futex_Control *_futex,
+  struct _Futex_Control *_futex2,
+  const int             *uaddr,
+  int                    val,
+  int                    wake_count,
+  int                    requeue_count,
+  int                   *count
+);
+
+/**
+ * @brief Performs the ``FUTEX_WAKE_OP`` operation.
+ *
+ * Atomically modifies the state of the second futex object according to the
+ * encoded operation, see FUTEX_OP().  Wakes up at most the specified count of
+ * threads waiting on the first futex object.  If the comparison of the
+ * previous state of the second futex object with the comparison argument is
+ * true, then at most the second specified count of threads waiting on the
+ * second futex object are woken up.
+ *
+ * @param[in, out] _futex is the futex object.
+ *
+ * @param[in, out] _futex2 is the second futex object.
+ *
+ * @param[in, out] uaddr2 is the address to the state of the second futex
+ *   object.
+ *
+ * @param wake_count is the maximum count of threads to wake up on the first
+ *   futex object.
+ *
+ * @param wake_count2 is the maximum count of threads to wake up on the second
+ *   futex object.
+ *
+ * @param op is the encoded operation.
+ *
+ * @param[out] woken is the pointer to an int object.  If the operation was
+ *   performed, then the count of woken up threads is stored in this object.
+ *
+ * @retval 0 The operation was performed.
+ *
+ * @retval ENOSYS The operation or comparison is invalid.
+ */
+int _Futex_Wake_op(
+  struct _Futex_Control *_futex,
+  struct _Futex_Control *_futex2,
+  int                   *uaddr2,
+  int                    wake_count,
+  int                    wake_count2,
+  int                    op,
+  int                   *woken
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_FUTEX_H */
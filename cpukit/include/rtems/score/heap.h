@@ -148,6 +148,12 @@ extern "C" {
  * last block appears as used for the _Heap_Is_used() and _Heap_Is_free()
  * functions.
  *
+ * Optionally, a heap may use a segregated fit index instead of the first fit
+ * method, see _Heap_Enable_segregated_fit().  In this case the free list is
+ * kept in ascending size class order and allocations and deallocations of
+ * blocks without alignment or boundary constraints have a constant execution
+ * time which is independent of the fragmentation of the heap.
+ *
  * @{
  */
 
@@ -333,6 +339,63 @@ struct Heap_Block {
   Heap_Block *prev;
 };
 
+/**
+ * @brief Base two logarithm of the second level index count of the segregated
+ * fit index.
+ */
+#define HEAP_SEGREGATED_SL_INDEX_COUNT_LOG2 3
+
+/**
+ * @brief Second level index count of the segregated fit index.
+ *
+ * Each first level size class (a power of two range) is subdivided into this
+ * count of linear size classes.
+ */
+#define HEAP_SEGREGATED_SL_INDEX_COUNT \
+  ( 1U << HEAP_SEGREGATED_SL_INDEX_COUNT_LOG2 )
+
+/**
+ * @brief First level index count of the segregated fit index.
+ *
+ * There is one first level size class for each bit of a block size.
+ */
+#define HEAP_SEGREGATED_FL_INDEX_COUNT ( 8 * sizeof( uintptr_t ) )
+
+/**
+ * @brief Segregated fit index of a heap.
+ *
+ * The index provides a two-level size class bitmap for the free blocks of a
+ * heap (this is similar to the Two-Level Segregated Fit allocator).  The free
+ * list of the heap is kept in ascending size class order and the index
+ * contains the first free block of each non-empty size class.  This enables
+ * allocations and deallocations in constant time.
+ *
+ * @see _Heap_Enable_segregated_fit().
+ */
+typedef struct {
+  /**
+   * @brief The first level bitmap.
+   *
+   * Bit i is set if and only if the second level bitmap i is not zero.
+   */
+  uintptr_t fl_bitmap;
+
+  /**
+   * @brief The second level bitmaps.
+   *
+   * Bit j of bitmap i is set if and only if the size class (i, j) contains at
+   * least one free block.
+   */
+  uint32_t sl_bitmap[ HEAP_SEGREGATED_FL_INDEX_COUNT ];
+
+  /**
+   * @brief The first free block of each size class or NULL if the size class
+   * is empty.
+   */
+  Heap_Block *first[ HEAP_SEGREGATED_FL_INDEX_COUNT ]
+    [ HEAP_SEGREGATED_SL_INDEX_COUNT ];
+} Heap_Segregated_index;
+
 /**
  * @brief Control block used to manage a heap.
  */
@@ -345,6 +408,7 @@ struct Heap_Control {
   Heap_Block *first_block;
   Heap_Block *last_block;
   Heap_Statistics stats;
+  Heap_Segregated_index *segregated;
   #ifdef HEAP_PROTECTION
     Heap_Protection Protection;
   #endif
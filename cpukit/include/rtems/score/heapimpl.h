@@ -118,6 +118,26 @@ uintptr_t _Heap_Initialize(
   uintptr_t page_size
 );
 
+/**
+ * @brief Enables the segregated fit method for the heap.
+ *
+ * The segregated fit index is allocated from the heap itself.  Afterwards,
+ * allocations without alignment or boundary constraints and deallocations
+ * have a constant execution time.  There is no way to go back to the first
+ * fit method.  Enabling the segregated fit method for a heap which uses it
+ * already has no effect.
+ *
+ * This function shall be called with the heap being protected against
+ * concurrent access, for example immediately after _Heap_Initialize().
+ *
+ * @param[in, out] heap The heap to operate upon.
+ *
+ * @retval true The heap uses the segregated fit method.
+ * @retval false There was not enough memory available in the heap to allocate
+ *   the segregated fit index.
+ */
+bool _Heap_Enable_segregated_fit( Heap_Control *heap );
+
 /**
  * @brief Allocates an aligned memory area with boundary constraint.
  *
@@ -824,6 +844,208 @@ static inline uintptr_t _Heap_Min( uintptr_t a, uintptr_t b )
   return a < b ? a : b;
 }
 
+/**
+ * @brief Returns the index of the most significant bit set in the value.
+ *
+ * @param value The value.  It shall not be zero.
+ *
+ * @return The index of the most significant bit set in @a value.
+ */
+static inline unsigned int _Heap_Segregated_fls( uintptr_t value )
+{
+  return (unsigned int) ( 8 * sizeof( unsigned long ) - 1 )
+    - (unsigned int) __builtin_clzl( (unsigned long) value );
+}
+
+/**
+ * @brief Maps the block size to the size class of the segregated fit index.
+ *
+ * @param size The block size.  It shall not be zero.
+ * @param[out] fl Stores the first level index of the size class.
+ * @param[out] sl Stores the second level index of the size class.
+ */
+static inline void _Heap_Segregated_mapping(
+  uintptr_t     size,
+  unsigned int *fl,
+  unsigned int *sl
+)
+{
+  unsigned int const msb = _Heap_Segregated_fls( size );
+  uintptr_t shifted_size;
+
+  if ( msb >= HEAP_SEGREGATED_SL_INDEX_COUNT_LOG2 ) {
+    shifted_size = size >> ( msb - HEAP_SEGREGATED_SL_INDEX_COUNT_LOG2 );
+  } else {
+    shifted_size = size << ( HEAP_SEGREGATED_SL_INDEX_COUNT_LOG2 - msb );
+  }
+
+  *fl = msb;
+  *sl = (unsigned int) shifted_size - HEAP_SEGREGATED_SL_INDEX_COUNT;
+}
+
+/**
+ * @brief Searches the first free block of the first non-empty size class
+ * which is greater than or equal to the specified size class.
+ *
+ * @param index The segregated fit index.
+ * @param fl The first level index of the size class.
+ * @param sl The second level index of the size class.  It may be equal to
+ *   ::HEAP_SEGREGATED_SL_INDEX_COUNT to search beginning with the next first
+ *   level size class.
+ *
+ * @retval NULL There is no such free block.
+ *
+ * @return Returns the first free block of the first non-empty size class
+ *   greater than or equal to the specified size class.
+ */
+static inline Heap_Block *_Heap_Segregated_search(
+  const Heap_Segregated_index *index,
+  unsigned int                 fl,
+  unsigned int                 sl
+)
+{
+  uint32_t sl_bitmap = index->sl_bitmap[ fl ] & ( UINT32_MAX << sl );
+
+  if ( sl_bitmap == 0 ) {
+    uintptr_t fl_bitmap;
+
+    ++fl;
+
+    if ( fl >= HEAP_SEGREGATED_FL_INDEX_COUNT ) {
+      return NULL;
+    }
+
+    fl_bitmap = index->fl_bitmap & ( UINTPTR_MAX << fl );
+
+    if ( fl_bitmap == 0 ) {
+      return NULL;
+    }
+
+    fl = (unsigned int) __builtin_ctzl( (unsigned long) fl_bitmap );
+    sl_bitmap = index->sl_bitmap[ fl ];
+  }
+
+  sl = (unsigned int) __builtin_ctz( sl_bitmap );
+
+  return index->first[ fl ][ sl ];
+}
+
+/**
+ * @brief Inserts the free block into the free list of a heap using the
+ * segregated fit method.
+ *
+ * The size of the block shall be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] block The block to insert.
+ */
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Removes the free block from the free list of a heap using the
+ * segregated fit method.
+ *
+ * The size of the block shall be the size it had when it was inserted.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] block The block to remove.
+ */
+void _Heap_Segregated_remove( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Inserts the free block into the free list of the heap.
+ *
+ * In case the heap uses the first fit method, the block is inserted after the
+ * anchor block, otherwise the anchor block is ignored and the block is inserted
+ * according to its size class.  The size of the block shall be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] free_list_anchor The block after which the new block is
+ *   inserted in case the heap uses the first fit method.
+ * @param[in, out] block The block to insert.
+ */
+static inline void _Heap_Free_list_insert_block(
+  Heap_Control *heap,
+  Heap_Block   *free_list_anchor,
+  Heap_Block   *block
+)
+{
+  if ( heap->segregated != NULL ) {
+    _Heap_Segregated_insert( heap, block );
+  } else {
+    _Heap_Free_list_insert_after( free_list_anchor, block );
+  }
+}
+
+/**
+ * @brief Removes the free block from the free list of the heap.
+ *
+ * The size of the block shall be the size it had when it was inserted.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] block The block to remove.
+ */
+static inline void _Heap_Free_list_remove_block(
+  Heap_Control *heap,
+  Heap_Block   *block
+)
+{
+  if ( heap->segregated != NULL ) {
+    _Heap_Segregated_remove( heap, block );
+  } else {
+    _Heap_Free_list_remove( block );
+  }
+}
+
+/**
+ * @brief Replaces one free block in the free list of the heap by another.
+ *
+ * The size of the new block shall be valid.  The size of the old block shall
+ * be the size it had when it was inserted.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] old_block The block in the free list to replace.
+ * @param[in, out] new_block The block that should replace @a old_block.
+ */
+static inline void _Heap_Free_list_replace_block(
+  Heap_Control *heap,
+  Heap_Block   *old_block,
+  Heap_Block   *new_block
+)
+{
+  if ( heap->segregated != NULL ) {
+    _Heap_Segregated_remove( heap, old_block );
+    _Heap_Segregated_insert( heap, new_block );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Sets the size of a block which is in the free list of the heap.
+ *
+ * The previous block of a free block is always used, so the
+ * @c HEAP_PREV_BLOCK_USED flag is set.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] block The free block.
+ * @param size The new size of the block.
+ */
+static inline void _Heap_Free_list_set_block_size(
+  Heap_Control *heap,
+  Heap_Block   *block,
+  uintptr_t     size
+)
+{
+  if ( heap->segregated != NULL ) {
+    _Heap_Segregated_remove( heap, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_Segregated_insert( heap, block );
+  } else {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  }
+}
+
 #ifdef RTEMS_DEBUG
   #define RTEMS_HEAP_DEBUG
 #endif
@@ -159,13 +159,56 @@ typedef struct {
   uintptr_t total;
 } Heap_Information;
 
+/**
+ * @brief Information about blocks held in caches of a heap user.
+ *
+ * The heap itself has no caches.  Users of a heap, for example the C program
+ * heap with the optional per-processor caches, may keep allocated blocks in
+ * caches to satisfy allocation requests without the heap lock.  From the heap
+ * point of view these blocks are used blocks.
+ */
+typedef struct {
+  /**
+   * @brief Current number of blocks held in caches.
+   */
+  uintptr_t blocks;
+
+  /**
+   * @brief Current total size in bytes of the blocks held in caches.
+   */
+  uintptr_t total;
+
+  /**
+   * @brief Number of allocations satisfied by a cache.
+   */
+  uint64_t allocs;
+
+  /**
+   * @brief Number of deallocations which put the block into a cache.
+   */
+  uint64_t frees;
+
+  /**
+   * @brief Number of cache refills from the heap.
+   */
+  uint64_t refills;
+
+  /**
+   * @brief Number of cache drains to the heap.
+   */
+  uint64_t drains;
+} Heap_Cache_information;
+
 /**
  * @brief Information block returned by _Heap_Get_information().
+ *
+ * _Heap_Get_information() sets the cache information to zero.
  */
 typedef struct {
   Heap_Information Free;
   Heap_Information Used;
   Heap_Statistics Stats;
+  Heap_Cache_information Cache;
 } Heap_Information_block;
 
 /** @} */
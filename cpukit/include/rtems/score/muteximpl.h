@@ -55,6 +55,11 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief These are the thread queue operations of the system lock mutexes.
+ */
+#define MUTEX_TQ_OPERATIONS &_Thread_queue_Operations_priority_inherit
+
 typedef struct {
   Thread_queue_Syslock_queue Queue;
 } Mutex_Control;
@@ -41,6 +41,7 @@
 #define _RTEMS_SCORE_OBJECTDATA_H
 
 #include <rtems/score/object.h>
+#include <rtems/score/atomic.h>
 #include <rtems/score/chainimpl.h>
 #include <rtems/score/rbtree.h>
 
@@ -184,6 +185,60 @@ typedef void ( *Objects_Thread_queue_Extract_callout )(
 );
 #endif
 
+/**
+ * @brief This structure represents a slot of an object name index.
+ */
+typedef struct {
+  /**
+   * @brief This is the hash value of the object name.
+   */
+  uint32_t hash;
+
+  /**
+   * @brief This is the object index of the object or zero if the slot is
+   *   empty.
+   */
+  Objects_Maximum index;
+} Objects_Name_index_slot;
+
+/**
+ * @brief This structure represents an object name index.
+ *
+ * The name index is an open addressing hash table with linear probing.  It
+ * maps the name of each active object with a non-empty name to the object
+ * index.  The count of slots is twice the maximum object count of the API
+ * class.
+ */
+typedef struct {
+  /**
+   * @brief This sequence number is odd while the name index is modified.
+   *
+   * Name lookups without the allocator lock use it to detect concurrent
+   * modifications.
+   */
+  Atomic_Uint sequence;
+
+  /**
+   * @brief This is the count of slots.
+   */
+  uint32_t size;
+
+  /**
+   * @brief These are the slots.
+   */
+  Objects_Name_index_slot slots[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Objects_Name_index;
+
+/**
+ * @brief Returns the size in bytes of an object name index for the
+ *   specified maximum object count.
+ *
+ * @param _max is the maximum object count.
+ */
+#define OBJECTS_NAME_INDEX_SIZE( _max ) \
+  ( sizeof( Objects_Name_index ) \
+    + 2 * ( _max ) * sizeof( Objects_Name_index_slot ) )
+
 typedef struct Objects_Information Objects_Information;
 
 /**
@@ -330,6 +385,30 @@ struct Objects_Information {
    */
   RBTree_Control Global_by_name;
 #endif
+
+  /**
+   * @brief This is the name index of this API class.
+   *
+   * This member is statically initialized to NULL.  If the name index is
+   * enabled by the CONFIGURE_OBJECTS_NAME_INDEX application configuration
+   * option, then _Objects_Initialize_information() allocates the name index
+   * for Classic API classes and classes with string names.
+   * _Objects_Extend_information() replaces the name index with a larger one
+   * on demand.  Once present, the name index is never removed.
+   */
+  Objects_Name_index *name_index;
+
+#if defined(RTEMS_SMP)
+  /**
+   * @brief This is the count of name lookups which currently use the name
+   *   index without owning the allocator lock.
+   *
+   * This member is statically initialized to zero.
+   * _Objects_Name_index_replace() waits until this count is zero before it
+   * frees the previous name index.
+   */
+  Atomic_Uint name_index_readers;
+#endif
 };
 
 /**
@@ -105,6 +105,14 @@ extern uint16_t _Objects_Maximum_nodes;
 extern Objects_Information ** const
 _Objects_Information_table[ OBJECTS_APIS_LAST + 1 ];
 
+/**
+ * @brief Indicates if the object name index is enabled.
+ *
+ * This constant is provided by the application configuration via
+ * <rtems/confdefs.h>, see CONFIGURE_OBJECTS_NAME_INDEX.
+ */
+extern const bool _Objects_Name_index_is_enabled;
+
 /**
  * @brief Extends an object class information record.
  *
@@ -444,6 +452,132 @@ size_t _Objects_Name_to_string(
   size_t        buffer_size
 );
 
+/**
+ * @brief Initializes the name index of the object information.
+ *
+ * The name index is only initialized for Classic API classes and classes with
+ * string names which have at least one object.  In case there is not enough
+ * workspace available for the name index, then a fatal error occurs.
+ *
+ * @param[in, out] information is the object information.
+ */
+void _Objects_Name_index_initialize( Objects_Information *information );
+
+/**
+ * @brief Allocates an empty name index for the specified maximum object
+ *   count.
+ *
+ * This function is used by _Objects_Extend_information() to allocate the name
+ * index before the object information is extended, so that the extension can
+ * fail without side-effects.
+ *
+ * @param maximum is the maximum object count.
+ *
+ * @return Returns the allocated name index.  NULL is returned, if there is
+ *   not enough workspace available.
+ */
+Objects_Name_index *_Objects_Name_index_allocate( Objects_Maximum maximum );
+
+/**
+ * @brief Replaces the name index of the object information.
+ *
+ * This function is used by _Objects_Extend_information() after the tables of
+ * the object information were extended.  The new name index is filled with
+ * the objects of the local table.  The previous name index is freed once no
+ * name lookup uses it any longer.
+ *
+ * @param[in, out] information is the object information.  The name index
+ *   shall be present.
+ *
+ * @param[in, out] name_index is the new name index.  It shall be allocated by
+ *   _Objects_Name_index_allocate() for the current maximum object count of
+ *   the object information.
+ */
+void _Objects_Name_index_replace(
+  Objects_Information *information,
+  Objects_Name_index  *name_index
+);
+
+/**
+ * @brief Inserts the object into the name index of the object information.
+ *
+ * Objects with an empty name are not inserted.  The caller shall own the
+ * allocator lock or call this function before multitasking.
+ *
+ * @param information is the object information.  The name index shall be
+ *   present.
+ *
+ * @param the_object is the object to insert.  It shall be in the local table.
+ */
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+);
+
+/**
+ * @brief Removes the object from the name index of the object information.
+ *
+ * The caller shall own the allocator lock.
+ *
+ * @param information is the object information.  The name index shall be
+ *   present.
+ *
+ * @param the_object is the object to remove.  The object name shall be the
+ *   one used to insert the object.
+ */
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+);
+
+/**
+ * @brief Searches the local object with the specified 32-bit name in the name
+ *   index.
+ *
+ * This function may be called without the allocator lock.
+ *
+ * @param information is the object information.  The name index shall be
+ *   present.
+ *
+ * @param name is the object name.
+ *
+ * @param[out] the_object is set to the object with the lowest object index
+ *   and the specified name or to NULL if no such object exists, if the
+ *   function returns true.
+ *
+ * @retval true The search result is valid.
+ *
+ * @retval false The name index was concurrently modified.  The caller shall
+ *   use a linear search.
+ */
+bool _Objects_Name_index_find_u32(
+  const Objects_Information  *information,
+  uint32_t                    name,
+  Objects_Control           **the_object
+);
+
+/**
+ * @brief Searches the object with the specified string name in the name
+ *   index.
+ *
+ * The caller shall own the allocator lock.
+ *
+ * @param information is the object information.  The name index shall be
+ *   present.
+ *
+ * @param name is the object name.
+ *
+ * @param name_length is the length of the object name.
+ *
+ * @return Returns the object with the lowest object index and the specified
+ *   name or NULL if no such object exists.
+ */
+Objects_Control *_Objects_Name_index_find_string(
+  const Objects_Information *information,
+  const char                *name,
+  size_t                     name_length
+);
+
 /**
  * @brief Sets objects name.
  *
@@ -477,6 +611,11 @@ static inline void _Objects_Namespace_remove_u32(
 )
 {
   _Assert( !_Objects_Has_string_name( information ) );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_remove( information, the_object );
+  }
+
   the_object->name.name_u32 = 0;
 }
 
@@ -754,6 +893,10 @@ static inline Objects_Id _Objects_Open_u32(
     the_object
   );
 
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
+
   return the_object->id;
 }
 
@@ -784,6 +927,10 @@ static inline void _Objects_Open_string(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
 }
 
 /**
@@ -71,12 +71,12 @@ extern "C" {
   #endif
 
   #if CPU_SIZEOF_POINTER > 4
-    #define PER_CPU_CONTROL_SIZE_BIG_POINTER 76
+    #define PER_CPU_CONTROL_SIZE_BIG_POINTER 88
   #else
     #define PER_CPU_CONTROL_SIZE_BIG_POINTER 0
   #endif
 
-  #define PER_CPU_CONTROL_SIZE_BASE 180
+  #define PER_CPU_CONTROL_SIZE_BASE 192
   #define PER_CPU_CONTROL_SIZE_APPROX \
     ( PER_CPU_CONTROL_SIZE_BASE + CPU_PER_CPU_CONTROL_SIZE + \
     CPU_INTERRUPT_FRAME_SIZE + PER_CPU_CONTROL_SIZE_PROFILING + \
@@ -257,6 +257,34 @@ typedef struct Per_CPU_Job {
   const Per_CPU_Job_context *context;
 } Per_CPU_Job;
 
+/**
+ * @brief A batch of per-processor jobs.
+ *
+ * Jobs are collected in processor-specific lists without locking through
+ * _Per_CPU_Add_job_to_batch().  The lists are handed over to the processors
+ * through _Per_CPU_Submit_job_batch() which acquires the job lock of each
+ * target processor once and sends at most one ::SMP_MESSAGE_PERFORM_JOBS
+ * message to each target processor.
+ */
+typedef struct {
+  /**
+   * @brief The processor-specific job lists of the batch.
+   */
+  struct {
+    /**
+     * @brief Head of the job list of this processor in the batch.
+     */
+    Per_CPU_Job *head;
+
+    /**
+     * @brief Tail of the job list of this processor in the batch.
+     *
+     * This member is only valid if the head is not NULL.
+     */
+    Per_CPU_Job **tail;
+  } Jobs[ CPU_MAXIMUM_PROCESSORS ];
+} Per_CPU_Job_batch;
+
 #endif /* defined( RTEMS_SMP ) */
 
 /**
@@ -891,6 +919,60 @@ void _Per_CPU_Wait_for_job(
   const Per_CPU_Job     *job
 );
 
+/**
+ * @brief Checks if the job is done.
+ *
+ * In contrast to _Per_CPU_Wait_for_job(), this function does not wait.
+ *
+ * @param job is the job to check.
+ *
+ * @retval true The job handler was called on the target processor.
+ *
+ * @retval false Otherwise.
+ */
+static inline bool _Per_CPU_Is_job_done( const Per_CPU_Job *job )
+{
+  return _Atomic_Load_ulong( &job->done, ATOMIC_ORDER_ACQUIRE )
+    == PER_CPU_JOB_DONE;
+}
+
+/**
+ * @brief Initializes the job batch.
+ *
+ * @param[out] batch is the job batch to initialize.
+ */
+void _Per_CPU_Initialize_job_batch( Per_CPU_Job_batch *batch );
+
+/**
+ * @brief Adds the job to the job list of the processor in the batch.
+ *
+ * No lock is acquired and no message is sent.  The job is handed over to the
+ * processor by _Per_CPU_Submit_job_batch().
+ *
+ * @param[in, out] batch is the job batch.
+ * @param cpu is the processor to add the job.
+ * @param[in, out] job is the job.  The Per_CPU_Job::context member must be
+ *   initialized by the caller.
+ */
+void _Per_CPU_Add_job_to_batch(
+  Per_CPU_Job_batch     *batch,
+  const Per_CPU_Control *cpu,
+  Per_CPU_Job           *job
+);
+
+/**
+ * @brief Submits the jobs of the batch to the processors.
+ *
+ * For each processor with at least one job in the batch, the job list of the
+ * batch is appended to the job list of the processor while the job lock of
+ * the processor is acquired once.  Afterwards, the ::SMP_MESSAGE_PERFORM_JOBS
+ * message is sent once to the processor, see also _Per_CPU_Submit_job().  The
+ * batch is empty after the call.
+ *
+ * @param[in, out] batch is the job batch to submit.
+ */
+void _Per_CPU_Submit_job_batch( Per_CPU_Job_batch *batch );
+
 #endif /* defined( RTEMS_SMP ) */
 
 /*
@@ -38,6 +38,7 @@
 #ifndef _RTEMS_SCORE_SCHEDULERSTRONGAPA_H
 #define _RTEMS_SCORE_SCHEDULERSTRONGAPA_H
 
+#include <rtems/score/prioritybitmap.h>
 #include <rtems/score/scheduler.h>
 #include <rtems/score/schedulersmp.h>
 
@@ -65,9 +66,19 @@ struct Per_CPU_Control;
  * the cpu by checking all the executing nodes in the affinity set of the
  * node and the subsequent nodes executing on the processors in its
  * affinity set.
+ *
+ * The nodes of Scheduler_strong_APA_Context::Ready are queued by priority
+ * and indexed by a priority bit map.  Each processor has a priority bit map
+ * of the priorities which have a node with the processor in its affinity
+ * set.  The processors reachable from a blocked node are found through the
+ * scheduled nodes, so the search for the highest ready node only visits the
+ * priorities which have a node with a reachable processor and skips at most
+ * the scheduled nodes.
  * @{
  */
 
+#define SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY 255
+
 /**
  * @brief Scheduler node specialization for Strong APA schedulers.
  */
@@ -82,6 +93,12 @@ typedef struct {
    */
   Chain_Node Ready_node;
 
+  /**
+   * @brief The unmapped priority of the Scheduler_strong_APA_Context::Ready
+   * chain which contains this node.
+   */
+  unsigned int ready_priority;
+
   /**
    * @brief CPU that this node would preempt in the backtracking part of
    * _Scheduler_strong_APA_Get_highest_ready and
@@ -120,6 +137,19 @@ typedef struct {
    * @brief The node currently executing on this cpu.
    */
   Scheduler_Node *executing;
+
+  /**
+   * @brief The bit map of the priorities with a node in
+   * Scheduler_strong_APA_Context::Ready which has this cpu in its affinity
+   * set.
+   */
+  Priority_bit_map_Control Ready_bit_map;
+
+  /**
+   * @brief The count of nodes in Scheduler_strong_APA_Context::Ready which
+   * have this cpu in their affinity set for each priority.
+   */
+  uint32_t ready_count[ SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY + 1 ];
 } Scheduler_strong_APA_CPU;
 
 /**
@@ -132,10 +162,16 @@ typedef struct {
   Scheduler_SMP_Context Base;
 
   /**
-   * @brief Chain of all the ready and scheduled nodes present in
-   * the Strong APA scheduler.
+   * @brief The bit map of the priorities with a non-empty chain in
+   * Scheduler_strong_APA_Context::Ready.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief Chains of all the ready and scheduled nodes present in
+   * the Strong APA scheduler, one chain for each priority.
    */
-  Chain_Control Ready;
+  Chain_Control Ready[ SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY + 1 ];
 
   /**
    * @brief Stores cpu-specific variables.
@@ -143,8 +179,6 @@ typedef struct {
   Scheduler_strong_APA_CPU CPU[ RTEMS_ZERO_LENGTH_ARRAY ];
 } Scheduler_strong_APA_Context;
 
-#define SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY 255
-
 /**
  * @brief Entry points for the Strong APA Scheduler.
  */
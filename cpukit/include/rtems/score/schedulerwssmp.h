@@ -0,0 +1,420 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerWSSMP
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreSchedulerWSSMP.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERWSSMP_H
+#define _RTEMS_SCORE_SCHEDULERWSSMP_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/schedulerpriority.h>
+#include <rtems/score/schedulersmp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreSchedulerWSSMP Work Stealing SMP Scheduler
+ *
+ * @ingroup RTEMSScoreSchedulerSMP
+ *
+ * @brief This group contains the Work Stealing SMP Scheduler implementation.
+ *
+ * This is a fixed priority scheduler with one ready queue for each processor.
+ * A ready thread waits in the ready queue of the processor it executed on
+ * most recently.  The queues use one ready chain per priority and a priority
+ * bit map, so that the highest priority thread of a queue is found in
+ * constant time.
+ *
+ * An unblocked thread preempts the thread of its processor if it has a higher
+ * priority.  Otherwise, it is scheduled on an idle processor of its affinity
+ * set.  Otherwise, it preempts the lowest priority thread of its affinity set
+ * if this thread has a lower priority, or it waits in the ready queue of its
+ * processor.  A processor selects the next thread from its own ready queue.
+ * In case this queue is empty, the processor steals the highest priority
+ * thread which may execute on it from the ready queues of the other
+ * processors before it becomes idle.  Every
+ * #SCHEDULER_WS_SMP_BALANCE_INTERVAL selections, a processor also steals a
+ * thread from another ready queue if this thread has a higher priority than
+ * the highest priority thread of its own ready queue.
+ *
+ * In contrast to the global fixed priority scheduler, a thread preempted on
+ * its processor may wait in the ready queue of this processor while a lower
+ * priority thread executes on another processor of its affinity set.  It
+ * waits until the next load balancing of a processor of its affinity set or
+ * until its processor selects it.
+ *
+ * Arbitrary thread to processor affinity sets are supported.  The thread
+ * preempt mode will be ignored.
+ *
+ * @{
+ */
+
+/**
+ * @brief This define specifies the count of selections of a processor
+ *   between two load balancing steps of the processor.
+ */
+#define SCHEDULER_WS_SMP_BALANCE_INTERVAL 16
+
+/**
+ * @brief Scheduler node specialization for Work Stealing SMP schedulers.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler node.
+   */
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief The associated ready chain of this node.
+   */
+  Scheduler_priority_Ready_queue Ready_queue;
+
+  /**
+   * @brief The processor affinity set of this node.
+   */
+  Processor_mask Affinity;
+
+  /**
+   * @brief The index of the processor this node was allocated to most
+   *   recently.
+   */
+  uint32_t home_index;
+
+  /**
+   * @brief The index of the processor with the ready queue which contains
+   *   this node.
+   */
+  uint32_t ready_index;
+} Scheduler_WS_SMP_Node;
+
+/**
+ * @brief Processor-specific data of a Work Stealing SMP scheduler.
+ */
+typedef struct {
+  /**
+   * @brief The bit map of the non-empty ready chains of this processor.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief The ready chains of this processor, one chain for each priority.
+   */
+  Chain_Control *Ready;
+
+  /**
+   * @brief The node allocated to this processor.
+   */
+  Scheduler_WS_SMP_Node *allocated;
+
+  /**
+   * @brief The count of selections of this processor.
+   */
+  uint32_t selections;
+} Scheduler_WS_SMP_CPU;
+
+/**
+ * @brief Scheduler context specialization for Work Stealing SMP schedulers.
+ *
+ * The ready chains of all processors follow the processor-specific data in
+ * memory, see RTEMS_SCHEDULER_WS_SMP().
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler context.
+   */
+  Scheduler_SMP_Context Base;
+
+  /**
+   * @brief The idle nodes which are not scheduled.
+   */
+  Chain_Control Idle;
+
+  /**
+   * @brief The set of processors allocated to an idle node.
+   */
+  Processor_mask Idle_processors;
+
+  /**
+   * @brief The processor-specific data.
+   */
+  Scheduler_WS_SMP_CPU CPU[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_WS_SMP_Context;
+
+/**
+ * @brief Entry points for the Work Stealing SMP Scheduler.
+ */
+#define SCHEDULER_WS_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_WS_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_WS_SMP_Yield, \
+    _Scheduler_WS_SMP_Block, \
+    _Scheduler_WS_SMP_Unblock, \
+    _Scheduler_WS_SMP_Update_priority, \
+    _Scheduler_default_Map_priority, \
+    _Scheduler_default_Unmap_priority, \
+    _Scheduler_WS_SMP_Ask_for_help, \
+    _Scheduler_WS_SMP_Reconsider_help_request, \
+    _Scheduler_WS_SMP_Withdraw_node, \
+    _Scheduler_WS_SMP_Make_sticky, \
+    _Scheduler_WS_SMP_Clean_sticky, \
+    _Scheduler_default_Pin_or_unpin_not_supported, \
+    _Scheduler_default_Pin_or_unpin_not_supported, \
+    _Scheduler_WS_SMP_Add_processor, \
+    _Scheduler_WS_SMP_Remove_processor, \
+    _Scheduler_WS_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_default_Release_job, \
+    _Scheduler_default_Cancel_job, \
+    _Scheduler_WS_SMP_Start_idle, \
+    _Scheduler_WS_SMP_Set_affinity \
+  }
+
+/**
+ * @brief Initializes the scheduler.
+ *
+ * @param scheduler The scheduler to initialize.
+ */
+void _Scheduler_WS_SMP_Initialize( const Scheduler_Control *scheduler );
+
+/**
+ * @brief Initializes the node with the given priority.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[out] node The node to initialize.
+ * @param the_thread The thread of the node to initialize.
+ * @param priority The priority for @a node.
+ */
+void _Scheduler_WS_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+);
+
+/**
+ * @brief Blocks the thread.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[in, out] the_thread The thread to block.
+ * @param[in, out] node The node of the thread to block.
+ */
+void _Scheduler_WS_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Unblocks the thread.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[in, out] the_thread The thread to unblock.
+ * @param[in, out] node The node of the thread to unblock.
+ */
+void _Scheduler_WS_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Updates the priority of the node.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param the_thread The thread for the operation.
+ * @param[in, out] node The node to update the priority of.
+ */
+void _Scheduler_WS_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Asks for help.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param the_thread The thread that asks for help.
+ * @param node The node of @a the_thread.
+ *
+ * @retval true The request for help was successful.
+ * @retval false The request for help was not successful.
+ */
+bool _Scheduler_WS_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Reconsiders help request.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param the_thread The thread to reconsider the help request of.
+ * @param[in, out] node The node of @a the_thread.
+ */
+void _Scheduler_WS_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Withdraws the node.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[in, out] the_thread The thread to change to @a next_state.
+ * @param[in, out] node The node to withdraw.
+ * @param next_state The next state for @a the_thread.
+ */
+void _Scheduler_WS_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+);
+
+/**
+ * @brief Makes the node sticky.
+ *
+ * @param scheduler is the scheduler of the node.
+ *
+ * @param[in, out] the_thread is the thread owning the node.
+ *
+ * @param[in, out] node is the scheduler node to make sticky.
+ */
+void _Scheduler_WS_SMP_Make_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Cleans the sticky property from the node.
+ *
+ * @param scheduler is the scheduler of the node.
+ *
+ * @param[in, out] the_thread is the thread owning the node.
+ *
+ * @param[in, out] node is the scheduler node to clean the sticky property.
+ */
+void _Scheduler_WS_SMP_Clean_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Adds the idle thread to a processor.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[in, out] idle The idle thread to add to the processor.
+ */
+void _Scheduler_WS_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+);
+
+/**
+ * @brief Removes an idle thread from the given cpu.
+ *
+ * The ready threads of the ready queue of the processor are moved to the
+ * remaining processors of the scheduler.
+ *
+ * @param scheduler The scheduler instance.
+ * @param cpu The cpu control to remove from @a scheduler.
+ *
+ * @return The idle thread of the processor.
+ */
+Thread_Control *_Scheduler_WS_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Performs a yield operation.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param the_thread The thread to yield.
+ * @param[in, out] node The node of @a the_thread.
+ */
+void _Scheduler_WS_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Starts an idle thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] idle An idle thread.
+ * @param cpu The cpu for the operation.
+ */
+void _Scheduler_WS_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Sets the thread affinity.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param the_thread The thread for the operation.
+ * @param[in, out] node The scheduler node.
+ * @param affinity The new processor affinity set for the thread.
+ *
+ * @retval STATUS_SUCCESSFUL The operation succeeded.
+ *
+ * @retval STATUS_INVALID_NUMBER The affinity set contains no processor owned
+ *   by the scheduler.
+ */
+Status_Control _Scheduler_WS_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  const Processor_mask    *affinity
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERWSSMP_H */
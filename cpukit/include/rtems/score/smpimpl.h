@@ -263,6 +263,100 @@ void _SMP_Multicast_action(
   void                 *arg
 );
 
+/**
+ * @brief This structure represents an asynchronous SMP multicast action.
+ *
+ * The storage of the request must be valid until
+ * _SMP_Multicast_action_is_done() returned true or
+ * _SMP_Multicast_action_wait() returned.
+ */
+typedef struct {
+  /**
+   * @brief This member provides the action handler and argument for the jobs.
+   */
+  Per_CPU_Job_context Context;
+
+  /**
+   * @brief This member contains the set of target processors.
+   */
+  Processor_mask Targets;
+
+  /**
+   * @brief This member provides a job for each target processor.
+   */
+  Per_CPU_Job Jobs[ CPU_MAXIMUM_PROCESSORS ];
+} SMP_Multicast_request;
+
+/**
+ * @brief Initiates an SMP multicast action to the set of target processors
+ *   and returns immediately.
+ *
+ * Each target processor receives at most one inter-processor interrupt.  Use
+ * _SMP_Multicast_action_is_done() or _SMP_Multicast_action_wait() to get the
+ * completion status.  In contrast to _SMP_Multicast_action(), thread
+ * dispatching may be enabled during the call and afterwards.
+ *
+ * @param[out] request is the multicast request.
+ * @param targets is the set of target processors for the action.
+ * @param handler is the multicast action handler.
+ * @param arg is the multicast action argument.
+ */
+void _SMP_Multicast_action_async(
+  SMP_Multicast_request *request,
+  const Processor_mask  *targets,
+  SMP_Action_handler     handler,
+  void                  *arg
+);
+
+/**
+ * @brief Adds an SMP multicast action to the job batch.
+ *
+ * This is a variant of _SMP_Multicast_action_async() which allows to issue
+ * several multicast actions with at most one inter-processor interrupt for
+ * each target processor through _Per_CPU_Submit_job_batch().
+ *
+ * @param[in, out] batch is the job batch.
+ * @param[out] request is the multicast request.
+ * @param targets is the set of target processors for the action.
+ * @param handler is the multicast action handler.
+ * @param arg is the multicast action argument.
+ */
+void _SMP_Multicast_action_add_to_batch(
+  Per_CPU_Job_batch     *batch,
+  SMP_Multicast_request *request,
+  const Processor_mask  *targets,
+  SMP_Action_handler     handler,
+  void                  *arg
+);
+
+/**
+ * @brief Checks if the SMP multicast action was carried out by all target
+ *   processors.
+ *
+ * This function does not wait and does not process messages.
+ *
+ * @param request is the multicast request.
+ *
+ * @retval true The action handler was called on all target processors.
+ *
+ * @retval false Otherwise.
+ */
+bool _SMP_Multicast_action_is_done( const SMP_Multicast_request *request );
+
+/**
+ * @brief Waits until the SMP multicast action was carried out by all target
+ *   processors.
+ *
+ * The caller must ensure that no thread dispatch can happen during the call
+ * of this function, otherwise the behaviour is undefined.  In case a target
+ * processor is in a wrong state to process per-processor jobs, then this
+ * function results in an SMP_FATAL_WRONG_CPU_STATE_TO_PERFORM_JOBS fatal SMP
+ * error.
+ *
+ * @param request is the multicast request.
+ */
+void _SMP_Multicast_action_wait( const SMP_Multicast_request *request );
+
 /**
  * @brief Initiates an SMP multicast action to the set of all online
  * processors.
@@ -825,6 +825,27 @@ typedef struct  {
   void *        control;
 }Thread_Capture_control;
 
+/**
+ * @brief The stack checker high water mark state of a thread.
+ *
+ * The positions are counted in stack words from the stack base, this is the
+ * end of the stack area the thread starts to use.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of stack words known to be used.
+   */
+  uintptr_t high_water;
+
+  /**
+   * @brief This member contains the position of the incremental scan.
+   *
+   * In the current scan pass, the stack words from the cursor position up to
+   * the deepest position were found to contain the fill pattern.
+   */
+  uintptr_t cursor;
+} Thread_Stack_check_control;
+
 /**
  *  This structure defines the Thread Control Block (TCB).
  *
@@ -986,6 +1007,11 @@ struct _Thread_Control {
 
   Thread_Capture_control                Capture;
 
+  /**
+   * @brief The stack checker high water mark state.
+   */
+  Thread_Stack_check_control            Stack_check;
+
   /**
    * @brief Pointer to an optional thread-specific POSIX user environment.
    */
@@ -1107,25 +1133,19 @@ typedef struct Thread_Configured_control Thread_Configured_control;
 /**
  * @brief The configured thread queue heads.
  *
- * In SMP configurations, this type is defined in <rtems/confdefs.h> and depends
- * on the application configuration.
+ * This type is defined in <rtems/confdefs.h> and depends on the application
+ * configuration.  In SMP configurations, it contains one priority queue per
+ * scheduler instance.  If the priority bucket thread queue operations are
+ * used, it contains the thread priority buckets.
  */
-#if defined(RTEMS_SMP)
 typedef struct Thread_queue_Configured_heads Thread_queue_Configured_heads;
-#else
-typedef Thread_queue_Heads Thread_queue_Configured_heads;
-#endif
 
 /**
  * @brief Size of the thread queue heads of a particular application.
  *
- * In SMP configurations, this value is provided via <rtems/confdefs.h>.
+ * This value is provided via <rtems/confdefs.h>.
  */
-#if defined(RTEMS_SMP)
 extern const size_t _Thread_queue_Heads_size;
-#else
-#define _Thread_queue_Heads_size sizeof(Thread_queue_Heads)
-#endif
 
 /**
  * @brief The thread object information.
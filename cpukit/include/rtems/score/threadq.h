@@ -43,6 +43,7 @@
 #include <rtems/score/isrlock.h>
 #include <rtems/score/object.h>
 #include <rtems/score/priority.h>
+#include <rtems/score/prioritybitmap.h>
 #include <rtems/score/rbtree.h>
 #include <rtems/score/states.h>
 #include <rtems/score/watchdogticks.h>
@@ -369,6 +370,30 @@ typedef struct {
   struct Scheduler_Node *scheduler_node;
 } Thread_queue_Priority_queue;
 
+/**
+ * @brief Thread priority buckets.
+ *
+ * The thread queue priority bucket operations use this structure to manage
+ * the enqueued threads.  There is one FIFO per thread priority.  The priority
+ * bit map indicates the non-empty FIFOs.  Only the FIFOs of set priority bits
+ * are initialized.
+ *
+ * The buckets follow the thread queue heads and the per scheduler instance
+ * priority queues.  They are only present if <rtems/confdefs.h> selected the
+ * priority bucket operations, see ::_Thread_queue_Operations_priority.
+ */
+typedef struct {
+  /**
+   * @brief This bit map indicates the non-empty FIFOs.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief This is the FIFO of each thread priority.
+   */
+  Chain_Control Fifo[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Thread_queue_Priority_buckets;
+
 /**
  * @brief Thread queue heads.
  *
@@ -971,6 +971,45 @@ bool _Thread_queue_Extract_locked(
   Thread_queue_Context          *queue_context
 );
 
+/**
+ * @brief Moves the thread from the thread queue to the target thread queue
+ *   without unblocking it.
+ *
+ * The caller must be the owner of the thread queue lock and the target thread
+ * queue lock.  The thread queue must not have an owner.  The locks are not
+ * released.  The thread timer, for example of a timed wait, is kept and
+ * applies to the wait on the target thread queue.
+ *
+ * In SMP configurations, the thread cannot be moved if there are pending
+ * requests for its thread wait lock.  It cannot be moved either if an owner
+ * on the thread queue path of the target waits on the thread queue, since the
+ * caller owns its lock.  In these cases, and in case a deadlock is detected on
+ * the target thread queue, the thread is extracted from the thread queue as in
+ * _Thread_queue_Extract_locked() instead.
+ *
+ * Use _Thread_queue_Context_clear_priority_updates() before and
+ * _Thread_Priority_update() after the release of the locks to carry out the
+ * priority updates due to the enqueue on the target thread queue.
+ *
+ * @param queue is the actual thread queue.
+ * @param operations is the thread queue operations.
+ * @param[in, out] target is the target thread queue.
+ * @param target_operations is the target thread queue operations.
+ * @param[in, out] the_thread is the thread to move.
+ * @param[in, out] queue_context is the thread queue context.
+ *
+ * @return Returns the unblock indicator of _Thread_queue_Extract_locked() in
+ *   case the thread was extracted instead of moved, otherwise false.
+ */
+bool _Thread_queue_Requeue_locked(
+  Thread_queue_Queue            *queue,
+  const Thread_queue_Operations *operations,
+  Thread_queue_Queue            *target,
+  const Thread_queue_Operations *target_operations,
+  Thread_Control                *the_thread,
+  Thread_queue_Context          *queue_context
+);
+
 /**
  * @brief Resumes the extracted or surrendered thread.
  *
@@ -1234,6 +1273,51 @@ size_t _Thread_queue_Flush_critical(
   Thread_queue_Context          *queue_context
 );
 
+/**
+ * @brief Unblocks some and moves the other threads enqueued on the thread
+ *   queue to the target thread queue.
+ *
+ * This function iteratively removes the first enqueued thread of the thread
+ * queue until the thread queue is empty or the filter function indicates a
+ * stop.  The first threads up to the wake count are extracted and unblocked
+ * as in _Thread_queue_Flush_critical().  The following threads are moved to
+ * the target thread queue through _Thread_queue_Requeue_locked() without
+ * unblocking them.  Threads which cannot be moved are unblocked.
+ *
+ * The target thread queue lock is released, afterwards the thread queue lock
+ * is released.  The priorities changed by the moved threads, for example
+ * through priority inheritance along the thread queue path of the target, are
+ * updated through _Thread_Priority_update().  If the thread queue context
+ * cannot record more priority updates, then the remaining threads are
+ * unblocked instead of moved.
+ *
+ * @param queue is the actual thread queue.  The thread queue must not have an
+ *   owner.
+ * @param operations is the thread queue operations.
+ * @param[in, out] target is the target thread queue.
+ * @param target_operations is the target thread queue operations.
+ * @param[in, out] target_lock_context is the lock context used to acquire the
+ *   target thread queue lock.  The ISR level shall be stored in the lock
+ *   context of the thread queue context.
+ * @param wake_count is the count of threads to unblock before the threads are
+ *   moved.
+ * @param filter is the filter function which is called for each thread to
+ *   remove from the thread queue, see _Thread_queue_Flush_critical().
+ * @param queue_context is the thread queue context of the lock acquire.
+ *
+ * @return Returns the count of threads removed from the thread queue.
+ */
+size_t _Thread_queue_Requeue_critical(
+  Thread_queue_Queue            *queue,
+  const Thread_queue_Operations *operations,
+  Thread_queue_Queue            *target,
+  const Thread_queue_Operations *target_operations,
+  ISR_lock_Context              *target_lock_context,
+  size_t                         wake_count,
+  Thread_queue_Flush_filter      filter,
+  Thread_queue_Context          *queue_context
+);
+
 /**
  * @brief Initializes the thread queue control to the given name.
  *
@@ -1449,6 +1533,11 @@ extern const Thread_queue_Operations _Thread_queue_Operations_FIFO;
 /**
  * @brief The FIFO thread queue operations are used when a thread is enqueued
  *   on a thread queue and provide priority ordering of enqueued threads.
+ *
+ * This object is defined by <rtems/confdefs.h>.  In configurations with
+ * exactly one scheduler which uses the default priority mapping and with a
+ * maximum priority of at most 63, the priority bucket operations are used,
+ * otherwise the priority operations are used.
  */
 extern const Thread_queue_Operations _Thread_queue_Operations_priority;
 
@@ -125,6 +125,161 @@ Thread_Control *_Thread_queue_FIFO_surrender(
  */
 Thread_Control *_Thread_queue_FIFO_first( const Thread_queue_Heads *heads );
 
+/**
+ * @brief Performs the priority actions of the priority thread queue.
+ *
+ * @param[in, out] queue is the thread queue.
+ *
+ * @param[in, out] priority_actions are the priority actions to perform.
+ */
+void _Thread_queue_Priority_priority_actions(
+  Thread_queue_Queue *queue,
+  Priority_Actions   *priority_actions
+);
+
+/**
+ * @brief Enqueues the thread to the priority thread queue.
+ *
+ * @param[in, out] queue is the thread queue.
+ *
+ * @param[in, out] the_thread is the thread to enqueue.
+ *
+ * @param[in, out] queue_context is the thread queue context.
+ */
+void _Thread_queue_Priority_enqueue(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Extracts the thread from the priority thread queue.
+ *
+ * @param[in, out] queue is the thread queue.
+ *
+ * @param[in, out] the_thread is the thread to extract.
+ *
+ * @param[in, out] queue_context is the thread queue context.
+ */
+void _Thread_queue_Priority_extract(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Surrenders the thread queue to the first thread on the priority
+ *   thread queue.
+ *
+ * @param[in, out] queue is the thread queue.
+ *
+ * @param[in, out] heads are heads of the thread queue.
+ *
+ * @param previous_owner is unused.
+ *
+ * @param[in, out] queue_context is the thread queue context.
+ *
+ * @return Returns the first thread on the thread queue according to the queue
+ *   order.
+ */
+Thread_Control *_Thread_queue_Priority_surrender(
+  Thread_queue_Queue   *queue,
+  Thread_queue_Heads   *heads,
+  Thread_Control       *previous_owner,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Gets the first thread on the priority thread queue.
+ *
+ * @param heads are heads of the thread queue.
+ *
+ * @return Returns the first thread on the thread queue according to the queue
+ *   order.
+ */
+Thread_Control *_Thread_queue_Priority_first(
+  const Thread_queue_Heads *heads
+);
+
+/**
+ * @brief Performs the priority actions of the priority bucket thread queue.
+ *
+ * The thread is moved to the FIFO of its new priority.
+ *
+ * @param[in, out] queue is the thread queue.
+ *
+ * @param[in, out] priority_actions are the priority actions to perform.
+ */
+void _Thread_queue_Priority_bucket_priority_actions(
+  Thread_queue_Queue *queue,
+  Priority_Actions   *priority_actions
+);
+
+/**
+ * @brief Enqueues the thread to the priority bucket thread queue.
+ *
+ * The thread is appended to the FIFO of its priority.
+ *
+ * @param[in, out] queue is the thread queue.
+ *
+ * @param[in, out] the_thread is the thread to enqueue.
+ *
+ * @param[in, out] queue_context is the thread queue context.
+ */
+void _Thread_queue_Priority_bucket_enqueue(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Extracts the thread from the priority bucket thread queue.
+ *
+ * @param[in, out] queue is the thread queue.
+ *
+ * @param[in, out] the_thread is the thread to extract.
+ *
+ * @param[in, out] queue_context is the thread queue context.
+ */
+void _Thread_queue_Priority_bucket_extract(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Surrenders the thread queue to the first thread on the priority
+ *   bucket thread queue.
+ *
+ * @param[in, out] queue is the thread queue.
+ *
+ * @param[in, out] heads are heads of the thread queue.
+ *
+ * @param previous_owner is unused.
+ *
+ * @param[in, out] queue_context is the thread queue context.
+ *
+ * @return Returns the first thread on the thread queue according to the queue
+ *   order.
+ */
+Thread_Control *_Thread_queue_Priority_bucket_surrender(
+  Thread_queue_Queue   *queue,
+  Thread_queue_Heads   *heads,
+  Thread_Control       *previous_owner,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Gets the first thread on the priority bucket thread queue.
+ *
+ * @param heads are heads of the thread queue.
+ *
+ * @return Returns the first thread of the highest priority non-empty FIFO.
+ */
+Thread_Control *_Thread_queue_Priority_bucket_first(
+  const Thread_queue_Heads *heads
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -84,6 +84,55 @@ typedef void Watchdog_Service_routine;
 typedef Watchdog_Service_routine
   ( *Watchdog_Service_routine_entry )( Watchdog_Control * );
 
+/**
+ * @brief The count of bits of the expiration time used to select the slot of a
+ * timing wheel level.
+ */
+#define WATCHDOG_WHEEL_SLOT_BITS 6
+
+/**
+ * @brief The count of slots of a timing wheel level.
+ */
+#define WATCHDOG_WHEEL_SLOTS ( 1U << WATCHDOG_WHEEL_SLOT_BITS )
+
+/**
+ * @brief The count of timing wheel levels.
+ *
+ * The levels cover expiration times up to 2**24 ticks in the future.
+ * Watchdogs which expire later are kept on an overflow chain.
+ */
+#define WATCHDOG_WHEEL_LEVELS 4
+
+/**
+ * @brief The hierarchical timing wheel to manage scheduled watchdogs with an
+ * expiration time in clock ticks.
+ *
+ * Level zero has a slot for each of the next clock ticks.  Each slot of a
+ * higher level covers all slots of the previous level.  The watchdogs of a
+ * higher level slot are moved to lower levels once the slot becomes due.
+ */
+typedef struct Watchdog_Wheel {
+  /**
+   * @brief The clock tick of the level zero slot which is processed next.
+   */
+  uint64_t due;
+
+  /**
+   * @brief Bit field of the non-empty slots for each level.
+   */
+  uint64_t occupied[ WATCHDOG_WHEEL_LEVELS ];
+
+  /**
+   * @brief Chain of scheduled watchdogs which expire beyond the last level.
+   */
+  Chain_Control overflow;
+
+  /**
+   * @brief The slots of the levels.
+   */
+  Chain_Control slots[ WATCHDOG_WHEEL_LEVELS ][ WATCHDOG_WHEEL_SLOTS ];
+} Watchdog_Wheel;
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -96,8 +145,16 @@ typedef struct {
   /**
    * @brief The scheduled watchdog with the earliest expiration time or NULL in
    * case no watchdog is scheduled.
+   *
+   * In case a timing wheel is used, then this member references an arbitrary
+   * scheduled watchdog.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The timing wheel used instead of the red-black tree or NULL.
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -117,6 +174,22 @@ struct Watchdog_Control {
      */
     RBTree_Node RBTree;
 
+    /**
+     * @brief this field allows this to be placed on a slot of a timing wheel
+     * used to manage the scheduled watchdogs.
+     */
+    struct {
+      /**
+       * @brief The node on the slot chain.
+       */
+      Chain_Node Node;
+
+      /**
+       * @brief The slot chain.
+       */
+      Chain_Control *slot;
+    } Wheel;
+
     /**
      * @brief this field is a chain node structure and allows this to be placed
      * on a chain used to manage pending watchdogs by the timer server.
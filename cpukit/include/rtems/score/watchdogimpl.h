@@ -64,6 +64,8 @@ extern "C" {
 typedef enum {
   /**
    * @brief The watchdog is scheduled and a black node in the red-black tree.
+   *
+   * This state is also used for watchdogs scheduled on a timing wheel.
    */
   WATCHDOG_SCHEDULED_BLACK,
 
@@ -120,6 +122,35 @@ static inline void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
+}
+
+/**
+ * @brief Initializes the watchdog header to use the timing wheel.
+ *
+ * @param[out] header The header to initialize.
+ * @param[out] wheel The timing wheel to use for the header.
+ * @param now The current time in clock ticks.
+ */
+void _Watchdog_Header_initialize_wheel(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+);
+
+/**
+ * @brief Checks if the watchdog header uses a timing wheel.
+ *
+ * @param header The watchdog header.
+ *
+ * @retval true The header uses a timing wheel.
+ * @retval false The header uses a red-black tree.
+ */
+static inline bool _Watchdog_Header_has_wheel(
+  const Watchdog_Header *header
+)
+{
+  return header->wheel != NULL;
 }
 
 /**
@@ -288,6 +319,54 @@ void _Watchdog_Do_tickle(
     _Watchdog_Do_tickle( header, first, now, lock_context )
 #endif
 
+/**
+ * @brief Advances the timing wheel of the watchdog header to the current time
+ * and calls the routine of each expired watchdog.
+ *
+ * In contrast to _Watchdog_Tickle(), this function shall be called for each
+ * clock tick, even if no watchdog is scheduled.
+ *
+ * @param header The watchdog header using a timing wheel.
+ * @param now The current time in clock ticks.
+ * @param lock The lock that is released before calling the routine and then
+ *      acquired after the call.
+ * @param lock_context The lock context for the release before calling the
+ *      routine and for the acquire after.
+ */
+void _Watchdog_Do_tickle_wheel(
+  Watchdog_Header  *header,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined(RTEMS_SMP)
+  #define _Watchdog_Tickle_wheel( header, now, lock, lock_context ) \
+    _Watchdog_Do_tickle_wheel( header, now, lock, lock_context )
+#else
+  #define _Watchdog_Tickle_wheel( header, now, lock, lock_context ) \
+    _Watchdog_Do_tickle_wheel( header, now, lock_context )
+#endif
+
+/**
+ * @brief The timing wheels of the processors.
+ *
+ * This table is defined by the application configuration if
+ * #CONFIGURE_WATCHDOG_TIMING_WHEEL is defined.
+ */
+extern Watchdog_Wheel _Watchdog_Wheel_table[];
+
+/**
+ * @brief Uses the timing wheels for the clock tick watchdog header of each
+ * processor.
+ *
+ * This function is used by the application configuration if
+ * #CONFIGURE_WATCHDOG_TIMING_WHEEL is defined.
+ */
+void _Watchdog_Wheel_initialize( void );
+
 /**
  * @brief Inserts a watchdog into the set of scheduled watchdogs according to
  * the specified expiration time.
@@ -304,6 +383,22 @@ void _Watchdog_Insert(
   uint64_t          expire
 );
 
+/**
+ * @brief Inserts a watchdog into the timing wheel of the watchdog header.
+ *
+ * The watchdog must be inactive.  Use _Watchdog_Insert() instead of this
+ * function.
+ *
+ * @param[in, out] header The watchdog header using a timing wheel.
+ * @param[in, out] the_watchdog The watchdog to insert.
+ * @param expire The expiration time in clock ticks.
+ */
+void _Watchdog_Wheel_insert(
+  Watchdog_Header  *header,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+);
+
 /**
  * @brief In the case the watchdog is scheduled, then it is removed from the set of
  * scheduled watchdogs.
@@ -318,6 +413,20 @@ void _Watchdog_Remove(
   Watchdog_Control *the_watchdog
 );
 
+/**
+ * @brief Removes the scheduled watchdog from the timing wheel of the watchdog
+ * header.
+ *
+ * Use _Watchdog_Remove() instead of this function.
+ *
+ * @param[in, out] header The watchdog header using a timing wheel.
+ * @param[in, out] the_watchdog The scheduled watchdog to remove.
+ */
+void _Watchdog_Wheel_remove(
+  Watchdog_Header  *header,
+  Watchdog_Control *the_watchdog
+);
+
 /**
  * @brief In the case the watchdog is scheduled, then it is removed from the set of
  * scheduled watchdogs.
@@ -65,6 +65,15 @@ extern Heap_Control _Workspace_Area;
  */
 void _Workspace_Handler_initialization( void );
 
+/**
+ * @brief Enables the segregated fit method for the workspace.
+ *
+ * This function is used by the application configuration option
+ * ``CONFIGURE_WORKSPACE_SEGREGATED_FIT``.  In case there is not enough memory
+ * available for the segregated fit index, then a fatal error occurs.
+ */
+void _Workspace_Enable_segregated_fit( void );
+
 /**
  * @brief Allocates a memory block of the specified size from the workspace.
  *
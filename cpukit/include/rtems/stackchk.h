@@ -161,6 +161,32 @@ typedef void ( *rtems_stack_checker_visitor )(
  */
 void rtems_stack_checker_iterate( rtems_stack_checker_visitor visit, void *arg );
 
+/**
+ * @brief Gets the stack usage of a thread in bounded time.
+ *
+ * Instead of a scan of the complete stack, this method continues the
+ * incremental high water mark scan of the thread and examines at most
+ * CONFIGURE_STACK_CHECKER_SCAN_WORDS stack words.  The saved stack pointer of
+ * the thread is sampled as well.  The returned usage is a lower bound of the
+ * actual usage which catches up with it after repeated invocations.
+ *
+ * @param id is the identifier of the thread.  The constant RTEMS_SELF may be
+ *   used to get the stack usage of the calling thread.
+ *
+ * @param[out] info is the stack information.  The name member is set to NULL.
+ *
+ * @retval RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval RTEMS_INVALID_ADDRESS The @a info parameter was NULL.
+ *
+ * @retval RTEMS_INVALID_ID There was no thread associated with the
+ *   identifier specified by @a id.
+ */
+rtems_status_code rtems_stack_checker_get_usage(
+  rtems_id                  id,
+  rtems_stack_checker_info *info
+);
+
 /*************************************************************
  *************************************************************
  **  Prototyped only so the user extension can be installed **
@@ -272,6 +298,22 @@ typedef void (*Stack_checker_Reporter_handler)(
  */
 extern const Stack_checker_Reporter_handler Stack_checker_Reporter;
 
+/**
+ * @brief The maximum count of stack words examined by one step of the
+ *   incremental high water mark scan.
+ *
+ * Application provided via <rtems/confdefs.h>
+ */
+extern const uint32_t Stack_checker_Scan_words;
+
+/**
+ * @brief Indicates if the context switch extension samples the stack usage of
+ *   the thread which is switched out.
+ *
+ * Application provided via <rtems/confdefs.h>
+ */
+extern const bool Stack_checker_Switch_sampling;
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,7 @@
 #include <xz.h>
 
 #include <rtems/print.h>
+#include <rtems/rtems/types.h>
 
 /**
  *  @defgroup libmisc_untar_img Untar Image
@@ -80,6 +81,13 @@ typedef struct {
   const rtems_printer *printer;
 } Untar_HeaderContext;
 
+/**
+ * @brief The untar pipeline writes file bodies with worker tasks.
+ *
+ * @see Untar_Pipeline_Create().
+ */
+typedef struct Untar_Pipeline Untar_Pipeline;
+
 typedef struct {
   Untar_HeaderContext base;
 
@@ -112,6 +120,13 @@ typedef struct {
    * @brief File descriptor of output file.
    */
   int out_fd;
+
+  /**
+   * @brief Pipeline which writes the file bodies.
+   *
+   * If NULL, the file bodies are written directly.
+   */
+  Untar_Pipeline *pipeline;
 } Untar_ChunkContext;
 
 typedef struct {
@@ -259,6 +274,172 @@ int Untar_FromXzChunk_Print(
 
 int Untar_ProcessHeader(Untar_HeaderContext *ctx, const char *bufr);
 
+/**
+ * @brief The default size in bytes of one untar pipeline write buffer.
+ */
+#define UNTAR_PIPELINE_BUFFER_SIZE_DEFAULT 65536
+
+/**
+ * @brief The default count of untar pipeline write buffers.
+ */
+#define UNTAR_PIPELINE_BUFFER_COUNT_DEFAULT 8
+
+/**
+ * @brief This structure defines the untar pipeline configuration.
+ */
+typedef struct {
+  /**
+   * @brief Size in bytes of one write buffer.
+   *
+   * The size is rounded up to a multiple of the tar block size.  If zero,
+   * #UNTAR_PIPELINE_BUFFER_SIZE_DEFAULT is used.
+   */
+  size_t buffer_size;
+
+  /**
+   * @brief Count of write buffers.
+   *
+   * This count limits the data which is read ahead of the writes.  If zero,
+   * #UNTAR_PIPELINE_BUFFER_COUNT_DEFAULT is used.
+   */
+  size_t buffer_count;
+
+  /**
+   * @brief Count of worker tasks writing the file bodies.
+   *
+   * If zero, the file bodies are written by the task feeding the pipeline.
+   * Each file is written by exactly one worker task.  Different files may be
+   * written in parallel.
+   */
+  uint32_t worker_count;
+
+  /**
+   * @brief Priority of the worker tasks.
+   *
+   * If zero, the priority of the task creating the pipeline is used.
+   */
+  rtems_task_priority worker_priority;
+} Untar_PipelineConfig;
+
+/**
+ * @brief This structure provides the untar pipeline statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of regular files.
+   */
+  size_t files;
+
+  /**
+   * @brief Count of tar archive bytes fed into the pipeline.
+   */
+  uint64_t input_bytes;
+
+  /**
+   * @brief Time in nanoseconds the feeding task spent to read, decompress,
+   *   and parse the tar archive.
+   */
+  uint64_t input_nanoseconds;
+
+  /**
+   * @brief Count of file body bytes written.
+   */
+  uint64_t write_bytes;
+
+  /**
+   * @brief Time in nanoseconds spent to write and close the files summed up
+   *   over all writers.
+   */
+  uint64_t write_nanoseconds;
+
+  /**
+   * @brief Time in nanoseconds the feeding task waited for a free write
+   *   buffer.
+   */
+  uint64_t stall_nanoseconds;
+
+  /**
+   * @brief Time in nanoseconds from the pipeline creation to its destruction.
+   */
+  uint64_t total_nanoseconds;
+} Untar_PipelineStatistics;
+
+/**
+ * @brief Creates an untar pipeline.
+ *
+ * The pipeline decouples the reading, decompression, and parsing of a tar
+ * archive from the writing of the file bodies.  The file bodies are copied
+ * into large, cache line aligned write buffers which are written by a pool of
+ * worker tasks.  Use Untar_ChunkContext_Set_pipeline() to feed a pipeline
+ * with one of the chunk based untar functions.
+ *
+ * Each worker task needs a task object and a task stack of twice the minimum
+ * task stack size.  Each file which is not yet completely written needs a
+ * file descriptor.  These are at most the count of write buffers plus one.
+ *
+ * @param config is the pipeline configuration.
+ *
+ * @return Returns the pipeline, or NULL if not enough resources were
+ *   available.
+ */
+Untar_Pipeline *Untar_Pipeline_Create(const Untar_PipelineConfig *config);
+
+/**
+ * @brief Waits until all files are written and destroys the pipeline.
+ *
+ * @param pipeline is the pipeline to destroy.
+ *
+ * @param[out] stats is the pipeline statistics.  It may be NULL.
+ *
+ * @param printer is the printer for the per-stage throughput.  It may be NULL.
+ *
+ * @retval UNTAR_SUCCESSFUL All files were successfully written.
+ *
+ * @retval UNTAR_FAIL Writing or closing of at least one file failed.
+ */
+int Untar_Pipeline_Destroy(
+  Untar_Pipeline           *pipeline,
+  Untar_PipelineStatistics *stats,
+  const rtems_printer      *printer
+);
+
+/**
+ * @brief Sets the pipeline which writes the file bodies of the chunk context.
+ *
+ * Call this function after the initialization of the chunk context.  This
+ * works also for the base of Untar_GzChunkContext and Untar_XzChunkContext.
+ *
+ * @param context is the chunk context.
+ *
+ * @param pipeline is the pipeline.
+ */
+void Untar_ChunkContext_Set_pipeline(
+  Untar_ChunkContext *context,
+  Untar_Pipeline     *pipeline
+);
+
+/**
+ * @brief Untars a tar file using an untar pipeline.
+ *
+ * The tar file is read in chunks of the write buffer size.
+ *
+ * @param tar_name is the tar file name.
+ *
+ * @param config is the pipeline configuration.
+ *
+ * @param printer is the printer.  It may be NULL.
+ *
+ * @retval UNTAR_SUCCESSFUL        on successful completion.
+ * @retval UNTAR_FAIL              for a faulty step within the process.
+ * @retval UNTAR_INVALID_CHECKSUM  for an invalid header checksum.
+ * @retval UNTAR_INVALID_HEADER    for an invalid header.
+ */
+int Untar_FromFile_Pipelined_Print(
+  const char                 *tar_name,
+  const Untar_PipelineConfig *config,
+  const rtems_printer        *printer
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -60,6 +60,10 @@ typedef struct rtems_bdbuf_swapout_transfer
   rtems_chain_control   bds;         /**< The transfer list of BDs. */
   rtems_disk_device    *dd;          /**< The device the transfer is for. */
   bool                  syncing;     /**< The data is a sync'ing. */
+  uint32_t              urgent;      /**< The count of BDs at the head of
+                                      * the transfer list which belong to
+                                      * runs with sync'ing or waiting
+                                      * users. */
   rtems_blkdev_request  write_req;   /**< The write request. */
 } rtems_bdbuf_swapout_transfer;
 
@@ -116,8 +120,10 @@ typedef struct rtems_bdbuf_cache
                                           * BDBUF_INVALID_DEV not a device
                                           * sync. */
 
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
+  rtems_bdbuf_buffer** hash;             /**< Buffer descriptor lookup hash
+                                          * table. There is only one. */
+  uint32_t            hash_shift;        /**< The shift to get the bucket
+                                          * index from the hashed key. */
   rtems_chain_control lru;               /**< Least recently used list */
   rtems_chain_control modified;          /**< Modified buffers list */
   rtems_chain_control sync;              /**< Buffers to sync list */
@@ -270,15 +276,6 @@ rtems_bdbuf_show_users (const char* where, rtems_bdbuf_buffer* bd)
 #define rtems_bdbuf_show_users(_w, _b) ((void) 0)
 #endif
 
-/**
- * The default maximum height of 32 allows for AVL trees having between
- * 5,704,880 and 4,294,967,295 nodes, depending on order of insertion.  You may
- * change this compile-time constant as you wish.
- */
-#ifndef RTEMS_BDBUF_AVL_MAX_HEIGHT
-#define RTEMS_BDBUF_AVL_MAX_HEIGHT (32)
-#endif
-
 static void
 rtems_bdbuf_fatal (rtems_fatal_code error)
 {
@@ -293,490 +290,91 @@ rtems_bdbuf_fatal_with_state (rtems_bdbuf_buf_state state,
 }
 
 /**
- * Searches for the node with specified dd/block.
+ * Computes the hash table bucket index for the specified dd/block.
+ *
+ * @param dd disk device key
+ * @param block block key
+ * @return the bucket index
+ */
+static size_t
+rtems_bdbuf_hash_index (const rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  uint32_t key = block + (uint32_t) ((uintptr_t) dd >> 3);
+
+  return (key * UINT32_C (0x9e3779b1)) >> bdbuf_cache.hash_shift;
+}
+
+/**
+ * Searches for the buffer with specified dd/block.
  *
- * @param root pointer to the root node of the AVL-Tree
  * @param dd disk device search key
  * @param block block search key
- * @retval NULL node with the specified dd/block is not found
- * @return pointer to the node with specified dd/block
+ * @retval NULL buffer with the specified dd/block is not found
+ * @return pointer to the buffer with specified dd/block
  */
 static rtems_bdbuf_buffer *
-rtems_bdbuf_avl_search (rtems_bdbuf_buffer** root,
-                        const rtems_disk_device *dd,
-                        rtems_blkdev_bnum    block)
+rtems_bdbuf_hash_search (const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
 {
-  rtems_bdbuf_buffer* p = *root;
+  rtems_bdbuf_buffer* p = bdbuf_cache.hash[rtems_bdbuf_hash_index (dd, block)];
 
   while ((p != NULL) && ((p->dd != dd) || (p->block != block)))
-  {
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p = p->avl.right;
-    }
-    else
-    {
-      p = p->avl.left;
-    }
-  }
+    p = p->hash_next;
 
   return p;
 }
 
 /**
- * Inserts the specified node to the AVl-Tree.
+ * Inserts the specified buffer to the hash table.
  *
- * @param root pointer to the root node of the AVL-Tree
- * @param node Pointer to the node to add.
- * @retval 0 The node added successfully
- * @retval -1 An error occurred
+ * @param node Pointer to the buffer to insert
+ * @retval 0 Buffer inserted
+ * @retval -1 A buffer with the same dd/block is already in the hash table
  */
 static int
-rtems_bdbuf_avl_insert(rtems_bdbuf_buffer** root,
-                       rtems_bdbuf_buffer*  node)
+rtems_bdbuf_hash_insert (rtems_bdbuf_buffer* node)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
+  rtems_bdbuf_buffer** bucket;
+  rtems_bdbuf_buffer*  p;
 
-  bool modified = false;
-
-  if (p == NULL)
-  {
-    *root = node;
-    node->avl.left = NULL;
-    node->avl.right = NULL;
-    node->avl.bal = 0;
-    return 0;
-  }
+  bucket = &bdbuf_cache.hash[rtems_bdbuf_hash_index (node->dd, node->block)];
 
-  while (p != NULL)
+  for (p = *bucket; p != NULL; p = p->hash_next)
   {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      q = p->avl.right;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.right = q = node;
-        break;
-      }
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      q = p->avl.left;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.left = q;
-        break;
-      }
-    }
-    else
-    {
+    if ((p->dd == node->dd) && (p->block == node->block))
       return -1;
-    }
-
-    p = q;
   }
 
-  q->avl.left = q->avl.right = NULL;
-  q->avl.bal = 0;
-  modified = true;
-  buf_prev--;
-
-  while (modified)
-  {
-    if (p->avl.cache == -1)
-    {
-      switch (p->avl.bal)
-      {
-        case 1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = -1;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-          if (p1->avl.bal == -1) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-            if (p2->avl.bal == -1) p->avl.bal = +1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = 1;
-          break;
-
-        case 1:
-          p1 = p->avl.right;
-          if (p1->avl.bal == 1) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = +1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    q = p;
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-
-      if (p->avl.cache == -1)
-      {
-        p->avl.left = q;
-      }
-      else
-      {
-        p->avl.right = q;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
-  };
+  node->hash_next = *bucket;
+  *bucket = node;
 
   return 0;
 }
 
-
 /**
- * Removes the node from the tree.
+ * Removes the buffer from the hash table.
  *
- * @param root Pointer to pointer to the root node
- * @param node Pointer to the node to remove
+ * @param node Pointer to the buffer to remove
  * @retval 0 Item removed
  * @retval -1 No such item found
  */
 static int
-rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
-                       const rtems_bdbuf_buffer* node)
+rtems_bdbuf_hash_remove (rtems_bdbuf_buffer* node)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  r;
-  rtems_bdbuf_buffer*  s;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
+  rtems_bdbuf_buffer** p;
 
-  memset (buf_stack, 0, sizeof(buf_stack));
+  p = &bdbuf_cache.hash[rtems_bdbuf_hash_index (node->dd, node->block)];
 
-  while (p != NULL)
+  while (*p != node)
   {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      p = p->avl.right;
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      p = p->avl.left;
-    }
-    else
-    {
-      /* node found */
-      break;
-    }
-  }
-
-  if (p == NULL)
-  {
-    /* there is no such node */
-    return -1;
-  }
-
-  q = p;
-
-  buf_prev--;
-  if (buf_prev > buf_stack)
-  {
-    p = *(buf_prev - 1);
-  }
-  else
-  {
-    p = NULL;
-  }
-
-  /* at this moment q - is a node to delete, p is q's parent */
-  if (q->avl.right == NULL)
-  {
-    r = q->avl.left;
-    if (r != NULL)
-    {
-      r->avl.bal = 0;
-    }
-    q = r;
-  }
-  else
-  {
-    rtems_bdbuf_buffer **t;
-
-    r = q->avl.right;
-
-    if (r->avl.left == NULL)
-    {
-      r->avl.left = q->avl.left;
-      r->avl.bal = q->avl.bal;
-      r->avl.cache = 1;
-      *buf_prev++ = q = r;
-    }
-    else
-    {
-      t = buf_prev++;
-      s = r;
-
-      while (s->avl.left != NULL)
-      {
-        *buf_prev++ = r = s;
-        s = r->avl.left;
-        r->avl.cache = -1;
-      }
-
-      s->avl.left = q->avl.left;
-      r->avl.left = s->avl.right;
-      s->avl.right = q->avl.right;
-      s->avl.bal = q->avl.bal;
-      s->avl.cache = 1;
-
-      *t = q = s;
-    }
-  }
+    if (*p == NULL)
+      return -1;
 
-  if (p != NULL)
-  {
-    if (p->avl.cache == -1)
-    {
-      p->avl.left = q;
-    }
-    else
-    {
-      p->avl.right = q;
-    }
-  }
-  else
-  {
-    *root = q;
+    p = &(*p)->hash_next;
   }
 
-  modified = true;
-
-  while (modified)
-  {
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-    }
-    else
-    {
-      break;
-    }
-
-    if (p->avl.cache == -1)
-    {
-      /* rebalance left branch */
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          break;
-        case  0:
-          p->avl.bal = 1;
-          modified = false;
-          break;
-
-        case +1:
-          p1 = p->avl.right;
-
-          if (p1->avl.bal >= 0) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = -1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = 1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      /* rebalance right branch */
-      switch (p->avl.bal)
-      {
-        case +1:
-          p->avl.bal = 0;
-          break;
-
-        case  0:
-          p->avl.bal = -1;
-          modified = false;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-
-          if (p1->avl.bal <= 0) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = 1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-
-            if (p2->avl.bal == -1) p->avl.bal = 1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-
-    if (buf_prev > buf_stack)
-    {
-      q = *(buf_prev - 1);
-
-      if (q->avl.cache == -1)
-      {
-        q->avl.left = p;
-      }
-      else
-      {
-        q->avl.right = p;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
-
-  }
+  *p = node->hash_next;
+  node->hash_next = NULL;
 
   return 0;
 }
@@ -938,21 +536,21 @@ rtems_bdbuf_has_buffer_waiters (void)
 }
 
 static void
-rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_hash (rtems_bdbuf_buffer *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_remove (bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
 static void
-rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_hash_and_lru_list (rtems_bdbuf_buffer *bd)
 {
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_hash (bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_10);
@@ -965,6 +563,7 @@ static void
 rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_FREE);
+  bd->referenced = false;
   rtems_chain_prepend_unprotected (&bdbuf_cache.lru, &bd->link);
 }
 
@@ -988,7 +587,7 @@ rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
 
   if (bd->waiters == 0)
   {
-    rtems_bdbuf_remove_from_tree (bd);
+    rtems_bdbuf_remove_from_hash (bd);
     rtems_bdbuf_make_free_and_add_to_lru_list (bd);
   }
 }
@@ -1083,7 +682,7 @@ rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
- * from the ALV tree and any lists then the new BD's are prepended to the ready
+ * from the hash table and any lists then the new BD's are prepended to the ready
  * list of the cache.
  *
  * @param group The group to reallocate.
@@ -1107,7 +706,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 0, bd = group->bdbuf;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+    rtems_bdbuf_remove_from_hash_and_lru_list (bd);
 
   group->bds_per_group = new_bds_per_group;
   bufs_per_bd = bdbuf_cache.max_bds_per_group / new_bds_per_group;
@@ -1128,13 +727,12 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
                                 rtems_disk_device  *dd,
                                 rtems_blkdev_bnum   block)
 {
-  bd->dd        = dd ;
-  bd->block     = block;
-  bd->avl.left  = NULL;
-  bd->avl.right = NULL;
-  bd->waiters   = 0;
+  bd->dd         = dd ;
+  bd->block      = block;
+  bd->waiters    = 0;
+  bd->referenced = false;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_insert (bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
@@ -1157,6 +755,26 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
               bd->group - bdbuf_cache.groups, bd->group->users,
               bd->group->bds_per_group, dd->bds_per_group);
 
+    /*
+     * A referenced buffer gets a second chance.  Move it to the end of the
+     * list, so that it is recycled only if it is not hit again until the scan
+     * reaches it the next time.  The last buffer of the list is already at
+     * the end, so it is examined right away.  Otherwise, the scan would end
+     * without a second look at it.
+     */
+    if (bd->referenced)
+    {
+      bd->referenced = false;
+
+      if (!rtems_chain_is_last (node))
+      {
+        node = rtems_chain_next (node);
+        rtems_chain_extract_unprotected (&bd->link);
+        rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+        continue;
+      }
+    }
+
     /*
      * If nobody waits for this BD, we may recycle it.
      */
@@ -1164,7 +782,7 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        rtems_bdbuf_remove_from_hash_and_lru_list (bd);
 
         empty_bd = bd;
       }
@@ -1233,6 +851,7 @@ rtems_bdbuf_swapout_transfer_init (rtems_bdbuf_swapout_transfer* transfer,
   rtems_chain_initialize_empty (&transfer->bds);
   transfer->dd = BDBUF_INVALID_DEV;
   transfer->syncing = false;
+  transfer->urgent = 0;
   transfer->write_req.req = RTEMS_BLKDEV_REQ_WRITE;
   transfer->write_req.done = rtems_bdbuf_transfer_done;
   transfer->write_req.io_task = id;
@@ -1358,6 +977,21 @@ rtems_bdbuf_do_init (void)
   if (!bdbuf_cache.bds)
     goto error;
 
+  /*
+   * Allocate the lookup hash table.  There is at least one bucket for each
+   * buffer descriptor, so the average bucket length stays at or below one.
+   */
+  bdbuf_cache.hash_shift = 31;
+  while ((bdbuf_cache.hash_shift > 1) &&
+         (((size_t) 1 << (32 - bdbuf_cache.hash_shift))
+          < bdbuf_cache.buffer_min_count))
+    --bdbuf_cache.hash_shift;
+
+  bdbuf_cache.hash = calloc (sizeof (rtems_bdbuf_buffer*),
+                             (size_t) 1 << (32 - bdbuf_cache.hash_shift));
+  if (!bdbuf_cache.hash)
+    goto error;
+
   /*
    * Allocate the memory for the buffer descriptors.
    */
@@ -1489,6 +1123,7 @@ error:
 
   free (bdbuf_cache.buffers);
   free (bdbuf_cache.groups);
+  free (bdbuf_cache.hash);
   free (bdbuf_cache.bds);
   free (bdbuf_cache.swapout_transfer);
   free (bdbuf_cache.swapout_workers);
@@ -1689,7 +1324,7 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
   {
     if (bd->state == RTEMS_BDBUF_STATE_EMPTY)
     {
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_hash (bd);
       rtems_bdbuf_make_free_and_add_to_lru_list (bd);
     }
     rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
@@ -1702,7 +1337,7 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_hash_search (dd, block);
 
   if (bd == NULL)
   {
@@ -1729,7 +1364,7 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_hash_search (dd, block);
 
     if (bd != NULL)
     {
@@ -1737,12 +1372,14 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
       {
         if (rtems_bdbuf_wait_for_recycle (bd))
         {
-          rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+          rtems_bdbuf_remove_from_hash_and_lru_list (bd);
           rtems_bdbuf_make_free_and_add_to_lru_list (bd);
           rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
         }
         bd = NULL;
       }
+      else
+        bd->referenced = true;
     }
     else
     {
@@ -2309,6 +1946,12 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
      */
     uint32_t last_block = 0;
 
+    /*
+     * The count of buffers left in the urgent runs at the head of the
+     * transfer list.
+     */
+    uint32_t urgent = transfer->urgent;
+
     rtems_disk_device *dd = transfer->dd;
     uint32_t media_blocks_per_block = dd->media_blocks_per_block;
     bool need_continuous_blocks =
@@ -2359,6 +2002,13 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
         buf->length = dd->block_size;
         buf->buffer = bd->buffer;
         last_block  = bd->block;
+
+        /*
+         * Do not hold back the buffers of sync'ing or waiting users until
+         * the request is filled with buffers nobody waits for.
+         */
+        if (urgent > 0 && --urgent == 0)
+          write = true;
       }
 
       /*
@@ -2401,6 +2051,8 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  * disk.
  * @param chain The modified chain to process.
  * @param transfer The chain to append buffers to be written too.
+ * @param urgent The chain to append buffers to be written too which are
+ *               sync'ed or have waiters.
  * @param sync_active If true this is a sync operation so expire all timers.
  * @param update_timers If true update the timers.
  * @param timer_delta It update_timers is true update the timers by this
@@ -2410,6 +2062,7 @@ static void
 rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
                                          rtems_chain_control* chain,
                                          rtems_chain_control* transfer,
+                                         rtems_chain_control* urgent,
                                          bool                 sync_active,
                                          bool                 update_timers,
                                          uint32_t             timer_delta)
@@ -2472,36 +2125,21 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
       if (bd->dd == *dd_ptr)
       {
         rtems_chain_node* next_node = node->next;
-        rtems_chain_node* tnode = rtems_chain_tail (transfer);
 
         /*
-         * The blocks on the transfer list are sorted in block order. This
-         * means multi-block transfers for drivers that require consecutive
-         * blocks perform better with sorted blocks and for real disks it may
-         * help lower head movement.
+         * The buffers are sorted in block order and merged with adjacent
+         * modified buffers once all buffers of the device are gathered. Keep
+         * the buffers of sync'ing or waiting users apart so that their runs
+         * can be written first.
          */
-
-        rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
-
         rtems_chain_extract_unprotected (node);
 
-        tnode = tnode->previous;
-
-        while (node && !rtems_chain_is_head (transfer, tnode))
-        {
-          rtems_bdbuf_buffer* tbd = (rtems_bdbuf_buffer*) tnode;
-
-          if (bd->block > tbd->block)
-          {
-            rtems_chain_insert_unprotected (tnode, node);
-            node = NULL;
-          }
-          else
-            tnode = tnode->previous;
-        }
+        if (bd->state == RTEMS_BDBUF_STATE_SYNC || bd->waiters > 0)
+          rtems_chain_append_unprotected (urgent, node);
+        else
+          rtems_chain_append_unprotected (transfer, node);
 
-        if (node)
-          rtems_chain_prepend_unprotected (transfer, node);
+        rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
 
         node = next_node;
       }
@@ -2513,6 +2151,244 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
   }
 }
 
+/**
+ * Merge two lists of buffers sorted in block order. The lists are linked
+ * through the next pointer of the chain nodes and are terminated by NULL.
+ *
+ * @param a The first sorted list.
+ * @param b The second sorted list.
+ *
+ * @return The merged sorted list.
+ */
+static rtems_chain_node*
+rtems_bdbuf_swapout_merge_lists (rtems_chain_node* a, rtems_chain_node* b)
+{
+  rtems_chain_node  head;
+  rtems_chain_node* tail = &head;
+
+  while ((a != NULL) && (b != NULL))
+  {
+    if (((rtems_bdbuf_buffer*) a)->block < ((rtems_bdbuf_buffer*) b)->block)
+    {
+      tail->next = a;
+      tail = a;
+      a = a->next;
+    }
+    else
+    {
+      tail->next = b;
+      tail = b;
+      b = b->next;
+    }
+  }
+
+  tail->next = (a != NULL) ? a : b;
+
+  return head.next;
+}
+
+/**
+ * Sort the buffers of a chain in block order. This is a bottom-up merge sort
+ * so the swapout task does not spend quadratic time with a large number of
+ * modified buffers.
+ *
+ * @param chain The chain of buffers to sort. The chain is empty afterwards.
+ *
+ * @return The sorted buffers as a list linked through the next pointer of
+ *         the chain nodes and terminated by NULL.
+ */
+static rtems_chain_node*
+rtems_bdbuf_swapout_sort (rtems_chain_control* chain)
+{
+  rtems_chain_node* parts[32];
+  rtems_chain_node* node;
+  rtems_chain_node* list;
+  size_t            count = 0;
+  size_t            i;
+
+  while ((node = rtems_chain_get_unprotected (chain)) != NULL)
+  {
+    list = node;
+    list->next = NULL;
+
+    for (i = 0; (i < count) && (parts[i] != NULL); ++i)
+    {
+      list = rtems_bdbuf_swapout_merge_lists (parts[i], list);
+      parts[i] = NULL;
+    }
+
+    if (i == count)
+      ++count;
+
+    parts[i] = list;
+  }
+
+  list = NULL;
+
+  for (i = 0; i < count; ++i)
+  {
+    if (parts[i] != NULL)
+      list = rtems_bdbuf_swapout_merge_lists (parts[i], list);
+  }
+
+  return list;
+}
+
+/**
+ * Try to extend a run of the transfer with the buffer of the specified block.
+ * Only modified buffers which are not yet due for the swapout are taken. They
+ * would be written with a separate request later.
+ *
+ * @param dd The device of the transfer.
+ * @param block The media block following the run.
+ * @param run The run to append the buffer to.
+ *
+ * @retval true The buffer was appended to the run.
+ * @retval false There is no modified buffer for this block.
+ */
+static bool
+rtems_bdbuf_swapout_merge (rtems_disk_device*   dd,
+                           rtems_blkdev_bnum    block,
+                           rtems_chain_control* run)
+{
+  rtems_bdbuf_buffer* bd = rtems_bdbuf_hash_search (dd, block);
+
+  if (bd == NULL || bd->state != RTEMS_BDBUF_STATE_MODIFIED)
+    return false;
+
+  rtems_chain_extract_unprotected (&bd->link);
+  rtems_chain_append_unprotected (run, &bd->link);
+  rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
+  ++dd->stats.write_merges;
+
+  return true;
+}
+
+/**
+ * Move a run of buffers to the transfer list. Runs with buffers of sync'ing
+ * or waiting users go to the head of the transfer list, the other runs are
+ * kept on a list which is appended once all runs are done.
+ */
+static void
+rtems_bdbuf_swapout_end_run (rtems_bdbuf_swapout_transfer* transfer,
+                             rtems_chain_control*          run,
+                             rtems_chain_control*          later,
+                             uint32_t                      run_blocks,
+                             bool                          run_urgent)
+{
+  rtems_chain_control* chain;
+  rtems_chain_node*    node;
+
+  if (run_urgent)
+  {
+    chain = &transfer->bds;
+    transfer->urgent += run_blocks;
+  }
+  else
+    chain = later;
+
+  while ((node = rtems_chain_get_unprotected (run)) != NULL)
+    rtems_chain_append_unprotected (chain, node);
+}
+
+/**
+ * Schedule the buffers gathered for the transfer. The buffers are sorted in
+ * block order which means multi-block transfers for drivers that require
+ * consecutive blocks perform better and for real disks it may help lower head
+ * movement. Gaps between the buffers and the end of each run are filled with
+ * modified buffers of the device which are not due yet, as long as a run fits
+ * into one request. The runs containing buffers of sync'ing or waiting users
+ * are written first. The cache must be locked.
+ *
+ * @param transfer The transfer with the gathered buffers. The buffers are on
+ *                 the transfer list in scheduled order afterwards.
+ * @param urgent The gathered buffers of sync'ing or waiting users.
+ */
+static void
+rtems_bdbuf_swapout_schedule (rtems_bdbuf_swapout_transfer* transfer,
+                              rtems_chain_control*          urgent)
+{
+  rtems_disk_device*  dd = transfer->dd;
+  uint32_t            media_blocks_per_block = dd->media_blocks_per_block;
+  uint32_t            max_blocks = bdbuf_config.max_write_blocks;
+  rtems_chain_node*   urgent_list;
+  rtems_chain_node*   normal_list;
+  rtems_chain_control run;
+  rtems_chain_control later;
+  rtems_chain_node*   node;
+  rtems_blkdev_bnum   next_block = 0;
+  uint32_t            run_blocks = 0;
+  bool                run_urgent = false;
+
+  urgent_list = rtems_bdbuf_swapout_sort (urgent);
+  normal_list = rtems_bdbuf_swapout_sort (&transfer->bds);
+  rtems_chain_initialize_empty (&run);
+  rtems_chain_initialize_empty (&later);
+  transfer->urgent = 0;
+
+  while ((urgent_list != NULL) || (normal_list != NULL))
+  {
+    rtems_bdbuf_buffer* bd;
+    bool                is_urgent;
+
+    if ((normal_list == NULL) ||
+        ((urgent_list != NULL) &&
+         (((rtems_bdbuf_buffer*) urgent_list)->block <
+          ((rtems_bdbuf_buffer*) normal_list)->block)))
+    {
+      node = urgent_list;
+      urgent_list = node->next;
+      is_urgent = true;
+    }
+    else
+    {
+      node = normal_list;
+      normal_list = node->next;
+      is_urgent = false;
+    }
+
+    bd = (rtems_bdbuf_buffer*) node;
+
+    while ((run_blocks > 0) && (run_blocks < max_blocks) &&
+           (bd->block != next_block) &&
+           rtems_bdbuf_swapout_merge (dd, next_block, &run))
+    {
+      next_block += media_blocks_per_block;
+      ++run_blocks;
+    }
+
+    if ((run_blocks > 0) &&
+        ((bd->block != next_block) || (run_blocks >= max_blocks)))
+    {
+      rtems_bdbuf_swapout_end_run (transfer, &run, &later,
+                                   run_blocks, run_urgent);
+      run_blocks = 0;
+      run_urgent = false;
+    }
+
+    rtems_chain_append_unprotected (&run, node);
+    next_block = bd->block + media_blocks_per_block;
+    ++run_blocks;
+    run_urgent = run_urgent || is_urgent;
+  }
+
+  if (run_blocks > 0)
+  {
+    while ((run_blocks < max_blocks) &&
+           rtems_bdbuf_swapout_merge (dd, next_block, &run))
+    {
+      next_block += media_blocks_per_block;
+      ++run_blocks;
+    }
+
+    rtems_bdbuf_swapout_end_run (transfer, &run, &later,
+                                 run_blocks, run_urgent);
+  }
+
+  while ((node = rtems_chain_get_unprotected (&later)) != NULL)
+    rtems_chain_append_unprotected (&transfer->bds, node);
+}
+
 /**
  * Process the cache's modified buffers. Check the sync list first then the
  * modified list extracting the buffers suitable to be written to disk. We have
@@ -2537,6 +2413,7 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   rtems_bdbuf_swapout_worker* worker;
   bool                        transfered_buffers = false;
   bool                        sync_active;
+  rtems_chain_control         urgent;
 
   rtems_bdbuf_lock_cache ();
 
@@ -2565,8 +2442,10 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   }
 
   rtems_chain_initialize_empty (&transfer->bds);
+  rtems_chain_initialize_empty (&urgent);
   transfer->dd = BDBUF_INVALID_DEV;
   transfer->syncing = sync_active;
+  transfer->urgent = 0;
 
   /*
    * When the sync is for a device limit the sync to that device. If the sync
@@ -2583,6 +2462,7 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   rtems_bdbuf_swapout_modified_processing (&transfer->dd,
                                            &bdbuf_cache.sync,
                                            &transfer->bds,
+                                           &urgent,
                                            true, false,
                                            timer_delta);
 
@@ -2592,10 +2472,18 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   rtems_bdbuf_swapout_modified_processing (&transfer->dd,
                                            &bdbuf_cache.modified,
                                            &transfer->bds,
+                                           &urgent,
                                            sync_active,
                                            update_timers,
                                            timer_delta);
 
+  /*
+   * Sort the buffers and merge them into runs of consecutive blocks.
+   */
+  if (!rtems_chain_is_empty (&transfer->bds) ||
+      !rtems_chain_is_empty (&urgent))
+    rtems_bdbuf_swapout_schedule (transfer, &urgent);
+
   /*
    * We have all the buffers that have been modified for this device so the
    * cache can be unlocked because the state of each buffer has been set to
@@ -2797,16 +2685,18 @@ static void
 rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
                               const rtems_disk_device *dd)
 {
-  rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
-
-  *prev = NULL;
+  size_t bucket_count = (size_t) 1 << (32 - bdbuf_cache.hash_shift);
+  size_t i;
 
-  while (cur != NULL)
+  for (i = 0; i < bucket_count; ++i)
   {
-    if (cur->dd == dd)
+    rtems_bdbuf_buffer *cur;
+
+    for (cur = bdbuf_cache.hash [i]; cur != NULL; cur = cur->hash_next)
     {
+      if (cur->dd != dd)
+        continue;
+
       switch (cur->state)
       {
         case RTEMS_BDBUF_STATE_FREE:
@@ -2836,37 +2726,6 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
           rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
       }
     }
-
-    if (cur->avl.left != NULL)
-    {
-      /* Left */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.left;
-    }
-    else if (cur->avl.right != NULL)
-    {
-      /* Right */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.right;
-    }
-    else
-    {
-      while (*prev != NULL
-             && (cur == (*prev)->avl.right || (*prev)->avl.right == NULL))
-      {
-        /* Up */
-        cur = *prev;
-        --prev;
-      }
-      if (*prev != NULL)
-        /* Right */
-        cur = (*prev)->avl.right;
-      else
-        /* Finished */
-        cur = NULL;
-    }
   }
 }
 
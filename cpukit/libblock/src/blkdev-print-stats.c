@@ -49,6 +49,13 @@ void rtems_blkdev_print_stats(
   const rtems_printer* printer
 )
 {
+  uint32_t avg_write_blocks = 0;
+
+  if (stats->write_transfers > 0) {
+    avg_write_blocks = (uint32_t)
+      ((100 * (uint64_t) stats->write_blocks) / stats->write_transfers);
+  }
+
   rtems_printf(
      printer,
      "-------------------------------------------------------------------------------\n"
@@ -66,6 +73,8 @@ void rtems_blkdev_print_stats(
      " WRITE TRANSFERS      | %" PRIu32 "\n"
      " WRITE BLOCKS         | %" PRIu32 "\n"
      " WRITE ERRORS         | %" PRIu32 "\n"
+     " WRITE MERGES         | %" PRIu32 "\n"
+     " AVG WRITE BLOCKS     | %" PRIu32 ".%02" PRIu32 "\n"
      "----------------------+--------------------------------------------------------\n",
      media_block_size,
      media_block_count,
@@ -78,6 +87,9 @@ void rtems_blkdev_print_stats(
      stats->read_errors,
      stats->write_transfers,
      stats->write_blocks,
-     stats->write_errors
+     stats->write_errors,
+     stats->write_merges,
+     avg_write_blocks / 100,
+     avg_write_blocks % 100
   );
 }
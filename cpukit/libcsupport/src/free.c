@@ -48,27 +48,41 @@ static RTEMS_CHAIN_DEFINE_EMPTY( _Malloc_GC_list );
 
 RTEMS_INTERRUPT_LOCK_DEFINE( static, _Malloc_GC_lock, "Malloc GC" )
 
-static void *_Malloc_Get_deferred_free( void )
+void _Malloc_Process_deferred_frees( void )
 {
   rtems_interrupt_lock_context lock_context;
-  void *p;
+  rtems_chain_node *to_be_freed;
 
+  /*
+   *  This is only a hint, free's deferred afterwards are done by the next
+   *  call.
+   */
+  if ( rtems_chain_is_empty( &_Malloc_GC_list ) ) {
+    return;
+  }
+
+  /*
+   *  If some free's have been deferred, then do them now.  Detach all of
+   *  them at once, so that the lock is acquired only once per batch.
+   */
   rtems_interrupt_lock_acquire( &_Malloc_GC_lock, &lock_context );
-  p = rtems_chain_get_unprotected( &_Malloc_GC_list );
-  rtems_interrupt_lock_release( &_Malloc_GC_lock, &lock_context );
 
-  return p;
-}
+  if ( rtems_chain_is_empty( &_Malloc_GC_list ) ) {
+    to_be_freed = NULL;
+  } else {
+    to_be_freed = rtems_chain_first( &_Malloc_GC_list );
+    rtems_chain_last( &_Malloc_GC_list )->next = NULL;
+    rtems_chain_initialize_empty( &_Malloc_GC_list );
+  }
 
-void _Malloc_Process_deferred_frees( void )
-{
-  rtems_chain_node *to_be_freed;
+  rtems_interrupt_lock_release( &_Malloc_GC_lock, &lock_context );
 
-  /*
-   *  If some free's have been deferred, then do them now.
-   */
-  while ( ( to_be_freed = _Malloc_Get_deferred_free() ) != NULL ) {
+  while ( to_be_freed != NULL ) {
+    rtems_chain_node *next;
+
+    next = to_be_freed->next;
     free( to_be_freed );
+    to_be_freed = next;
   }
 }
 
@@ -100,6 +114,13 @@ void free(
       return;
   }
 
+  if (
+    _Malloc_Cache_handler != NULL
+      && ( *_Malloc_Cache_handler->free )( ptr )
+  ) {
+    return;
+  }
+
   if ( !_Protected_heap_Free( RTEMS_Malloc_Heap, ptr ) ) {
     rtems_fatal( RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE, (rtems_fatal_code) ptr );
   }
@@ -85,6 +85,16 @@ void *rtems_heap_allocate_aligned_with_boundary(
 
   switch ( _Malloc_System_state() ) {
     case MALLOC_SYSTEM_STATE_NORMAL:
+      if (
+        _Malloc_Cache_handler != NULL && alignment == 0 && boundary == 0
+      ) {
+        p = ( *_Malloc_Cache_handler->allocate )( size );
+
+        if ( p != NULL ) {
+          break;
+        }
+      }
+
       _RTEMS_Lock_allocator();
       _Malloc_Process_deferred_frees();
       p = _Heap_Allocate_aligned_with_boundary(
@@ -0,0 +1,422 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup MallocSupport
+ *
+ * @brief This source file contains the implementation of the per-processor
+ *   small object cache of the C program heap.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "malloc_p.h"
+
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/percpudata.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threaddispatch.h>
+
+#include <string.h>
+
+/*
+ * The size classes are multiples of the class granule.  Each size class is
+ * an integral multiple of CPU_HEAP_ALIGNMENT, so that the first two words of
+ * a cached memory area may be used as the free list link and the tag.
+ */
+#define MALLOC_CACHE_CLASS_GRANULE 16
+
+#define MALLOC_CACHE_CLASS_COUNT 8
+
+#define MALLOC_CACHE_CLASS_MAX_SIZE 256
+
+/*
+ * This is the maximum count of memory areas held per size class and
+ * processor.
+ */
+#define MALLOC_CACHE_DEPTH 32
+
+/*
+ * This is the count of memory areas allocated from the heap to refill an
+ * empty free list.
+ */
+#define MALLOC_CACHE_BATCH ( MALLOC_CACHE_DEPTH / 2 )
+
+RTEMS_STATIC_ASSERT(
+  MALLOC_CACHE_CLASS_GRANULE % CPU_HEAP_ALIGNMENT == 0,
+  MALLOC_CACHE_CLASS_GRANULE
+);
+
+RTEMS_STATIC_ASSERT(
+  MALLOC_CACHE_CLASS_GRANULE >= 2 * sizeof( uintptr_t ),
+  MALLOC_CACHE_CLASS_GRANULE_WORDS
+);
+
+typedef struct {
+  void     *first;
+  uint32_t  count;
+} Malloc_Cache_class;
+
+typedef struct {
+  Malloc_Cache_class Classes[ MALLOC_CACHE_CLASS_COUNT ];
+  uint64_t           allocs;
+  uint64_t           frees;
+  uint64_t           refills;
+  uint64_t           drains;
+} Malloc_Per_CPU_cache;
+
+PER_CPU_DATA_NEED_INITIALIZATION();
+
+static PER_CPU_DATA_ITEM( Malloc_Per_CPU_cache, _Malloc_Per_CPU_cache );
+
+static const uint16_t _Malloc_Cache_class_sizes[ MALLOC_CACHE_CLASS_COUNT ] = {
+  16, 32, 48, 64, 96, 128, 192, 256
+};
+
+/*
+ * Maps ( size - 1 ) / MALLOC_CACHE_CLASS_GRANULE to the smallest size class
+ * which is greater than or equal to the size.
+ */
+static const uint8_t _Malloc_Cache_class_map[
+  MALLOC_CACHE_CLASS_MAX_SIZE / MALLOC_CACHE_CLASS_GRANULE
+] = {
+  0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7
+};
+
+static Malloc_Per_CPU_cache *_Malloc_Cache_get( Per_CPU_Control *cpu )
+{
+  Malloc_Per_CPU_cache *cache;
+
+  cache = PER_CPU_DATA_GET( cpu, Malloc_Per_CPU_cache, _Malloc_Per_CPU_cache );
+  return cache;
+}
+
+/*
+ * The second word of a cached memory area contains a tag which depends on the
+ * address of the area.  It is used to detect a free of a memory area which is
+ * already in a cache.  For the heap, a cached memory area is still allocated.
+ * The tag is only a hint, since the application may store the same value in
+ * an allocated memory area.
+ */
+static uintptr_t *_Malloc_Cache_tag_of_area( void *ptr )
+{
+  return &( (uintptr_t *) ptr )[ 1 ];
+}
+
+static uintptr_t _Malloc_Cache_tag( const void *ptr )
+{
+  return ~(uintptr_t) ptr ^ (uintptr_t) 0x6d63616cU;
+}
+
+static void _Malloc_Cache_push( Malloc_Cache_class *cls, void *ptr )
+{
+  *(void **) ptr = cls->first;
+  *_Malloc_Cache_tag_of_area( ptr ) = _Malloc_Cache_tag( ptr );
+  cls->first = ptr;
+  ++cls->count;
+}
+
+static void *_Malloc_Cache_pop( Malloc_Cache_class *cls )
+{
+  void *ptr;
+
+  ptr = cls->first;
+
+  if ( ptr != NULL ) {
+    cls->first = *(void **) ptr;
+    *_Malloc_Cache_tag_of_area( ptr ) = 0;
+    --cls->count;
+  }
+
+  return ptr;
+}
+
+static bool _Malloc_Cache_contains(
+  const Malloc_Cache_class *cls,
+  const void               *ptr
+)
+{
+  const void *other;
+
+  other = cls->first;
+
+  while ( other != NULL ) {
+    if ( other == ptr ) {
+      return true;
+    }
+
+    other = *(void * const *) other;
+  }
+
+  return false;
+}
+
+static void *_Malloc_Cache_refill( size_t index )
+{
+  Heap_Control         *heap;
+  uintptr_t             class_size;
+  Per_CPU_Control      *cpu_self;
+  Malloc_Per_CPU_cache *cache;
+  Malloc_Cache_class   *cls;
+  void                 *ptr;
+
+  heap = RTEMS_Malloc_Heap;
+  class_size = _Malloc_Cache_class_sizes[ index ];
+
+  _RTEMS_Lock_allocator();
+
+  /*
+   * Deferred frees may end up in the free list of this processor, so process
+   * them before we look at the free list again.
+   */
+  _Malloc_Process_deferred_frees();
+
+  cpu_self = _Thread_Dispatch_disable();
+  cache = _Malloc_Cache_get( cpu_self );
+  cls = &cache->Classes[ index ];
+  ptr = _Malloc_Cache_pop( cls );
+
+  if ( ptr == NULL ) {
+    ptr = _Heap_Allocate( heap, class_size );
+
+    if ( ptr != NULL ) {
+      uint32_t i;
+
+      ++cache->refills;
+
+      for ( i = 1; i < MALLOC_CACHE_BATCH; ++i ) {
+        void *other;
+
+        other = _Heap_Allocate( heap, class_size );
+
+        if ( other == NULL ) {
+          break;
+        }
+
+        _Malloc_Cache_push( cls, other );
+      }
+    }
+  }
+
+  if ( ptr != NULL ) {
+    ++cache->allocs;
+  }
+
+  _Thread_Dispatch_enable( cpu_self );
+  _RTEMS_Unlock_allocator();
+  return ptr;
+}
+
+static void *_Malloc_Cache_allocate( size_t size )
+{
+  size_t                index;
+  Per_CPU_Control      *cpu_self;
+  Malloc_Per_CPU_cache *cache;
+  void                 *ptr;
+
+  /* A size of zero wraps around and is handled by the heap */
+  if ( size - 1 >= MALLOC_CACHE_CLASS_MAX_SIZE ) {
+    return NULL;
+  }
+
+  index = _Malloc_Cache_class_map[ ( size - 1 ) / MALLOC_CACHE_CLASS_GRANULE ];
+  cpu_self = _Thread_Dispatch_disable();
+  cache = _Malloc_Cache_get( cpu_self );
+  ptr = _Malloc_Cache_pop( &cache->Classes[ index ] );
+
+  if ( ptr != NULL ) {
+    ++cache->allocs;
+    _Thread_Dispatch_enable( cpu_self );
+    return ptr;
+  }
+
+  _Thread_Dispatch_enable( cpu_self );
+  return _Malloc_Cache_refill( index );
+}
+
+static bool _Malloc_Cache_get_class_of_area(
+  const Heap_Control *heap,
+  uintptr_t           area_size,
+  size_t             *index
+)
+{
+  size_t i;
+
+  if ( area_size < _Malloc_Cache_class_sizes[ 0 ] ) {
+    return false;
+  }
+
+  if ( area_size > MALLOC_CACHE_CLASS_MAX_SIZE ) {
+    i = MALLOC_CACHE_CLASS_COUNT - 1;
+  } else {
+    i = _Malloc_Cache_class_map[
+      ( area_size - 1 ) / MALLOC_CACHE_CLASS_GRANULE
+    ];
+
+    if ( _Malloc_Cache_class_sizes[ i ] > area_size ) {
+      --i;
+    }
+  }
+
+  /*
+   * Do not cache memory areas which are considerably larger than the size
+   * class.  The heap may hand out up to a page plus a minimum block more than
+   * requested.
+   */
+  if (
+    area_size - _Malloc_Cache_class_sizes[ i ]
+      >= heap->min_block_size + heap->page_size
+  ) {
+    return false;
+  }
+
+  *index = i;
+  return true;
+}
+
+static void _Malloc_Cache_drain( size_t index, void *ptr )
+{
+  Heap_Control         *heap;
+  Per_CPU_Control      *cpu_self;
+  Malloc_Per_CPU_cache *cache;
+  Malloc_Cache_class   *cls;
+
+  heap = RTEMS_Malloc_Heap;
+
+  _RTEMS_Lock_allocator();
+  cpu_self = _Thread_Dispatch_disable();
+  cache = _Malloc_Cache_get( cpu_self );
+  cls = &cache->Classes[ index ];
+
+  if ( cls->count >= MALLOC_CACHE_DEPTH ) {
+    ++cache->drains;
+
+    while ( cls->count > MALLOC_CACHE_DEPTH - MALLOC_CACHE_BATCH ) {
+      (void) _Heap_Free( heap, _Malloc_Cache_pop( cls ) );
+    }
+  }
+
+  _Malloc_Cache_push( cls, ptr );
+  ++cache->frees;
+  _Thread_Dispatch_enable( cpu_self );
+  _RTEMS_Unlock_allocator();
+}
+
+static bool _Malloc_Cache_free( void *ptr )
+{
+  Heap_Control         *heap;
+  uintptr_t             area_size;
+  size_t                index;
+  Per_CPU_Control      *cpu_self;
+  Malloc_Per_CPU_cache *cache;
+  Malloc_Cache_class   *cls;
+
+  heap = RTEMS_Malloc_Heap;
+
+  /*
+   * The block of an allocated memory area is owned by the caller, so its size
+   * is stable without the allocator lock.
+   */
+  if ( !_Heap_Size_of_alloc_area( heap, ptr, &area_size ) ) {
+    return false;
+  }
+
+  if ( !_Malloc_Cache_get_class_of_area( heap, area_size, &index ) ) {
+    return false;
+  }
+
+  cpu_self = _Thread_Dispatch_disable();
+  cache = _Malloc_Cache_get( cpu_self );
+  cls = &cache->Classes[ index ];
+
+  /*
+   * A matching tag is confirmed by the free list of this processor.  The free
+   * lists of other processors cannot be examined without synchronization, so
+   * a double free of a memory area cached by another processor is not
+   * detected.
+   */
+  if (
+    *_Malloc_Cache_tag_of_area( ptr ) == _Malloc_Cache_tag( ptr ) &&
+      _Malloc_Cache_contains( cls, ptr )
+  ) {
+    _Thread_Dispatch_enable( cpu_self );
+    rtems_fatal( RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE, (rtems_fatal_code) ptr );
+  }
+
+  if ( cls->count < MALLOC_CACHE_DEPTH ) {
+    _Malloc_Cache_push( cls, ptr );
+    ++cache->frees;
+    _Thread_Dispatch_enable( cpu_self );
+    return true;
+  }
+
+  _Thread_Dispatch_enable( cpu_self );
+  _Malloc_Cache_drain( index, ptr );
+  return true;
+}
+
+static void _Malloc_Cache_get_information( Heap_Cache_information *info )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  memset( info, 0, sizeof( *info ) );
+  cpu_max = _SMP_Get_processor_maximum();
+
+  /*
+   * The counters of other processors are read without synchronization, so
+   * the information is only a snapshot.
+   */
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    const Malloc_Per_CPU_cache *cache;
+    size_t                      i;
+
+    cache = _Malloc_Cache_get( _Per_CPU_Get_by_index( cpu_index ) );
+    info->allocs += cache->allocs;
+    info->frees += cache->frees;
+    info->refills += cache->refills;
+    info->drains += cache->drains;
+
+    for ( i = 0; i < MALLOC_CACHE_CLASS_COUNT; ++i ) {
+      uint32_t count;
+
+      count = cache->Classes[ i ].count;
+      info->blocks += count;
+      info->total += count * (uintptr_t) _Malloc_Cache_class_sizes[ i ];
+    }
+  }
+}
+
+const Malloc_Cache_handler _Malloc_Per_CPU_cache_handler = {
+  .allocate = _Malloc_Cache_allocate,
+  .free = _Malloc_Cache_free,
+  .get_information = _Malloc_Cache_get_information
+};
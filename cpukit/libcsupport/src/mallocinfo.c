@@ -48,5 +48,10 @@ int malloc_info(
     return -1;
 
   _Protected_heap_Get_information( RTEMS_Malloc_Heap, the_info );
+
+  if ( _Malloc_Cache_handler != NULL ) {
+    ( *_Malloc_Cache_handler->get_information )( &the_info->Cache );
+  }
+
   return 0;
 }
@@ -49,78 +49,66 @@ fat_cluster_num_to_block_num (const fat_fs_info_t *fs_info,
     return blk;
 }
 
-int
-fat_buf_access(fat_fs_info_t   *fs_info,
-               const uint32_t   sec_num,
-               const int        op_type,
-               uint8_t        **sec_buf)
+static void
+fat_buf_init_entry(fat_cache_t *c, uint32_t blk)
 {
-    rtems_status_code sc = RTEMS_SUCCESSFUL;
-    uint32_t          blk = fat_sector_num_to_block_num (fs_info,
-                                                         sec_num);
-    uint32_t          blk_ofs = fat_sector_offset_to_block_offset (fs_info,
-                                                                   sec_num,
-                                                                   0);
+    c->blk_num = blk;
+    c->modified = false;
+    c->state = FAT_CACHE_ACTUAL;
+    c->fat_sec_first = UINT32_MAX;
+    c->fat_sec_last = 0;
+}
 
-    if (fs_info->c.state == FAT_CACHE_EMPTY || fs_info->c.blk_num != sec_num)
+static fat_cache_t *
+fat_buf_find(fat_fs_info_t *fs_info, uint32_t blk)
+{
+    uint32_t i;
+
+    for (i = 0; i < fs_info->c_count; i++)
     {
-        fat_buf_release(fs_info);
+        fat_cache_t *c = &fs_info->c[i];
 
-        if (op_type == FAT_OP_TYPE_READ)
-            sc = rtems_bdbuf_read(fs_info->vol.dd, blk, &fs_info->c.buf);
-        else
-            sc = rtems_bdbuf_get(fs_info->vol.dd, blk, &fs_info->c.buf);
-        if (sc != RTEMS_SUCCESSFUL)
-            rtems_set_errno_and_return_minus_one(EIO);
-        fs_info->c.blk_num = sec_num;
-        fs_info->c.modified = 0;
-        fs_info->c.state = FAT_CACHE_ACTUAL;
+        if (c->state != FAT_CACHE_EMPTY && c->blk_num == blk)
+            return c;
     }
-    *sec_buf = &fs_info->c.buf->buffer[blk_ofs];
-    return RC_OK;
+
+    return NULL;
 }
 
-int
-fat_buf_release(fat_fs_info_t *fs_info)
+/* fat_buf_mirror_fat --
+ *     Copy the modified sectors of the active FAT held by a cache entry to
+ *     the other FATs. A block of the other FATs which is held by the cache
+ *     itself is updated in place, since obtaining it a second time from
+ *     the bdbuf would dead lock.
+ */
+static int
+fat_buf_mirror_fat(fat_fs_info_t *fs_info, const fat_cache_t *c)
 {
     rtems_status_code sc = RTEMS_SUCCESSFUL;
+    uint32_t          sec_num;
+    uint8_t           i;
 
-    if (fs_info->c.state == FAT_CACHE_EMPTY)
-        return RC_OK;
-
-    if (fs_info->c.modified)
+    for (i = 1; i < fs_info->vol.fats; i++)
     {
-        uint32_t sec_num = fs_info->c.blk_num;
-        bool     sec_of_fat = ((sec_num >= fs_info->vol.fat_loc) &&
-                              (sec_num < fs_info->vol.rdir_loc));
-        uint32_t blk_ofs = fat_sector_offset_to_block_offset(fs_info,
-                                                             sec_num,
-                                                             0);
-
-        if (sec_of_fat && !fs_info->vol.mirror)
-            memcpy(fs_info->sec_buf,
-                   fs_info->c.buf->buffer + blk_ofs,
-                   fs_info->vol.bps);
-
-        sc = rtems_bdbuf_release_modified(fs_info->c.buf);
-        if (sc != RTEMS_SUCCESSFUL)
-            rtems_set_errno_and_return_minus_one(EIO);
-        fs_info->c.modified = 0;
-
-        if (sec_of_fat && !fs_info->vol.mirror)
+        for (sec_num = c->fat_sec_first; sec_num <= c->fat_sec_last; sec_num++)
         {
-            uint8_t i;
-
-            for (i = 1; i < fs_info->vol.fats; i++)
+            const uint8_t *src = c->buf->buffer +
+                fat_sector_offset_to_block_offset(fs_info, sec_num, 0);
+            uint32_t       dst_sec = sec_num + fs_info->vol.fat_length * i;
+            uint32_t       blk = fat_sector_num_to_block_num(fs_info, dst_sec);
+            uint32_t       blk_ofs = fat_sector_offset_to_block_offset(fs_info,
+                                                                       dst_sec,
+                                                                       0);
+            fat_cache_t   *dst = fat_buf_find(fs_info, blk);
+
+            if (dst != NULL)
+            {
+                memcpy(dst->buf->buffer + blk_ofs, src, fs_info->vol.bps);
+                dst->modified = true;
+            }
+            else
             {
                 rtems_bdbuf_buffer *bd;
-                uint32_t blk;
-
-                sec_num = fs_info->c.blk_num + fs_info->vol.fat_length * i,
-                blk = fat_sector_num_to_block_num(fs_info, sec_num);
-                blk_ofs = fat_sector_offset_to_block_offset(fs_info,
-                                                            sec_num,
-                                                            0);
 
                 if (blk_ofs == 0
                     && fs_info->vol.bps == fs_info->vol.bytes_per_block)
@@ -133,23 +121,119 @@ fat_buf_release(fat_fs_info_t *fs_info)
                 }
                 if ( sc != RTEMS_SUCCESSFUL)
                     rtems_set_errno_and_return_minus_one(ENOMEM);
-                memcpy(bd->buffer + blk_ofs, fs_info->sec_buf, fs_info->vol.bps);
+                memcpy(bd->buffer + blk_ofs, src, fs_info->vol.bps);
                 sc = rtems_bdbuf_release_modified(bd);
                 if ( sc != RTEMS_SUCCESSFUL)
                     rtems_set_errno_and_return_minus_one(ENOMEM);
             }
         }
     }
+
+    return RC_OK;
+}
+
+static int
+fat_buf_release_entry(fat_fs_info_t *fs_info, fat_cache_t *c)
+{
+    rtems_status_code sc = RTEMS_SUCCESSFUL;
+    int               rc = RC_OK;
+
+    if (c->state == FAT_CACHE_EMPTY)
+        return RC_OK;
+
+    if (c->modified)
+    {
+        if (c->fat_sec_first <= c->fat_sec_last && !fs_info->vol.mirror)
+            rc = fat_buf_mirror_fat(fs_info, c);
+
+        sc = rtems_bdbuf_release_modified(c->buf);
+    }
     else
     {
-        sc = rtems_bdbuf_release(fs_info->c.buf);
+        sc = rtems_bdbuf_release(c->buf);
+    }
+    c->state = FAT_CACHE_EMPTY;
+    if (sc != RTEMS_SUCCESSFUL)
+        rtems_set_errno_and_return_minus_one(EIO);
+
+    return rc;
+}
+
+int
+fat_buf_access(fat_fs_info_t   *fs_info,
+               const uint32_t   sec_num,
+               const int        op_type,
+               uint8_t        **sec_buf)
+{
+    rtems_status_code sc = RTEMS_SUCCESSFUL;
+    uint32_t          blk = fat_sector_num_to_block_num (fs_info,
+                                                         sec_num);
+    uint32_t          blk_ofs = fat_sector_offset_to_block_offset (fs_info,
+                                                                   sec_num,
+                                                                   0);
+    fat_cache_t      *c = NULL;
+    uint32_t          i;
+
+    /*
+     * Look for the block and otherwise choose an empty entry or the least
+     * recently used one.
+     */
+    for (i = 0; i < fs_info->c_count; i++)
+    {
+        fat_cache_t *e = &fs_info->c[i];
+
+        if (e->state == FAT_CACHE_EMPTY)
+        {
+            if (c == NULL || c->state != FAT_CACHE_EMPTY)
+                c = e;
+        }
+        else if (e->blk_num == blk)
+        {
+            c = e;
+            break;
+        }
+        else if (c == NULL || (c->state != FAT_CACHE_EMPTY &&
+                               (int32_t) (e->last_use - c->last_use) < 0))
+        {
+            c = e;
+        }
+    }
+
+    if (c->state == FAT_CACHE_EMPTY || c->blk_num != blk)
+    {
+        if (fat_buf_release_entry(fs_info, c) != RC_OK)
+            return -1;
+
+        if (op_type == FAT_OP_TYPE_READ)
+            sc = rtems_bdbuf_read(fs_info->vol.dd, blk, &c->buf);
+        else
+            sc = rtems_bdbuf_get(fs_info->vol.dd, blk, &c->buf);
         if (sc != RTEMS_SUCCESSFUL)
             rtems_set_errno_and_return_minus_one(EIO);
+        fat_buf_init_entry(c, blk);
     }
-    fs_info->c.state = FAT_CACHE_EMPTY;
+    c->last_use = ++fs_info->c_stamp;
+    fs_info->c_cur = c;
+    fs_info->c_sec = sec_num;
+    *sec_buf = &c->buf->buffer[blk_ofs];
     return RC_OK;
 }
 
+int
+fat_buf_release(fat_fs_info_t *fs_info)
+{
+    int      rc = RC_OK;
+    uint32_t i;
+
+    for (i = 0; i < fs_info->c_count; i++)
+    {
+        if (fat_buf_release_entry(fs_info, &fs_info->c[i]) != RC_OK)
+            rc = -1;
+    }
+
+    return rc;
+}
+
 /* _fat_block_read --
  *     This function reads 'count' bytes from device filesystem is mounted on,
  *     starts at 'start+offset' position where 'start' computed in sectors
@@ -189,13 +273,17 @@ _fat_block_read(
         if (rc != RC_OK)
             return -1;
 
-        c = MIN(count, (fs_info->vol.bps - ofs));
+        /* copy up to the end of the block held by the cache */
+        c = MIN(count, (fs_info->vol.bytes_per_block -
+                        fat_sector_offset_to_block_offset(fs_info, sec_num,
+                                                          ofs)));
         memcpy((buff + cmpltd), (sec_buf + ofs), c);
 
         count -= c;
         cmpltd += c;
-        sec_num++;
-        ofs = 0;
+        ofs += c;
+        sec_num += ofs >> fs_info->vol.sec_log2;
+        ofs &= fs_info->vol.bps - 1;
     }
     return cmpltd;
 }
@@ -489,6 +577,8 @@ fat_init_volume_info(fat_fs_info_t *fs_info, const char *device)
     int                 i = 0;
     rtems_bdbuf_buffer *block = NULL;
 
+    fs_info->c_count = 1;
+
     vol->fd = open(device, O_RDWR);
     if (vol->fd < 0)
     {
@@ -775,6 +865,19 @@ fat_init_volume_info(fat_fs_info_t *fs_info, const char *device)
         }
     }
 
+    /*
+     * Hold at most half of the blocks the bdbuf cache provides for the block
+     * size, otherwise the cache may run out of buffers for other users.
+     */
+    fs_info->c_count = (rtems_bdbuf_configuration.size /
+                        rtems_bdbuf_configuration.buffer_max) *
+                       (rtems_bdbuf_configuration.buffer_max /
+                        vol->bytes_per_block) / 2;
+    if (fs_info->c_count > FAT_CACHE_ENTRIES)
+        fs_info->c_count = FAT_CACHE_ENTRIES;
+    if (fs_info->c_count == 0)
+        fs_info->c_count = 1;
+
     return RC_OK;
 }
 
@@ -336,12 +336,26 @@ typedef struct fat_vol_s
 } fat_vol_t;
 
 
+/*
+ * Count of bdbuf blocks the FAT layer may keep accessed at the same time.
+ * FAT, directory and file data accesses of an operation usually touch
+ * different blocks, with a single entry each of them would release and
+ * re-obtain the buffer of the others.  The count actually used is limited
+ * further by the size of the bdbuf cache, see fat_init_volume_info().
+ */
+#ifndef FAT_CACHE_ENTRIES
+#define FAT_CACHE_ENTRIES 4
+#endif
+
 typedef struct fat_cache_s
 {
     uint32_t            blk_num;
     bool                modified;
     uint8_t             state;
     rtems_bdbuf_buffer *buf;
+    uint32_t            fat_sec_first; /* modified sectors of the active FAT */
+    uint32_t            fat_sec_last;
+    uint32_t            last_use;      /* for LRU replacement */
 } fat_cache_t;
 
 /*
@@ -357,7 +371,11 @@ typedef struct fat_fs_info_s
     uint32_t             index;
     uint32_t             uino_pool_size; /* size */
     uint32_t             uino_base;
-    fat_cache_t          c;             /* cache */
+    fat_cache_t          c[FAT_CACHE_ENTRIES]; /* cache */
+    fat_cache_t         *c_cur;         /* cache entry of the last access */
+    uint32_t             c_sec;         /* sector of the last access */
+    uint32_t             c_count;       /* number of cache entries in use */
+    uint32_t             c_stamp;       /* cache access counter */
     uint8_t             *sec_buf; /* just placeholder for anything */
 } fat_fs_info_t;
 
@@ -480,7 +498,18 @@ static inline uint32_t
 static inline void
 fat_buf_mark_modified(fat_fs_info_t *fs_info)
 {
-    fs_info->c.modified = true;
+    fat_cache_t *c = fs_info->c_cur;
+    uint32_t     sec_num = fs_info->c_sec;
+
+    c->modified = true;
+
+    if ((sec_num >= fs_info->vol.fat_loc) && (sec_num < fs_info->vol.rdir_loc))
+    {
+        if (sec_num < c->fat_sec_first)
+            c->fat_sec_first = sec_num;
+        if (sec_num > c->fat_sec_last)
+            c->fat_sec_last = sec_num;
+    }
 }
 
 int
@@ -59,6 +59,12 @@ fat_file_lseek(
     uint32_t                              *disk_cln
 );
 
+static void
+fat_file_extents_trim(fat_file_fd_t *fat_fd, uint32_t file_cln);
+
+static void
+fat_file_extents_free(fat_file_fd_t *fat_fd);
+
 /* fat_file_open --
  *     Open fat-file. Two hash tables are accessed by key
  *     constructed from cluster num and offset of the node (i.e.
@@ -324,11 +330,14 @@ fat_file_close(
                 if (fat_ino_is_unique(fs_info, fat_fd->ino))
                     fat_free_unique_ino(fs_info, fat_fd->ino);
 
+                fat_file_extents_free(fat_fd);
                 free(fat_fd);
             }
         }
         else
         {
+            fat_file_extents_free(fat_fd);
+
             if (fat_ino_is_unique(fs_info, fat_fd->ino))
             {
                 fat_fd->links_num = 0;
@@ -436,12 +445,21 @@ fat_file_read(
         if ( rc != RC_OK )
             return rc;
 
-        sec_peek = fat_cluster_num_to_sector_num(fs_info, cur_cln);
-        blk = fat_sector_num_to_block_num (fs_info, sec_peek);
-        blk_cnt = fs_info->vol.bpc >> fs_info->vol.bytes_per_block_log2;
-        if (blk_cnt == 0)
-            blk_cnt = 1;
-        fat_block_peek(fs_info, blk, blk_cnt);
+        /*
+         * Read ahead the next cluster only if the chain continues elsewhere
+         * on the disk.  The sequential read-ahead of the bdbuf covers
+         * contiguous clusters and a peek would restart it.
+         */
+        if ((cur_cln & fs_info->vol.mask) < fs_info->vol.eoc_val &&
+            cur_cln != save_cln + 1)
+        {
+            sec_peek = fat_cluster_num_to_sector_num(fs_info, cur_cln);
+            blk = fat_sector_num_to_block_num (fs_info, sec_peek);
+            blk_cnt = fs_info->vol.bpc >> fs_info->vol.bytes_per_block_log2;
+            if (blk_cnt == 0)
+                blk_cnt = 1;
+            fat_block_peek(fs_info, blk, blk_cnt);
+        }
 
         sec += (ofs >> fs_info->vol.sec_log2);
         byte = ofs & (fs_info->vol.bps - 1);
@@ -849,6 +867,8 @@ fat_file_truncate(
     if (rc != RC_OK)
         return rc;
 
+    fat_file_extents_trim(fat_fd, cl_start);
+
     rc = fat_free_fat_clusters_chain(fs_info, cur_cln);
     if (rc != RC_OK)
         return rc;
@@ -1103,6 +1123,170 @@ _hash_search(
     return -1;
 }
 
+/* extent map support routines */
+
+static void
+fat_file_extents_free(fat_file_fd_t *fat_fd)
+{
+    free(fat_fd->map.ext);
+    fat_fd->map.ext = NULL;
+    fat_fd->map.ext_num = 0;
+    fat_fd->map.ext_size = 0;
+}
+
+/* fat_file_extents_trim --
+ *     Forget the mapping of all clusters from 'file_cln' on.
+ */
+static void
+fat_file_extents_trim(fat_file_fd_t *fat_fd, uint32_t file_cln)
+{
+    while (fat_fd->map.ext_num > 0)
+    {
+        fat_file_extent_t *e = &fat_fd->map.ext[fat_fd->map.ext_num - 1];
+
+        if (e->file_cln >= file_cln)
+            --fat_fd->map.ext_num;
+        else
+        {
+            if (e->file_cln + e->count > file_cln)
+                e->count = file_cln - e->file_cln;
+            break;
+        }
+    }
+}
+
+/* fat_file_extents_add --
+ *     Append the next cluster of the chain to the extent map.
+ *
+ * RETURNS:
+ *     true if the cluster is recorded, false if the map is full
+ */
+static bool
+fat_file_extents_add(fat_file_fd_t *fat_fd, uint32_t file_cln,
+                     uint32_t disk_cln)
+{
+    fat_file_map_t    *map = &fat_fd->map;
+    fat_file_extent_t *e;
+
+    if (map->ext_num > 0)
+    {
+        e = &map->ext[map->ext_num - 1];
+
+        if (e->disk_cln + e->count == disk_cln)
+        {
+            ++e->count;
+            return true;
+        }
+    }
+
+    if (map->ext_num == map->ext_size)
+    {
+        uint32_t size = map->ext_size > 0 ? 2 * map->ext_size : 4;
+
+        if (size > FAT_FILE_EXTENTS_MAX)
+            size = FAT_FILE_EXTENTS_MAX;
+
+        if (size <= map->ext_size)
+            return false;
+
+        e = realloc(map->ext, size * sizeof(*e));
+        if (e == NULL)
+            return false;
+
+        map->ext = e;
+        map->ext_size = size;
+    }
+
+    e = &map->ext[map->ext_num];
+    e->file_cln = file_cln;
+    e->disk_cln = disk_cln;
+    e->count = 1;
+    ++map->ext_num;
+
+    return true;
+}
+
+/* fat_file_extents_lseek --
+ *     Map a cluster of the fat-file with the extent map.  The map is
+ *     extended up to the cluster if necessary.  Once it is full the rest of
+ *     the chain is walked as usual.
+ */
+static int
+fat_file_extents_lseek(
+    fat_fs_info_t                         *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                              *disk_cln
+    )
+{
+    fat_file_map_t    *map = &fat_fd->map;
+    fat_file_extent_t *e;
+    uint32_t           cur_cln;
+    uint32_t           pos;
+    bool               record = true;
+
+    /* the first cluster may be changed behind our back */
+    if (map->ext_num > 0 && map->ext_cln != fat_fd->cln)
+        map->ext_num = 0;
+
+    if (map->ext_num == 0)
+    {
+        if (!fat_file_extents_add(fat_fd, 0, fat_fd->cln))
+            return -1;
+        map->ext_cln = fat_fd->cln;
+    }
+
+    e = &map->ext[map->ext_num - 1];
+    pos = e->file_cln + e->count - 1;
+
+    if (file_cln <= pos)
+    {
+        uint32_t lo = 0;
+        uint32_t hi = map->ext_num - 1;
+
+        while (lo < hi)
+        {
+            uint32_t mid = lo + (hi - lo + 1) / 2;
+
+            if (map->ext[mid].file_cln <= file_cln)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+
+        e = &map->ext[lo];
+        *disk_cln = e->disk_cln + (file_cln - e->file_cln);
+        return RC_OK;
+    }
+
+    cur_cln = e->disk_cln + e->count - 1;
+
+    /* without recording the single entry cache may be closer */
+    if (map->ext_num == FAT_FILE_EXTENTS_MAX &&
+        map->file_cln > pos && map->file_cln <= file_cln)
+    {
+        pos = map->file_cln;
+        cur_cln = map->disk_cln;
+        record = false;
+    }
+
+    while (pos < file_cln)
+    {
+        int rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+        if ( rc != RC_OK )
+            return rc;
+
+        ++pos;
+
+        if (record)
+            record = (cur_cln & fs_info->vol.mask) < fs_info->vol.eoc_val &&
+                     fat_file_extents_add(fat_fd, pos, cur_cln);
+    }
+
+    *disk_cln = cur_cln;
+    return RC_OK;
+}
+
 static off_t
 fat_file_lseek(
     fat_fs_info_t                         *fs_info,
@@ -1113,8 +1297,21 @@ fat_file_lseek(
 {
     int rc = RC_OK;
 
+    /*
+     * Only non-sequential look-ups use the extent map, so that files which
+     * are just streamed do not allocate one.
+     */
     if (file_cln == fat_fd->map.file_cln)
         *disk_cln = fat_fd->map.disk_cln;
+    else if (FAT_FILE_EXTENTS_MAX > 0 &&
+             file_cln - fat_fd->map.file_cln != 1 &&
+             fat_file_extents_lseek(fs_info, fat_fd, file_cln,
+                                    disk_cln) == RC_OK)
+    {
+        /* update cache */
+        fat_fd->map.file_cln = file_cln;
+        fat_fd->map.disk_cln = *disk_cln;
+    }
     else
     {
         uint32_t   cur_cln;
@@ -43,6 +43,23 @@ typedef enum {
   FAT_FILE = 4
 } fat_file_type_t;
 
+/*
+ * Maximum count of extents (runs of contiguous clusters) recorded by the
+ * extent map of a fat-file.  The map is built on demand by non-sequential
+ * cluster look-ups and turns them into a binary search.  Define it to 0 to
+ * disable the extent map.
+ */
+#ifndef FAT_FILE_EXTENTS_MAX
+#define FAT_FILE_EXTENTS_MAX 256
+#endif
+
+typedef struct fat_file_extent_s
+{
+    uint32_t   file_cln;    /* first cluster of the extent in the fat-file */
+    uint32_t   disk_cln;    /* first cluster of the extent on the volume */
+    uint32_t   count;       /* count of contiguous clusters */
+} fat_file_extent_t;
+
 /**
  * @brief The "fat-file" representation.
  *
@@ -60,9 +77,13 @@ typedef enum {
  */
 typedef struct fat_file_map_s
 {
-    uint32_t   file_cln;
-    uint32_t   disk_cln;
-    uint32_t   last_cln;
+    uint32_t           file_cln;
+    uint32_t           disk_cln;
+    uint32_t           last_cln;
+    fat_file_extent_t *ext;      /* extents from the start of the chain */
+    uint32_t           ext_num;
+    uint32_t           ext_size; /* allocated extents */
+    uint32_t           ext_cln;  /* first cluster the extents belong to */
 } fat_file_map_t;
 
 /**
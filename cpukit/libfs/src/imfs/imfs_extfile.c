@@ -0,0 +1,326 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief IMFS Extent File Handlers
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfsimpl.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static IMFS_extfile_t *IMFS_iop_to_extfile( const rtems_libio_t *iop )
+{
+  return (IMFS_extfile_t *) iop->pathinfo.node_access;
+}
+
+static off_t IMFS_extfile_extent_begin( size_t extent )
+{
+  return (((off_t) 1 << extent) - 1) * IMFS_EXTFILE_FIRST_EXTENT_SIZE;
+}
+
+static size_t IMFS_extfile_extent_size( size_t extent )
+{
+  return (size_t) IMFS_EXTFILE_FIRST_EXTENT_SIZE << extent;
+}
+
+/*
+ *  IMFS_extfile_extent
+ *
+ *  This routine returns the index of the extent containing the offset.
+ */
+static size_t IMFS_extfile_extent( off_t offset )
+{
+  return (size_t) flsl(
+    (long) ( offset / IMFS_EXTFILE_FIRST_EXTENT_SIZE + 1 )
+  ) - 1;
+}
+
+/*
+ *  IMFS_extfile_copy
+ *
+ *  This routine copies data between the file and a buffer.  The extents
+ *  of the file range shall be allocated.
+ */
+static void IMFS_extfile_copy(
+  IMFS_extfile_t *extfile,
+  off_t           start,
+  unsigned char  *buffer,
+  size_t          length,
+  bool            to_file
+)
+{
+  size_t extent = IMFS_extfile_extent( start );
+  size_t offset = (size_t) ( start - IMFS_extfile_extent_begin( extent ) );
+
+  while ( length > 0 ) {
+    size_t   to_copy = IMFS_extfile_extent_size( extent ) - offset;
+    uint8_t *data = &extfile->extents[ extent ][ offset ];
+
+    if ( to_copy > length )
+      to_copy = length;
+
+    if ( to_file )
+      memcpy( data, buffer, to_copy );
+    else
+      memcpy( buffer, data, to_copy );
+
+    buffer += to_copy;
+    length -= to_copy;
+    offset = 0;
+    ++extent;
+  }
+}
+
+/*
+ *  IMFS_extfile_zero
+ *
+ *  This routine clears a file range.  The extents of the file range shall
+ *  be allocated.
+ */
+static void IMFS_extfile_zero(
+  IMFS_extfile_t *extfile,
+  off_t           start,
+  off_t           end
+)
+{
+  size_t extent = IMFS_extfile_extent( start );
+  size_t offset = (size_t) ( start - IMFS_extfile_extent_begin( extent ) );
+
+  while ( start < end ) {
+    size_t to_zero = IMFS_extfile_extent_size( extent ) - offset;
+
+    if ( (off_t) to_zero > end - start )
+      to_zero = (size_t) ( end - start );
+
+    memset( &extfile->extents[ extent ][ offset ], 0, to_zero );
+    start += to_zero;
+    offset = 0;
+    ++extent;
+  }
+}
+
+/*
+ *  IMFS_extfile_release
+ *
+ *  This routine frees the extents which contain no byte below the length.
+ */
+static void IMFS_extfile_release( IMFS_extfile_t *extfile, off_t length )
+{
+  size_t extent;
+
+  for ( extent = 0 ; extent < IMFS_EXTFILE_EXTENT_COUNT ; ++extent ) {
+    if ( IMFS_extfile_extent_begin( extent ) >= length ) {
+      free( extfile->extents[ extent ] );
+      extfile->extents[ extent ] = NULL;
+    }
+  }
+}
+
+/*
+ *  IMFS_extfile_extend
+ *
+ *  This routine insures that the in-memory file is of the length
+ *  specified.  If necessary, it will allocate extents to extend the file.
+ */
+static int IMFS_extfile_extend(
+  IMFS_extfile_t *extfile,
+  bool            zero_fill,
+  off_t           new_length
+)
+{
+  off_t  old_length;
+  size_t extent;
+  size_t last;
+
+  IMFS_assert( extfile );
+
+  if ( new_length > IMFS_EXTFILE_MAXIMUM_SIZE )
+    rtems_set_errno_and_return_minus_one( EFBIG );
+
+  old_length = extfile->File.size;
+  if ( new_length <= old_length )
+    return 0;
+
+  last = IMFS_extfile_extent( new_length - 1 );
+
+  for ( extent = 0 ; extent <= last ; ++extent ) {
+    if ( extfile->extents[ extent ] == NULL ) {
+      void *memory = malloc( IMFS_extfile_extent_size( extent ) );
+
+      if ( memory == NULL ) {
+        IMFS_extfile_release( extfile, old_length );
+        rtems_set_errno_and_return_minus_one( ENOSPC );
+      }
+
+      extfile->extents[ extent ] = memory;
+    }
+  }
+
+  /*
+   *  The extents are not cleared on allocation.  A shrinked file may also
+   *  have data beyond its end.
+   */
+  if ( zero_fill )
+    IMFS_extfile_zero( extfile, old_length, new_length );
+
+  extfile->File.size = new_length;
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+static ssize_t extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+  off_t           start = iop->offset;
+  off_t           size = extfile->File.size;
+
+  if ( start >= size )
+    count = 0;
+  else if ( (off_t) count > size - start )
+    count = (size_t) ( size - start );
+
+  IMFS_extfile_copy( extfile, start, buffer, count, false );
+  IMFS_update_atime( &extfile->File.Node );
+  iop->offset = start + count;
+
+  return (ssize_t) count;
+}
+
+static ssize_t extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+  off_t           start;
+  off_t           last_byte;
+
+  if ( rtems_libio_iop_is_append( iop ) )
+    iop->offset = extfile->File.size;
+
+  start = iop->offset;
+  last_byte = start + (off_t) count;
+
+  if ( last_byte > (off_t) extfile->File.size ) {
+    off_t old_length = extfile->File.size;
+    int   status;
+
+    status = IMFS_extfile_extend( extfile, false, last_byte );
+    if ( status != 0 )
+      return status;
+
+    if ( start > old_length )
+      IMFS_extfile_zero( extfile, old_length, start );
+  }
+
+  IMFS_extfile_copy(
+    extfile,
+    start,
+    RTEMS_DECONST( void *, buffer ),
+    count,
+    true
+  );
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+  iop->offset = last_byte;
+
+  return (ssize_t) count;
+}
+
+static int extfile_ftruncate(
+  rtems_libio_t *iop,
+  off_t          length
+)
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+
+  if ( length > (off_t) extfile->File.size )
+    return IMFS_extfile_extend( extfile, true, length );
+
+  /*
+   *  In contrast to the memfiles, the extents which are no longer used are
+   *  freed immediately.
+   */
+  extfile->File.size = length;
+  IMFS_extfile_release( extfile, length );
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+static void IMFS_extfile_destroy( IMFS_jnode_t *the_jnode )
+{
+  IMFS_extfile_release( (IMFS_extfile_t *) the_jnode, 0 );
+  IMFS_node_destroy_default( the_jnode );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_extfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = extfile_read,
+  .write_h = extfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_file,
+  .ftruncate_h = extfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = rtems_filesystem_default_mmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+const IMFS_mknod_control IMFS_mknod_control_extfile = {
+  {
+    .handlers = &IMFS_extfile_handlers,
+    .node_initialize = IMFS_node_initialize_default,
+    .node_remove = IMFS_node_remove_default,
+    .node_destroy = IMFS_extfile_destroy
+  },
+  .node_size = sizeof( IMFS_extfile_t )
+};
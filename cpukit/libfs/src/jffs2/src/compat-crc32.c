@@ -54,7 +54,11 @@
 //==========================================================================
 
 #include <cyg/crc/crc.h>
+#ifdef __rtems__
+#include <rtems/crc.h>
+#endif /* __rtems__ */
 
+#ifndef __rtems__
   /* ====================================================================== */
   /*  COPYRIGHT (C) 1986 Gary S. Brown.  You may use this program, or       */
   /*  code or tables extracted from it, as desired without restriction.     */
@@ -119,18 +123,23 @@ static const cyg_uint32 crc32_tab[] = {
       0x5d681b02L, 0x2a6f2b94L, 0xb40bbe37L, 0xc30c8ea1L, 0x5a05df1bL,
       0x2d02ef8dL
    };
+#endif /* __rtems__ */
 
 /* This is the standard Gary S. Brown's 32 bit CRC algorithm, but
    accumulate the CRC into the result of a previous CRC. */
 cyg_uint32 
 cyg_crc32_accumulate(cyg_uint32 crc32val, unsigned char *s, int len)
 {
+#ifdef __rtems__
+  return _CRC32_Sequence_update(crc32val, s, (size_t) len);
+#else /* __rtems__ */
   int i;
 
   for (i = 0;  i < len;  i++) {
     crc32val = crc32_tab[(crc32val ^ s[i]) & 0xff] ^ (crc32val >> 8);
   }
   return crc32val;
+#endif /* __rtems__ */
 }
 
 /* This is the standard Gary S. Brown's 32 bit CRC algorithm */
@@ -146,15 +155,22 @@ cyg_crc32(unsigned char *s, int len)
 cyg_uint32
 cyg_ether_crc32_accumulate(cyg_uint32 crc32val, unsigned char *s, int len)
 {
+#ifndef __rtems__
   int i;
+#endif /* __rtems__ */
 
   if (s == 0) return 0L;
   
+#ifdef __rtems__
+  return _CRC32_Sequence_update(crc32val ^ CRC32_SEED, s, (size_t) len) ^
+    CRC32_FINAL_XOR;
+#else /* __rtems__ */
   crc32val = crc32val ^ 0xffffffff;
   for (i = 0;  i < len;  i++) {
       crc32val = crc32_tab[(crc32val ^ s[i]) & 0xff] ^ (crc32val >> 8);
   }
   return crc32val ^ 0xffffffff;
+#endif /* __rtems__ */
 }
 
 /* Return a 32-bit CRC of the contents of the buffer, using the
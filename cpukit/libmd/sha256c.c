@@ -34,6 +34,15 @@ __FBSDID("$FreeBSD$");
 
 #include "sha224.h"
 #include "sha256.h"
+#include "sha256c_impl.h"
+
+#if defined(__aarch64__)
+#include <rtems/score/aarch64-system-registers.h>
+#define SHA256_TRANSFORM_DISPATCH
+#elif defined(__x86_64__)
+#include <cpuid.h>
+#define SHA256_TRANSFORM_DISPATCH
+#endif
 
 #if BYTE_ORDER == BIG_ENDIAN
 
@@ -128,7 +137,12 @@ static const uint32_t K[64] = {
  * the 512-bit input block to produce a new state.
  */
 static void
-SHA256_Transform(uint32_t * state, const unsigned char block[64])
+#ifdef SHA256_TRANSFORM_DISPATCH
+SHA256_Transform_c
+#else
+SHA256_Transform
+#endif
+(uint32_t * state, const unsigned char block[64])
 {
 	uint32_t W[64];
 	uint32_t S[8];
@@ -184,6 +198,68 @@ SHA256_Transform(uint32_t * state, const unsigned char block[64])
 		state[i] += S[i];
 }
 
+#ifdef SHA256_TRANSFORM_DISPATCH
+#if defined(__aarch64__)
+static void
+SHA256_Transform_arm64(uint32_t * state, const unsigned char block[64])
+{
+
+	SHA256_Transform_arm64_impl(state, block, K);
+}
+#elif defined(__x86_64__)
+static void
+SHA256_Transform_x86(uint32_t * state, const unsigned char block[64])
+{
+
+	SHA256_Transform_x86_impl(state, block, K);
+}
+#endif
+
+static void SHA256_Transform_resolve(uint32_t *, const unsigned char [64]);
+
+/*
+ * The block compression function is selected by the first transform
+ * according to the processor features.  Concurrent first transforms store the
+ * same function.
+ */
+static void (*SHA256_Transform_impl)(uint32_t *, const unsigned char [64]) =
+    SHA256_Transform_resolve;
+
+static void
+SHA256_Transform_resolve(uint32_t * state, const unsigned char block[64])
+{
+	void (*impl)(uint32_t *, const unsigned char [64]);
+#if defined(__aarch64__)
+	uint64_t isar0;
+
+	isar0 = _AArch64_Read_id_aa64isar0_el1();
+	if (AARCH64_ID_AA64ISAR0_EL1_SHA2_GET(isar0) != 0)
+		impl = SHA256_Transform_arm64;
+	else
+		impl = SHA256_Transform_c;
+#elif defined(__x86_64__)
+	unsigned int eax, ebx, ecx, edx;
+
+	impl = SHA256_Transform_c;
+	if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 &&
+	    (ecx & bit_SSE4_1) != 0 && (ecx & bit_SSSE3) != 0 &&
+	    __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0 &&
+	    (ebx & bit_SHA) != 0)
+		impl = SHA256_Transform_x86;
+#endif
+
+	SHA256_Transform_impl = impl;
+	(*impl)(state, block);
+}
+
+static inline void
+SHA256_Transform(uint32_t * state, const unsigned char block[64])
+{
+
+	(*SHA256_Transform_impl)(state, block);
+}
+#endif /* SHA256_TRANSFORM_DISPATCH */
+
 static const unsigned char PAD[64] = {
 	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * SHA-256 block compression function using the ARMv8 SHA2 instructions.  The
+ * SHA256H and SHA256H2 instructions perform four rounds on the state in the
+ * ABCD and EFGH order.
+ */
+
+#if defined(__aarch64__)
+
+#pragma GCC target("+crypto")
+
+#include <arm_neon.h>
+
+#include "sha256c_impl.h"
+
+#define LOAD_W(W, block, i)						\
+	W[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&block[16 * (i)])))
+
+/* Message schedule for the four words 4 * i, ..., 4 * i + 3 */
+#define MSCH(W, i)							\
+	W[(i) % 4] = vsha256su1q_u32(					\
+	    vsha256su0q_u32(W[(i) % 4], W[((i) + 1) % 4]),		\
+	    W[((i) + 2) % 4], W[((i) + 3) % 4])
+
+/* Four rounds using the message words 4 * i, ..., 4 * i + 3 */
+#define RND4(S, W, K, i)						\
+	T = vaddq_u32(W[(i) % 4], vld1q_u32(&K[4 * (i)]));		\
+	ABCD = S[0];							\
+	S[0] = vsha256hq_u32(S[0], S[1], T);				\
+	S[1] = vsha256h2q_u32(S[1], ABCD, T)
+
+#define RND4M(S, W, K, i)						\
+	MSCH(W, i);							\
+	RND4(S, W, K, i)
+
+void
+SHA256_Transform_arm64_impl(uint32_t *state,
+    const unsigned char block[SHA256_BLOCK_LENGTH], const uint32_t K[64])
+{
+	uint32x4_t W[4];
+	uint32x4_t S[2];
+	uint32x4_t S_start[2];
+	uint32x4_t ABCD;
+	uint32x4_t T;
+
+	/* 1. Prepare the first part of the message schedule W. */
+	LOAD_W(W, block, 0);
+	LOAD_W(W, block, 1);
+	LOAD_W(W, block, 2);
+	LOAD_W(W, block, 3);
+
+	/* 2. Initialize working variables. */
+	S[0] = vld1q_u32(&state[0]);
+	S[1] = vld1q_u32(&state[4]);
+	S_start[0] = S[0];
+	S_start[1] = S[1];
+
+	/* 3. Mix. */
+	RND4(S, W, K, 0);
+	RND4(S, W, K, 1);
+	RND4(S, W, K, 2);
+	RND4(S, W, K, 3);
+	RND4M(S, W, K, 4);
+	RND4M(S, W, K, 5);
+	RND4M(S, W, K, 6);
+	RND4M(S, W, K, 7);
+	RND4M(S, W, K, 8);
+	RND4M(S, W, K, 9);
+	RND4M(S, W, K, 10);
+	RND4M(S, W, K, 11);
+	RND4M(S, W, K, 12);
+	RND4M(S, W, K, 13);
+	RND4M(S, W, K, 14);
+	RND4M(S, W, K, 15);
+
+	/* 4. Mix local working variables into global state */
+	vst1q_u32(&state[0], vaddq_u32(S[0], S_start[0]));
+	vst1q_u32(&state[4], vaddq_u32(S[1], S_start[1]));
+}
+
+#endif /* __aarch64__ */
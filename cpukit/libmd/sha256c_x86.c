@@ -0,0 +1,122 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * SHA-256 block compression function using the x86 SHA extensions (SHA-NI).
+ * The SHA256RNDS2 instruction operates on the state in the ABEF and CDGH
+ * order.  It performs two rounds, so each group of four message words needs
+ * two instructions.
+ */
+
+#if defined(__x86_64__)
+
+#pragma GCC target("sse4.1,sha")
+
+#include <immintrin.h>
+
+#include "sha256c_impl.h"
+
+/* Message schedule for the four words 4 * i, ..., 4 * i + 3 */
+#define MSCH(M, i)							\
+	M[(i) % 4] = _mm_sha256msg2_epu32(_mm_add_epi32(		\
+	    _mm_sha256msg1_epu32(M[(i) % 4], M[((i) + 1) % 4]),	\
+	    _mm_alignr_epi8(M[((i) + 3) % 4], M[((i) + 2) % 4], 4)),	\
+	    M[((i) + 3) % 4])
+
+/* Four rounds using the message words 4 * i, ..., 4 * i + 3 */
+#define RND4(S0, S1, M, K, i)						\
+	T = _mm_add_epi32(M[(i) % 4],					\
+	    _mm_loadu_si128((const __m128i *)&K[4 * (i)]));		\
+	S1 = _mm_sha256rnds2_epu32(S1, S0, T);				\
+	T = _mm_shuffle_epi32(T, 0x0e);					\
+	S0 = _mm_sha256rnds2_epu32(S0, S1, T)
+
+#define RND4M(S0, S1, M, K, i)						\
+	MSCH(M, i);							\
+	RND4(S0, S1, M, K, i)
+
+void
+SHA256_Transform_x86_impl(uint32_t *state,
+    const unsigned char block[SHA256_BLOCK_LENGTH], const uint32_t K[64])
+{
+	const __m128i BSWAP = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+	    0x0405060700010203ULL);
+	__m128i M[4];
+	__m128i ABEF;
+	__m128i CDGH;
+	__m128i ABEF_start;
+	__m128i CDGH_start;
+	__m128i T;
+
+	/* 1. Load the state in the ABEF and CDGH order. */
+	T = _mm_loadu_si128((const __m128i *)&state[0]);
+	CDGH = _mm_loadu_si128((const __m128i *)&state[4]);
+	T = _mm_shuffle_epi32(T, 0xb1);
+	CDGH = _mm_shuffle_epi32(CDGH, 0x1b);
+	ABEF = _mm_alignr_epi8(T, CDGH, 8);
+	CDGH = _mm_blend_epi16(CDGH, T, 0xf0);
+	ABEF_start = ABEF;
+	CDGH_start = CDGH;
+
+	/* 2. Load the big-endian message words. */
+	M[0] = _mm_shuffle_epi8(
+	    _mm_loadu_si128((const __m128i *)&block[0]), BSWAP);
+	M[1] = _mm_shuffle_epi8(
+	    _mm_loadu_si128((const __m128i *)&block[16]), BSWAP);
+	M[2] = _mm_shuffle_epi8(
+	    _mm_loadu_si128((const __m128i *)&block[32]), BSWAP);
+	M[3] = _mm_shuffle_epi8(
+	    _mm_loadu_si128((const __m128i *)&block[48]), BSWAP);
+
+	/* 3. Mix. */
+	RND4(ABEF, CDGH, M, K, 0);
+	RND4(ABEF, CDGH, M, K, 1);
+	RND4(ABEF, CDGH, M, K, 2);
+	RND4(ABEF, CDGH, M, K, 3);
+	RND4M(ABEF, CDGH, M, K, 4);
+	RND4M(ABEF, CDGH, M, K, 5);
+	RND4M(ABEF, CDGH, M, K, 6);
+	RND4M(ABEF, CDGH, M, K, 7);
+	RND4M(ABEF, CDGH, M, K, 8);
+	RND4M(ABEF, CDGH, M, K, 9);
+	RND4M(ABEF, CDGH, M, K, 10);
+	RND4M(ABEF, CDGH, M, K, 11);
+	RND4M(ABEF, CDGH, M, K, 12);
+	RND4M(ABEF, CDGH, M, K, 13);
+	RND4M(ABEF, CDGH, M, K, 14);
+	RND4M(ABEF, CDGH, M, K, 15);
+
+	/* 4. Mix local working variables into global state */
+	ABEF = _mm_add_epi32(ABEF, ABEF_start);
+	CDGH = _mm_add_epi32(CDGH, CDGH_start);
+	T = _mm_shuffle_epi32(ABEF, 0x1b);
+	CDGH = _mm_shuffle_epi32(CDGH, 0xb1);
+	_mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(T, CDGH, 0xf0));
+	_mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(CDGH, T, 8));
+}
+
+#endif /* __x86_64__ */
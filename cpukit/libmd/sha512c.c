@@ -36,6 +36,12 @@ __FBSDID("$FreeBSD$");
 #include "sha512.h"
 #include "sha512t.h"
 #include "sha384.h"
+#include "sha512c_impl.h"
+
+#if defined(__aarch64__)
+#include <rtems/score/aarch64-system-registers.h>
+#define SHA512_TRANSFORM_DISPATCH
+#endif
 
 #if BYTE_ORDER == BIG_ENDIAN
 
@@ -157,7 +163,12 @@ static const uint64_t K[80] = {
  * the 512-bit input block to produce a new state.
  */
 static void
-SHA512_Transform(uint64_t * state, const unsigned char block[SHA512_BLOCK_LENGTH])
+#ifdef SHA512_TRANSFORM_DISPATCH
+SHA512_Transform_c
+#else
+SHA512_Transform
+#endif
+(uint64_t * state, const unsigned char block[SHA512_BLOCK_LENGTH])
 {
 	uint64_t W[80];
 	uint64_t S[8];
@@ -213,6 +224,53 @@ SHA512_Transform(uint64_t * state, const unsigned char block[SHA512_BLOCK_LENGTH
 		state[i] += S[i];
 }
 
+#ifdef SHA512_TRANSFORM_DISPATCH
+static void
+SHA512_Transform_arm64(uint64_t * state,
+    const unsigned char block[SHA512_BLOCK_LENGTH])
+{
+
+	SHA512_Transform_arm64_impl(state, block, K);
+}
+
+static void SHA512_Transform_resolve(uint64_t *,
+    const unsigned char [SHA512_BLOCK_LENGTH]);
+
+/*
+ * The block compression function is selected by the first transform
+ * according to the processor features.  Concurrent first transforms store the
+ * same function.
+ */
+static void (*SHA512_Transform_impl)(uint64_t *,
+    const unsigned char [SHA512_BLOCK_LENGTH]) = SHA512_Transform_resolve;
+
+static void
+SHA512_Transform_resolve(uint64_t * state,
+    const unsigned char block[SHA512_BLOCK_LENGTH])
+{
+	void (*impl)(uint64_t *, const unsigned char [SHA512_BLOCK_LENGTH]);
+	uint64_t isar0;
+
+	/* A SHA2 field value of two indicates the SHA512 instructions */
+	isar0 = _AArch64_Read_id_aa64isar0_el1();
+	if (AARCH64_ID_AA64ISAR0_EL1_SHA2_GET(isar0) >= 2)
+		impl = SHA512_Transform_arm64;
+	else
+		impl = SHA512_Transform_c;
+
+	SHA512_Transform_impl = impl;
+	(*impl)(state, block);
+}
+
+static inline void
+SHA512_Transform(uint64_t * state,
+    const unsigned char block[SHA512_BLOCK_LENGTH])
+{
+
+	(*SHA512_Transform_impl)(state, block);
+}
+#endif /* SHA512_TRANSFORM_DISPATCH */
+
 static const unsigned char PAD[SHA512_BLOCK_LENGTH] = {
 	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -0,0 +1,129 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * SHA-512 block compression function using the ARMv8.2 SHA512 instructions.
+ * The SHA512H and SHA512H2 instructions perform two rounds on the state in
+ * the AB, CD, EF, and GH order.
+ */
+
+#if defined(__aarch64__)
+
+#pragma GCC target("+sha3")
+
+#include <arm_neon.h>
+
+#include "sha512c_impl.h"
+
+#define LOAD_W(W, block, i)						\
+	W[i] = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(&block[16 * (i)])))
+
+/*
+ * Two rounds using the message words ii + 2 * i and ii + 2 * i + 1.  The
+ * working variables rotate by one vector every two rounds:
+ *  ab = S[(8 - i) % 4]
+ *  cd = S[(9 - i) % 4]
+ *  ef = S[(10 - i) % 4]
+ *  gh = S[(11 - i) % 4]
+ */
+#define RND2(S, W, K, i, ii)						\
+	T = vaddq_u64(W[i], vld1q_u64(&K[(ii) + 2 * (i)]));		\
+	T = vaddq_u64(vextq_u64(T, T, 1), S[(11 - (i)) % 4]);		\
+	T = vsha512hq_u64(T,						\
+	    vextq_u64(S[(10 - (i)) % 4], S[(11 - (i)) % 4], 1),	\
+	    vextq_u64(S[(9 - (i)) % 4], S[(10 - (i)) % 4], 1));	\
+	S[(11 - (i)) % 4] = vsha512h2q_u64(T, S[(9 - (i)) % 4],		\
+	    S[(8 - (i)) % 4]);						\
+	S[(9 - (i)) % 4] = vaddq_u64(S[(9 - (i)) % 4], T)
+
+/* Message schedule for the two words 2 * i + 16 and 2 * i + 17 */
+#define MSCH(W, i)							\
+	W[i] = vsha512su1q_u64(vsha512su0q_u64(W[i], W[((i) + 1) % 8]),	\
+	    W[((i) + 7) % 8], vextq_u64(W[((i) + 4) % 8],		\
+	    W[((i) + 5) % 8], 1))
+
+void
+SHA512_Transform_arm64_impl(uint64_t *state,
+    const unsigned char block[SHA512_BLOCK_LENGTH], const uint64_t K[80])
+{
+	uint64x2_t W[8];
+	uint64x2_t S[4];
+	uint64x2_t S_start[4];
+	uint64x2_t T;
+	int i;
+
+	/* 1. Prepare the first part of the message schedule W. */
+	LOAD_W(W, block, 0);
+	LOAD_W(W, block, 1);
+	LOAD_W(W, block, 2);
+	LOAD_W(W, block, 3);
+	LOAD_W(W, block, 4);
+	LOAD_W(W, block, 5);
+	LOAD_W(W, block, 6);
+	LOAD_W(W, block, 7);
+
+	/* 2. Initialize working variables. */
+	S[0] = vld1q_u64(&state[0]);
+	S[1] = vld1q_u64(&state[2]);
+	S[2] = vld1q_u64(&state[4]);
+	S[3] = vld1q_u64(&state[6]);
+	S_start[0] = S[0];
+	S_start[1] = S[1];
+	S_start[2] = S[2];
+	S_start[3] = S[3];
+
+	/* 3. Mix. */
+	for (i = 0; i < 80; i += 16) {
+		RND2(S, W, K, 0, i);
+		RND2(S, W, K, 1, i);
+		RND2(S, W, K, 2, i);
+		RND2(S, W, K, 3, i);
+		RND2(S, W, K, 4, i);
+		RND2(S, W, K, 5, i);
+		RND2(S, W, K, 6, i);
+		RND2(S, W, K, 7, i);
+
+		if (i == 64)
+			break;
+		MSCH(W, 0);
+		MSCH(W, 1);
+		MSCH(W, 2);
+		MSCH(W, 3);
+		MSCH(W, 4);
+		MSCH(W, 5);
+		MSCH(W, 6);
+		MSCH(W, 7);
+	}
+
+	/* 4. Mix local working variables into global state */
+	vst1q_u64(&state[0], vaddq_u64(S[0], S_start[0]));
+	vst1q_u64(&state[2], vaddq_u64(S[1], S_start[1]));
+	vst1q_u64(&state[4], vaddq_u64(S[2], S_start[2]));
+	vst1q_u64(&state[6], vaddq_u64(S[3], S_start[3]));
+}
+
+#endif /* __aarch64__ */
@@ -72,12 +72,22 @@
 #define RTEMS_CAPTURE_RECORD_EVENTS  (0)
 #endif
 
+/*
+ * The records buffer is written by its CPU only, with interrupts disabled,
+ * and drained by the reader. The write side owns write_flags, the read side
+ * owns everything else and serializes readers with the lock. The recording
+ * path never takes the lock.
+ */
 typedef struct {
   rtems_capture_buffer records;
-  uint32_t             count;
+  uint32_t             write_flags;
   rtems_id             reader;
   rtems_interrupt_lock lock;
   uint32_t             flags;
+  const uint8_t*       read_next;
+  size_t               read_size;
+  rtems_capture_time   read_time;
+  bool                 read_more;
 } rtems_capture_per_cpu_data;
 
 typedef struct {
@@ -103,7 +113,6 @@ static rtems_capture_global_data capture_global = {
    ( &capture_per_cpu[ _cpu ] )
 
 #define capture_records_on_cpu( _cpu ) capture_per_cpu[ _cpu ].records
-#define capture_count_on_cpu( _cpu )   capture_per_cpu[ _cpu ].count
 #define capture_flags_on_cpu( _cpu )   capture_per_cpu[ _cpu ].flags
 #define capture_reader_on_cpu( _cpu )  capture_per_cpu[ _cpu ].reader
 #define capture_lock_on_cpu( _cpu )    capture_per_cpu[ _cpu ].lock
@@ -372,17 +381,17 @@ rtems_capture_create_control (rtems_name name, rtems_id id)
 void
 rtems_capture_record_lock (rtems_capture_record_lock_context* context)
 {
-  rtems_capture_per_cpu_data* cpu;
-  cpu = capture_per_cpu_get (rtems_scheduler_get_processor ());
-  rtems_interrupt_lock_interrupt_disable (&context->lock_context);
-  context->lock = &cpu->lock;
-  rtems_interrupt_lock_acquire_isr (&cpu->lock, &context->lock_context);
+  rtems_interrupt_local_disable (context->level);
+  context->cpu = rtems_scheduler_get_processor ();
 }
 
 void
 rtems_capture_record_unlock (rtems_capture_record_lock_context* context)
 {
-  rtems_interrupt_lock_release (context->lock, &context->lock_context);
+  rtems_capture_per_cpu_data* cpu;
+  cpu = capture_per_cpu_get (context->cpu);
+  rtems_capture_buffer_commit (&cpu->records);
+  rtems_interrupt_local_enable (context->level);
 }
 
 void*
@@ -396,18 +405,16 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
 
   size += sizeof (rtems_capture_record);
 
-  cpu = capture_per_cpu_get (rtems_scheduler_get_processor ());
-
   rtems_capture_record_lock (context);
 
+  cpu = capture_per_cpu_get (context->cpu);
+
   ptr = rtems_capture_buffer_allocate (&cpu->records, size);
   if (ptr != NULL)
   {
     rtems_capture_record in;
     rtems_capture_time time;
 
-    ++cpu->count;
-
     if ((events & RTEMS_CAPTURE_RECORD_EVENTS) == 0)
       tcb->Capture.flags |= RTEMS_CAPTURE_TRACED;
 
@@ -426,7 +433,7 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
     ptr = rtems_capture_record_append(ptr, &in, sizeof(in));
   }
   else
-    cpu->flags |= RTEMS_CAPTURE_OVERFLOW;
+    cpu->write_flags |= RTEMS_CAPTURE_OVERFLOW;
 
   return ptr;
 }
@@ -807,9 +814,12 @@ rtems_capture_flush (bool prime)
       RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( cpu )) )
       rtems_interrupt_lock_context lock_context_per_cpu;
 
+      /*
+       * Capture control is off so the write side is idle and its flags can
+       * be cleared. The buffer itself is drained from the read side.
+       */
       rtems_interrupt_lock_acquire (lock, &lock_context_per_cpu);
-      capture_count_on_cpu(cpu) = 0;
-      capture_flags_on_cpu(cpu) &= ~RTEMS_CAPTURE_OVERFLOW;
+      capture_per_cpu_get(cpu)->write_flags &= ~RTEMS_CAPTURE_OVERFLOW;
       if (capture_records_on_cpu(cpu).buffer)
         rtems_capture_buffer_flush( &capture_records_on_cpu(cpu) );
       rtems_interrupt_lock_release (lock, &lock_context_per_cpu);
@@ -1214,22 +1224,112 @@ rtems_capture_clear_trigger (rtems_name                 from_name,
   return RTEMS_SUCCESSFUL;
 }
 
-static inline uint32_t
-rtems_capture_count_records (const void* records, size_t size)
+/*
+ * This function counts the records in a block of records up to a maximum
+ * and returns their size in bytes.
+ */
+static inline size_t
+rtems_capture_size_records (const void* records, size_t size, uint32_t* count)
 {
   const uint8_t* ptr = records;
   uint32_t       recs = 0;
   size_t         bytes = 0;
 
-  while (bytes < size)
+  while ((recs < *count) && (bytes < size))
   {
     const rtems_capture_record* rec = (const rtems_capture_record*) ptr;
+    _Assert (rec->size >= sizeof (*rec));
     recs++;
     ptr += rec->size;
     bytes += rec->size;
- }
+  }
+
+  _Assert (bytes <= size);
+
+  *count = recs;
+  return bytes;
+}
+
+static inline uint32_t
+rtems_capture_count_records (const void* records, size_t size)
+{
+  uint32_t recs = UINT32_MAX;
+
+  rtems_capture_size_records (records, size, &recs);
+
+  return recs;
+}
+
+/*
+ * This function claims the reader of a CPU and returns the contiguous block
+ * of records available to it.
+ */
+static rtems_status_code
+rtems_capture_reader_claim (uint32_t cpu, size_t* size, const void** recs)
+{
+  RTEMS_INTERRUPT_LOCK_REFERENCE (lock, &(capture_lock_on_cpu (cpu)))
+  rtems_interrupt_lock_context lock_context;
+  rtems_capture_buffer*        records;
+  uint32_t*                    flags;
+
+  records = &(capture_records_on_cpu (cpu));
+  flags = &(capture_flags_on_cpu (cpu));
+
+  rtems_interrupt_lock_acquire (lock, &lock_context);
+
+  /*
+   * Only one reader is allowed.
+   */
+
+  if (*flags & RTEMS_CAPTURE_READER_ACTIVE)
+  {
+    rtems_interrupt_lock_release (lock, &lock_context);
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  *flags |= RTEMS_CAPTURE_READER_ACTIVE;
+
+  rtems_interrupt_lock_release (lock, &lock_context);
+
+  /*
+   * The writer never waits for the reader, so the block can be taken
+   * while capture control is on.
+   */
+  *recs = rtems_capture_buffer_peek (records, size);
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static void
+rtems_capture_reader_drop (uint32_t cpu)
+{
+  RTEMS_INTERRUPT_LOCK_REFERENCE (lock, &(capture_lock_on_cpu (cpu)))
+  rtems_interrupt_lock_context lock_context;
 
- return recs;
+  rtems_interrupt_lock_acquire (lock, &lock_context);
+  capture_flags_on_cpu (cpu) &= ~RTEMS_CAPTURE_READER_ACTIVE;
+  rtems_interrupt_lock_release (lock, &lock_context);
+}
+
+/*
+ * This function releases up to count records at the read position of a
+ * CPU and returns the number of records released.
+ */
+static uint32_t
+rtems_capture_release_records (uint32_t cpu, uint32_t count)
+{
+  rtems_capture_buffer* records = &(capture_records_on_cpu (cpu));
+  const void*           ptr;
+  size_t                ptr_size = 0;
+  size_t                rel_size;
+
+  ptr = rtems_capture_buffer_peek (records, &ptr_size);
+  rel_size = rtems_capture_size_records (ptr, ptr_size, &count);
+
+  if (count)
+    rtems_capture_buffer_free (records, rel_size);
+
+  return count;
 }
 
 /*
@@ -1252,45 +1352,14 @@ rtems_capture_read (uint32_t cpu, size_t* read, const void** recs)
   rtems_status_code sc = RTEMS_NOT_CONFIGURED;
   if (capture_per_cpu != NULL)
   {
-    RTEMS_INTERRUPT_LOCK_REFERENCE (lock, &(capture_lock_on_cpu (cpu)))
-    rtems_interrupt_lock_context lock_context;
-    size_t                       recs_size = 0;
-    rtems_capture_buffer*        records;
-    uint32_t*                    flags;
+    size_t recs_size = 0;
 
     *read = 0;
     *recs = NULL;
 
-    records = &(capture_records_on_cpu (cpu));
-    flags = &(capture_flags_on_cpu (cpu));
-
-    rtems_interrupt_lock_acquire (lock, &lock_context);
-
-    /*
-     * Only one reader is allowed.
-     */
-
-    if (*flags & RTEMS_CAPTURE_READER_ACTIVE)
-    {
-      rtems_interrupt_lock_release (lock, &lock_context);
-      return RTEMS_RESOURCE_IN_USE;
-    }
-
-    if ( (capture_flags_global & RTEMS_CAPTURE_ON) != 0 )
-    {
-      rtems_interrupt_lock_release (lock, &lock_context);
-      return RTEMS_UNSATISFIED;
-    }
-
-    *flags |= RTEMS_CAPTURE_READER_ACTIVE;
-
-    *recs = rtems_capture_buffer_peek( records, &recs_size );
-
-    *read = rtems_capture_count_records( *recs, recs_size );
-
-    rtems_interrupt_lock_release (lock, &lock_context);
-
-    sc = RTEMS_SUCCESSFUL;
+    sc = rtems_capture_reader_claim (cpu, &recs_size, recs);
+    if (sc == RTEMS_SUCCESSFUL)
+      *read = rtems_capture_count_records (*recs, recs_size);
   }
 
   return sc;
@@ -1306,59 +1375,163 @@ rtems_capture_release (uint32_t cpu, uint32_t count)
   rtems_status_code sc = RTEMS_NOT_CONFIGURED;
   if (capture_per_cpu != NULL)
   {
-    rtems_interrupt_lock_context lock_context;
-    uint8_t*                     ptr;
-    rtems_capture_record*        rec;
-    uint32_t                     counted;
-    size_t                       ptr_size = 0;
-    size_t                       rel_size = 0;
-    RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( cpu )) )
-    rtems_capture_buffer*        records = &(capture_records_on_cpu( cpu ));
-    uint32_t*                    flags = &(capture_flags_on_cpu( cpu ));
-    uint32_t*                    total = &(capture_count_on_cpu( cpu ));
-
+    rtems_capture_release_records (cpu, count);
+    rtems_capture_reader_drop (cpu);
     sc = RTEMS_SUCCESSFUL;
+  }
 
-    rtems_interrupt_lock_acquire (lock, &lock_context);
+  return sc;
+}
 
-    if (count > *total) {
-      count = *total;
-    }
+/*
+ * This function loads the time of the next record of a CPU taking part in a
+ * batched read.
+ */
+static void
+rtems_capture_read_batch_next (rtems_capture_per_cpu_data* cpu)
+{
+  if (cpu->read_size != 0)
+  {
+    rtems_capture_record rec;
+    rtems_capture_record_extract (cpu->read_next, &rec, sizeof (rec));
+    cpu->read_time = rec.time;
+  }
+}
 
-    if ( (capture_flags_global & RTEMS_CAPTURE_ON) != 0 ) {
-      rtems_interrupt_lock_release (lock, &lock_context);
-      return RTEMS_UNSATISFIED;
-    }
+/*
+ * This function reads the available records of all CPUs and merges them by
+ * time into spans of contiguous records of one CPU. The merge stops early if
+ * the spans are used up or if a CPU runs out of contiguous records while it
+ * has more records at the start of its buffer. The records of those are
+ * earlier than the remaining records of the other CPUs and are returned by
+ * the next batch.
+ */
+rtems_status_code
+rtems_capture_read_batch (rtems_capture_record_span* spans,
+                          size_t                     max_spans,
+                          size_t*                    count)
+{
+  rtems_capture_record_span* span = NULL;
+  uint32_t                   cpus;
+  uint32_t                   i;
 
-    counted = count;
+  *count = 0;
 
-    ptr = rtems_capture_buffer_peek( records, &ptr_size );
-    _Assert(ptr_size >= (count * sizeof(*rec) ));
+  if (capture_per_cpu == NULL)
+    return RTEMS_NOT_CONFIGURED;
 
-    rel_size = 0;
-    while (counted--) {
-      rec = (rtems_capture_record*) ptr;
-      rel_size += rec->size;
-      _Assert( rel_size <= ptr_size );
-      ptr += rec->size;
+  cpus = rtems_scheduler_get_processor_maximum ();
+
+  for (i = 0; i < cpus; i++)
+  {
+    rtems_capture_per_cpu_data* cpu = capture_per_cpu_get (i);
+    rtems_status_code           sc;
+    const void*                 recs;
+
+    sc = rtems_capture_reader_claim (i, &cpu->read_size, &recs);
+    if (sc != RTEMS_SUCCESSFUL)
+    {
+      while (i-- > 0)
+        rtems_capture_reader_drop (i);
+      return sc;
     }
 
-    if (rel_size > ptr_size ) {
-      sc = RTEMS_INVALID_NUMBER;
-      rel_size = ptr_size;
+    cpu->read_next = recs;
+    cpu->read_more = rtems_capture_buffer_has_wrapped (&cpu->records);
+    rtems_capture_read_batch_next (cpu);
+  }
+
+  while (true)
+  {
+    rtems_capture_per_cpu_data* cpu;
+    rtems_capture_record        rec;
+    uint32_t                    cpu_out = cpus;
+
+    for (i = 0; i < cpus; i++)
+    {
+      cpu = capture_per_cpu_get (i);
+      if ((cpu->read_size != 0) &&
+          ((cpu_out == cpus) ||
+           (cpu->read_time < capture_per_cpu_get (cpu_out)->read_time)))
+        cpu_out = i;
     }
 
-    *total -= count;
+    if (cpu_out == cpus)
+      break;
 
-    if (count) {
-      rtems_capture_buffer_free( records, rel_size );
+    if ((span == NULL) || (span->cpu != cpu_out))
+    {
+      if (*count == max_spans)
+        break;
+
+      span = &spans[*count];
+      ++(*count);
+      span->cpu = cpu_out;
+      span->count = 0;
+      span->size = 0;
+      span->records = capture_per_cpu_get (cpu_out)->read_next;
     }
 
-    *flags &= ~RTEMS_CAPTURE_READER_ACTIVE;
+    cpu = capture_per_cpu_get (cpu_out);
+    rtems_capture_record_extract (cpu->read_next, &rec, sizeof (rec));
+    _Assert (rec.size >= sizeof (rec));
+    _Assert (rec.size <= cpu->read_size);
 
-    rtems_interrupt_lock_release (lock, &lock_context);
+    ++span->count;
+    span->size += rec.size;
+    cpu->read_next += rec.size;
+    cpu->read_size -= rec.size;
+    rtems_capture_read_batch_next (cpu);
+
+    if ((cpu->read_size == 0) && cpu->read_more)
+      break;
   }
 
+  return RTEMS_SUCCESSFUL;
+}
+
+/*
+ * This function releases the records of spans returned by
+ * rtems_capture_read_batch and ends the batched read on all CPUs. The record
+ * count of a span may be lowered to release less records. A span which does
+ * not start at the read position of its CPU is not released.
+ */
+rtems_status_code
+rtems_capture_release_batch (const rtems_capture_record_span* spans,
+                             size_t                           count)
+{
+  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  uint32_t          cpus;
+  uint32_t          i;
+  size_t            s;
+
+  if (capture_per_cpu == NULL)
+    return RTEMS_NOT_CONFIGURED;
+
+  for (s = 0; s < count; s++)
+  {
+    const rtems_capture_record_span* span = &spans[s];
+    size_t                           size = 0;
+
+    if (span->count == 0)
+      continue;
+
+    if (rtems_capture_buffer_peek (&capture_records_on_cpu (span->cpu),
+                                   &size) != span->records)
+    {
+      sc = RTEMS_INVALID_ADDRESS;
+      continue;
+    }
+
+    if (rtems_capture_release_records (span->cpu, span->count) != span->count)
+      sc = RTEMS_INVALID_NUMBER;
+  }
+
+  cpus = rtems_scheduler_get_processor_maximum ();
+
+  for (i = 0; i < cpus; i++)
+    rtems_capture_reader_drop (i);
+
   return sc;
 }
 
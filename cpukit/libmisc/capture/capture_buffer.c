@@ -45,101 +45,121 @@
 void*
 rtems_capture_buffer_allocate (rtems_capture_buffer* buffer, size_t size)
 {
-  void* ptr = NULL;
+  size_t head = buffer->write;
+  size_t next = head;
+  size_t tail;
+  void*  ptr = NULL;
 
-  if ((buffer->count + size) <= buffer->end)
-  {
-    size_t end;
+  /*
+   * The acquire pairs with the release of the consumer so the bytes it
+   * finished reading are not overwritten early.
+   */
+  tail = _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_ACQUIRE);
 
+  if (head >= tail)
+  {
     /*
-     * Determine if the end of free space is marked with the end of buffer
-     * space, or the head of allocated space.
-     *
-     * |...|head| freespace |tail| ...| end
-     *
-     * tail|.....|head| freespace| end
+     * |...|tail| records |head| freespace | size
      */
-    if (buffer->tail > buffer->head)
+    if ((head + size) <= buffer->size)
     {
-      end = buffer->tail;
-    } else
+      ptr = &buffer->buffer[head];
+      next = head + size;
+    }
+    else if (size < tail)
     {
-      end = buffer->end;
+      /*
+       * Wrap around to the front of the buffer. The end marker is published
+       * together with the head in rtems_capture_buffer_commit.
+       */
+      _Atomic_Store_uintptr (&buffer->end, head, ATOMIC_ORDER_RELAXED);
+      ptr = buffer->buffer;
+      next = size;
     }
-
+  }
+  else
+  {
     /*
-     * Can we allocate it easily?
+     * records |head| freespace |tail| records | end
      */
-    if ((buffer->head + size) <= end)
+    if ((head + size) < tail)
     {
-      ptr = &buffer->buffer[buffer->head];
-      buffer->head += size;
-      buffer->count = buffer->count + size;
-      if (buffer->max_rec < size)
-        buffer->max_rec = size;
+      ptr = &buffer->buffer[head];
+      next = head + size;
     }
-    else
+  }
+
+  if (ptr != NULL)
+  {
+    buffer->write = next;
+    if (buffer->max_rec < size)
+      buffer->max_rec = size;
+  }
+
+  return ptr;
+}
+
+void*
+rtems_capture_buffer_peek (rtems_capture_buffer* buffer, size_t* size)
+{
+  size_t head;
+  size_t tail;
+
+  head = _Atomic_Load_uintptr (&buffer->head, ATOMIC_ORDER_ACQUIRE);
+  tail = _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_RELAXED);
+
+  if (tail > head)
+  {
+    size_t end = _Atomic_Load_uintptr (&buffer->end, ATOMIC_ORDER_RELAXED);
+
+    if (tail < end)
     {
-      /*
-       * We have to consider wrapping around to the front of the buffer
-       *
-       * If there is no room at the end of the buffer and we have we already
-       * wrapped then we can't allocate and if there is room at the front of
-       * the buffer.
-       */
-      if ((end != buffer->tail) && (buffer->tail >= size))
-      {
-        /*
-         * Change the end pointer to the last used byte, so a read will wrap
-         * when out of data
-         */
-        buffer->end = buffer->head;
-
-        /*
-         * Now return the buffer
-         */
-        ptr = buffer->buffer;
-        buffer->head = size;
-        buffer->count = buffer->count + size;
-        if (buffer->max_rec < size)
-          buffer->max_rec = size;
-      }
+      *size = end - tail;
+      return &buffer->buffer[tail];
     }
+
+    /*
+     * Everything up to the end marker is consumed, continue at the front.
+     */
+    tail = 0;
+    _Atomic_Store_uintptr (&buffer->tail, tail, ATOMIC_ORDER_RELEASE);
   }
 
-  return ptr;
+  *size = head - tail;
+  if (*size == 0)
+    return NULL;
+
+  return &buffer->buffer[tail];
 }
 
 void*
 rtems_capture_buffer_free (rtems_capture_buffer* buffer, size_t size)
 {
   void*  ptr;
-  size_t next;
   size_t buff_size;
+  size_t next;
 
   if (size == 0)
     return NULL;
 
   ptr = rtems_capture_buffer_peek (buffer, &buff_size);
-  next = buffer->tail + size;
 
   /*
-   * Check if we are freeing space past the end of the buffer
+   * Check if we are freeing space past the end of the contiguous block
    */
-  _Assert (! rtems_capture_buffer_is_empty( buffer));
-  _Assert (!((buffer->tail > buffer->head) && (next > buffer->end)));
-  _Assert (!((buffer->tail < buffer->head) && (next > buffer->head)));
+  _Assert (ptr != NULL);
+  _Assert (size <= buff_size);
 
-  buffer->count = buffer->count - size;
+  if (size > buff_size)
+    size = buff_size;
 
-  if (next == buffer->end)
-  {
-    buffer->end = buffer->size;
-    buffer->tail = 0;
-  } else
-  {
-    buffer->tail = next;
-  }
+  next = _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_RELAXED) + size;
+
+  /*
+   * The release orders the reads of the freed records before the producer
+   * may reuse the space.
+   */
+  _Atomic_Store_uintptr (&buffer->tail, next, ATOMIC_ORDER_RELEASE);
 
   return ptr;
 }
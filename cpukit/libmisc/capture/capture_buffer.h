@@ -38,11 +38,16 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+
 #ifndef __CAPTURE_BUFFER_H_
 #define __CAPTURE_BUFFER_H_
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#include <rtems/score/atomic.h>
+
 /**@{*/
 #ifdef __cplusplus
 extern "C" {
@@ -50,24 +55,33 @@ extern "C" {
 
 /**
  * Capture buffer. There is one per CPU.
+ *
+ * The buffer is a single producer, single consumer ring. The producer is the
+ * owner CPU with interrupts disabled, the consumer is the reader. The producer
+ * owns the write position and the end marker and publishes the head with
+ * release semantics once a record is complete. The consumer owns the tail and
+ * publishes it with release semantics once records are consumed. Neither side
+ * takes a lock. A wrapped producer keeps at least one free byte in front of
+ * the tail so that head == tail always means empty.
  */
 typedef struct rtems_capture_buffer {
-  uint8_t* buffer;       /**< The per cpu buffer. */
-  size_t   size;         /**< The size of the buffer in bytes. */
-  size_t   count;        /**< The number of used bytes in the buffer. */
-  size_t   head;         /**< First record. */
-  size_t   tail;         /**< Head == Tail for empty. */
-  size_t   end;          /**< Buffer current end, it may move in. */
-  size_t   max_rec;      /**< The largest record in the buffer. */
+  uint8_t*       buffer;  /**< The per cpu buffer. */
+  size_t         size;    /**< The size of the buffer in bytes. */
+  size_t         write;   /**< Next write position, private to the producer. */
+  size_t         max_rec; /**< The largest record in the buffer. */
+  Atomic_Uintptr head;    /**< Published write position. */
+  Atomic_Uintptr end;     /**< End of the data if the producer wrapped. */
+  Atomic_Uintptr tail;    /**< Read position, head == tail for empty. */
 } rtems_capture_buffer;
 
 static inline void
-rtems_capture_buffer_flush (rtems_capture_buffer* buffer)
+rtems_capture_buffer_reset (rtems_capture_buffer* buffer)
 {
-  buffer->end = buffer->size;
-  buffer->head = buffer->tail =  0;
-  buffer->count = 0;
+  buffer->write = 0;
   buffer->max_rec = 0;
+  _Atomic_Init_uintptr (&buffer->head, 0);
+  _Atomic_Init_uintptr (&buffer->end, buffer->size);
+  _Atomic_Init_uintptr (&buffer->tail, 0);
 }
 
 static inline void
@@ -75,59 +89,71 @@ rtems_capture_buffer_create (rtems_capture_buffer* buffer, size_t size)
 {
   buffer->buffer = malloc(size);
   buffer->size = size;
-  rtems_capture_buffer_flush (buffer);
+  rtems_capture_buffer_reset (buffer);
 }
 
 static inline void
 rtems_capture_buffer_destroy (rtems_capture_buffer*  buffer)
 {
-  rtems_capture_buffer_flush (buffer);
+  rtems_capture_buffer_reset (buffer);
   free (buffer->buffer);
   buffer->buffer = NULL;
 }
 
-static inline bool
-rtems_capture_buffer_is_empty (rtems_capture_buffer* buffer)
+/*
+ * Producer side.
+ */
+
+void* rtems_capture_buffer_allocate (rtems_capture_buffer* buffer, size_t size);
+
+/*
+ * Make the records allocated since the last commit visible to the consumer.
+ */
+static inline void
+rtems_capture_buffer_commit (rtems_capture_buffer* buffer)
 {
-   return buffer->count == 0;
+  _Atomic_Store_uintptr (&buffer->head, buffer->write, ATOMIC_ORDER_RELEASE);
 }
 
+/*
+ * Consumer side.
+ */
+
 static inline bool
-rtems_capture_buffer_is_full (rtems_capture_buffer* buffer)
+rtems_capture_buffer_is_empty (rtems_capture_buffer* buffer)
 {
-   return buffer->count == buffer->size;
+  return _Atomic_Load_uintptr (&buffer->head, ATOMIC_ORDER_ACQUIRE) ==
+    _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_RELAXED);
 }
 
+/*
+ * Returns true if the records following the contiguous block returned by
+ * rtems_capture_buffer_peek continue at the start of the buffer.
+ */
 static inline bool
 rtems_capture_buffer_has_wrapped (rtems_capture_buffer* buffer)
 {
-  if (buffer->tail > buffer->head)
-    return true;
-
-  return false;
-}
-
-static inline void*
-rtems_capture_buffer_peek (rtems_capture_buffer* buffer, size_t* size)
-{
-  if (rtems_capture_buffer_is_empty (buffer))
-  {
-    *size = 0;
-    return NULL;
-  }
-
-  if (buffer->tail > buffer->head)
-    *size = buffer->end - buffer->tail;
-  else
-    *size = buffer->head - buffer->tail;
-
-  return &buffer->buffer[buffer->tail];
+  return _Atomic_Load_uintptr (&buffer->tail, ATOMIC_ORDER_RELAXED) >
+    _Atomic_Load_uintptr (&buffer->head, ATOMIC_ORDER_ACQUIRE);
 }
 
-void* rtems_capture_buffer_allocate (rtems_capture_buffer* buffer, size_t size);
+void* rtems_capture_buffer_peek (rtems_capture_buffer* buffer, size_t* size);
 
 void* rtems_capture_buffer_free (rtems_capture_buffer* buffer, size_t size);
 
+/*
+ * Discard all published records.
+ */
+static inline void
+rtems_capture_buffer_flush (rtems_capture_buffer* buffer)
+{
+  _Atomic_Store_uintptr (
+    &buffer->tail,
+    _Atomic_Load_uintptr (&buffer->head, ATOMIC_ORDER_ACQUIRE),
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -53,17 +53,9 @@
 #include <rtems/captureimpl.h>
 
 /*
- * Structure used during printing of the capture records.
+ * Number of record spans read at once when printing the capture records.
  */
-
-typedef struct
-{
-  const void*          recs;      /**< Next record to be read. */
-  size_t               read;      /**< Number of records read. */
-  size_t               printed;   /**< Records been printed. */
-  bool                 rec_valid; /**< The record is valid. */
-  rtems_capture_record rec;       /**< The record, copied out. */
-} ctrace_per_cpu;
+#define CTRACE_SPAN_COUNT (32)
 
 /*
  * Task block size.
@@ -279,141 +271,97 @@ rtems_capture_print_record_capture(int                         cpu,
 void
 rtems_capture_print_trace_records (int total, bool csv)
 {
-  ctrace_per_cpu*    per_cpu;
-  ctrace_per_cpu*    cpu;
-  int                cpus;
-  rtems_capture_time last_time = 0;
-  int                i;
-
-  cpus = rtems_scheduler_get_processor_maximum ();
-
-  per_cpu = calloc (cpus, sizeof(*per_cpu));
-  if (per_cpu == NULL)
-  {
-    fprintf(stdout, "error: no memory\n");
-    return;
-  }
+  rtems_capture_record_span spans[CTRACE_SPAN_COUNT];
+  rtems_capture_time        last_time = 0;
 
   while (total)
   {
-    const rtems_capture_record* rec_out = NULL;
-    int                         cpu_out = -1;
-    rtems_capture_time          this_time = 0;
-
-    /* Prime the per_cpu data */
-    for (i = 0; i < cpus; i++) {
-      cpu = &per_cpu[i];
-
-      if (cpu->read == 0)
-      {
-        rtems_status_code sc;
-        sc = rtems_capture_read (i, &cpu->read, &cpu->recs);
-        if (sc != RTEMS_SUCCESSFUL)
-        {
-          fprintf (stdout,
-                   "error: trace read failed: %s\n", rtems_status_text (sc));
-          rtems_capture_flush (0);
-          free (per_cpu);
-          return;
-        }
-        /* Release the buffer if there are no records to read */
-        if (cpu->read == 0)
-          rtems_capture_release (i, 0);
-      }
-
-      /* Read the record out from the capture buffer */
-      if (!cpu->rec_valid && (cpu->read != 0))
-      {
-        cpu->recs = rtems_capture_record_extract (cpu->recs,
-                                                  &cpu->rec,
-                                                  sizeof (cpu->rec));
-        cpu->rec_valid = true;
-      }
+    rtems_status_code sc;
+    size_t            count;
+    size_t            s;
 
-      /* Find the next record to print, the earliest recond on any core */
-      if ((cpu->rec_valid) && ((this_time == 0) || (cpu->rec.time < this_time)))
-      {
-        rec_out = &cpu->rec;
-        cpu_out = i;
-        this_time = rec_out->time;
-      }
+    sc = rtems_capture_read_batch (spans, RTEMS_ARRAY_SIZE (spans), &count);
+    if (sc != RTEMS_SUCCESSFUL)
+    {
+      fprintf (stdout,
+               "error: trace read failed: %s\n", rtems_status_text (sc));
+      rtems_capture_flush (0);
+      return;
     }
 
     /*  If we have read all the records abort. */
-    if (rec_out == NULL)
-      break;
-
-    cpu = &per_cpu[cpu_out];
-
-    /* Print the record */
-    if (csv)
+    if (count == 0)
     {
-      fprintf(stdout,
-              "%03i,%08" PRIu32 ",%03" PRIu32
-              ",%03" PRIu32 ",%04" PRIx32 ",%" PRId64 "\n",
-              cpu_out,
-              (uint32_t) rec_out->task_id,
-              (rec_out->events >> RTEMS_CAPTURE_REAL_PRIORITY_EVENT) & 0xff,
-              (rec_out->events >> RTEMS_CAPTURE_CURR_PRIORITY_EVENT) & 0xff,
-              (rec_out->events >> RTEMS_CAPTURE_EVENT_START),
-              (uint64_t) rec_out->time);
+      rtems_capture_release_batch (spans, count);
+      break;
     }
-    else
+
+    for (s = 0; s < count; s++)
     {
-      if ((rec_out->events >> RTEMS_CAPTURE_EVENT_START) == 0)
-      {
-        rtems_capture_task_record task_rec;
-        cpu->recs = rtems_capture_record_extract (cpu->recs,
-                                                  &task_rec,
-                                                  sizeof (task_rec));
-        ctrace_task_name_add (rec_out->task_id, task_rec.name);
-        rtems_capture_print_record_task (cpu_out, rec_out, &task_rec);
-      }
-      else
+      rtems_capture_record_span* span = &spans[s];
+      const uint8_t*             recs = span->records;
+      uint32_t                   printed = 0;
+      int                        cpu_out = (int) span->cpu;
+
+      while ((printed < span->count) && total)
       {
-        rtems_capture_time diff;
-        const rtems_name*  name = NULL;
-        if (last_time != 0)
-          diff = rec_out->time - last_time;
+        rtems_capture_record        rec;
+        const rtems_capture_record* rec_out = &rec;
+
+        rtems_capture_record_extract (recs, &rec, sizeof (rec));
+
+        /* Print the record */
+        if (csv)
+        {
+          fprintf(stdout,
+                  "%03i,%08" PRIu32 ",%03" PRIu32
+                  ",%03" PRIu32 ",%04" PRIx32 ",%" PRId64 "\n",
+                  cpu_out,
+                  (uint32_t) rec_out->task_id,
+                  (rec_out->events >> RTEMS_CAPTURE_REAL_PRIORITY_EVENT) & 0xff,
+                  (rec_out->events >> RTEMS_CAPTURE_CURR_PRIORITY_EVENT) & 0xff,
+                  (rec_out->events >> RTEMS_CAPTURE_EVENT_START),
+                  (uint64_t) rec_out->time);
+        }
         else
-          diff = 0;
-        last_time = rec_out->time;
-        ctrace_task_name_find (rec_out->task_id, &name);
-        rtems_capture_print_record_capture (cpu_out, rec_out, diff, name);
-        if ((rec_out->events &
-             (RTEMS_CAPTURE_DELETED_BY_EVENT | RTEMS_CAPTURE_DELETED_EVENT)) != 0)
-          ctrace_task_name_remove (rec_out->task_id);
+        {
+          if ((rec_out->events >> RTEMS_CAPTURE_EVENT_START) == 0)
+          {
+            rtems_capture_task_record task_rec;
+            rtems_capture_record_extract (recs + sizeof (rec),
+                                          &task_rec,
+                                          sizeof (task_rec));
+            ctrace_task_name_add (rec_out->task_id, task_rec.name);
+            rtems_capture_print_record_task (cpu_out, rec_out, &task_rec);
+          }
+          else
+          {
+            rtems_capture_time diff;
+            const rtems_name*  name = NULL;
+            if (last_time != 0)
+              diff = rec_out->time - last_time;
+            else
+              diff = 0;
+            last_time = rec_out->time;
+            ctrace_task_name_find (rec_out->task_id, &name);
+            rtems_capture_print_record_capture (cpu_out, rec_out, diff, name);
+            if ((rec_out->events &
+                 (RTEMS_CAPTURE_DELETED_BY_EVENT | RTEMS_CAPTURE_DELETED_EVENT)) != 0)
+              ctrace_task_name_remove (rec_out->task_id);
+          }
+        }
+
+        recs += rec.size;
+        ++printed;
+        --total;
       }
-    }
 
-    /*
-     * If we have not printed all the records read increment to the next
-     * record. If we have printed all records release the records printed.
-     */
-    cpu->rec_valid = false;
-    ++cpu->printed;
-    if (cpu->printed == cpu->read)
-    {
-      rtems_capture_release (cpu_out, cpu->printed);
-      cpu->recs = NULL;
-      cpu->read = 0;
-      cpu->printed = 0;
+      /* Only release the records printed. */
+      span->count = printed;
     }
 
-    --total;
-  }
-
-  /* Finished so release all the records that were printed. */
-  for (i = 0; i < cpus; i++)
-  {
-    cpu = &per_cpu[i];
-    if (cpu->read != 0)
-    {
-      rtems_capture_release (i, cpu->printed);
-    }
+    rtems_capture_release_batch (spans, count);
   }
-
-  free(per_cpu);
 }
 
 void
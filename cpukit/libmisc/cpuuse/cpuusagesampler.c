@@ -0,0 +1,709 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplCPUUsageReporting
+ *
+ * @brief This source file contains the definition of the incremental CPU
+ *   usage sampler.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/cpuuse.h>
+#include <rtems/thread.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/todimpl.h>
+
+/*
+ * The usage of a full period in units of 0.001 percent.
+ */
+#define CPU_USAGE_SAMPLER_FULL 100000
+
+#define CPU_USAGE_SAMPLER_HISTORY_DEFAULT 16
+
+#define CPU_USAGE_SAMPLER_BATCH_DEFAULT 16
+
+#define CPU_USAGE_SAMPLER_EVENT_STOP RTEMS_EVENT_1
+
+/*
+ * The state of one thread object slot.  A slot is identified by the object
+ * API and index of the thread.  If the identifier of the thread in the slot
+ * changes, the history starts again.
+ */
+typedef struct {
+  rtems_id          id;
+  Timestamp_Control cpu_time;
+  Timestamp_Control stamp;
+  uint32_t          head;
+  uint32_t          count;
+  uint32_t          current;
+  uint64_t          sum;
+} CPU_usage_Sampler_slot;
+
+/*
+ * A reading of one thread object slot taken with the object allocator locked.
+ */
+typedef struct {
+  rtems_id          id;
+  Timestamp_Control cpu_time;
+} CPU_usage_Sampler_reading;
+
+struct rtems_cpu_usage_sampler {
+  rtems_mutex                 sample_mutex;
+  rtems_mutex                 mutex;
+  rtems_interval              period;
+  uint32_t                    history_size;
+  uint32_t                    batch;
+  uint32_t                    slot_count;
+  CPU_usage_Sampler_slot     *slots;
+  uint32_t                   *history;
+  CPU_usage_Sampler_reading  *readings;
+  uint32_t                   *scratch;
+  rtems_id                    task;
+  volatile bool               run;
+  rtems_counting_semaphore    stopped;
+};
+
+static uint32_t CPU_usage_Sampler_slot_maximum( void )
+{
+  uint32_t count;
+  int      api_index;
+
+  count = 0;
+
+  for ( api_index = 1 ; api_index <= OBJECTS_APIS_LAST ; ++api_index ) {
+    const Objects_Information *information;
+
+    information = _Objects_Information_table[ api_index ][ 1 ];
+
+    if ( information != NULL ) {
+      count += _Objects_Get_maximum_index( information );
+    }
+  }
+
+  return count;
+}
+
+/*
+ * Make room for all thread object slots.  The number of thread objects may
+ * grow if unlimited objects are configured.
+ */
+static bool CPU_usage_Sampler_grow(
+  rtems_cpu_usage_sampler *sampler,
+  uint32_t                 slot_count
+)
+{
+  CPU_usage_Sampler_slot *slots;
+  uint32_t               *history;
+
+  if ( slot_count <= sampler->slot_count ) {
+    return true;
+  }
+
+  slots = realloc( sampler->slots, slot_count * sizeof( *slots ) );
+  if ( slots == NULL ) {
+    return false;
+  }
+
+  sampler->slots = slots;
+
+  history = realloc(
+    sampler->history,
+    (size_t) slot_count * sampler->history_size * sizeof( *history )
+  );
+  if ( history == NULL ) {
+    return false;
+  }
+
+  sampler->history = history;
+  memset(
+    &slots[ sampler->slot_count ],
+    0,
+    ( slot_count - sampler->slot_count ) * sizeof( *slots )
+  );
+  sampler->slot_count = slot_count;
+  return true;
+}
+
+static uint32_t CPU_usage_Sampler_usage(
+  const Timestamp_Control *used,
+  const Timestamp_Control *period
+)
+{
+  uint64_t used_ns;
+  uint64_t period_ns;
+
+  used_ns = _Timestamp_Get_as_nanoseconds( used );
+  period_ns = _Timestamp_Get_as_nanoseconds( period );
+
+  if ( period_ns == 0 ) {
+    return 0;
+  }
+
+  if ( used_ns >= period_ns ) {
+    return CPU_USAGE_SAMPLER_FULL;
+  }
+
+  return (uint32_t) ( ( used_ns * CPU_USAGE_SAMPLER_FULL ) / period_ns );
+}
+
+static void CPU_usage_Sampler_update(
+  rtems_cpu_usage_sampler         *sampler,
+  uint32_t                         slot_index,
+  const CPU_usage_Sampler_reading *reading,
+  const Timestamp_Control         *now
+)
+{
+  CPU_usage_Sampler_slot *slot;
+  uint32_t               *history;
+  Timestamp_Control       used;
+  Timestamp_Control       period;
+  uint32_t                usage;
+
+  slot = &sampler->slots[ slot_index ];
+
+  if ( slot->id != reading->id ) {
+    slot->id = reading->id;
+    slot->cpu_time = reading->cpu_time;
+    slot->stamp = *now;
+    slot->head = 0;
+    slot->count = 0;
+    slot->current = 0;
+    slot->sum = 0;
+    return;
+  }
+
+  if ( reading->id == 0 ) {
+    return;
+  }
+
+  _Timestamp_Subtract( &slot->cpu_time, &reading->cpu_time, &used );
+  _Timestamp_Subtract( &slot->stamp, now, &period );
+  usage = CPU_usage_Sampler_usage( &used, &period );
+
+  history = &sampler->history[ slot_index * sampler->history_size ];
+
+  if ( slot->count == sampler->history_size ) {
+    slot->sum -= history[ slot->head ];
+  } else {
+    ++slot->count;
+  }
+
+  history[ slot->head ] = usage;
+  slot->sum += usage;
+  slot->head = ( slot->head + 1 ) % sampler->history_size;
+  slot->current = usage;
+  slot->cpu_time = reading->cpu_time;
+  slot->stamp = *now;
+}
+
+void rtems_cpu_usage_sampler_sample( rtems_cpu_usage_sampler *sampler )
+{
+  uint32_t slot_base;
+  int      api_index;
+
+  /*
+   * The sample mutex serializes the passes which share the readings.  The
+   * mutex protecting the slots is only held to update a batch so that the
+   * queries are not delayed by a pass.
+   */
+  rtems_mutex_lock( &sampler->sample_mutex );
+  rtems_mutex_lock( &sampler->mutex );
+
+  if ( !CPU_usage_Sampler_grow( sampler, CPU_usage_Sampler_slot_maximum() ) ) {
+    rtems_mutex_unlock( &sampler->mutex );
+    rtems_mutex_unlock( &sampler->sample_mutex );
+    return;
+  }
+
+  rtems_mutex_unlock( &sampler->mutex );
+
+  slot_base = 0;
+
+  for ( api_index = 1 ; api_index <= OBJECTS_APIS_LAST ; ++api_index ) {
+    const Objects_Information *information;
+    Objects_Maximum            maximum;
+    Objects_Maximum            index;
+
+    information = _Objects_Information_table[ api_index ][ 1 ];
+
+    if ( information == NULL ) {
+      continue;
+    }
+
+    maximum = _Objects_Get_maximum_index( information );
+    index = 0;
+
+    while ( index < maximum ) {
+      Timestamp_Control now;
+      uint32_t          count;
+      uint32_t          i;
+
+      /*
+       * Hold the object allocator lock only for one batch so that thread
+       * creation and deletion is not delayed by the sampling of all threads.
+       */
+      count = maximum - index;
+      if ( count > sampler->batch ) {
+        count = sampler->batch;
+      }
+
+      _Objects_Allocator_lock();
+
+      /*
+       * The thread objects may have been shrunk in the meantime.
+       */
+      if ( index + count > _Objects_Get_maximum_index( information ) ) {
+        count = _Objects_Get_maximum_index( information ) - index;
+      }
+
+      for ( i = 0 ; i < count ; ++i ) {
+        CPU_usage_Sampler_reading *reading;
+        Thread_Control            *the_thread;
+
+        reading = &sampler->readings[ i ];
+        the_thread = (Thread_Control *) information->local_table[ index + i ];
+
+        if ( the_thread != NULL ) {
+          reading->id = the_thread->Object.id;
+          reading->cpu_time = _Thread_Get_CPU_time_used( the_thread );
+        } else {
+          reading->id = 0;
+        }
+      }
+
+      _TOD_Get_uptime( &now );
+      _Objects_Allocator_unlock();
+
+      rtems_mutex_lock( &sampler->mutex );
+
+      for ( i = 0 ; i < count ; ++i ) {
+        uint32_t slot_index;
+
+        slot_index = slot_base + index + i;
+
+        if ( slot_index < sampler->slot_count ) {
+          CPU_usage_Sampler_update(
+            sampler,
+            slot_index,
+            &sampler->readings[ i ],
+            &now
+          );
+        }
+      }
+
+      rtems_mutex_unlock( &sampler->mutex );
+
+      if ( count == 0 ) {
+        break;
+      }
+
+      index += count;
+    }
+
+    slot_base += maximum;
+  }
+
+  rtems_mutex_unlock( &sampler->sample_mutex );
+}
+
+static uint32_t CPU_usage_Sampler_percentile(
+  rtems_cpu_usage_sampler *sampler,
+  uint32_t                 slot_index,
+  uint32_t                 percent
+)
+{
+  const CPU_usage_Sampler_slot *slot;
+  const uint32_t               *history;
+  uint32_t                      count;
+  uint32_t                      rank;
+  uint32_t                      i;
+
+  slot = &sampler->slots[ slot_index ];
+  count = slot->count;
+
+  if ( count == 0 ) {
+    return 0;
+  }
+
+  history = &sampler->history[ slot_index * sampler->history_size ];
+
+  /*
+   * Insertion sort, the history is short.
+   */
+  for ( i = 0 ; i < count ; ++i ) {
+    uint32_t value;
+    uint32_t j;
+
+    value = history[ i ];
+    j = i;
+
+    while ( j > 0 && sampler->scratch[ j - 1 ] > value ) {
+      sampler->scratch[ j ] = sampler->scratch[ j - 1 ];
+      --j;
+    }
+
+    sampler->scratch[ j ] = value;
+  }
+
+  if ( percent > 100 ) {
+    percent = 100;
+  }
+
+  rank = ( percent * count + 99 ) / 100;
+  if ( rank > 0 ) {
+    --rank;
+  }
+
+  return sampler->scratch[ rank ];
+}
+
+static void CPU_usage_Sampler_get_stats(
+  rtems_cpu_usage_sampler      *sampler,
+  uint32_t                      slot_index,
+  uint32_t                      percent,
+  rtems_cpu_usage_thread_stats *stats
+)
+{
+  const CPU_usage_Sampler_slot *slot;
+  const uint32_t               *history;
+  uint32_t                      maximum;
+  uint32_t                      i;
+
+  slot = &sampler->slots[ slot_index ];
+  history = &sampler->history[ slot_index * sampler->history_size ];
+  maximum = 0;
+
+  for ( i = 0 ; i < slot->count ; ++i ) {
+    if ( history[ i ] > maximum ) {
+      maximum = history[ i ];
+    }
+  }
+
+  stats->id = slot->id;
+  stats->samples = slot->count;
+  stats->current = slot->current;
+  stats->average = slot->count > 0 ? (uint32_t) ( slot->sum / slot->count ) : 0;
+  stats->maximum = maximum;
+  stats->percentile = CPU_usage_Sampler_percentile(
+    sampler,
+    slot_index,
+    percent
+  );
+}
+
+static uint32_t CPU_usage_Sampler_key(
+  const rtems_cpu_usage_sampler *sampler,
+  uint32_t                       slot_index,
+  rtems_cpu_usage_sampler_order  order
+)
+{
+  const CPU_usage_Sampler_slot *slot;
+
+  slot = &sampler->slots[ slot_index ];
+
+  if ( order == RTEMS_CPU_USAGE_SAMPLER_ORDER_AVERAGE ) {
+    return (uint32_t) ( slot->sum / slot->count );
+  }
+
+  return slot->current;
+}
+
+size_t rtems_cpu_usage_sampler_top(
+  rtems_cpu_usage_sampler       *sampler,
+  rtems_cpu_usage_sampler_order  order,
+  uint32_t                       percent,
+  rtems_cpu_usage_thread_stats  *top,
+  size_t                         n
+)
+{
+  size_t   count;
+  uint32_t slot_index;
+  size_t   i;
+
+  count = 0;
+
+  rtems_mutex_lock( &sampler->mutex );
+
+  /*
+   * Select the top slots with an insertion into the output array.  The
+   * slot index is kept in the samples member until the statistics are
+   * filled in.
+   */
+  for ( slot_index = 0 ; slot_index < sampler->slot_count ; ++slot_index ) {
+    const CPU_usage_Sampler_slot *slot;
+    uint32_t                      key;
+
+    slot = &sampler->slots[ slot_index ];
+
+    if ( slot->id == 0 || slot->count == 0 ) {
+      continue;
+    }
+
+    key = CPU_usage_Sampler_key( sampler, slot_index, order );
+
+    if ( count == n ) {
+      if (
+        n == 0 ||
+        key <= CPU_usage_Sampler_key( sampler, top[ n - 1 ].samples, order )
+      ) {
+        continue;
+      }
+    } else {
+      ++count;
+    }
+
+    i = count - 1;
+
+    while (
+      i > 0 &&
+      key > CPU_usage_Sampler_key( sampler, top[ i - 1 ].samples, order )
+    ) {
+      top[ i ].samples = top[ i - 1 ].samples;
+      --i;
+    }
+
+    top[ i ].samples = slot_index;
+  }
+
+  for ( i = 0 ; i < count ; ++i ) {
+    CPU_usage_Sampler_get_stats( sampler, top[ i ].samples, percent, &top[ i ] );
+  }
+
+  rtems_mutex_unlock( &sampler->mutex );
+
+  return count;
+}
+
+rtems_status_code rtems_cpu_usage_sampler_get(
+  rtems_cpu_usage_sampler      *sampler,
+  rtems_id                      id,
+  uint32_t                      percent,
+  rtems_cpu_usage_thread_stats *stats
+)
+{
+  rtems_status_code sc;
+  uint32_t          slot_index;
+  int               api;
+  int               api_index;
+
+  api = (int) _Objects_Get_API( id );
+
+  if ( api < 1 || api > OBJECTS_APIS_LAST ) {
+    return RTEMS_INVALID_ID;
+  }
+
+  /*
+   * The slots are laid out in the order of the object APIs.
+   */
+  slot_index = _Objects_Get_index( id ) - OBJECTS_INDEX_MINIMUM;
+
+  for ( api_index = 1 ; api_index < api ; ++api_index ) {
+    const Objects_Information *information;
+
+    information = _Objects_Information_table[ api_index ][ 1 ];
+
+    if ( information != NULL ) {
+      slot_index += _Objects_Get_maximum_index( information );
+    }
+  }
+
+  sc = RTEMS_INVALID_ID;
+
+  rtems_mutex_lock( &sampler->mutex );
+
+  if (
+    slot_index < sampler->slot_count &&
+    sampler->slots[ slot_index ].id == id
+  ) {
+    CPU_usage_Sampler_get_stats( sampler, slot_index, percent, stats );
+    sc = RTEMS_SUCCESSFUL;
+  }
+
+  rtems_mutex_unlock( &sampler->mutex );
+
+  return sc;
+}
+
+static void CPU_usage_Sampler_task( rtems_task_argument arg )
+{
+  rtems_cpu_usage_sampler *sampler;
+
+  sampler = (rtems_cpu_usage_sampler *) arg;
+
+  while ( sampler->run ) {
+    rtems_event_set events;
+
+    (void) rtems_event_receive(
+      CPU_USAGE_SAMPLER_EVENT_STOP,
+      RTEMS_EVENT_ANY | RTEMS_WAIT,
+      sampler->period,
+      &events
+    );
+
+    if ( sampler->run ) {
+      rtems_cpu_usage_sampler_sample( sampler );
+    }
+  }
+
+  rtems_counting_semaphore_post( &sampler->stopped );
+  rtems_task_exit();
+}
+
+static void CPU_usage_Sampler_free( rtems_cpu_usage_sampler *sampler )
+{
+  rtems_counting_semaphore_destroy( &sampler->stopped );
+  rtems_mutex_destroy( &sampler->mutex );
+  rtems_mutex_destroy( &sampler->sample_mutex );
+  free( sampler->slots );
+  free( sampler->history );
+  free( sampler->readings );
+  free( sampler->scratch );
+  free( sampler );
+}
+
+rtems_status_code rtems_cpu_usage_sampler_create(
+  const rtems_cpu_usage_sampler_config  *config,
+  rtems_cpu_usage_sampler              **sampler_p
+)
+{
+  rtems_cpu_usage_sampler *sampler;
+  rtems_task_priority      priority;
+  rtems_status_code        sc;
+
+  if ( config == NULL || sampler_p == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  sampler = calloc( 1, sizeof( *sampler ) );
+  if ( sampler == NULL ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  rtems_mutex_init( &sampler->sample_mutex, "CPU Usage Sampler Pass" );
+  rtems_mutex_init( &sampler->mutex, "CPU Usage Sampler" );
+  rtems_counting_semaphore_init( &sampler->stopped, "CPU Usage Sampler", 0 );
+  sampler->period = config->period;
+  sampler->history_size = config->history;
+  if ( sampler->history_size == 0 ) {
+    sampler->history_size = CPU_USAGE_SAMPLER_HISTORY_DEFAULT;
+  }
+  sampler->batch = config->batch;
+  if ( sampler->batch == 0 ) {
+    sampler->batch = CPU_USAGE_SAMPLER_BATCH_DEFAULT;
+  }
+
+  sampler->readings = calloc( sampler->batch, sizeof( *sampler->readings ) );
+  sampler->scratch = calloc(
+    sampler->history_size,
+    sizeof( *sampler->scratch )
+  );
+  if ( sampler->readings == NULL || sampler->scratch == NULL ) {
+    CPU_usage_Sampler_free( sampler );
+    return RTEMS_NO_MEMORY;
+  }
+
+  rtems_mutex_lock( &sampler->mutex );
+  if ( !CPU_usage_Sampler_grow( sampler, CPU_usage_Sampler_slot_maximum() ) ) {
+    rtems_mutex_unlock( &sampler->mutex );
+    CPU_usage_Sampler_free( sampler );
+    return RTEMS_NO_MEMORY;
+  }
+  rtems_mutex_unlock( &sampler->mutex );
+
+  /*
+   * The first sample establishes the reference point of all threads.
+   */
+  rtems_cpu_usage_sampler_sample( sampler );
+
+  if ( sampler->period != 0 ) {
+    priority = config->priority;
+
+    if ( priority == 0 ) {
+      sc = rtems_task_set_priority(
+        RTEMS_SELF,
+        RTEMS_CURRENT_PRIORITY,
+        &priority
+      );
+      _Assert( sc == RTEMS_SUCCESSFUL );
+    }
+
+    sc = rtems_task_create(
+      rtems_build_name( 'C', 'P', 'U', 'S' ),
+      priority,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &sampler->task
+    );
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      CPU_usage_Sampler_free( sampler );
+      return sc;
+    }
+
+    sampler->run = true;
+
+    sc = rtems_task_start(
+      sampler->task,
+      CPU_usage_Sampler_task,
+      (rtems_task_argument) sampler
+    );
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      (void) rtems_task_delete( sampler->task );
+      CPU_usage_Sampler_free( sampler );
+      return sc;
+    }
+  }
+
+  *sampler_p = sampler;
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_cpu_usage_sampler_delete( rtems_cpu_usage_sampler *sampler )
+{
+  if ( sampler == NULL ) {
+    return;
+  }
+
+  if ( sampler->task != 0 ) {
+    sampler->run = false;
+    (void) rtems_event_send( sampler->task, CPU_USAGE_SAMPLER_EVENT_STOP );
+    rtems_counting_semaphore_wait( &sampler->stopped );
+  }
+
+  CPU_usage_Sampler_free( sampler );
+}
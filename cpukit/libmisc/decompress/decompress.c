@@ -0,0 +1,1016 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIDecompress
+ *
+ * @brief This source file contains the implementation of the parallel
+ *   decompression service.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/decompress.h>
+#include <rtems/thread.h>
+#include <rtems.h>
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xz.h>
+#include <zlib.h>
+
+#define DECOMPRESS_WORKER_STACK_SIZE ( 2 * RTEMS_MINIMUM_STACK_SIZE )
+
+#define DECOMPRESS_XZ_HEADER_SIZE 12
+
+#define DECOMPRESS_XZ_FOOTER_SIZE 12
+
+/* Index indicator, record count, one record, padding, and CRC32 */
+#define DECOMPRESS_XZ_INDEX_SIZE_MAX ( 1 + 1 + 2 * 9 + 4 )
+
+#define DECOMPRESS_GZIP_HEADER_SIZE 10
+
+#define DECOMPRESS_GZIP_OUTPUT_SIZE_MIN 4096
+
+typedef enum {
+  DECOMPRESS_FORMAT_XZ,
+  DECOMPRESS_FORMAT_GZIP,
+  DECOMPRESS_FORMAT_ZLIB
+} Decompress_Format;
+
+typedef enum {
+  DECOMPRESS_JOB_NEW,
+  DECOMPRESS_JOB_BUSY,
+  DECOMPRESS_JOB_DONE
+} Decompress_Job_state;
+
+typedef struct {
+  Decompress_Job_state state;
+
+  /*
+   * This member contains the status of the decode.  It is valid in the
+   * DECOMPRESS_JOB_DONE state.
+   */
+  rtems_status_code status;
+
+  /* For xz, this is the header of the stream containing the block */
+  const uint8_t *stream_header;
+
+  const uint8_t *begin;
+
+  /*
+   * For xz, this is the unpadded block size.  For gzip and zlib, this is the
+   * size up to the end of the compressed image.
+   */
+  size_t size;
+
+  /*
+   * For xz, this is the uncompressed size recorded in the index.  For gzip
+   * and zlib, this is the initial output buffer size.
+   */
+  size_t uncompressed_size;
+
+  uint8_t *out;
+  size_t out_size;
+
+  /* For gzip, this is the size of the decoded member */
+  size_t consumed;
+} Decompress_Job;
+
+struct rtems_decompress_context {
+  /*
+   * The mutex protects the job states, the window position, and the stop
+   * request.
+   */
+  rtems_mutex mutex;
+  rtems_condition_variable job_available;
+  rtems_condition_variable job_done;
+  rtems_counting_semaphore workers_done;
+  Decompress_Format format;
+  const uint8_t *begin;
+  size_t size;
+  Decompress_Job *jobs;
+  size_t job_count;
+  size_t window;
+  size_t next_job;
+  size_t current;
+  size_t out_pos;
+  bool current_checked;
+  size_t gzip_end;
+  uint32_t worker_count;
+  bool stop;
+  rtems_status_code status;
+};
+
+static uint32_t Decompress_Get_le32( const uint8_t *p )
+{
+  return (uint32_t) p[ 0 ] | ( (uint32_t) p[ 1 ] << 8 ) |
+    ( (uint32_t) p[ 2 ] << 16 ) | ( (uint32_t) p[ 3 ] << 24 );
+}
+
+static void Decompress_Put_le32( uint8_t *p, uint32_t value )
+{
+  p[ 0 ] = (uint8_t) value;
+  p[ 1 ] = (uint8_t) ( value >> 8 );
+  p[ 2 ] = (uint8_t) ( value >> 16 );
+  p[ 3 ] = (uint8_t) ( value >> 24 );
+}
+
+static size_t Decompress_Put_vli( uint8_t *p, uint64_t value )
+{
+  size_t i;
+
+  i = 0;
+
+  while ( value >= 0x80 ) {
+    p[ i ] = (uint8_t) value | 0x80;
+    value >>= 7;
+    ++i;
+  }
+
+  p[ i ] = (uint8_t) value;
+
+  return i + 1;
+}
+
+static bool Decompress_Get_vli(
+  const uint8_t **pos,
+  const uint8_t  *end,
+  size_t         *value
+)
+{
+  const uint8_t *p;
+  uint64_t       v;
+  unsigned int   shift;
+
+  p = *pos;
+  v = 0;
+  shift = 0;
+
+  while ( p < end && shift < 63 ) {
+    uint8_t b;
+
+    b = *p;
+    ++p;
+    v |= (uint64_t) ( b & 0x7f ) << shift;
+
+    if ( ( b & 0x80 ) == 0 ) {
+      if ( v > SIZE_MAX ) {
+        return false;
+      }
+
+      *pos = p;
+      *value = (size_t) v;
+      return true;
+    }
+
+    shift += 7;
+  }
+
+  return false;
+}
+
+static size_t Decompress_Round_up_4( size_t value )
+{
+  return ( value + 3 ) & ~(size_t) 3;
+}
+
+static bool Decompress_Is_xz( const uint8_t *begin, size_t size )
+{
+  static const uint8_t magic[] = { 0xfd, '7', 'z', 'X', 'Z', 0x00 };
+
+  return size >= sizeof( magic ) && memcmp( begin, magic, sizeof( magic ) ) == 0;
+}
+
+static bool Decompress_Is_gzip( const uint8_t *begin, size_t size )
+{
+  return size >= DECOMPRESS_GZIP_HEADER_SIZE && begin[ 0 ] == 0x1f &&
+    begin[ 1 ] == 0x8b && begin[ 2 ] == Z_DEFLATED &&
+    ( begin[ 3 ] & 0xe0 ) == 0;
+}
+
+static bool Decompress_Is_zlib( const uint8_t *begin, size_t size )
+{
+  return size >= 2 && ( begin[ 0 ] & 0x0f ) == Z_DEFLATED &&
+    ( ( (unsigned int) begin[ 0 ] << 8 ) | begin[ 1 ] ) % 31 == 0;
+}
+
+static bool Decompress_Is_zero( const uint8_t *begin, size_t size )
+{
+  size_t i;
+
+  for ( i = 0; i < size; ++i ) {
+    if ( begin[ i ] != 0 ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static Decompress_Job *Decompress_Add_jobs(
+  rtems_decompress_context *ctx,
+  size_t                    count
+)
+{
+  Decompress_Job *jobs;
+
+  if ( count > SIZE_MAX / sizeof( *jobs ) - ctx->job_count ) {
+    return NULL;
+  }
+
+  jobs = realloc( ctx->jobs, ( ctx->job_count + count ) * sizeof( *jobs ) );
+
+  if ( jobs == NULL ) {
+    return NULL;
+  }
+
+  memset( &jobs[ ctx->job_count ], 0, count * sizeof( *jobs ) );
+  ctx->jobs = jobs;
+  ctx->job_count += count;
+
+  return &jobs[ ctx->job_count - count ];
+}
+
+/*
+ * Parses one xz stream which ends at the specified end and adds a job for
+ * each of its blocks.  The streams are parsed from the end of the image to
+ * the begin.  The jobs of a stream are inserted in front of the jobs of the
+ * following streams.  The end is set to the begin of the stream.
+ */
+static rtems_status_code Decompress_Scan_xz_stream(
+  rtems_decompress_context *ctx,
+  size_t                   *end
+)
+{
+  const uint8_t  *footer;
+  const uint8_t  *index;
+  const uint8_t  *index_end;
+  const uint8_t  *p;
+  const uint8_t  *records;
+  const uint8_t  *stream_header;
+  size_t          index_size;
+  size_t          record_count;
+  size_t          blocks_size;
+  size_t          old_count;
+  size_t          i;
+  Decompress_Job *jobs;
+
+  if ( *end < DECOMPRESS_XZ_HEADER_SIZE + DECOMPRESS_XZ_FOOTER_SIZE + 8 ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  footer = ctx->begin + *end - DECOMPRESS_XZ_FOOTER_SIZE;
+
+  if (
+    footer[ 10 ] != 'Y' || footer[ 11 ] != 'Z' ||
+    xz_crc32( footer + 4, 6, 0 ) != Decompress_Get_le32( footer )
+  ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  index_size = ( (size_t) Decompress_Get_le32( footer + 4 ) + 1 ) * 4;
+
+  if (
+    index_size > *end - DECOMPRESS_XZ_HEADER_SIZE - DECOMPRESS_XZ_FOOTER_SIZE
+  ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  index = footer - index_size;
+  index_end = footer - 4;
+
+  if (
+    index[ 0 ] != 0 ||
+    xz_crc32( index, index_size - 4, 0 ) != Decompress_Get_le32( index_end )
+  ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  p = index + 1;
+
+  if ( !Decompress_Get_vli( &p, index_end, &record_count ) ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  /* Each record has at least two bytes */
+  if ( record_count > (size_t) ( index_end - p ) / 2 ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  records = p;
+  blocks_size = 0;
+
+  for ( i = 0; i < record_count; ++i ) {
+    size_t unpadded;
+    size_t uncompressed;
+
+    if (
+      !Decompress_Get_vli( &p, index_end, &unpadded ) ||
+      !Decompress_Get_vli( &p, index_end, &uncompressed ) ||
+      unpadded == 0 ||
+      Decompress_Round_up_4( unpadded ) > (size_t) ( index - ctx->begin )
+    ) {
+      return RTEMS_IO_ERROR;
+    }
+
+    blocks_size += Decompress_Round_up_4( unpadded );
+
+    if ( blocks_size > (size_t) ( index - ctx->begin ) ) {
+      return RTEMS_IO_ERROR;
+    }
+  }
+
+  if (
+    index_end - p >= 4 ||
+    !Decompress_Is_zero( p, (size_t) ( index_end - p ) )
+  ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  if (
+    blocks_size + DECOMPRESS_XZ_HEADER_SIZE > (size_t) ( index - ctx->begin )
+  ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  stream_header = index - blocks_size - DECOMPRESS_XZ_HEADER_SIZE;
+
+  if (
+    !Decompress_Is_xz( stream_header, DECOMPRESS_XZ_HEADER_SIZE ) ||
+    memcmp( stream_header + 6, footer + 8, 2 ) != 0 ||
+    xz_crc32( stream_header + 6, 2, 0 ) !=
+      Decompress_Get_le32( stream_header + 8 )
+  ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  old_count = ctx->job_count;
+
+  if ( Decompress_Add_jobs( ctx, record_count ) == NULL ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  jobs = ctx->jobs;
+  memmove( &jobs[ record_count ], &jobs[ 0 ], old_count * sizeof( *jobs ) );
+  memset( &jobs[ 0 ], 0, record_count * sizeof( *jobs ) );
+  p = records;
+  blocks_size = 0;
+
+  for ( i = 0; i < record_count; ++i ) {
+    (void) Decompress_Get_vli( &p, index_end, &jobs[ i ].size );
+    (void) Decompress_Get_vli( &p, index_end, &jobs[ i ].uncompressed_size );
+    jobs[ i ].stream_header = stream_header;
+    jobs[ i ].begin = stream_header + DECOMPRESS_XZ_HEADER_SIZE + blocks_size;
+    blocks_size += Decompress_Round_up_4( jobs[ i ].size );
+  }
+
+  *end = (size_t) ( stream_header - ctx->begin );
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code Decompress_Scan_xz( rtems_decompress_context *ctx )
+{
+  size_t end;
+
+  end = ctx->size;
+
+  while ( end > 0 ) {
+    rtems_status_code sc;
+
+    /* Skip the stream padding */
+    while ( end >= 4 && Decompress_Get_le32( ctx->begin + end - 4 ) == 0 ) {
+      end -= 4;
+    }
+
+    sc = Decompress_Scan_xz_stream( ctx, &end );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      return sc;
+    }
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code Decompress_Scan_gzip( rtems_decompress_context *ctx )
+{
+  Decompress_Job *job;
+  size_t          offset;
+
+  job = NULL;
+
+  for (
+    offset = 0;
+    offset + DECOMPRESS_GZIP_HEADER_SIZE <= ctx->size;
+    ++offset
+  ) {
+    if ( Decompress_Is_gzip( ctx->begin + offset, ctx->size - offset ) ) {
+      if ( job != NULL ) {
+        job->uncompressed_size = 4 * (size_t) ( ctx->begin + offset - job->begin );
+      }
+
+      job = Decompress_Add_jobs( ctx, 1 );
+
+      if ( job == NULL ) {
+        return RTEMS_NO_MEMORY;
+      }
+
+      job->begin = ctx->begin + offset;
+      job->size = ctx->size - offset;
+      job->uncompressed_size = 4 * job->size;
+    }
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code Decompress_Scan_zlib( rtems_decompress_context *ctx )
+{
+  Decompress_Job *job;
+
+  job = Decompress_Add_jobs( ctx, 1 );
+
+  if ( job == NULL ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  job->begin = ctx->begin;
+  job->size = ctx->size;
+  job->uncompressed_size = 4 * ctx->size;
+
+  return RTEMS_SUCCESSFUL;
+}
+
+/*
+ * Decodes one xz block.  The block is embedded in a single-block stream with
+ * the header of the original stream and a synthesized index and footer.  This
+ * allows to use the single-call mode of the stream decoder which uses the
+ * output buffer as the dictionary.  The stream decoder verifies the sizes of
+ * the synthesized index against the decoded block.
+ */
+static rtems_status_code Decompress_Decode_xz( Decompress_Job *job )
+{
+  struct xz_dec *dec;
+  struct xz_buf  buf;
+  uint8_t       *in;
+  uint8_t       *p;
+  uint8_t       *index;
+  size_t         block_size;
+  size_t         index_size;
+  size_t         in_size;
+  enum xz_ret    ret;
+
+  block_size = Decompress_Round_up_4( job->size );
+  in_size = DECOMPRESS_XZ_HEADER_SIZE + block_size +
+    DECOMPRESS_XZ_INDEX_SIZE_MAX + DECOMPRESS_XZ_FOOTER_SIZE;
+
+  if ( block_size < job->size || in_size < block_size ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  in = malloc( in_size );
+  job->out = malloc( job->uncompressed_size > 0 ? job->uncompressed_size : 1 );
+  dec = xz_dec_init( XZ_SINGLE, 0 );
+
+  if ( in == NULL || job->out == NULL || dec == NULL ) {
+    xz_dec_end( dec );
+    free( in );
+    return RTEMS_NO_MEMORY;
+  }
+
+  p = in;
+  memcpy( p, job->stream_header, DECOMPRESS_XZ_HEADER_SIZE );
+  p += DECOMPRESS_XZ_HEADER_SIZE;
+  memcpy( p, job->begin, block_size );
+  p += block_size;
+
+  index = p;
+  *p = 0;
+  ++p;
+  p += Decompress_Put_vli( p, 1 );
+  p += Decompress_Put_vli( p, job->size );
+  p += Decompress_Put_vli( p, job->uncompressed_size );
+
+  while ( ( (size_t) ( p - index ) & 3 ) != 0 ) {
+    *p = 0;
+    ++p;
+  }
+
+  Decompress_Put_le32( p, xz_crc32( index, (size_t) ( p - index ), 0 ) );
+  p += 4;
+  index_size = (size_t) ( p - index );
+
+  Decompress_Put_le32( p + 4, (uint32_t) ( index_size / 4 - 1 ) );
+  memcpy( p + 8, job->stream_header + 6, 2 );
+  p[ 10 ] = 'Y';
+  p[ 11 ] = 'Z';
+  Decompress_Put_le32( p, xz_crc32( p + 4, 6, 0 ) );
+  p += DECOMPRESS_XZ_FOOTER_SIZE;
+
+  buf.in = in;
+  buf.in_pos = 0;
+  buf.in_size = (size_t) ( p - in );
+  buf.out = job->out;
+  buf.out_pos = 0;
+  buf.out_size = job->uncompressed_size;
+  ret = xz_dec_run( dec, &buf );
+  xz_dec_end( dec );
+  free( in );
+
+  if ( ret == XZ_MEM_ERROR ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  if ( ret != XZ_STREAM_END || buf.out_pos != job->uncompressed_size ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  job->out_size = buf.out_pos;
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code Decompress_Decode_inflate(
+  Decompress_Job *job,
+  int             window_bits
+)
+{
+  z_stream z;
+  size_t   capacity;
+  int      ret;
+
+  memset( &z, 0, sizeof( z ) );
+
+  if ( inflateInit2( &z, window_bits ) != Z_OK ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  capacity = job->uncompressed_size;
+
+  if ( capacity < DECOMPRESS_GZIP_OUTPUT_SIZE_MIN ) {
+    capacity = DECOMPRESS_GZIP_OUTPUT_SIZE_MIN;
+  }
+
+  z.next_in = (z_const Bytef *) job->begin;
+  z.avail_in = job->size < UINT_MAX ? (uInt) job->size : UINT_MAX;
+
+  while ( true ) {
+    uint8_t *out;
+    size_t   avail;
+
+    if ( z.total_out == capacity ) {
+      if ( capacity > SIZE_MAX / 2 ) {
+        ret = Z_MEM_ERROR;
+        break;
+      }
+
+      capacity *= 2;
+    }
+
+    out = realloc( job->out, capacity );
+
+    if ( out == NULL ) {
+      ret = Z_MEM_ERROR;
+      break;
+    }
+
+    job->out = out;
+    avail = capacity - z.total_out;
+    z.next_out = out + z.total_out;
+    z.avail_out = avail < UINT_MAX ? (uInt) avail : UINT_MAX;
+    ret = inflate( &z, Z_NO_FLUSH );
+
+    if ( ret == Z_STREAM_END ) {
+      break;
+    }
+
+    if ( ret != Z_OK && !( ret == Z_BUF_ERROR && z.avail_out == 0 ) ) {
+      break;
+    }
+  }
+
+  job->out_size = z.total_out;
+  job->consumed = z.total_in;
+  (void) inflateEnd( &z );
+
+  if ( ret == Z_STREAM_END ) {
+    return RTEMS_SUCCESSFUL;
+  }
+
+  if ( ret == Z_MEM_ERROR ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  return RTEMS_IO_ERROR;
+}
+
+static rtems_status_code Decompress_Decode(
+  const rtems_decompress_context *ctx,
+  Decompress_Job                 *job
+)
+{
+  switch ( ctx->format ) {
+    case DECOMPRESS_FORMAT_XZ:
+      return Decompress_Decode_xz( job );
+    case DECOMPRESS_FORMAT_GZIP:
+      return Decompress_Decode_inflate( job, 16 + MAX_WBITS );
+    default:
+      return Decompress_Decode_inflate( job, MAX_WBITS );
+  }
+}
+
+static void Decompress_Release_job( Decompress_Job *job )
+{
+  free( job->out );
+  job->out = NULL;
+  job->out_size = 0;
+}
+
+static bool Decompress_Is_inside_member(
+  const rtems_decompress_context *ctx,
+  const Decompress_Job           *job
+)
+{
+  return ctx->format == DECOMPRESS_FORMAT_GZIP &&
+    (size_t) ( job->begin - ctx->begin ) < ctx->gzip_end;
+}
+
+/* The mutex shall be owned by the caller */
+static Decompress_Job *Decompress_Claim_job( rtems_decompress_context *ctx )
+{
+  while (
+    ctx->next_job < ctx->job_count &&
+    ctx->next_job < ctx->current + ctx->window
+  ) {
+    Decompress_Job *job;
+
+    job = &ctx->jobs[ ctx->next_job ];
+    ++ctx->next_job;
+
+    if ( job->state == DECOMPRESS_JOB_NEW ) {
+      if ( Decompress_Is_inside_member( ctx, job ) ) {
+        job->state = DECOMPRESS_JOB_DONE;
+        job->status = RTEMS_SUCCESSFUL;
+      } else {
+        job->state = DECOMPRESS_JOB_BUSY;
+        return job;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+/* The mutex shall be owned by the caller */
+static void Decompress_Run_job(
+  rtems_decompress_context *ctx,
+  Decompress_Job           *job
+)
+{
+  rtems_status_code sc;
+
+  rtems_mutex_unlock( &ctx->mutex );
+  sc = Decompress_Decode( ctx, job );
+  rtems_mutex_lock( &ctx->mutex );
+  job->status = sc;
+  job->state = DECOMPRESS_JOB_DONE;
+  rtems_condition_variable_broadcast( &ctx->job_done );
+}
+
+static void Decompress_Worker( rtems_task_argument arg )
+{
+  rtems_decompress_context *ctx;
+
+  ctx = (rtems_decompress_context *) arg;
+  rtems_mutex_lock( &ctx->mutex );
+
+  while ( !ctx->stop ) {
+    Decompress_Job *job;
+
+    job = Decompress_Claim_job( ctx );
+
+    if ( job != NULL ) {
+      Decompress_Run_job( ctx, job );
+    } else {
+      rtems_condition_variable_wait( &ctx->job_available, &ctx->mutex );
+    }
+  }
+
+  rtems_mutex_unlock( &ctx->mutex );
+  rtems_counting_semaphore_post( &ctx->workers_done );
+  rtems_task_exit();
+}
+
+static void Decompress_Advance( rtems_decompress_context *ctx )
+{
+  Decompress_Release_job( &ctx->jobs[ ctx->current ] );
+  ctx->out_pos = 0;
+  ctx->current_checked = false;
+
+  rtems_mutex_lock( &ctx->mutex );
+  ++ctx->current;
+
+  if ( ctx->next_job < ctx->current ) {
+    ctx->next_job = ctx->current;
+  }
+
+  rtems_condition_variable_broadcast( &ctx->job_available );
+  rtems_mutex_unlock( &ctx->mutex );
+}
+
+/*
+ * Returns the job with output at the current position, or NULL at the end of
+ * the output or in case of an error.
+ */
+static Decompress_Job *Decompress_Get_current_job(
+  rtems_decompress_context *ctx
+)
+{
+  while ( ctx->status == RTEMS_SUCCESSFUL ) {
+    Decompress_Job *job;
+    size_t          offset;
+
+    if ( ctx->current == ctx->job_count ) {
+      if (
+        ctx->format == DECOMPRESS_FORMAT_GZIP &&
+        !Decompress_Is_zero(
+          ctx->begin + ctx->gzip_end,
+          ctx->size - ctx->gzip_end
+        )
+      ) {
+        ctx->status = RTEMS_IO_ERROR;
+      }
+
+      return NULL;
+    }
+
+    job = &ctx->jobs[ ctx->current ];
+
+    if ( ctx->current_checked ) {
+      if ( job->out_size > ctx->out_pos ) {
+        return job;
+      }
+
+      Decompress_Advance( ctx );
+      continue;
+    }
+
+    rtems_mutex_lock( &ctx->mutex );
+
+    if ( job->state == DECOMPRESS_JOB_NEW ) {
+      if ( Decompress_Is_inside_member( ctx, job ) ) {
+        job->state = DECOMPRESS_JOB_DONE;
+        job->status = RTEMS_SUCCESSFUL;
+      } else {
+        job->state = DECOMPRESS_JOB_BUSY;
+        Decompress_Run_job( ctx, job );
+      }
+    }
+
+    while ( job->state != DECOMPRESS_JOB_DONE ) {
+      rtems_condition_variable_wait( &ctx->job_done, &ctx->mutex );
+    }
+
+    offset = (size_t) ( job->begin - ctx->begin );
+
+    if ( Decompress_Is_inside_member( ctx, job ) ) {
+      /* Discard the decode of a member candidate inside a member */
+      Decompress_Release_job( job );
+    } else if ( job->status != RTEMS_SUCCESSFUL ) {
+      ctx->status = job->status;
+    } else if ( ctx->format == DECOMPRESS_FORMAT_GZIP ) {
+      if ( offset == ctx->gzip_end ) {
+        ctx->gzip_end = offset + job->consumed;
+      } else {
+        ctx->status = RTEMS_IO_ERROR;
+      }
+    }
+
+    rtems_mutex_unlock( &ctx->mutex );
+    ctx->current_checked = true;
+  }
+
+  return NULL;
+}
+
+rtems_status_code rtems_decompress_read(
+  rtems_decompress_context *ctx,
+  void                     *buffer,
+  size_t                    size,
+  size_t                   *count
+)
+{
+  uint8_t *out;
+  size_t   done;
+
+  out = buffer;
+  done = 0;
+
+  while ( done < size ) {
+    Decompress_Job *job;
+    size_t          n;
+
+    job = Decompress_Get_current_job( ctx );
+
+    if ( job == NULL ) {
+      break;
+    }
+
+    n = job->out_size - ctx->out_pos;
+
+    if ( n > size - done ) {
+      n = size - done;
+    }
+
+    memcpy( &out[ done ], &job->out[ ctx->out_pos ], n );
+    ctx->out_pos += n;
+    done += n;
+  }
+
+  *count = done;
+
+  if ( done > 0 ) {
+    return RTEMS_SUCCESSFUL;
+  }
+
+  return ctx->status;
+}
+
+static void Decompress_Stop_workers(
+  rtems_decompress_context *ctx,
+  uint32_t                  worker_count
+)
+{
+  uint32_t i;
+
+  rtems_mutex_lock( &ctx->mutex );
+  ctx->stop = true;
+  rtems_condition_variable_broadcast( &ctx->job_available );
+  rtems_mutex_unlock( &ctx->mutex );
+
+  for ( i = 0; i < worker_count; ++i ) {
+    rtems_counting_semaphore_wait( &ctx->workers_done );
+  }
+}
+
+static void Decompress_Free( rtems_decompress_context *ctx )
+{
+  size_t i;
+
+  for ( i = 0; i < ctx->job_count; ++i ) {
+    Decompress_Release_job( &ctx->jobs[ i ] );
+  }
+
+  rtems_counting_semaphore_destroy( &ctx->workers_done );
+  rtems_condition_variable_destroy( &ctx->job_done );
+  rtems_condition_variable_destroy( &ctx->job_available );
+  rtems_mutex_destroy( &ctx->mutex );
+  free( ctx->jobs );
+  free( ctx );
+}
+
+static rtems_status_code Decompress_Start_workers(
+  rtems_decompress_context *ctx,
+  rtems_task_priority       priority
+)
+{
+  rtems_status_code sc;
+  uint32_t          i;
+
+  if ( priority == 0 ) {
+    sc = rtems_task_set_priority(
+      RTEMS_SELF,
+      RTEMS_CURRENT_PRIORITY,
+      &priority
+    );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      return sc;
+    }
+  }
+
+  for ( i = 0; i < ctx->worker_count; ++i ) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name( 'D', 'C', 'M', 'P' ),
+      priority,
+      DECOMPRESS_WORKER_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      Decompress_Stop_workers( ctx, i );
+      return sc;
+    }
+
+    (void) rtems_task_start(
+      id,
+      Decompress_Worker,
+      (rtems_task_argument) ctx
+    );
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_decompress_create(
+  const void                     *begin,
+  size_t                          size,
+  const rtems_decompress_config  *config,
+  rtems_decompress_context      **context
+)
+{
+  rtems_decompress_context *ctx;
+  rtems_status_code         sc;
+
+  if ( begin == NULL || config == NULL || context == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  ctx = calloc( 1, sizeof( *ctx ) );
+
+  if ( ctx == NULL ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  rtems_mutex_init( &ctx->mutex, "Decompress" );
+  rtems_condition_variable_init( &ctx->job_available, "Decompress Job" );
+  rtems_condition_variable_init( &ctx->job_done, "Decompress Done" );
+  rtems_counting_semaphore_init( &ctx->workers_done, "Decompress Workers", 0 );
+  ctx->begin = begin;
+  ctx->size = size;
+  ctx->worker_count = config->worker_count;
+  ctx->window = config->window;
+
+  if ( ctx->window == 0 ) {
+    ctx->window = 2 * (size_t) ctx->worker_count + 1;
+  }
+
+  xz_crc32_init();
+
+  if ( Decompress_Is_xz( ctx->begin, size ) ) {
+    ctx->format = DECOMPRESS_FORMAT_XZ;
+    sc = Decompress_Scan_xz( ctx );
+  } else if ( Decompress_Is_gzip( ctx->begin, size ) ) {
+    ctx->format = DECOMPRESS_FORMAT_GZIP;
+    sc = Decompress_Scan_gzip( ctx );
+  } else if ( Decompress_Is_zlib( ctx->begin, size ) ) {
+    ctx->format = DECOMPRESS_FORMAT_ZLIB;
+    sc = Decompress_Scan_zlib( ctx );
+  } else {
+    sc = RTEMS_NOT_IMPLEMENTED;
+  }
+
+  if ( sc == RTEMS_SUCCESSFUL ) {
+    sc = Decompress_Start_workers( ctx, config->worker_priority );
+  }
+
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    Decompress_Free( ctx );
+    return sc;
+  }
+
+  *context = ctx;
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_decompress_destroy( rtems_decompress_context *ctx )
+{
+  Decompress_Stop_workers( ctx, ctx->worker_count );
+  Decompress_Free( ctx );
+}
@@ -47,12 +47,53 @@ typedef struct
   int         offset;       /**< The offset of the item in the FDT blob. */
 } rtems_fdt_index_entry;
 
+/**
+ * A node with a phandle.
+ */
+typedef struct
+{
+  uint32_t phandle;         /**< The phandle of the node. */
+  int      offset;          /**< The offset of the node in the FDT blob. */
+} rtems_fdt_index_phandle;
+
+/**
+ * The nodes with a compatible string.
+ */
+typedef struct
+{
+  const char* compatible;   /**< The compatible string in the FDT blob. */
+  int         first;        /**< The first of the ordered node offsets. */
+  int         count;        /**< The number of nodes. */
+} rtems_fdt_index_compatible;
+
+/**
+ * An open addressing hash table of item numbers. A slot contains the item
+ * number plus one, zero marks a free slot.
+ */
+typedef struct
+{
+  size_t mask;              /**< The number of slots minus one. */
+  int*   slots;             /**< The slots of the table. */
+} rtems_fdt_index_hash;
+
 typedef struct
 {
   int                    num_entries;    /**< The number of entries in this index. */
   rtems_fdt_index_entry* entries;        /**< An ordered set of entries which we
                                           *  can binary search. */
   char*                  names;          /**< Storage allocated for all the path names. */
+  rtems_fdt_index_hash   by_name;        /**< The entries hashed by the path name. */
+  rtems_fdt_index_hash   by_offset;      /**< The entries hashed by the offset. */
+  int                    num_phandles;   /**< The number of nodes with a phandle. */
+  rtems_fdt_index_phandle* phandles;     /**< The nodes with a phandle. */
+  rtems_fdt_index_hash   by_phandle;     /**< The phandles hashed by value. */
+  int                    num_compatibles; /**< The number of compatible strings. */
+  rtems_fdt_index_compatible* compatibles; /**< The compatible strings. */
+  int*                   compatible_offsets; /**< The node offsets of each
+                                              *  compatible string in
+                                              *  ascending order. */
+  rtems_fdt_index_hash   by_compatible;  /**< The compatible strings hashed by
+                                          *  the string. */
 } rtems_fdt_index;
 
 
@@ -123,12 +164,265 @@ static int rtems_fdt_index_compare(const void* a, const void* b)
   return rtems_fdt_node_path_compare(e1->name, e2->name, 0);
 }
 
+/**
+ * Hash a string of a length, this is the FNV-1a hash.
+ */
+static uint32_t
+rtems_fdt_hash_string (const char* s, size_t len)
+{
+  uint32_t h = 2166136261U;
+  while (len-- > 0)
+  {
+    h ^= (uint8_t) *s++;
+    h *= 16777619U;
+  }
+  return h;
+}
+
+/**
+ * Hash an integer, this is a finalizer with a good avalanche.
+ */
+static uint32_t
+rtems_fdt_hash_int (uint32_t v)
+{
+  v ^= v >> 16;
+  v *= 0x7feb352dU;
+  v ^= v >> 15;
+  v *= 0x846ca68bU;
+  v ^= v >> 16;
+  return v;
+}
+
+/**
+ * Allocate a hash table with at most a half of the slots in use.
+ */
+static bool
+rtems_fdt_hash_init (rtems_fdt_index_hash* hash, int items)
+{
+  size_t size = 1;
+  while (size < 2 * (size_t) items)
+    size <<= 1;
+  hash->slots = rtems_calloc(size, sizeof(int));
+  if (!hash->slots)
+  {
+    hash->mask = 0;
+    return false;
+  }
+  hash->mask = size - 1;
+  return true;
+}
+
+static void
+rtems_fdt_hash_release (rtems_fdt_index_hash* hash)
+{
+  free(hash->slots);
+  hash->slots = NULL;
+  hash->mask = 0;
+}
+
+static void
+rtems_fdt_hash_insert (rtems_fdt_index_hash* hash, uint32_t h, int item)
+{
+  size_t slot = h & hash->mask;
+  while (hash->slots[slot] != 0)
+    slot = (slot + 1) & hash->mask;
+  hash->slots[slot] = item + 1;
+}
+
+/**
+ * Compare compatible strings and order the nodes of a string by offset.
+ */
+static int rtems_fdt_index_compatible_compare(const void* a, const void* b)
+{
+  const rtems_fdt_index_compatible* c1 = (const rtems_fdt_index_compatible*) a;
+  const rtems_fdt_index_compatible* c2 = (const rtems_fdt_index_compatible*) b;
+  int cmp = strcmp(c1->compatible, c2->compatible);
+  if (cmp == 0)
+    cmp = c1->first - c2->first;
+  return cmp;
+}
+
+/**
+ * Release the contents of the index, freeing memory.
+ */
+static void
+rtems_fdt_release_index (rtems_fdt_index* index)
+{
+  free(index->entries);
+  free(index->names);
+  free(index->phandles);
+  free(index->compatibles);
+  free(index->compatible_offsets);
+  rtems_fdt_hash_release(&index->by_name);
+  rtems_fdt_hash_release(&index->by_offset);
+  rtems_fdt_hash_release(&index->by_phandle);
+  rtems_fdt_hash_release(&index->by_compatible);
+  memset(index, 0, sizeof(*index));
+}
+
+/**
+ * Index the phandles and the compatible strings of all nodes including the
+ * root node. The first pass counts and the second pass records.
+ */
+static int
+rtems_fdt_init_node_index (rtems_fdt_index* index, const void* blob)
+{
+  rtems_fdt_index_compatible* records = NULL;
+  int                         num_records = 0;
+  int                         num_offsets = 0;
+  int                         root_offset;
+  int                         pass;
+  int                         r;
+  int                         c;
+
+  root_offset = fdt_path_offset(blob, "/");
+  if (root_offset < 0)
+  {
+    return root_offset;
+  }
+
+  for (pass = 0; pass < 2; ++pass)
+  {
+    int offset = root_offset;
+    int depth = 0;
+
+    index->num_phandles = 0;
+    num_records = 0;
+
+    while (depth >= 0)
+    {
+      uint32_t    phandle = fdt_get_phandle(blob, offset);
+      const char* compatible;
+      int         len = 0;
+
+      if (phandle != 0 && phandle != (uint32_t) -1)
+      {
+        if (pass != 0)
+        {
+          index->phandles[index->num_phandles].phandle = phandle;
+          index->phandles[index->num_phandles].offset = offset;
+        }
+        index->num_phandles++;
+      }
+
+      /*
+       * The compatible property is a list of NUL terminated strings.
+       */
+      compatible = fdt_getprop(blob, offset, "compatible", &len);
+      if (compatible)
+      {
+        const char* end = compatible + len;
+        while (compatible < end)
+        {
+          size_t n = strnlen(compatible, end - compatible);
+          if (n == (size_t) (end - compatible))
+            break;
+          if (pass != 0)
+          {
+            records[num_records].compatible = compatible;
+            records[num_records].first = offset;
+            records[num_records].count = 1;
+          }
+          num_records++;
+          compatible += n + 1;
+        }
+      }
+
+      offset = fdt_next_node(blob, offset, &depth);
+      if (offset < 0)
+      {
+        free(records);
+        return offset;
+      }
+    }
+
+    if (pass == 0)
+    {
+      index->phandles =
+        rtems_calloc(index->num_phandles + 1, sizeof(rtems_fdt_index_phandle));
+      records =
+        rtems_calloc(num_records + 1, sizeof(rtems_fdt_index_compatible));
+      index->compatible_offsets = rtems_calloc(num_records + 1, sizeof(int));
+      if (!index->phandles || !records || !index->compatible_offsets)
+      {
+        free(records);
+        return -RTEMS_FDT_ERR_NO_MEMORY;
+      }
+    }
+  }
+
+  if (!rtems_fdt_hash_init(&index->by_phandle, index->num_phandles))
+  {
+    free(records);
+    return -RTEMS_FDT_ERR_NO_MEMORY;
+  }
+
+  for (r = 0; r < index->num_phandles; ++r)
+  {
+    rtems_fdt_hash_insert(&index->by_phandle,
+                          rtems_fdt_hash_int(index->phandles[r].phandle),
+                          r);
+  }
+
+  /*
+   * Group the nodes by compatible string. Until the records are grouped the
+   * first member of a record holds the offset of its node.
+   */
+  if (num_records != 0)
+  {
+    qsort(records,
+          num_records,
+          sizeof(rtems_fdt_index_compatible),
+          rtems_fdt_index_compatible_compare);
+  }
+
+  c = -1;
+  for (r = 0; r < num_records; ++r)
+  {
+    const char* compatible = records[r].compatible;
+    int         offset = records[r].first;
+    if (c < 0 || strcmp(records[c].compatible, compatible) != 0)
+    {
+      ++c;
+      records[c].compatible = compatible;
+      records[c].first = num_offsets;
+      records[c].count = 0;
+    }
+    else if (index->compatible_offsets[num_offsets - 1] == offset)
+    {
+      /* The node lists the string more than once. */
+      continue;
+    }
+    index->compatible_offsets[num_offsets++] = offset;
+    records[c].count++;
+  }
+
+  index->compatibles = records;
+  index->num_compatibles = c + 1;
+
+  if (!rtems_fdt_hash_init(&index->by_compatible, index->num_compatibles))
+  {
+    return -RTEMS_FDT_ERR_NO_MEMORY;
+  }
+
+  for (c = 0; c < index->num_compatibles; ++c)
+  {
+    const char* compatible = index->compatibles[c].compatible;
+    rtems_fdt_hash_insert(&index->by_compatible,
+                          rtems_fdt_hash_string(compatible, strlen(compatible)),
+                          c);
+  }
+
+  return 0;
+}
+
 /**
  * Create an index based on the contents of an FDT blob.
  */
 static int
 rtems_fdt_init_index (rtems_fdt_handle* fdt, rtems_fdt_blob* blob)
 {
+  rtems_fdt_index*       index = &blob->index;
   rtems_fdt_index_entry* entries = NULL;
   int                    num_entries = 0;
   int                    entry = 0;
@@ -141,6 +435,9 @@ rtems_fdt_init_index (rtems_fdt_handle* fdt, rtems_fdt_blob* blob)
   int                    depth = 0;
   char*                  names = NULL;
   char*                  names_pos = NULL;
+  int                    fe;
+
+  memset(index, 0, sizeof(*index));
 
   /*
    * Count the number of entries in the blob first.
@@ -264,28 +561,39 @@ rtems_fdt_init_index (rtems_fdt_handle* fdt, rtems_fdt_blob* blob)
           rtems_fdt_index_compare);
   }
 
-  fdt->blob->index.entries = entries;
-  fdt->blob->index.num_entries = num_entries;
-  fdt->blob->index.names = names;
+  index->entries = entries;
+  index->num_entries = num_entries;
+  index->names = names;
 
-  return 0;
-}
+  /*
+   * Hash the entries by path name and offset.
+   */
+  if (!rtems_fdt_hash_init(&index->by_name, num_entries) ||
+      !rtems_fdt_hash_init(&index->by_offset, num_entries))
+  {
+    rtems_fdt_release_index(index);
+    return -RTEMS_FDT_ERR_NO_MEMORY;
+  }
 
-/**
- * Release the contents of the index, freeing memory.
- */
-static void
-rtems_fdt_release_index (rtems_fdt_index* index)
-{
-  if (index->entries)
+  for (entry = 0; entry < num_entries; ++entry)
   {
-    free(index->entries);
-    free(index->names);
+    rtems_fdt_hash_insert(&index->by_name,
+                          rtems_fdt_hash_string(entries[entry].name,
+                                                strlen(entries[entry].name)),
+                          entry);
+    rtems_fdt_hash_insert(&index->by_offset,
+                          rtems_fdt_hash_int(entries[entry].offset),
+                          entry);
+  }
 
-    index->num_entries = 0;
-    index->entries = NULL;
-    index->names = NULL;
+  fe = rtems_fdt_init_node_index(index, blob->blob);
+  if (fe < 0)
+  {
+    rtems_fdt_release_index(index);
+    return fe;
   }
+
+  return 0;
 }
 
 /**
@@ -296,8 +604,8 @@ static int
 rtems_fdt_index_find_by_name(rtems_fdt_index* index,
                              const char*      name)
 {
-  int         min = 0;
-  int         max = index->num_entries;
+  size_t slot;
+  int    item;
   /*
    * Handle trailing slash case.
    */
@@ -307,39 +615,23 @@ rtems_fdt_index_find_by_name(rtems_fdt_index* index,
     namelen--;
   }
 
-  /* Binary search for the name. */
-  while (min < max)
+  if (index->by_name.slots == NULL)
   {
-    int middle = (min + max) / 2;
-    int cmp = rtems_fdt_node_path_compare(name,
-                                          index->entries[middle].name,
-                                          namelen);
-    if (cmp == 0)
-    {
-      /* 'namelen' characters are equal but 'index->entries[middle].name' */
-      /* could have additional characters. */
-      if (index->entries[middle].name[namelen] == '\0')
-      {
-        /* Found it. */
-        return index->entries[middle].offset;
-      }
-      else
-      {
-         /* 'index->entries[middle].name' is longer than 'name'. */
-         cmp = -1;
-      }
-    }
-    if (cmp < 0)
-    {
-      /* Look lower than here. */
-      max = middle;
-    }
-    else
+    return -FDT_ERR_NOTFOUND;
+  }
+
+  /* Probe the hash table for the name. */
+  slot = rtems_fdt_hash_string(name, namelen) & index->by_name.mask;
+  while ((item = index->by_name.slots[slot]) != 0)
+  {
+    const char* entry_name = index->entries[item - 1].name;
+    if (strncmp(entry_name, name, namelen) == 0 && entry_name[namelen] == '\0')
     {
-      /* Look higher than here. */
-      min = middle + 1;
+      /* Found it. */
+      return index->entries[item - 1].offset;
     }
- }
+    slot = (slot + 1) & index->by_name.mask;
+  }
 
   /* Didn't find it. */
   return -FDT_ERR_NOTFOUND;
@@ -352,34 +644,135 @@ static const char *
 rtems_fdt_index_find_name_by_offset(rtems_fdt_index* index,
                                     int              offset)
 {
-  int min = 0;
-  int max = index->num_entries;
+  size_t slot;
+  int    item;
+
+  if (index->by_offset.slots == NULL)
+  {
+    return NULL;
+  }
 
   /*
-   * Binary search for the offset.
+   * Probe the hash table for the offset.
    */
-  while (min < max)
+  slot = rtems_fdt_hash_int(offset) & index->by_offset.mask;
+  while ((item = index->by_offset.slots[slot]) != 0)
   {
-    int middle = (min + max) / 2;
-    if (offset < index->entries[middle].offset)
+    if (index->entries[item - 1].offset == offset)
     {
-      /* Look lower than here. */
-      max = middle;
+      /* Found it. */
+      return index->entries[item - 1].name;
+    }
+    slot = (slot + 1) & index->by_offset.mask;
+  }
+
+  /* Didn't find it. */
+  return NULL;
+}
+
+/**
+ * For a given phandle, find the corresponding node offset.
+ */
+static int
+rtems_fdt_index_find_by_phandle(rtems_fdt_index* index,
+                                uint32_t         phandle)
+{
+  size_t slot;
+  int    item;
+
+  if (phandle == 0 || phandle == (uint32_t) -1)
+  {
+    return -FDT_ERR_BADPHANDLE;
+  }
+
+  if (index->by_phandle.slots == NULL)
+  {
+    return -FDT_ERR_NOTFOUND;
+  }
+
+  slot = rtems_fdt_hash_int(phandle) & index->by_phandle.mask;
+  while ((item = index->by_phandle.slots[slot]) != 0)
+  {
+    if (index->phandles[item - 1].phandle == phandle)
+    {
+      return index->phandles[item - 1].offset;
     }
-    else if (offset > index->entries[middle].offset)
+    slot = (slot + 1) & index->by_phandle.mask;
+  }
+
+  return -FDT_ERR_NOTFOUND;
+}
+
+/**
+ * For a given compatible string, find the first node after the start offset.
+ */
+static int
+rtems_fdt_index_find_by_compatible(rtems_fdt_index* index,
+                                   int              startoffset,
+                                   const char*      compatible)
+{
+  const rtems_fdt_index_compatible* group = NULL;
+  size_t                            slot;
+  int                               item;
+  int                               min;
+  int                               max;
+
+  if (index->by_compatible.slots == NULL)
+  {
+    return -FDT_ERR_NOTFOUND;
+  }
+
+  /*
+   * The start offset has to be a node offset as with libfdt, the root node
+   * is at offset 0.
+   */
+  if (startoffset > 0 &&
+      rtems_fdt_index_find_name_by_offset(index, startoffset) == NULL)
+  {
+    return -FDT_ERR_BADOFFSET;
+  }
+
+  slot = rtems_fdt_hash_string(compatible, strlen(compatible)) &
+    index->by_compatible.mask;
+  while ((item = index->by_compatible.slots[slot]) != 0)
+  {
+    if (strcmp(index->compatibles[item - 1].compatible, compatible) == 0)
+    {
+      group = &index->compatibles[item - 1];
+      break;
+    }
+    slot = (slot + 1) & index->by_compatible.mask;
+  }
+
+  if (group == NULL)
+  {
+    return -FDT_ERR_NOTFOUND;
+  }
+
+  /*
+   * Binary search for the first node offset after the start offset.
+   */
+  min = group->first;
+  max = group->first + group->count;
+  while (min < max)
+  {
+    int middle = (min + max) / 2;
+    if (index->compatible_offsets[middle] <= startoffset)
     {
-      /* Look higher than here. */
       min = middle + 1;
     }
     else
     {
-      /* Found it. */
-      return index->entries[middle].name;
+      max = middle;
     }
   }
 
-  /* Didn't find it. */
-  return NULL;
+  if (min == group->first + group->count)
+  {
+    return -FDT_ERR_NOTFOUND;
+  }
+
+  return index->compatible_offsets[min];
 }
 
 void
@@ -954,7 +1347,7 @@ rtems_fdt_node_offset_by_phandle (rtems_fdt_handle* handle, uint32_t phandle)
 {
   if (!handle->blob)
     return -RTEMS_FDT_ERR_INVALID_HANDLE;
-  return fdt_node_offset_by_phandle (handle->blob->blob, phandle);
+  return rtems_fdt_index_find_by_phandle (&handle->blob->index, phandle);
 }
 
 int
@@ -974,9 +1367,9 @@ rtems_fdt_node_offset_by_compatible (rtems_fdt_handle* handle,
 {
   if (!handle->blob)
     return -RTEMS_FDT_ERR_INVALID_HANDLE;
-  return fdt_node_offset_by_compatible (handle->blob->blob,
-                                        startoffset,
-                                        compatible);
+  return rtems_fdt_index_find_by_compatible (&handle->blob->index,
+                                             startoffset,
+                                             compatible);
 }
 
 int
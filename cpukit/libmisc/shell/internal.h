@@ -50,6 +50,10 @@ extern void rtems_shell_print_heap_stats(
   const Heap_Statistics *s
 );
 
+extern void rtems_shell_print_heap_cache_info(
+  const Heap_Cache_information *c
+);
+
 extern void rtems_shell_print_unified_work_area_message(void);
 
 #include <sys/types.h>
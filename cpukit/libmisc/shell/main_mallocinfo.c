@@ -60,6 +60,10 @@ static int rtems_shell_main_malloc_info(
     rtems_shell_print_heap_info( "free", &info.Free );
     rtems_shell_print_heap_info( "used", &info.Used );
     rtems_shell_print_heap_stats( &info.Stats );
+
+    if ( _Malloc_Cache_handler != NULL ) {
+      rtems_shell_print_heap_cache_info( &info.Cache );
+    }
   }
 
   return 0;
@@ -84,3 +84,23 @@ void rtems_shell_print_heap_stats(
     s->resizes
   );
 }
+
+void rtems_shell_print_heap_cache_info(
+  const Heap_Cache_information *c
+)
+{
+  printf(
+    "Number of cached blocks:                  %12" PRIuPTR "\n"
+    "Total bytes cached:                       %12" PRIuPTR "\n"
+    "Total number of cached allocations:       %12" PRIu64 "\n"
+    "Total number of cached frees:             %12" PRIu64 "\n"
+    "Total number of cache refills:            %12" PRIu64 "\n"
+    "Total number of cache drains:             %12" PRIu64 "\n",
+    c->blocks,
+    c->total,
+    c->allocs,
+    c->frees,
+    c->refills,
+    c->drains
+  );
+}
@@ -127,9 +127,6 @@ static inline bool Stack_check_Frame_pointer_in_range(
     ((char *)(_the_stack)->area + \
          (_the_stack)->size - SANITY_PATTERN_SIZE_BYTES )
 
-  #define Stack_check_Calculate_used( _low, _size, _high_water ) \
-      ((char *)(_high_water) - (char *)(_low))
-
   #define Stack_check_Usable_stack_start(_the_stack) \
     ((_the_stack)->area)
 
@@ -137,9 +134,6 @@ static inline bool Stack_check_Frame_pointer_in_range(
   #define Stack_check_Get_pattern( _the_stack ) \
     ((char *)(_the_stack)->area)
 
-  #define Stack_check_Calculate_used( _low, _size, _high_water) \
-      ( ((char *)(_low) + (_size)) - (char *)(_high_water) )
-
   #define Stack_check_Usable_stack_start(_the_stack) \
       ((char *)(_the_stack)->area + SANITY_PATTERN_SIZE_BYTES)
 
@@ -152,10 +146,27 @@ static inline bool Stack_check_Frame_pointer_in_range(
 #define Stack_check_Usable_stack_size(_the_stack) \
     ((_the_stack)->size - SANITY_PATTERN_SIZE_BYTES)
 
+/*
+ *  The high water mark tracker counts the stack words from the stack base,
+ *  this is the end of the usable stack area the stack starts to grow from.
+ */
+#if (CPU_STACK_GROWS_UP == TRUE)
+  #define Stack_check_Word_at( _begin, _words, _position ) \
+    ( ( (const uint32_t *) (_begin) )[ _position ] )
+#else
+  #define Stack_check_Word_at( _begin, _words, _position ) \
+    ( ( (const uint32_t *) (_begin) )[ (_words) - 1 - (_position) ] )
+#endif
+
 #if defined(RTEMS_SMP)
 static Stack_Control Stack_check_Interrupt_stack[ CPU_MAXIMUM_PROCESSORS ];
+
+static Thread_Stack_check_control
+  Stack_check_Interrupt_mark[ CPU_MAXIMUM_PROCESSORS ];
 #else
 static Stack_Control Stack_check_Interrupt_stack[ 1 ];
+
+static Thread_Stack_check_control Stack_check_Interrupt_mark[ 1 ];
 #endif
 
 /*
@@ -189,6 +200,97 @@ static bool Stack_check_Is_sanity_pattern_valid( const Stack_Control *stack )
   ) == 0;
 }
 
+static void Stack_check_Reset_mark( Thread_Stack_check_control *mark )
+{
+  mark->high_water = 0;
+  mark->cursor = 0;
+}
+
+/*
+ *  Raise the high water mark to cover the stack word at the stack pointer.
+ *  Stack pointers outside of the usable stack area are ignored.
+ */
+static void Stack_check_Sample_stack_pointer(
+  Thread_Stack_check_control *mark,
+  const void                 *begin,
+  uintptr_t                   size,
+  const void                 *sp
+)
+{
+  uintptr_t offset;
+  uintptr_t position;
+
+  offset = (uintptr_t) sp - (uintptr_t) begin;
+
+  if ( offset >= size ) {
+    return;
+  }
+
+  #if ( CPU_STACK_GROWS_UP == TRUE )
+    position = offset / 4 + 1;
+  #else
+    position = ( size - offset + 3 ) / 4;
+  #endif
+
+  if ( position > size / 4 ) {
+    position = size / 4;
+  }
+
+  if ( position > mark->high_water ) {
+    mark->high_water = position;
+  }
+}
+
+/*
+ *  Continue the scan for the high water mark at the position of the last
+ *  invocation and examine at most budget stack words.  The scan goes from the
+ *  deepest stack word towards the stack base and a pass ends at the high water
+ *  mark or at the first stack word which does not contain the fill pattern.
+ *  The next invocation starts a new pass, so the high water mark follows the
+ *  stack usage of the thread with a lag of at most one pass.
+ *
+ *  The tracker state may be updated concurrently by the context switch
+ *  extension of the thread.  Lost updates are harmless, since the state only
+ *  provides an estimate which is always within the usable stack area.
+ */
+static uintptr_t Stack_check_Scan_stack(
+  Thread_Stack_check_control *mark,
+  const void                 *begin,
+  uintptr_t                   size,
+  uintptr_t                   budget
+)
+{
+  uintptr_t words;
+  uintptr_t high_water;
+  uintptr_t cursor;
+
+  words = size / 4;
+  high_water = mark->high_water;
+  cursor = mark->cursor;
+
+  if ( cursor <= high_water || cursor > words ) {
+    cursor = words;
+  }
+
+  while ( budget > 0 && cursor > high_water ) {
+    --cursor;
+    --budget;
+
+    if ( Stack_check_Word_at( begin, words, cursor ) != U32_PATTERN ) {
+      high_water = cursor + 1;
+      break;
+    }
+  }
+
+  mark->cursor = cursor;
+
+  if ( high_water > mark->high_water ) {
+    mark->high_water = high_water;
+  }
+
+  return high_water;
+}
+
 /*
  *  rtems_stack_checker_create_extension
  */
@@ -201,6 +303,7 @@ bool rtems_stack_checker_create_extension(
 
   Stack_check_Dope_stack( &the_thread->Start.Initial_stack );
   Stack_check_Add_sanity_pattern( &the_thread->Start.Initial_stack );
+  Stack_check_Reset_mark( &the_thread->Stack_check );
 
   return true;
 }
@@ -245,6 +348,7 @@ void rtems_stack_checker_begin_extension( Thread_Control *executing )
     }
 
     Stack_check_Dope_stack( stack );
+    Stack_check_Reset_mark( &Stack_check_Interrupt_mark[ cpu_self_index ] );
   }
 
 #if defined(RTEMS_SMP)
@@ -368,6 +472,26 @@ void rtems_stack_checker_switch_extension(
       rtems_build_name( 'I', 'N', 'T', 'R' )
     );
   }
+
+  /*
+   *  The running thread executes this extension on its own stack, so the
+   *  frame address is a position which is known to be used.
+   */
+  if ( Stack_checker_Switch_sampling ) {
+    stack = &running->Start.Initial_stack;
+    Stack_check_Sample_stack_pointer(
+      &running->Stack_check,
+      Stack_check_Usable_stack_start( stack ),
+      Stack_check_Usable_stack_size( stack ),
+      __builtin_frame_address( 0 )
+    );
+    (void) Stack_check_Scan_stack(
+      &running->Stack_check,
+      Stack_check_Usable_stack_start( stack ),
+      Stack_check_Usable_stack_size( stack ),
+      Stack_checker_Scan_words
+    );
+  }
 }
 
 /*
@@ -388,44 +512,24 @@ bool rtems_stack_checker_is_blown( void )
 
 /*
  * Stack_check_find_high_water_mark
+ *
+ * Start a new scan pass and complete it.  Only the stack words below the
+ * high water mark are examined.
  */
-static inline void *Stack_check_Find_high_water_mark(
-  const void *s,
-  size_t      n
+static uintptr_t Stack_check_Find_high_water_mark(
+  Thread_Stack_check_control *mark,
+  const void                 *begin,
+  uintptr_t                   size
 )
 {
-  const uint32_t   *base, *ebase;
-  uint32_t   length;
-
-  base = s;
-  length = n/4;
+  mark->cursor = 0;
 
-  #if ( CPU_STACK_GROWS_UP == TRUE )
-    /*
-     * start at higher memory and find first word that does not
-     * match pattern
-     */
-
-    base += length - 1;
-    for (ebase = s; base > ebase; base--)
-      if (*base != U32_PATTERN)
-        return (void *) base;
-  #else
-    /*
-     * start at lower memory and find first word that does not
-     * match pattern
-     */
-
-    for (ebase = base + length; base < ebase; base++)
-      if (*base != U32_PATTERN)
-        return (void *) base;
-  #endif
-
-  return NULL;
+  return Stack_check_Scan_stack( mark, begin, size, UINTPTR_MAX );
 }
 
 static void Stack_check_Visit_stack(
   const Stack_Control        *stack,
+  Thread_Stack_check_control *mark,
   const void                 *current,
   const char                 *name,
   rtems_id                    id,
@@ -447,17 +551,8 @@ static void Stack_check_Visit_stack(
   info.size = Stack_check_Usable_stack_size( stack );
 
   if ( Stack_check_Initialized ) {
-    void *high_water_mark;
-
-    high_water_mark =
-      Stack_check_Find_high_water_mark( info.begin, info.size );
-
-    if ( high_water_mark != NULL ) {
-      info.used =
-        Stack_check_Calculate_used( info.begin, info.size, high_water_mark );
-    } else {
-      info.used = 0;
-    }
+    info.used =
+      Stack_check_Find_high_water_mark( mark, info.begin, info.size ) * 4;
   } else {
     info.used = UINTPTR_MAX;
   }
@@ -483,6 +578,7 @@ static bool Stack_check_Visit_thread(
   _Thread_Get_name( the_thread, name, sizeof( name ) );
   Stack_check_Visit_stack(
     &the_thread->Start.Initial_stack,
+    &the_thread->Stack_check,
     (void *) sp,
     name,
     the_thread->Object.id,
@@ -494,6 +590,7 @@ static bool Stack_check_Visit_thread(
 
 static void Stack_check_Visit_interrupt_stack(
   const Stack_Control        *stack,
+  Thread_Stack_check_control *mark,
   uint32_t                    id,
   rtems_stack_checker_visitor visit,
   void                       *arg
@@ -501,6 +598,7 @@ static void Stack_check_Visit_interrupt_stack(
 {
   Stack_check_Visit_stack(
     stack,
+    mark,
     NULL,
     "Interrupt Stack",
     id,
@@ -574,6 +672,7 @@ void rtems_stack_checker_iterate( rtems_stack_checker_visitor visit, void *arg )
   for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
     Stack_check_Visit_interrupt_stack(
       &Stack_check_Interrupt_stack[ cpu_index ],
+      &Stack_check_Interrupt_mark[ cpu_index ],
       cpu_index,
       visit,
       arg
@@ -581,6 +680,62 @@ void rtems_stack_checker_iterate( rtems_stack_checker_visitor visit, void *arg )
   }
 }
 
+rtems_status_code rtems_stack_checker_get_usage(
+  rtems_id                  id,
+  rtems_stack_checker_info *info
+)
+{
+  Thread_Control      *the_thread;
+  ISR_lock_Context     lock_context;
+  const Stack_Control *stack;
+  uintptr_t            sp;
+
+  if ( info == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  /* The allocator lock prevents the deletion of the thread and its stack */
+  _Objects_Allocator_lock();
+
+  the_thread = _Thread_Get( id, &lock_context );
+
+  if ( the_thread == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INVALID_ID;
+  }
+
+  _ISR_lock_ISR_enable( &lock_context );
+
+  stack = &the_thread->Start.Initial_stack;
+  sp = _CPU_Context_Get_SP( &the_thread->Registers );
+
+  info->id = the_thread->Object.id;
+  info->name = NULL;
+  info->current = (void *) sp;
+  info->begin = Stack_check_Usable_stack_start( stack );
+  info->size = Stack_check_Usable_stack_size( stack );
+
+  if ( Stack_check_Initialized ) {
+    Stack_check_Sample_stack_pointer(
+      &the_thread->Stack_check,
+      info->begin,
+      info->size,
+      info->current
+    );
+    info->used = Stack_check_Scan_stack(
+      &the_thread->Stack_check,
+      info->begin,
+      info->size,
+      Stack_checker_Scan_words
+    ) * 4;
+  } else {
+    info->used = UINTPTR_MAX;
+  }
+
+  _Objects_Allocator_unlock();
+  return RTEMS_SUCCESSFUL;
+}
+
 static void Stack_check_Prepare_interrupt_stacks( void )
 {
   Stack_Control stack;
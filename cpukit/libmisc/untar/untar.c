@@ -51,6 +51,8 @@
 #include <rtems/untar.h>
 #include <rtems/bspIo.h>
 
+#include "untar_pipeline.h"
+
 /*
  * TAR file format:
 
@@ -501,6 +503,7 @@ void Untar_ChunkContext_Init(Untar_ChunkContext *context)
   context->state = UNTAR_CHUNK_HEADER;
   context->done_bytes = 0;
   context->out_fd = -1;
+  context->pipeline = NULL;
 }
 
 int Untar_FromChunk_Print(
@@ -523,6 +526,10 @@ int Untar_FromChunk_Print(
 
   context->base.printer = printer;
 
+  if (context->pipeline != NULL) {
+    _Untar_Pipeline_Add_input(context->pipeline, chunk_size);
+  }
+
   while (todo > 0) {
     switch (context->state) {
       case UNTAR_CHUNK_HEADER:
@@ -547,6 +554,10 @@ int Untar_FromChunk_Print(
                                     context->base.mode);
 
             if (context->out_fd >= 0) {
+              if (context->pipeline != NULL) {
+                _Untar_Pipeline_Open_file(context->pipeline, context->out_fd);
+              }
+
               context->state = UNTAR_CHUNK_WRITE;
               context->done_bytes = 0;
             } else {
@@ -574,12 +585,38 @@ int Untar_FromChunk_Print(
       case UNTAR_CHUNK_WRITE:
         remaining = context->base.file_size - context->done_bytes;
         consume = MIN(remaining, todo);
-        write(context->out_fd, &buf[done], consume);
+        if (context->pipeline != NULL) {
+          retval = _Untar_Pipeline_Write(
+            context->pipeline,
+            &buf[done],
+            consume
+          );
+
+          if (retval != UNTAR_SUCCESSFUL) {
+            context->state = UNTAR_CHUNK_ERROR;
+            return retval;
+          }
+        } else {
+          write(context->out_fd, &buf[done], consume);
+        }
+
         context->done_bytes += consume;
 
         if (context->done_bytes == context->base.file_size) {
-          close(context->out_fd);
+          if (context->pipeline != NULL) {
+            retval = _Untar_Pipeline_Close_file(context->pipeline);
+          } else {
+            close(context->out_fd);
+            retval = UNTAR_SUCCESSFUL;
+          }
+
           context->out_fd = -1;
+
+          if (retval != UNTAR_SUCCESSFUL) {
+            context->state = UNTAR_CHUNK_ERROR;
+            return retval;
+          }
+
           context->state = UNTAR_CHUNK_SKIP;
           context->base.file_size = 512 * context->base.nblocks
             - context->base.file_size;
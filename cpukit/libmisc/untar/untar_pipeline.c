@@ -0,0 +1,699 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup libmisc_untar_img
+ *
+ * @brief This source file contains the implementation of the untar pipeline.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/param.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/thread.h>
+#include <rtems/untar.h>
+
+#include "untar_pipeline.h"
+
+#define UNTAR_PIPELINE_BLOCK_SIZE 512
+
+#define UNTAR_PIPELINE_WORKER_STACK_SIZE (2 * RTEMS_MINIMUM_STACK_SIZE)
+
+/*
+ * A job writes the data of one buffer to a file.  The last job of a file
+ * closes the file.  A job with a negative file descriptor stops the worker.
+ */
+typedef struct {
+  int fd;
+  bool close;
+  void *buffer;
+  size_t size;
+} Untar_PipelineJob;
+
+typedef struct {
+  Untar_Pipeline *pipeline;
+  rtems_id id;
+  rtems_condition_variable job_available;
+  Untar_PipelineJob *jobs;
+  size_t job_head;
+  size_t job_count;
+  uint64_t write_bytes;
+  rtems_counter_ticks write_ticks;
+} Untar_PipelineWorker;
+
+struct Untar_Pipeline {
+  /*
+   * The mutex protects the free buffers, the job queues of the workers, and
+   * the error status.
+   */
+  rtems_mutex mutex;
+  rtems_condition_variable buffer_available;
+  rtems_counting_semaphore workers_done;
+  size_t buffer_size;
+  size_t buffer_count;
+  uint32_t worker_count;
+  uint32_t next_worker;
+  int error;
+  void *buffer_area;
+  void **free_buffers;
+  size_t free_count;
+  Untar_PipelineWorker *workers;
+
+  /*
+   * The following members are only used by the task feeding the pipeline.
+   */
+  int fd;
+  Untar_PipelineWorker *worker;
+  char *buffer;
+  size_t buffer_used;
+  size_t files;
+  uint64_t input_bytes;
+  uint64_t write_bytes;
+  rtems_counter_ticks write_ticks;
+  rtems_counter_ticks stall_ticks;
+  rtems_counter_ticks begin;
+};
+
+static void *Untar_Pipeline_Get_buffer(Untar_Pipeline *pipeline)
+{
+  void *buffer;
+
+  rtems_mutex_lock(&pipeline->mutex);
+
+  if (pipeline->free_count == 0) {
+    rtems_counter_ticks begin;
+
+    begin = rtems_counter_read();
+
+    do {
+      rtems_condition_variable_wait(
+        &pipeline->buffer_available,
+        &pipeline->mutex
+      );
+    } while (pipeline->free_count == 0);
+
+    pipeline->stall_ticks +=
+      rtems_counter_difference(rtems_counter_read(), begin);
+  }
+
+  --pipeline->free_count;
+  buffer = pipeline->free_buffers[pipeline->free_count];
+  rtems_mutex_unlock(&pipeline->mutex);
+
+  return buffer;
+}
+
+static int Untar_Pipeline_Get_error(Untar_Pipeline *pipeline)
+{
+  int error;
+
+  rtems_mutex_lock(&pipeline->mutex);
+  error = pipeline->error;
+  rtems_mutex_unlock(&pipeline->mutex);
+
+  return error;
+}
+
+static void Untar_Pipeline_Do_job(
+  Untar_Pipeline          *pipeline,
+  const Untar_PipelineJob *job,
+  uint64_t                *write_bytes,
+  rtems_counter_ticks     *write_ticks
+)
+{
+  rtems_counter_ticks begin;
+  bool ok;
+
+  begin = rtems_counter_read();
+  ok = true;
+
+  if (job->size > 0) {
+    ssize_t n;
+
+    n = write(job->fd, job->buffer, job->size);
+
+    if (n == (ssize_t) job->size) {
+      *write_bytes += job->size;
+    } else {
+      ok = false;
+    }
+  }
+
+  if (job->close && close(job->fd) != 0) {
+    ok = false;
+  }
+
+  *write_ticks += rtems_counter_difference(rtems_counter_read(), begin);
+
+  rtems_mutex_lock(&pipeline->mutex);
+  pipeline->free_buffers[pipeline->free_count] = job->buffer;
+  ++pipeline->free_count;
+
+  if (!ok) {
+    pipeline->error = UNTAR_FAIL;
+  }
+
+  rtems_condition_variable_signal(&pipeline->buffer_available);
+  rtems_mutex_unlock(&pipeline->mutex);
+}
+
+static void Untar_Pipeline_Submit(
+  Untar_Pipeline          *pipeline,
+  Untar_PipelineWorker    *worker,
+  const Untar_PipelineJob *job
+)
+{
+  size_t index;
+
+  if (worker == NULL) {
+    Untar_Pipeline_Do_job(
+      pipeline,
+      job,
+      &pipeline->write_bytes,
+      &pipeline->write_ticks
+    );
+    return;
+  }
+
+  /*
+   * There are at most one job for each buffer and one stop job in the queue,
+   * so the queue cannot overflow.
+   */
+  rtems_mutex_lock(&pipeline->mutex);
+  index = (worker->job_head + worker->job_count) % (pipeline->buffer_count + 1);
+  worker->jobs[index] = *job;
+  ++worker->job_count;
+  rtems_condition_variable_signal(&worker->job_available);
+  rtems_mutex_unlock(&pipeline->mutex);
+}
+
+static void Untar_Pipeline_Submit_buffer(Untar_Pipeline *pipeline, bool close)
+{
+  Untar_PipelineJob job;
+
+  job.fd = pipeline->fd;
+  job.close = close;
+  job.buffer = pipeline->buffer;
+  job.size = pipeline->buffer_used;
+  pipeline->buffer = NULL;
+  pipeline->buffer_used = 0;
+  Untar_Pipeline_Submit(pipeline, pipeline->worker, &job);
+}
+
+static void Untar_Pipeline_Worker_task(rtems_task_argument arg)
+{
+  Untar_PipelineWorker *worker;
+  Untar_Pipeline *pipeline;
+
+  worker = (Untar_PipelineWorker *) arg;
+  pipeline = worker->pipeline;
+
+  while (true) {
+    Untar_PipelineJob job;
+
+    rtems_mutex_lock(&pipeline->mutex);
+
+    while (worker->job_count == 0) {
+      rtems_condition_variable_wait(&worker->job_available, &pipeline->mutex);
+    }
+
+    job = worker->jobs[worker->job_head];
+    worker->job_head = (worker->job_head + 1) % (pipeline->buffer_count + 1);
+    --worker->job_count;
+    rtems_mutex_unlock(&pipeline->mutex);
+
+    if (job.fd < 0) {
+      break;
+    }
+
+    Untar_Pipeline_Do_job(
+      pipeline,
+      &job,
+      &worker->write_bytes,
+      &worker->write_ticks
+    );
+  }
+
+  rtems_counting_semaphore_post(&pipeline->workers_done);
+  rtems_task_exit();
+}
+
+static void Untar_Pipeline_Stop_workers(
+  Untar_Pipeline *pipeline,
+  uint32_t        worker_count
+)
+{
+  Untar_PipelineJob job;
+  uint32_t i;
+
+  memset(&job, 0, sizeof(job));
+  job.fd = -1;
+
+  for (i = 0; i < worker_count; ++i) {
+    Untar_Pipeline_Submit(pipeline, &pipeline->workers[i], &job);
+  }
+
+  for (i = 0; i < worker_count; ++i) {
+    rtems_counting_semaphore_wait(&pipeline->workers_done);
+  }
+}
+
+static void Untar_Pipeline_Free(Untar_Pipeline *pipeline)
+{
+  uint32_t i;
+
+  if (pipeline->workers != NULL) {
+    for (i = 0; i < pipeline->worker_count; ++i) {
+      rtems_condition_variable_destroy(&pipeline->workers[i].job_available);
+      free(pipeline->workers[i].jobs);
+    }
+  }
+
+  rtems_counting_semaphore_destroy(&pipeline->workers_done);
+  rtems_condition_variable_destroy(&pipeline->buffer_available);
+  rtems_mutex_destroy(&pipeline->mutex);
+  free(pipeline->workers);
+  free(pipeline->free_buffers);
+  free(pipeline->buffer_area);
+  free(pipeline);
+}
+
+static uint32_t Untar_Pipeline_Start_workers(
+  Untar_Pipeline      *pipeline,
+  rtems_task_priority  priority
+)
+{
+  rtems_status_code sc;
+  uint32_t i;
+
+  if (priority == 0) {
+    sc = rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &priority);
+
+    if (sc != RTEMS_SUCCESSFUL) {
+      return 0;
+    }
+  }
+
+  for (i = 0; i < pipeline->worker_count; ++i) {
+    Untar_PipelineWorker *worker;
+
+    worker = &pipeline->workers[i];
+    sc = rtems_task_create(
+      rtems_build_name('U', 'N', 'T', 'W'),
+      priority,
+      UNTAR_PIPELINE_WORKER_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &worker->id
+    );
+
+    if (sc != RTEMS_SUCCESSFUL) {
+      break;
+    }
+
+    (void) rtems_task_start(
+      worker->id,
+      Untar_Pipeline_Worker_task,
+      (rtems_task_argument) worker
+    );
+  }
+
+  return i;
+}
+
+Untar_Pipeline *Untar_Pipeline_Create(const Untar_PipelineConfig *config)
+{
+  Untar_Pipeline *pipeline;
+  size_t buffer_size;
+  size_t buffer_count;
+  uint32_t started;
+  uint32_t i;
+
+  buffer_size = config->buffer_size;
+
+  if (buffer_size == 0) {
+    buffer_size = UNTAR_PIPELINE_BUFFER_SIZE_DEFAULT;
+  }
+
+  buffer_size = roundup(buffer_size, UNTAR_PIPELINE_BLOCK_SIZE);
+  buffer_count = config->buffer_count;
+
+  if (buffer_count == 0) {
+    buffer_count = UNTAR_PIPELINE_BUFFER_COUNT_DEFAULT;
+  }
+
+  if (buffer_count > SIZE_MAX / buffer_size) {
+    return NULL;
+  }
+
+  pipeline = calloc(1, sizeof(*pipeline));
+
+  if (pipeline == NULL) {
+    return NULL;
+  }
+
+  rtems_mutex_init(&pipeline->mutex, "Untar Pipeline");
+  rtems_condition_variable_init(
+    &pipeline->buffer_available,
+    "Untar Pipeline Buffer"
+  );
+  rtems_counting_semaphore_init(
+    &pipeline->workers_done,
+    "Untar Pipeline Workers",
+    0
+  );
+  pipeline->buffer_size = buffer_size;
+  pipeline->buffer_count = buffer_count;
+  pipeline->worker_count = config->worker_count;
+  pipeline->fd = -1;
+  pipeline->begin = rtems_counter_read();
+
+  pipeline->buffer_area = rtems_cache_aligned_malloc(buffer_count * buffer_size);
+  pipeline->free_buffers = calloc(buffer_count, sizeof(*pipeline->free_buffers));
+  pipeline->workers = calloc(config->worker_count, sizeof(*pipeline->workers));
+
+  if (
+    pipeline->buffer_area == NULL || pipeline->free_buffers == NULL ||
+    (config->worker_count > 0 && pipeline->workers == NULL)
+  ) {
+    Untar_Pipeline_Free(pipeline);
+    return NULL;
+  }
+
+  for (i = 0; i < buffer_count; ++i) {
+    pipeline->free_buffers[i] = (char *) pipeline->buffer_area
+      + i * buffer_size;
+  }
+
+  pipeline->free_count = buffer_count;
+
+  for (i = 0; i < config->worker_count; ++i) {
+    Untar_PipelineWorker *worker;
+
+    worker = &pipeline->workers[i];
+    worker->pipeline = pipeline;
+    rtems_condition_variable_init(
+      &worker->job_available,
+      "Untar Pipeline Job"
+    );
+  }
+
+  for (i = 0; i < config->worker_count; ++i) {
+    Untar_PipelineWorker *worker;
+
+    worker = &pipeline->workers[i];
+    worker->jobs = calloc(buffer_count + 1, sizeof(*worker->jobs));
+
+    if (worker->jobs == NULL) {
+      Untar_Pipeline_Free(pipeline);
+      return NULL;
+    }
+  }
+
+  started = Untar_Pipeline_Start_workers(pipeline, config->worker_priority);
+
+  if (started != config->worker_count) {
+    Untar_Pipeline_Stop_workers(pipeline, started);
+    Untar_Pipeline_Free(pipeline);
+    return NULL;
+  }
+
+  return pipeline;
+}
+
+static uint64_t Untar_Pipeline_Kib_per_second(
+  uint64_t bytes,
+  uint64_t nanoseconds
+)
+{
+  if (nanoseconds == 0) {
+    return 0;
+  }
+
+  return (bytes * 1000000000 / 1024) / nanoseconds;
+}
+
+static void Untar_Pipeline_Print_statistics(
+  const Untar_PipelineStatistics *stats,
+  uint32_t                        worker_count,
+  const rtems_printer            *printer
+)
+{
+  rtems_printf(
+    printer,
+    "untar: pipeline: files: %zu, writers: %" PRIu32 ", total: %" PRIu64
+      " us\n"
+    "untar: pipeline: input: %" PRIu64 " bytes in %" PRIu64 " us"
+      " (%" PRIu64 " KiB/s)\n"
+    "untar: pipeline: write: %" PRIu64 " bytes in %" PRIu64 " us"
+      " (%" PRIu64 " KiB/s)\n"
+    "untar: pipeline: stall: %" PRIu64 " us\n",
+    stats->files,
+    worker_count,
+    stats->total_nanoseconds / 1000,
+    stats->input_bytes,
+    stats->input_nanoseconds / 1000,
+    Untar_Pipeline_Kib_per_second(
+      stats->input_bytes,
+      stats->input_nanoseconds
+    ),
+    stats->write_bytes,
+    stats->write_nanoseconds / 1000,
+    Untar_Pipeline_Kib_per_second(
+      stats->write_bytes,
+      stats->write_nanoseconds
+    ),
+    stats->stall_nanoseconds / 1000
+  );
+}
+
+int Untar_Pipeline_Destroy(
+  Untar_Pipeline           *pipeline,
+  Untar_PipelineStatistics *stats,
+  const rtems_printer      *printer
+)
+{
+  Untar_PipelineStatistics local_stats;
+  uint64_t write_bytes;
+  rtems_counter_ticks write_ticks;
+  rtems_counter_ticks total_ticks;
+  rtems_counter_ticks input_ticks;
+  rtems_counter_ticks begin;
+  uint32_t worker_count;
+  uint32_t i;
+  int error;
+
+  /* Close a file of a truncated archive */
+  if (pipeline->fd >= 0) {
+    (void) _Untar_Pipeline_Close_file(pipeline);
+  }
+
+  /* Waiting for the writers to drain their queues is accounted as stall */
+  worker_count = pipeline->worker_count;
+  begin = rtems_counter_read();
+  Untar_Pipeline_Stop_workers(pipeline, worker_count);
+  pipeline->stall_ticks +=
+    rtems_counter_difference(rtems_counter_read(), begin);
+
+  write_bytes = pipeline->write_bytes;
+  write_ticks = pipeline->write_ticks;
+
+  for (i = 0; i < worker_count; ++i) {
+    write_bytes += pipeline->workers[i].write_bytes;
+    write_ticks += pipeline->workers[i].write_ticks;
+  }
+
+  total_ticks = rtems_counter_difference(rtems_counter_read(), pipeline->begin);
+  input_ticks = total_ticks - pipeline->stall_ticks - pipeline->write_ticks;
+
+  if (stats == NULL) {
+    stats = &local_stats;
+  }
+
+  stats->files = pipeline->files;
+  stats->input_bytes = pipeline->input_bytes;
+  stats->input_nanoseconds = rtems_counter_ticks_to_nanoseconds(input_ticks);
+  stats->write_bytes = write_bytes;
+  stats->write_nanoseconds = rtems_counter_ticks_to_nanoseconds(write_ticks);
+  stats->stall_nanoseconds =
+    rtems_counter_ticks_to_nanoseconds(pipeline->stall_ticks);
+  stats->total_nanoseconds = rtems_counter_ticks_to_nanoseconds(total_ticks);
+
+  if (printer != NULL) {
+    Untar_Pipeline_Print_statistics(stats, worker_count, printer);
+  }
+
+  error = pipeline->error;
+  Untar_Pipeline_Free(pipeline);
+
+  return error;
+}
+
+void Untar_ChunkContext_Set_pipeline(
+  Untar_ChunkContext *context,
+  Untar_Pipeline     *pipeline
+)
+{
+  context->pipeline = pipeline;
+}
+
+void _Untar_Pipeline_Add_input(Untar_Pipeline *pipeline, size_t size)
+{
+  pipeline->input_bytes += size;
+}
+
+void _Untar_Pipeline_Open_file(Untar_Pipeline *pipeline, int fd)
+{
+  pipeline->fd = fd;
+  ++pipeline->files;
+
+  if (pipeline->worker_count > 0) {
+    pipeline->worker = &pipeline->workers[pipeline->next_worker];
+    pipeline->next_worker = (pipeline->next_worker + 1) %
+      pipeline->worker_count;
+  } else {
+    pipeline->worker = NULL;
+  }
+}
+
+int _Untar_Pipeline_Write(
+  Untar_Pipeline *pipeline,
+  const void     *data,
+  size_t          size
+)
+{
+  const char *src;
+
+  src = data;
+
+  while (size > 0) {
+    size_t n;
+
+    if (pipeline->buffer == NULL) {
+      pipeline->buffer = Untar_Pipeline_Get_buffer(pipeline);
+    }
+
+    n = MIN(size, pipeline->buffer_size - pipeline->buffer_used);
+    memcpy(&pipeline->buffer[pipeline->buffer_used], src, n);
+    pipeline->buffer_used += n;
+    src += n;
+    size -= n;
+
+    if (pipeline->buffer_used == pipeline->buffer_size) {
+      Untar_Pipeline_Submit_buffer(pipeline, false);
+    }
+  }
+
+  return Untar_Pipeline_Get_error(pipeline);
+}
+
+int _Untar_Pipeline_Close_file(Untar_Pipeline *pipeline)
+{
+  if (pipeline->buffer == NULL) {
+    pipeline->buffer = Untar_Pipeline_Get_buffer(pipeline);
+  }
+
+  Untar_Pipeline_Submit_buffer(pipeline, true);
+  pipeline->fd = -1;
+
+  return Untar_Pipeline_Get_error(pipeline);
+}
+
+int Untar_FromFile_Pipelined_Print(
+  const char                 *tar_name,
+  const Untar_PipelineConfig *config,
+  const rtems_printer        *printer
+)
+{
+  Untar_ChunkContext context;
+  Untar_Pipeline *pipeline;
+  char *buf;
+  ssize_t n;
+  int fd;
+  int retval;
+  int status;
+
+  fd = open(tar_name, O_RDONLY);
+
+  if (fd < 0) {
+    return UNTAR_FAIL;
+  }
+
+  pipeline = Untar_Pipeline_Create(config);
+
+  if (pipeline == NULL) {
+    close(fd);
+    return UNTAR_FAIL;
+  }
+
+  buf = malloc(pipeline->buffer_size);
+
+  if (buf == NULL) {
+    (void) Untar_Pipeline_Destroy(pipeline, NULL, NULL);
+    close(fd);
+    return UNTAR_FAIL;
+  }
+
+  Untar_ChunkContext_Init(&context);
+  Untar_ChunkContext_Set_pipeline(&context, pipeline);
+  retval = UNTAR_SUCCESSFUL;
+
+  while ((n = read(fd, buf, pipeline->buffer_size)) > 0) {
+    retval = Untar_FromChunk_Print(&context, buf, (size_t) n, printer);
+
+    if (retval != UNTAR_SUCCESSFUL) {
+      break;
+    }
+  }
+
+  if (n < 0) {
+    retval = UNTAR_FAIL;
+  }
+
+  free(buf);
+  close(fd);
+
+  status = Untar_Pipeline_Destroy(pipeline, NULL, printer);
+
+  if (retval == UNTAR_SUCCESSFUL) {
+    retval = status;
+  }
+
+  return retval;
+}
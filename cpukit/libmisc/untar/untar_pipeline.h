@@ -0,0 +1,104 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup libmisc_untar_img
+ *
+ * @brief This header file provides the interfaces used by the untar chunk
+ *   processing to feed an untar pipeline.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _UNTAR_PIPELINE_H
+#define _UNTAR_PIPELINE_H
+
+#include <rtems/untar.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Accounts the tar archive bytes fed into the pipeline.
+ *
+ * @param pipeline is the pipeline.
+ *
+ * @param size is the count of bytes.
+ */
+void _Untar_Pipeline_Add_input(Untar_Pipeline *pipeline, size_t size);
+
+/**
+ * @brief Starts a new output file.
+ *
+ * The pipeline is the owner of the file descriptor until the file is closed
+ * by _Untar_Pipeline_Close_file().
+ *
+ * @param pipeline is the pipeline.
+ *
+ * @param fd is the file descriptor of the output file.
+ */
+void _Untar_Pipeline_Open_file(Untar_Pipeline *pipeline, int fd);
+
+/**
+ * @brief Writes data to the current output file.
+ *
+ * The data is copied into write buffers.  A full write buffer is handed over
+ * to the writer of the current file.
+ *
+ * @param pipeline is the pipeline.
+ *
+ * @param data is the data to write.
+ *
+ * @param size is the size in bytes of the data.
+ *
+ * @retval UNTAR_SUCCESSFUL The data was successfully queued.
+ *
+ * @retval UNTAR_FAIL A previous write or close failed.
+ */
+int _Untar_Pipeline_Write(
+  Untar_Pipeline *pipeline,
+  const void     *data,
+  size_t          size
+);
+
+/**
+ * @brief Writes the remaining data of the current output file and closes it.
+ *
+ * @param pipeline is the pipeline.
+ *
+ * @retval UNTAR_SUCCESSFUL The close was successfully queued.
+ *
+ * @retval UNTAR_FAIL A previous write or close failed.
+ */
+int _Untar_Pipeline_Close_file(Untar_Pipeline *pipeline);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _UNTAR_PIPELINE_H */
@@ -0,0 +1,514 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recorddrain.h>
+#include <rtems/recorddump.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define WAKEUP_EVENT RTEMS_EVENT_0
+
+#define WRITER_DONE_EVENT RTEMS_EVENT_1
+
+#define BUFFER_READY_EVENT RTEMS_EVENT_0
+
+#define DEFAULT_BUFFER_SIZE 16384
+
+#define STACK_SIZE ( 2 * RTEMS_MINIMUM_STACK_SIZE )
+
+static void wait( rtems_event_set event )
+{
+  rtems_event_set events;
+
+  (void) rtems_event_receive(
+    event,
+    RTEMS_EVENT_ANY | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+}
+
+static void wakeup_timer( rtems_id timer, void *arg )
+{
+  rtems_record_drain_control *ctx;
+
+  ctx = arg;
+  (void) rtems_event_send( ctx->drain, WAKEUP_EVENT );
+  (void) rtems_timer_reset( timer );
+}
+
+static size_t buffer_used( const rtems_record_drain_control *ctx )
+{
+  if ( ctx->config.compress ) {
+    return ctx->config.buffer_size - ctx->stream.avail_out;
+  }
+
+  return ctx->used;
+}
+
+static void select_buffer( rtems_record_drain_control *ctx, size_t index )
+{
+  ctx->current = index;
+  ctx->used = 0;
+  ctx->stream.next_out = ctx->buffers[ index ];
+  ctx->stream.avail_out = ctx->config.buffer_size;
+}
+
+static void wait_for_writer( rtems_record_drain_control *ctx )
+{
+  if ( ctx->writer_busy ) {
+    wait( WRITER_DONE_EVENT );
+    ctx->writer_busy = false;
+  }
+}
+
+static bool is_writer_busy( rtems_record_drain_control *ctx )
+{
+  rtems_event_set events;
+
+  if (
+    ctx->writer_busy &&
+    rtems_event_receive(
+      WRITER_DONE_EVENT,
+      RTEMS_EVENT_ANY | RTEMS_NO_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    ) == RTEMS_SUCCESSFUL
+  ) {
+    ctx->writer_busy = false;
+  }
+
+  return ctx->writer_busy;
+}
+
+/*
+ * Hands the current buffer over to the writer task and continues with the
+ * other buffer.  Only one buffer is in the hands of the writer at a time.
+ */
+static void submit_buffer( rtems_record_drain_control *ctx )
+{
+  size_t used;
+
+  used = buffer_used( ctx );
+
+  if ( used == 0 ) {
+    return;
+  }
+
+  if ( is_writer_busy( ctx ) ) {
+    ++ctx->stats.writer_waits;
+    wait_for_writer( ctx );
+  }
+
+  ctx->pending_data = ctx->buffers[ ctx->current ];
+  ctx->pending = used;
+  ctx->writer_busy = true;
+  (void) rtems_event_send( ctx->writer, BUFFER_READY_EVENT );
+  select_buffer( ctx, 1 - ctx->current );
+}
+
+static void account(
+  rtems_record_drain_control *ctx,
+  const void                 *data,
+  size_t                      length
+)
+{
+  const rtems_record_item *items;
+  size_t                   count;
+  uint32_t                 cpu_index;
+
+  /* The first chunk is the stream header */
+  if ( !ctx->header_done ) {
+    ctx->header_done = true;
+    return;
+  }
+
+  /*
+   * The chunks of fetched items start with an RTEMS_RECORD_PROCESSOR item
+   * optionally followed by an RTEMS_RECORD_PER_CPU_OVERFLOW item.  The thread
+   * names are produced one item per chunk.
+   */
+  items = data;
+  count = length / sizeof( *items );
+
+  if (
+    count < 2 ||
+    RTEMS_RECORD_GET_EVENT( items[ 0 ].event ) != RTEMS_RECORD_PROCESSOR
+  ) {
+    return;
+  }
+
+  cpu_index = (uint32_t) items[ 0 ].data;
+  --count;
+
+  if ( RTEMS_RECORD_GET_EVENT( items[ 1 ].event ) ==
+    RTEMS_RECORD_PER_CPU_OVERFLOW ) {
+    if ( cpu_index < RTEMS_ARRAY_SIZE( ctx->overflow ) ) {
+      ctx->overflow[ cpu_index ] += items[ 1 ].data;
+    }
+
+    --count;
+  }
+
+  ctx->stats.item_count += count;
+}
+
+static void chunk( void *arg, const void *data, size_t length )
+{
+  rtems_record_drain_control *ctx;
+
+  ctx = arg;
+  account( ctx, data, length );
+
+  if ( ctx->config.compress ) {
+    ctx->stream.next_in = RTEMS_DECONST( void *, data );
+    ctx->stream.avail_in = length;
+
+    while ( ctx->stream.avail_in > 0 ) {
+      int err;
+
+      err = deflate( &ctx->stream, Z_NO_FLUSH );
+      if ( err != Z_OK ) {
+        return;
+      }
+
+      if ( ctx->stream.avail_out == 0 ) {
+        submit_buffer( ctx );
+      }
+    }
+  } else {
+    const unsigned char *in;
+
+    in = data;
+
+    while ( length > 0 ) {
+      size_t n;
+
+      n = ctx->config.buffer_size - ctx->used;
+
+      if ( n > length ) {
+        n = length;
+      }
+
+      memcpy( ctx->buffers[ ctx->current ] + ctx->used, in, n );
+      ctx->used += n;
+      in += n;
+      length -= n;
+
+      if ( ctx->used == ctx->config.buffer_size ) {
+        submit_buffer( ctx );
+      }
+    }
+  }
+}
+
+static void fetch( rtems_record_drain_control *ctx )
+{
+  rtems_record_fetch_control control;
+  rtems_record_fetch_status  status;
+
+  rtems_record_fetch_initialize( &control, ctx->items, ctx->item_count );
+
+  do {
+    status = rtems_record_fetch( &control );
+    chunk(
+      ctx,
+      control.fetched_items,
+      control.fetched_count * sizeof( *control.fetched_items )
+    );
+  } while ( status == RTEMS_RECORD_FETCH_CONTINUE );
+}
+
+static void finish( rtems_record_drain_control *ctx )
+{
+  if ( ctx->config.compress ) {
+    while ( true ) {
+      int err;
+
+      err = deflate( &ctx->stream, Z_FINISH );
+      if ( err != Z_OK ) {
+        break;
+      }
+
+      if ( ctx->stream.avail_out == 0 ) {
+        submit_buffer( ctx );
+      }
+    }
+
+    (void) deflateEnd( &ctx->stream );
+  }
+
+  submit_buffer( ctx );
+  wait_for_writer( ctx );
+}
+
+static void drain_task( rtems_task_argument arg )
+{
+  rtems_record_drain_control *ctx;
+  rtems_id                    writer;
+
+  ctx = (rtems_record_drain_control *) arg;
+
+  /* Produce the stream header, the thread names, and the available items */
+  rtems_record_dump( chunk, ctx );
+
+  (void) rtems_timer_fire_after(
+    ctx->timer,
+    ctx->config.period,
+    wakeup_timer,
+    ctx
+  );
+
+  while ( true ) {
+    bool stop;
+
+    wait( WAKEUP_EVENT );
+    stop = ctx->stop;
+    fetch( ctx );
+
+    if ( stop ) {
+      break;
+    }
+
+    /*
+     * Do not let the items wait in a partially filled buffer if the writer
+     * is idle anyway.
+     */
+    if ( !is_writer_busy( ctx ) ) {
+      submit_buffer( ctx );
+    }
+  }
+
+  (void) rtems_timer_delete( ctx->timer );
+  finish( ctx );
+
+  /* Tell the writer to terminate, which then notifies the stopper */
+  writer = ctx->writer;
+  ctx->pending = 0;
+  (void) rtems_event_send( writer, BUFFER_READY_EVENT );
+  rtems_task_exit();
+}
+
+static void writer_task( rtems_task_argument arg )
+{
+  rtems_record_drain_control *ctx;
+
+  ctx = (rtems_record_drain_control *) arg;
+
+  while ( true ) {
+    const unsigned char *data;
+    size_t               size;
+
+    wait( BUFFER_READY_EVENT );
+    data = ctx->pending_data;
+    size = ctx->pending;
+
+    if ( size == 0 ) {
+      break;
+    }
+
+    while ( size > 0 && ctx->stats.write_error == 0 ) {
+      ssize_t n;
+
+      n = write( ctx->config.fd, data, size );
+
+      if ( n <= 0 ) {
+        ctx->stats.write_error = n < 0 ? errno : EIO;
+      } else {
+        data += n;
+        size -= (size_t) n;
+        ctx->stats.byte_count += (size_t) n;
+      }
+    }
+
+    (void) rtems_event_send( ctx->drain, WRITER_DONE_EVENT );
+  }
+
+  (void) rtems_event_transient_send( ctx->stopper );
+  rtems_task_exit();
+}
+
+static void free_buffers( rtems_record_drain_control *ctx )
+{
+  free( ctx->buffers[ 0 ] );
+  free( ctx->buffers[ 1 ] );
+  free( ctx->items );
+}
+
+rtems_status_code rtems_record_drain_start(
+  rtems_record_drain_control      *control,
+  const rtems_record_drain_config *config
+)
+{
+  rtems_status_code sc;
+
+  control = memset( control, 0, sizeof( *control ) );
+  control->config = *config;
+
+  if ( control->config.buffer_size == 0 ) {
+    control->config.buffer_size = DEFAULT_BUFFER_SIZE;
+  }
+
+  control->item_count = rtems_record_get_item_count_for_fetch();
+  control->items = calloc( control->item_count, sizeof( *control->items ) );
+  control->buffers[ 0 ] = malloc( control->config.buffer_size );
+  control->buffers[ 1 ] = malloc( control->config.buffer_size );
+
+  if (
+    control->items == NULL ||
+    control->buffers[ 0 ] == NULL ||
+    control->buffers[ 1 ] == NULL
+  ) {
+    sc = RTEMS_NO_MEMORY;
+    goto buffer_error;
+  }
+
+  if ( control->config.compress ) {
+    int err;
+
+    /*
+     * Favour speed and a small memory footprint (about 48KiB) over the
+     * compression ratio.  The positive window bits produce a zlib wrapped
+     * stream.
+     */
+    err = deflateInit2(
+      &control->stream,
+      Z_BEST_SPEED,
+      Z_DEFLATED,
+      12,
+      6,
+      Z_DEFAULT_STRATEGY
+    );
+    if ( err != Z_OK ) {
+      sc = RTEMS_NO_MEMORY;
+      goto buffer_error;
+    }
+  }
+
+  select_buffer( control, 0 );
+
+  sc = rtems_timer_create(
+    rtems_build_name( 'R', 'C', 'D', 'T' ),
+    &control->timer
+  );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    goto timer_error;
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name( 'R', 'C', 'D', 'W' ),
+    control->config.priority,
+    STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &control->writer
+  );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    goto writer_error;
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name( 'R', 'C', 'D', 'D' ),
+    control->config.priority,
+    STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &control->drain
+  );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    goto drain_error;
+  }
+
+  (void) rtems_task_start(
+    control->writer,
+    writer_task,
+    (rtems_task_argument) control
+  );
+  (void) rtems_task_start(
+    control->drain,
+    drain_task,
+    (rtems_task_argument) control
+  );
+
+  return RTEMS_SUCCESSFUL;
+
+drain_error:
+
+  (void) rtems_task_delete( control->writer );
+
+writer_error:
+
+  (void) rtems_timer_delete( control->timer );
+
+timer_error:
+
+  if ( control->config.compress ) {
+    (void) deflateEnd( &control->stream );
+  }
+
+buffer_error:
+
+  free_buffers( control );
+  return sc;
+}
+
+void rtems_record_drain_stop( rtems_record_drain_control *control )
+{
+  control->stopper = rtems_task_self();
+  control->stop = true;
+  (void) rtems_event_send( control->drain, WAKEUP_EVENT );
+  (void) rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  free_buffers( control );
+}
+
+void rtems_record_drain_get_statistics(
+  const rtems_record_drain_control *control,
+  rtems_record_drain_statistics    *stats
+)
+{
+  *stats = control->stats;
+}
+
+rtems_record_data rtems_record_drain_get_overflow(
+  const rtems_record_drain_control *control,
+  uint32_t                          cpu_index
+)
+{
+  if ( cpu_index >= RTEMS_ARRAY_SIZE( control->overflow ) ) {
+    return 0;
+  }
+
+  return control->overflow[ cpu_index ];
+}
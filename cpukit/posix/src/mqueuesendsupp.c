@@ -54,6 +54,11 @@
 
 #include <fcntl.h>
 
+RTEMS_STATIC_ASSERT(
+  MQ_PRIO_MAX < CORE_MESSAGE_QUEUE_PRIORITY_COUNT,
+  MQ_PRIO_MAX
+);
+
 int _POSIX_Message_queue_Send_support(
   mqd_t                         mqdes,
   const char                   *msg_ptr,
@@ -46,6 +46,23 @@
 #include <rtems/score/threadqimpl.h>
 #include <rtems/sysinit.h>
 
+static uintptr_t _Region_Enable_segregated_fit( Heap_Control *heap )
+{
+  Heap_Information info;
+
+  if ( !_Heap_Enable_segregated_fit( heap ) ) {
+    return 0;
+  }
+
+  _Heap_Get_free_information( heap, &info );
+
+  if ( info.largest == 0 ) {
+    return 0;
+  }
+
+  return info.largest - HEAP_BLOCK_HEADER_SIZE + HEAP_ALLOC_BONUS;
+}
+
 rtems_status_code rtems_region_create(
   rtems_name          name,
   void               *starting_address,
@@ -88,6 +105,14 @@ rtems_status_code rtems_region_create(
         &the_region->Memory, starting_address, length, page_size
       );
 
+      if (
+        the_region->maximum_segment_size != 0
+          && _Attributes_Is_segregated_fit( attribute_set )
+      ) {
+        the_region->maximum_segment_size =
+          _Region_Enable_segregated_fit( &the_region->Memory );
+      }
+
       if ( !the_region->maximum_segment_size ) {
         _Region_Free( the_region );
         return_status = RTEMS_INVALID_SIZE;
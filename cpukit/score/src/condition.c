@@ -47,6 +47,7 @@
 
 #include <rtems/score/atomic.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/muteximpl.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/threadqimpl.h>
 #include <rtems/score/todimpl.h>
@@ -117,6 +118,23 @@ static void _Condition_Mutex_release( Thread_queue_Context *queue_context )
   _Mutex_Release( context->mutex );
 }
 
+/*
+ * _Condition_Broadcast() may move the waiting thread to the thread queue of
+ * the mutex.  In this case, the mutex ownership was already handed over to the
+ * thread when it wakes up.  A thread cannot own the mutex while it waits on
+ * the condition variable, since the mutex was released before the blocking.
+ */
+static bool _Condition_Mutex_is_owner(
+  const struct _Mutex_Control *_mutex,
+  const Thread_Control        *executing
+)
+{
+  const Mutex_Control *mutex;
+
+  mutex = (const Mutex_Control *) _mutex;
+  return mutex->Queue.Queue.owner == executing;
+}
+
 static void _Condition_Enqueue_no_timeout(
   Thread_queue_Queue   *queue,
   Thread_Control       *the_thread,
@@ -156,6 +174,7 @@ static Thread_Control *_Condition_Do_wait(
   condition = _Condition_Get( _condition );
   _ISR_lock_ISR_disable( &context->Base.Lock_context.Lock_context );
   executing = _Condition_Queue_acquire_critical( condition, &context->Base );
+  executing->Wait.return_argument = _mutex;
   _Thread_queue_Context_set_thread_state(
     &context->Base,
     STATES_WAITING_FOR_CONDITION_VARIABLE
@@ -175,15 +194,19 @@ void _Condition_Wait(
   struct _Mutex_Control     *_mutex
 )
 {
-  Condition_Enqueue_context context;
+  Condition_Enqueue_context  context;
+  Thread_Control            *executing;
 
   _Thread_queue_Context_initialize( &context.Base );
   _Thread_queue_Context_set_enqueue_callout(
     &context.Base,
     _Condition_Enqueue_no_timeout
   );
-  _Condition_Do_wait( _condition, _mutex, &context );
-  _Mutex_Acquire( _mutex );
+  executing = _Condition_Do_wait( _condition, _mutex, &context );
+
+  if ( !_Condition_Mutex_is_owner( _mutex, executing ) ) {
+    _Mutex_Acquire( _mutex );
+  }
 }
 
 int _Condition_Wait_timed(
@@ -204,7 +227,10 @@ int _Condition_Wait_timed(
   _Thread_queue_Context_set_timeout_argument( &context.Base, abstime, true );
   executing = _Condition_Do_wait( _condition, _mutex, &context );
   eno = STATUS_GET_POSIX( _Thread_Wait_get_status( executing ) );
-  _Mutex_Acquire( _mutex );
+
+  if ( !_Condition_Mutex_is_owner( _mutex, executing ) ) {
+    _Mutex_Acquire( _mutex );
+  }
 
   return eno;
 }
@@ -226,8 +252,9 @@ void _Condition_Wait_recursive(
   struct _Mutex_recursive_Control *_mutex
 )
 {
-  Condition_Enqueue_context context;
-  unsigned int              nest_level;
+  Condition_Enqueue_context  context;
+  Thread_Control            *executing;
+  unsigned int               nest_level;
 
   _Thread_queue_Context_initialize( &context.Base );
   _Thread_queue_Context_set_enqueue_callout(
@@ -235,8 +262,12 @@ void _Condition_Wait_recursive(
     _Condition_Enqueue_no_timeout
   );
   nest_level = _Condition_Unnest_mutex( _mutex );
-  _Condition_Do_wait( _condition, &_mutex->_Mutex, &context );
-  _Mutex_recursive_Acquire( _mutex );
+  executing = _Condition_Do_wait( _condition, &_mutex->_Mutex, &context );
+
+  if ( !_Condition_Mutex_is_owner( &_mutex->_Mutex, executing ) ) {
+    _Mutex_recursive_Acquire( _mutex );
+  }
+
   _mutex->_nest_level = nest_level;
 }
 
@@ -260,7 +291,10 @@ int _Condition_Wait_recursive_timed(
   nest_level = _Condition_Unnest_mutex( _mutex );
   executing = _Condition_Do_wait( _condition, &_mutex->_Mutex, &context );
   eno = STATUS_GET_POSIX( _Thread_Wait_get_status( executing ) );
-  _Mutex_recursive_Acquire( _mutex );
+
+  if ( !_Condition_Mutex_is_owner( &_mutex->_Mutex, executing ) ) {
+    _Mutex_recursive_Acquire( _mutex );
+  }
   _mutex->_nest_level = nest_level;
 
   return eno;
@@ -325,7 +359,95 @@ void _Condition_Signal( struct _Condition_Control *_condition )
   _Condition_Wake( _condition, 1 );
 }
 
+typedef struct {
+  Thread_queue_Context  Base;
+  const void           *mutex;
+  bool                  stopped;
+} Condition_Requeue_context;
+
+static Thread_Control *_Condition_Requeue_filter(
+  Thread_Control       *the_thread,
+  Thread_queue_Queue   *queue,
+  Thread_queue_Context *queue_context
+)
+{
+  Condition_Requeue_context *context;
+
+  context = (Condition_Requeue_context *) queue_context;
+
+  /*
+   * Waiting on the same condition variable with different mutexes is
+   * undefined behaviour.  Stop here and wake up the remaining threads.
+   */
+  if ( the_thread->Wait.return_argument != context->mutex ) {
+    context->stopped = true;
+    return NULL;
+  }
+
+  return the_thread;
+}
+
+/*
+ * Waking up all waiting threads would let them contend for the mutex right
+ * after the broadcast.  Instead, the waiting threads are moved to the thread
+ * queue of the mutex without waking them up.  If the mutex has no owner, then
+ * the first waiting thread becomes the owner and is woken up.  The other
+ * threads obtain the mutex ownership one by one through the mutex release.
+ */
 void _Condition_Broadcast( struct _Condition_Control *_condition )
 {
-  _Condition_Wake( _condition, INT_MAX );
+  Condition_Control         *condition;
+  Condition_Requeue_context  context;
+  Thread_Control            *first;
+  Mutex_Control             *mutex;
+  ISR_lock_Context           mutex_lock_context;
+  size_t                     wake_count;
+
+  condition = _Condition_Get( _condition );
+  _Thread_queue_Context_initialize( &context.Base );
+  _ISR_lock_ISR_disable( &context.Base.Lock_context.Lock_context );
+  _Condition_Queue_acquire_critical( condition, &context.Base );
+
+  if (
+    RTEMS_PREDICT_TRUE( _Thread_queue_Is_empty( &condition->Queue.Queue ) )
+  ) {
+    _Condition_Queue_release( condition, &context.Base );
+    return;
+  }
+
+  first = ( *( CONDITION_TQ_OPERATIONS )->first )(
+    condition->Queue.Queue.heads
+  );
+  mutex = first->Wait.return_argument;
+  context.mutex = mutex;
+  context.stopped = false;
+
+  _Thread_queue_Queue_acquire_critical(
+    &mutex->Queue.Queue,
+    &_Thread_Executing->Potpourri_stats,
+    &mutex_lock_context
+  );
+
+  if ( mutex->Queue.Queue.owner == NULL ) {
+    mutex->Queue.Queue.owner = first;
+    _Thread_Resource_count_increment( first );
+    wake_count = 1;
+  } else {
+    wake_count = 0;
+  }
+
+  _Thread_queue_Requeue_critical(
+    &condition->Queue.Queue,
+    CONDITION_TQ_OPERATIONS,
+    &mutex->Queue.Queue,
+    MUTEX_TQ_OPERATIONS,
+    &mutex_lock_context,
+    wake_count,
+    _Condition_Requeue_filter,
+    &context.Base
+  );
+
+  if ( RTEMS_PREDICT_FALSE( context.stopped ) ) {
+    _Condition_Wake( _condition, INT_MAX );
+  }
 }
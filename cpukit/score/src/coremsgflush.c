@@ -41,16 +41,42 @@
 
 #include <rtems/score/coremsgimpl.h>
 
-uint32_t   _CORE_message_queue_Flush(
-  CORE_message_queue_Control *the_message_queue,
-  Thread_queue_Context       *queue_context
+static void _CORE_message_queue_Flush_chain(
+  Chain_Control *inactive_messages,
+  Chain_Control *pending_messages
 )
 {
   Chain_Node *inactive_head;
   Chain_Node *inactive_first;
   Chain_Node *message_queue_first;
   Chain_Node *message_queue_last;
-  uint32_t    count;
+
+  if ( _Chain_Is_empty( pending_messages ) ) {
+    return;
+  }
+
+  inactive_head = _Chain_Head( inactive_messages );
+  inactive_first = inactive_head->next;
+  message_queue_first = _Chain_First( pending_messages );
+  message_queue_last = _Chain_Last( pending_messages );
+
+  inactive_head->next = message_queue_first;
+  message_queue_last->next = inactive_first;
+  inactive_first->previous = message_queue_last;
+  message_queue_first->previous = inactive_head;
+
+  _Chain_Initialize_empty( pending_messages );
+}
+
+uint32_t   _CORE_message_queue_Flush(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_queue_Context       *queue_context
+)
+{
+  uint32_t                    count;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  CORE_message_queue_Buckets *buckets;
+#endif
 
   /*
    *  Currently, RTEMS supports no API that has both flush and blocking
@@ -85,17 +111,31 @@ uint32_t   _CORE_message_queue_Flush(
   if ( count != 0 ) {
     the_message_queue->number_of_pending_messages = 0;
 
-    inactive_head = _Chain_Head( &the_message_queue->Inactive_messages );
-    inactive_first = inactive_head->next;
-    message_queue_first = _Chain_First( &the_message_queue->Pending_messages );
-    message_queue_last = _Chain_Last( &the_message_queue->Pending_messages );
+    _CORE_message_queue_Flush_chain(
+      &the_message_queue->Inactive_messages,
+      &the_message_queue->Pending_messages
+    );
 
-    inactive_head->next = message_queue_first;
-    message_queue_last->next = inactive_first;
-    inactive_first->previous = message_queue_last;
-    message_queue_first->previous = inactive_head;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    buckets = the_message_queue->Pending_buckets;
 
-    _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+    while ( buckets != NULL && !_Priority_bit_map_Is_empty( &buckets->Map ) ) {
+      Priority_bit_map_Information bit_map_info;
+      unsigned int                 index;
+
+      index = _Priority_bit_map_Get_highest( &buckets->Map );
+      _CORE_message_queue_Flush_chain(
+        &the_message_queue->Inactive_messages,
+        &buckets->Buckets[ index ]
+      );
+      _Priority_bit_map_Initialize_information(
+        &buckets->Map,
+        &bit_map_info,
+        index
+      );
+      _Priority_bit_map_Remove( &buckets->Map, &bit_map_info );
+    }
+#endif
   }
 
   _CORE_message_queue_Release( the_message_queue, queue_context );
@@ -6,6 +6,7 @@
  * @ingroup RTEMSScoreMessageQueue
  *
  * @brief This source file contains the implementation of
+ *   _CORE_message_queue_Insert_buffer() and
  *   _CORE_message_queue_Insert_message().
  */
 
@@ -41,29 +42,9 @@
 
 #include <rtems/score/coremsgimpl.h>
 
-#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
-static bool _CORE_message_queue_Order(
-  const void       *key,
-  const Chain_Node *left,
-  const Chain_Node *right
-)
-{
-   const int                       *left_priority;
-   const CORE_message_queue_Buffer *right_message;
-
-   (void) left;
-   left_priority = (const int *) key;
-   right_message = (const CORE_message_queue_Buffer *) right;
-
-   return *left_priority <
-     _CORE_message_queue_Get_message_priority( right_message );
-}
-#endif
-
-void _CORE_message_queue_Insert_message(
+void _CORE_message_queue_Insert_buffer(
   CORE_message_queue_Control      *the_message_queue,
   CORE_message_queue_Buffer       *the_message,
-  const void                      *content_source,
   size_t                           content_size,
   CORE_message_queue_Submit_types  submit_type
 )
@@ -72,12 +53,6 @@ void _CORE_message_queue_Insert_message(
 
   the_message->size = content_size;
 
-  _CORE_message_queue_Copy_buffer(
-    content_source,
-    the_message->buffer,
-    content_size
-  );
-
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
   the_message->priority = submit_type;
 #endif
@@ -89,17 +64,44 @@ void _CORE_message_queue_Insert_message(
     _Chain_Append_unprotected( pending_messages, &the_message->Node );
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
   } else  if ( submit_type != CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
-    int priority;
+    CORE_message_queue_Buckets   *buckets;
+    Priority_bit_map_Information  bit_map_info;
+    unsigned int                  index;
+
+    buckets = the_message_queue->Pending_buckets;
+    _Assert( buckets != NULL );
 
-    priority = _CORE_message_queue_Get_message_priority( the_message );
-    _Chain_Insert_ordered_unprotected(
-      pending_messages,
-      &the_message->Node,
-      &priority,
-      _CORE_message_queue_Order
+    index = _CORE_message_queue_Get_bucket_index( submit_type );
+    _Chain_Append_unprotected( &buckets->Buckets[ index ], &the_message->Node );
+    _Priority_bit_map_Initialize_information(
+      &buckets->Map,
+      &bit_map_info,
+      index
     );
+    _Priority_bit_map_Add( &buckets->Map, &bit_map_info );
 #endif
   } else {
     _Chain_Prepend_unprotected( pending_messages, &the_message->Node );
   }
 }
+
+void _CORE_message_queue_Insert_message(
+  CORE_message_queue_Control      *the_message_queue,
+  CORE_message_queue_Buffer       *the_message,
+  const void                      *content_source,
+  size_t                           content_size,
+  CORE_message_queue_Submit_types  submit_type
+)
+{
+  _CORE_message_queue_Copy_buffer(
+    content_source,
+    the_message->buffer,
+    content_size
+  );
+  _CORE_message_queue_Insert_buffer(
+    the_message_queue,
+    the_message,
+    content_size,
+    submit_type
+  );
+}
@@ -6,7 +6,7 @@
  * @ingroup RTEMSScoreMessageQueue
  *
  * @brief This source file contains the implementation of
- *   _CORE_message_queue_Seize().
+ *   _CORE_message_queue_Seize() and _CORE_message_queue_Seize_buffer().
  */
 
 /*
@@ -45,6 +45,39 @@
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/statesimpl.h>
 
+static Status_Control _CORE_message_queue_Wait_for_message(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                       *buffer,
+  size_t                     *size_p,
+  uint32_t                    option,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+)
+{
+  if ( !wait ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  executing->Wait.return_argument_second.mutable_object = buffer;
+  executing->Wait.return_argument = size_p;
+  executing->Wait.option = option;
+  /* Wait.count will be filled in with the message priority */
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
 Status_Control _CORE_message_queue_Seize(
   CORE_message_queue_Control *the_message_queue,
   Thread_Control             *executing,
@@ -124,24 +157,49 @@ Status_Control _CORE_message_queue_Seize(
     #endif
   }
 
-  if ( !wait ) {
+  return _CORE_message_queue_Wait_for_message(
+    the_message_queue,
+    executing,
+    buffer,
+    size_p,
+    CORE_MESSAGE_QUEUE_RECEIVE_COPY,
+    wait,
+    queue_context
+  );
+}
+
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control  *the_message_queue,
+  Thread_Control              *executing,
+  void                       **buffer,
+  size_t                      *size_p,
+  bool                         wait,
+  Thread_queue_Context        *queue_context
+)
+{
+  CORE_message_queue_Buffer *the_message;
+
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+    _Chain_Set_off_chain( &the_message->Node );
+
+    *size_p = the_message->size;
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    *buffer = the_message->buffer;
+
     _CORE_message_queue_Release( the_message_queue, queue_context );
-    return STATUS_UNSATISFIED;
+    return STATUS_SUCCESSFUL;
   }
 
-  executing->Wait.return_argument_second.mutable_object = buffer;
-  executing->Wait.return_argument = size_p;
-  /* Wait.count will be filled in with the message priority */
-
-  _Thread_queue_Context_set_thread_state(
-    queue_context,
-    STATES_WAITING_FOR_MESSAGE
-  );
-  _Thread_queue_Enqueue(
-    &the_message_queue->Wait_queue.Queue,
-    the_message_queue->operations,
+  return _CORE_message_queue_Wait_for_message(
+    the_message_queue,
     executing,
+    buffer,
+    size_p,
+    CORE_MESSAGE_QUEUE_RECEIVE_BUFFER,
+    wait,
     queue_context
   );
-  return _Thread_Wait_get_status( executing );
 }
@@ -6,7 +6,7 @@
  * @ingroup RTEMSScoreMessageQueue
  *
  * @brief This source file contains the implementation of
- *   _CORE_message_queue_Submit().
+ *   _CORE_message_queue_Submit() and _CORE_message_queue_Submit_buffer().
  */
 
 /*
@@ -45,6 +45,33 @@
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/statesimpl.h>
 
+static void _CORE_message_queue_Notify_or_release(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_queue_Context       *queue_context
+)
+{
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  /*
+   *  According to POSIX, does this happen before or after the message
+   *  is actually enqueued.  It is logical to think afterwards, because
+   *  the message is actually in the queue at this point.
+   */
+  if (
+    the_message_queue->number_of_pending_messages == 1
+      && the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )(
+      the_message_queue,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+}
+
 Status_Control _CORE_message_queue_Submit(
   CORE_message_queue_Control       *the_message_queue,
   Thread_Control                   *executing,
@@ -93,27 +120,7 @@ Status_Control _CORE_message_queue_Submit(
       submit_type
     );
 
-#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
-    /*
-     *  According to POSIX, does this happen before or after the message
-     *  is actually enqueued.  It is logical to think afterwards, because
-     *  the message is actually in the queue at this point.
-     */
-    if (
-      the_message_queue->number_of_pending_messages == 1
-        && the_message_queue->notify_handler != NULL
-    ) {
-      ( *the_message_queue->notify_handler )(
-        the_message_queue,
-        queue_context
-      );
-    } else {
-      _CORE_message_queue_Release( the_message_queue, queue_context );
-    }
-#else
-    _CORE_message_queue_Release( the_message_queue, queue_context );
-#endif
-
+    _CORE_message_queue_Notify_or_release( the_message_queue, queue_context );
     return STATUS_SUCCESSFUL;
   }
 
@@ -163,3 +170,70 @@ Status_Control _CORE_message_queue_Submit(
   return _Thread_Wait_get_status( executing );
 #endif
 }
+
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control      *the_message_queue,
+  CORE_message_queue_Buffer       *the_message,
+  size_t                           size,
+  CORE_message_queue_Submit_types  submit_type,
+  Thread_queue_Context            *queue_context
+)
+{
+  Thread_queue_Heads *heads;
+  Thread_Control     *the_thread;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  /*
+   *  Is there a thread currently waiting on this message queue?  See also
+   *  _CORE_message_queue_Dequeue_receiver().
+   */
+  heads = the_message_queue->Wait_queue.Queue.heads;
+  if ( the_message_queue->number_of_pending_messages != 0 || heads == NULL ) {
+    _CORE_message_queue_Insert_buffer(
+      the_message_queue,
+      the_message,
+      size,
+      submit_type
+    );
+    _CORE_message_queue_Notify_or_release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  the_thread = ( *the_message_queue->operations->surrender )(
+    &the_message_queue->Wait_queue.Queue,
+    heads,
+    NULL,
+    queue_context
+  );
+
+  *(size_t *) the_thread->Wait.return_argument = size;
+  the_thread->Wait.count = (uint32_t) submit_type;
+
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_BUFFER ) {
+    /* Hand over the message buffer without a copy */
+    the_message->size = size;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    the_message->priority = submit_type;
+#endif
+    *(void **) the_thread->Wait.return_argument_second.mutable_object =
+      the_message->buffer;
+  } else {
+    _CORE_message_queue_Copy_buffer(
+      the_message->buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+    _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+  }
+
+  _Thread_queue_Resume(
+    &the_message_queue->Wait_queue.Queue,
+    the_thread,
+    queue_context
+  );
+  return STATUS_SUCCESSFUL;
+}
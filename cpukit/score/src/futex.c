@@ -6,7 +6,8 @@
  * @ingroup RTEMSScoreFutex
  *
  * @brief This source file contains the implementation of
- *   _Futex_Wait() and _Futex_Wake().
+ *   _Futex_Cmp_requeue(), _Futex_Requeue(), _Futex_Wait(), _Futex_Wake(), and
+ *   _Futex_Wake_op().
  */
 
 /*
@@ -52,9 +53,11 @@
 
 #include <sys/lock.h>
 #include <errno.h>
+#include <limits.h>
 
 #include <rtems/score/atomic.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/futex.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/threadqimpl.h>
 
@@ -224,3 +227,345 @@ int _Futex_Wake( struct _Futex_Control *_futex, int count )
     &context.Base
   );
 }
+
+static void _Futex_Queue_acquire_two_critical(
+  Futex_Control        *futex,
+  Futex_Control        *futex2,
+  ISR_lock_Context     *lock_context2,
+  Thread_queue_Context *queue_context
+)
+{
+  _Assert( futex != futex2 );
+
+  /* Acquire the thread queue locks in a fixed order to avoid deadlocks */
+  if ( (uintptr_t) futex < (uintptr_t) futex2 ) {
+    _Futex_Queue_acquire_critical( futex, queue_context );
+    _Thread_queue_Queue_acquire_critical(
+      &futex2->Queue.Queue,
+      &_Thread_Executing->Potpourri_stats,
+      lock_context2
+    );
+  } else {
+    _Thread_queue_Queue_acquire_critical(
+      &futex2->Queue.Queue,
+      &_Thread_Executing->Potpourri_stats,
+      lock_context2
+    );
+    _Futex_Queue_acquire_critical( futex, queue_context );
+  }
+}
+
+static int _Futex_Clamp_count( int count )
+{
+  return count > 0 ? count : 0;
+}
+
+static int _Futex_Do_requeue(
+  struct _Futex_Control *_futex,
+  struct _Futex_Control *_futex2,
+  const int             *uaddr,
+  int                    val,
+  int                    wake_count,
+  int                    requeue_count,
+  int                   *count,
+  int                   *woken
+)
+{
+  Futex_Control    *futex;
+  Futex_Control    *futex2;
+  ISR_Level         level;
+  Futex_Context     context;
+  ISR_lock_Context  lock_context2;
+  int               removed;
+
+  futex = _Futex_Get( _futex );
+  futex2 = _Futex_Get( _futex2 );
+  wake_count = _Futex_Clamp_count( wake_count );
+  requeue_count = _Futex_Clamp_count( requeue_count );
+  _Thread_queue_Context_initialize( &context.Base );
+  _Thread_queue_Context_ISR_disable( &context.Base, level );
+
+  if ( futex == futex2 ) {
+    _Futex_Queue_acquire_critical( futex, &context.Base );
+
+    if ( uaddr != NULL && *uaddr != val ) {
+      _Futex_Queue_release( futex, level, &context.Base );
+      return EAGAIN;
+    }
+
+    /* Moving the threads to the same futex object is a no-operation */
+    context.count = wake_count;
+    _Thread_queue_Context_set_ISR_level( &context.Base, level );
+    removed = (int) _Thread_queue_Flush_critical(
+      &futex->Queue.Queue,
+      FUTEX_TQ_OPERATIONS,
+      _Futex_Flush_filter,
+      &context.Base
+    );
+    *count = removed;
+    *woken = removed;
+
+    return 0;
+  }
+
+  _Futex_Queue_acquire_two_critical(
+    futex,
+    futex2,
+    &lock_context2,
+    &context.Base
+  );
+
+  if ( uaddr != NULL && *uaddr != val ) {
+    _Thread_queue_Queue_release_critical(
+      &futex2->Queue.Queue,
+      &lock_context2
+    );
+    _Futex_Queue_release( futex, level, &context.Base );
+    return EAGAIN;
+  }
+
+  if ( requeue_count > INT_MAX - wake_count ) {
+    context.count = INT_MAX;
+  } else {
+    context.count = wake_count + requeue_count;
+  }
+
+  _Thread_queue_Context_set_ISR_level( &context.Base, level );
+  removed = (int) _Thread_queue_Requeue_critical(
+    &futex->Queue.Queue,
+    FUTEX_TQ_OPERATIONS,
+    &futex2->Queue.Queue,
+    FUTEX_TQ_OPERATIONS,
+    &lock_context2,
+    (size_t) wake_count,
+    _Futex_Flush_filter,
+    &context.Base
+  );
+  *count = removed;
+  *woken = removed < wake_count ? removed : wake_count;
+
+  return 0;
+}
+
+int _Futex_Requeue(
+  struct _Futex_Control *_futex,
+  struct _Futex_Control *_futex2,
+  int                    wake_count,
+  int                    requeue_count
+)
+{
+  int count;
+  int woken;
+
+  (void) _Futex_Do_requeue(
+    _futex,
+    _futex2,
+    NULL,
+    0,
+    wake_count,
+    requeue_count,
+    &count,
+    &woken
+  );
+
+  return woken;
+}
+
+int _Futex_Cmp_requeue(
+  struct _Futex_Control *_futex,
+  struct _Futex_Control *_futex2,
+  const int             *uaddr,
+  int                    val,
+  int                    wake_count,
+  int                    requeue_count,
+  int                   *count
+)
+{
+  int woken;
+
+  return _Futex_Do_requeue(
+    _futex,
+    _futex2,
+    uaddr,
+    val,
+    wake_count,
+    requeue_count,
+    count,
+    &woken
+  );
+}
+
+static int _Futex_Sign_extend_12( unsigned int value )
+{
+  return (int) ( ( value ^ 0x800U ) & 0xfffU ) - 0x800;
+}
+
+static bool _Futex_Do_op( int *uaddr, int op, int *oldval )
+{
+  Atomic_Uint  *state;
+  unsigned int  operation;
+  unsigned int  oparg;
+  unsigned int  expected;
+  unsigned int  desired;
+
+  operation = ( (unsigned int) op >> 28 ) & 0xfU;
+  oparg = (unsigned int) _Futex_Sign_extend_12( (unsigned int) op >> 12 );
+
+  if ( ( operation & FUTEX_OP_OPARG_SHIFT ) != 0 ) {
+    operation &= ~(unsigned int) FUTEX_OP_OPARG_SHIFT;
+    oparg = 1U << ( oparg & 31U );
+  }
+
+  if (
+    operation > FUTEX_OP_XOR ||
+      ( ( (unsigned int) op >> 24 ) & 0xfU ) > FUTEX_OP_CMP_GE
+  ) {
+    return false;
+  }
+
+  state = (Atomic_Uint *) uaddr;
+  expected = _Atomic_Load_uint( state, ATOMIC_ORDER_RELAXED );
+
+  do {
+    switch ( operation ) {
+      case FUTEX_OP_SET:
+        desired = oparg;
+        break;
+      case FUTEX_OP_ADD:
+        desired = expected + oparg;
+        break;
+      case FUTEX_OP_OR:
+        desired = expected | oparg;
+        break;
+      case FUTEX_OP_ANDN:
+        desired = expected & ~oparg;
+        break;
+      default:
+        _Assert( operation == FUTEX_OP_XOR );
+        desired = expected ^ oparg;
+        break;
+    }
+  } while (
+    !_Atomic_Compare_exchange_uint(
+      state,
+      &expected,
+      desired,
+      ATOMIC_ORDER_ACQ_REL,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  *oldval = (int) expected;
+  return true;
+}
+
+static bool _Futex_Do_cmp( int oldval, int op )
+{
+  int cmparg;
+
+  cmparg = _Futex_Sign_extend_12( (unsigned int) op );
+
+  switch ( ( (unsigned int) op >> 24 ) & 0xfU ) {
+    case FUTEX_OP_CMP_EQ:
+      return oldval == cmparg;
+    case FUTEX_OP_CMP_NE:
+      return oldval != cmparg;
+    case FUTEX_OP_CMP_LT:
+      return oldval < cmparg;
+    case FUTEX_OP_CMP_LE:
+      return oldval <= cmparg;
+    case FUTEX_OP_CMP_GT:
+      return oldval > cmparg;
+    default:
+      _Assert( ( ( (unsigned int) op >> 24 ) & 0xfU ) == FUTEX_OP_CMP_GE );
+      return oldval >= cmparg;
+  }
+}
+
+int _Futex_Wake_op(
+  struct _Futex_Control *_futex,
+  struct _Futex_Control *_futex2,
+  int                   *uaddr2,
+  int                    wake_count,
+  int                    wake_count2,
+  int                    op,
+  int                   *woken
+)
+{
+  Futex_Control    *futex;
+  Futex_Control    *futex2;
+  ISR_Level         level;
+  Futex_Context     context;
+  ISR_lock_Context  lock_context2;
+  int               oldval;
+  bool              wake2;
+
+  futex = _Futex_Get( _futex );
+  futex2 = _Futex_Get( _futex2 );
+  _Thread_queue_Context_initialize( &context.Base );
+  _Thread_queue_Context_ISR_disable( &context.Base, level );
+
+  if ( futex == futex2 ) {
+    _Futex_Queue_acquire_critical( futex, &context.Base );
+  } else {
+    _Futex_Queue_acquire_two_critical(
+      futex,
+      futex2,
+      &lock_context2,
+      &context.Base
+    );
+  }
+
+  /*
+   * The state of the second futex object is modified while the thread queue
+   * lock of the second futex object is owned.  Threads which check the state
+   * in _Futex_Wait() will either observe the new state or are already
+   * enqueued.
+   */
+  if ( !_Futex_Do_op( uaddr2, op, &oldval ) ) {
+    if ( futex != futex2 ) {
+      _Thread_queue_Queue_release_critical(
+        &futex2->Queue.Queue,
+        &lock_context2
+      );
+    }
+
+    _Futex_Queue_release( futex, level, &context.Base );
+    return ENOSYS;
+  }
+
+  wake2 = _Futex_Do_cmp( oldval, op );
+
+  if ( futex == futex2 ) {
+    wake_count = _Futex_Clamp_count( wake_count );
+    wake_count2 = wake2 ? _Futex_Clamp_count( wake_count2 ) : 0;
+
+    if ( wake_count2 > INT_MAX - wake_count ) {
+      context.count = INT_MAX;
+    } else {
+      context.count = wake_count + wake_count2;
+    }
+
+    wake2 = false;
+  } else {
+    _Thread_queue_Queue_release_critical(
+      &futex2->Queue.Queue,
+      &lock_context2
+    );
+    context.count = wake_count;
+  }
+
+  _Thread_queue_Context_set_ISR_level( &context.Base, level );
+  *woken = (int) _Thread_queue_Flush_critical(
+    &futex->Queue.Queue,
+    FUTEX_TQ_OPERATIONS,
+    _Futex_Flush_filter,
+    &context.Base
+  );
+
+  if ( wake2 ) {
+    *woken += _Futex_Wake( _futex2, wake_count2 );
+  }
+
+  return 0;
+}
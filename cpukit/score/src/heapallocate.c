@@ -218,6 +218,55 @@ static uintptr_t _Heap_Check_block(
   return 0;
 }
 
+static Heap_Block *_Heap_Segregated_first_candidate(
+  Heap_Control *heap,
+  uintptr_t block_size_floor,
+  uintptr_t alignment
+)
+{
+  const Heap_Segregated_index *const index = heap->segregated;
+  Heap_Block *block;
+  unsigned int fl;
+  unsigned int sl;
+
+  if ( alignment == 0 ) {
+    unsigned int const msb = _Heap_Segregated_fls( block_size_floor );
+    uintptr_t good_fit_size = block_size_floor;
+
+    /*
+     * Round up to the next size class boundary.  Each block of the size class
+     * of the rounded up size is large enough, so the first one is taken.
+     */
+    if ( msb > HEAP_SEGREGATED_SL_INDEX_COUNT_LOG2 ) {
+      good_fit_size +=
+        ( (uintptr_t) 1 << ( msb - HEAP_SEGREGATED_SL_INDEX_COUNT_LOG2 ) ) - 1;
+    }
+
+    if ( good_fit_size >= block_size_floor ) {
+      _Heap_Segregated_mapping( good_fit_size, &fl, &sl );
+      block = _Heap_Segregated_search( index, fl, sl );
+
+      if ( block != NULL ) {
+        return block;
+      }
+    }
+  }
+
+  /*
+   * Search the size class of the requested size.  Since the free list is in
+   * ascending size class order, the search may continue with the blocks of
+   * the greater size classes which is necessary for aligned allocations.
+   */
+  _Heap_Segregated_mapping( block_size_floor, &fl, &sl );
+  block = _Heap_Segregated_search( index, fl, sl );
+
+  if ( block == NULL ) {
+    block = _Heap_Free_list_tail( heap );
+  }
+
+  return block;
+}
+
 void *_Heap_Allocate_aligned_with_boundary(
   Heap_Control *heap,
   uintptr_t alloc_size,
@@ -252,7 +301,16 @@ void *_Heap_Allocate_aligned_with_boundary(
   do {
     Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
 
-    block = _Heap_Free_list_first( heap );
+    if ( heap->segregated != NULL ) {
+      block = _Heap_Segregated_first_candidate(
+        heap,
+        block_size_floor,
+        alignment
+      );
+    } else {
+      block = _Heap_Free_list_first( heap );
+    }
+
     while ( block != free_list_tail ) {
       _HAssert( _Heap_Is_prev_used( block ) );
 
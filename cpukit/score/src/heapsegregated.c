@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief This source file contains the implementation of
+ *   _Heap_Enable_segregated_fit(), _Heap_Segregated_insert(), and
+ *   _Heap_Segregated_remove().
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *const index = heap->segregated;
+  Heap_Block *next;
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_mapping( _Heap_Block_size( block ), &fl, &sl );
+  next = index->first[ fl ][ sl ];
+
+  if ( next == NULL ) {
+    /*
+     * The size class is empty.  Insert the block in front of the first block
+     * of the next non-empty size class to keep the free list in ascending size
+     * class order.
+     */
+    next = _Heap_Segregated_search( index, fl, sl + 1 );
+
+    if ( next == NULL ) {
+      next = _Heap_Free_list_tail( heap );
+    }
+
+    index->sl_bitmap[ fl ] |= UINT32_C( 1 ) << sl;
+    index->fl_bitmap |= (uintptr_t) 1 << fl;
+  }
+
+  index->first[ fl ][ sl ] = block;
+  _Heap_Free_list_insert_before( next, block );
+}
+
+void _Heap_Segregated_remove( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *const index = heap->segregated;
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_mapping( _Heap_Block_size( block ), &fl, &sl );
+
+  if ( index->first[ fl ][ sl ] == block ) {
+    Heap_Block *const next = block->next;
+    unsigned int next_fl;
+    unsigned int next_sl;
+
+    if ( next != _Heap_Free_list_tail( heap ) ) {
+      _Heap_Segregated_mapping( _Heap_Block_size( next ), &next_fl, &next_sl );
+    } else {
+      next_fl = HEAP_SEGREGATED_FL_INDEX_COUNT;
+      next_sl = 0;
+    }
+
+    if ( next_fl == fl && next_sl == sl ) {
+      index->first[ fl ][ sl ] = next;
+    } else {
+      index->first[ fl ][ sl ] = NULL;
+      index->sl_bitmap[ fl ] &= ~( UINT32_C( 1 ) << sl );
+
+      if ( index->sl_bitmap[ fl ] == 0 ) {
+        index->fl_bitmap &= ~( (uintptr_t) 1 << fl );
+      }
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+bool _Heap_Enable_segregated_fit( Heap_Control *heap )
+{
+  Heap_Segregated_index *index;
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  Heap_Block *block;
+
+  if ( heap->segregated != NULL ) {
+    return true;
+  }
+
+  index = _Heap_Allocate( heap, sizeof( *index ) );
+
+  if ( index == NULL ) {
+    return false;
+  }
+
+  memset( index, 0, sizeof( *index ) );
+
+  /*
+   * Detach the free blocks from the free list and insert them again according
+   * to their size class.
+   */
+  block = _Heap_Free_list_first( heap );
+  _Heap_Free_list_head( heap )->next = free_list_tail;
+  free_list_tail->prev = _Heap_Free_list_head( heap );
+  heap->segregated = index;
+
+  while ( block != free_list_tail ) {
+    Heap_Block *const next = block->next;
+
+    _Heap_Segregated_insert( heap, block );
+    block = next;
+  }
+
+  return true;
+}
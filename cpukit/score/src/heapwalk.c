@@ -139,6 +139,93 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_segregated_index(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  const Heap_Segregated_index *const index = heap->segregated;
+  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  unsigned int prev_size_class = 0;
+  unsigned int size_class_count = 0;
+  unsigned int bitmap_count = 0;
+  unsigned int fl;
+
+  while ( free_block != free_list_tail ) {
+    unsigned int sl;
+    unsigned int size_class;
+
+    _Heap_Segregated_mapping( _Heap_Block_size( free_block ), &fl, &sl );
+    size_class = fl * HEAP_SEGREGATED_SL_INDEX_COUNT + sl;
+
+    if ( size_class_count > 0 && size_class < prev_size_class ) {
+      (*printer)(
+        source,
+        true,
+        "free block 0x%08x: size class not in ascending order\n",
+        free_block
+      );
+
+      return false;
+    }
+
+    if ( size_class_count == 0 || size_class != prev_size_class ) {
+      if (
+        index->first[ fl ][ sl ] != free_block
+          || ( index->sl_bitmap[ fl ] & ( UINT32_C( 1 ) << sl ) ) == 0
+          || ( index->fl_bitmap & ( (uintptr_t) 1 << fl ) ) == 0
+      ) {
+        (*printer)(
+          source,
+          true,
+          "free block 0x%08x: not the first block of its size class\n",
+          free_block
+        );
+
+        return false;
+      }
+
+      ++size_class_count;
+    }
+
+    prev_size_class = size_class;
+    free_block = free_block->next;
+  }
+
+  for ( fl = 0; fl < HEAP_SEGREGATED_FL_INDEX_COUNT; ++fl ) {
+    bool const fl_bit = ( index->fl_bitmap & ( (uintptr_t) 1 << fl ) ) != 0;
+
+    if ( fl_bit != ( index->sl_bitmap[ fl ] != 0 ) ) {
+      (*printer)(
+        source,
+        true,
+        "segregated index: inconsistent first level bitmap at %u\n",
+        fl
+      );
+
+      return false;
+    }
+
+    bitmap_count += (unsigned int) __builtin_popcount( index->sl_bitmap[ fl ] );
+  }
+
+  if ( bitmap_count != size_class_count ) {
+    (*printer)(
+      source,
+      true,
+      "segregated index: %u size classes in bitmap, %u in free list\n",
+      bitmap_count,
+      size_class_count
+    );
+
+    return false;
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list(
   Heap_Control *heap,
   Heap_Block *block
@@ -256,7 +343,15 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
-  return _Heap_Walk_check_free_list( source, printer, heap );
+  if ( !_Heap_Walk_check_free_list( source, printer, heap ) ) {
+    return false;
+  }
+
+  if ( heap->segregated != NULL ) {
+    return _Heap_Walk_check_segregated_index( source, printer, heap );
+  }
+
+  return true;
 }
 
 static bool _Heap_Walk_check_free_block(
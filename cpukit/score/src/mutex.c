@@ -63,8 +63,6 @@
  * the objects allocator lock (see ::API_Mutex_Control).
  */
 
-#define MUTEX_TQ_OPERATIONS &_Thread_queue_Operations_priority_inherit
-
 RTEMS_STATIC_ASSERT(
   offsetof( Mutex_Control, Queue )
     == offsetof( struct _Mutex_Control, _Queue ),
@@ -125,14 +125,15 @@ Objects_Maximum _Objects_Extend_information(
    *  Do we need to grow the tables?
    */
   if ( do_extend ) {
-    ISR_lock_Context  lock_context;
-    Objects_Control **object_blocks;
-    Objects_Control **local_table;
-    Objects_Maximum  *inactive_per_block;
-    void             *old_tables;
-    size_t            table_size;
-    uintptr_t         object_blocks_size;
-    uintptr_t         local_table_size;
+    ISR_lock_Context    lock_context;
+    Objects_Control   **object_blocks;
+    Objects_Control   **local_table;
+    Objects_Maximum    *inactive_per_block;
+    Objects_Name_index *new_name_index;
+    void               *old_tables;
+    size_t              table_size;
+    uintptr_t           object_blocks_size;
+    uintptr_t           local_table_size;
 
     /*
      *  Growing the tables means allocating a new area, doing a copy and
@@ -170,6 +171,19 @@ Objects_Maximum _Objects_Extend_information(
       return 0;
     }
 
+    if ( information->name_index != NULL ) {
+      new_name_index = _Objects_Name_index_allocate(
+        (Objects_Maximum) new_maximum
+      );
+      if ( new_name_index == NULL ) {
+        _Workspace_Free( object_blocks );
+        _Workspace_Free( new_object_block );
+        return 0;
+      }
+    } else {
+      new_name_index = NULL;
+    }
+
     /*
      *  Break the block into the various sections.
      */
@@ -247,6 +261,10 @@ Objects_Maximum _Objects_Extend_information(
 
     _Workspace_Free( old_tables );
 
+    if ( new_name_index != NULL ) {
+      _Objects_Name_index_replace( information, new_name_index );
+    }
+
     block_count++;
   }
 
@@ -92,4 +92,8 @@ void _Objects_Initialize_information(
 
   current->next = tail;
   tail->previous = current;
+
+  if ( _Objects_Name_index_is_enabled ) {
+    _Objects_Name_index_initialize( information );
+  }
 }
@@ -0,0 +1,530 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreObject
+ *
+ * @brief This source file contains the implementation of the object name
+ *   index.
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/interr.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+static uint32_t _Objects_Name_index_hash_u32( uint32_t name )
+{
+  /* The high order bits are used to select the home slot */
+  return name * 0x9e3779b1U;
+}
+
+static uint32_t _Objects_Name_index_hash_string(
+  const char *name,
+  size_t      name_length
+)
+{
+  uint32_t hash;
+  size_t   i;
+
+  /* FNV-1a */
+  hash = 0x811c9dc5U;
+
+  for ( i = 0; i < name_length; ++i ) {
+    hash ^= (unsigned char) name[ i ];
+    hash *= 0x01000193U;
+  }
+
+  return _Objects_Name_index_hash_u32( hash );
+}
+
+static uint32_t _Objects_Name_index_hash_object(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  if ( _Objects_Has_string_name( information ) ) {
+    const char *name;
+
+    name = the_object->name.name_p;
+
+    if ( name == NULL ) {
+      return 0;
+    }
+
+    return _Objects_Name_index_hash_string(
+      name,
+      strnlen( name, information->name_length )
+    );
+  }
+
+  return _Objects_Name_index_hash_u32( the_object->name.name_u32 );
+}
+
+static bool _Objects_Name_index_has_name(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  if ( _Objects_Has_string_name( information ) ) {
+    return the_object->name.name_p != NULL;
+  }
+
+  return the_object->name.name_u32 != 0;
+}
+
+static uint32_t _Objects_Name_index_home(
+  const Objects_Name_index *name_index,
+  uint32_t                  hash
+)
+{
+  return (uint32_t) ( ( (uint64_t) hash * name_index->size ) >> 32 );
+}
+
+static uint32_t _Objects_Name_index_next(
+  const Objects_Name_index *name_index,
+  uint32_t                  slot
+)
+{
+  ++slot;
+
+  if ( slot == name_index->size ) {
+    slot = 0;
+  }
+
+  return slot;
+}
+
+static void _Objects_Name_index_modify_begin( Objects_Name_index *name_index )
+{
+  unsigned int sequence;
+
+  sequence = _Atomic_Load_uint( &name_index->sequence, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint(
+    &name_index->sequence,
+    sequence + 1,
+    ATOMIC_ORDER_RELAXED
+  );
+  _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+}
+
+static void _Objects_Name_index_modify_end( Objects_Name_index *name_index )
+{
+  unsigned int sequence;
+
+  sequence = _Atomic_Load_uint( &name_index->sequence, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint(
+    &name_index->sequence,
+    sequence + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
+static void _Objects_Name_index_do_insert(
+  Objects_Name_index *name_index,
+  uint32_t            hash,
+  Objects_Maximum     index
+)
+{
+  uint32_t slot;
+
+  slot = _Objects_Name_index_home( name_index, hash );
+
+  while ( name_index->slots[ slot ].index != 0 ) {
+    slot = _Objects_Name_index_next( name_index, slot );
+  }
+
+  name_index->slots[ slot ].hash = hash;
+  name_index->slots[ slot ].index = index;
+}
+
+Objects_Name_index *_Objects_Name_index_allocate( Objects_Maximum maximum )
+{
+  Objects_Name_index *name_index;
+  size_t              size;
+
+  size = OBJECTS_NAME_INDEX_SIZE( maximum );
+  name_index = _Workspace_Allocate( size );
+
+  if ( name_index == NULL ) {
+    return NULL;
+  }
+
+  memset( name_index, 0, size );
+  _Atomic_Init_uint( &name_index->sequence, 0 );
+  name_index->size = 2 * (uint32_t) maximum;
+
+  return name_index;
+}
+
+static void _Objects_Name_index_fill(
+  const Objects_Information *information,
+  Objects_Name_index        *name_index
+)
+{
+  Objects_Maximum maximum;
+  Objects_Maximum index;
+
+  maximum = _Objects_Get_maximum_index( information );
+  _Assert( name_index->size == 2 * (uint32_t) maximum );
+
+  for ( index = 0; index < maximum; ++index ) {
+    const Objects_Control *the_object;
+
+    the_object = information->local_table[ index ];
+
+    if (
+      the_object != NULL
+        && _Objects_Name_index_has_name( information, the_object )
+    ) {
+      _Objects_Name_index_do_insert(
+        name_index,
+        _Objects_Name_index_hash_object( information, the_object ),
+        index + OBJECTS_INDEX_MINIMUM
+      );
+    }
+  }
+}
+
+void _Objects_Name_index_initialize( Objects_Information *information )
+{
+  Objects_Name_index *name_index;
+  Objects_Maximum     maximum;
+
+  maximum = _Objects_Get_maximum_index( information );
+
+  if ( maximum == 0 ) {
+    return;
+  }
+
+  if (
+    _Objects_Get_API( information->maximum_id ) != OBJECTS_CLASSIC_API
+      && !_Objects_Has_string_name( information )
+  ) {
+    return;
+  }
+
+  name_index = _Objects_Name_index_allocate( maximum );
+
+  if ( name_index == NULL ) {
+    _Internal_error( INTERNAL_ERROR_TOO_LITTLE_WORKSPACE );
+  }
+
+  _Objects_Name_index_fill( information, name_index );
+  information->name_index = name_index;
+}
+
+void _Objects_Name_index_replace(
+  Objects_Information *information,
+  Objects_Name_index  *name_index
+)
+{
+  Objects_Name_index *old_name_index;
+
+  _Objects_Name_index_fill( information, name_index );
+  old_name_index = information->name_index;
+  _Assert( old_name_index != NULL );
+
+  /*
+   * Lookups without the allocator lock pin the name index which they use, see
+   * _Objects_Name_index_find_u32().  They disable thread dispatching, so on
+   * uniprocessor configurations no lookup can use the old name index at this
+   * point.  On SMP configurations, wait until all lookups which may have
+   * loaded the old name index are done.  Lookups which start after the
+   * publication of the new name index do not use the old one.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+  information->name_index = name_index;
+
+#if defined(RTEMS_SMP)
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  while (
+    _Atomic_Load_uint(
+      &information->name_index_readers,
+      ATOMIC_ORDER_ACQUIRE
+    ) != 0
+  ) {
+    /* Wait */
+  }
+#endif
+
+  _Workspace_Free( old_name_index );
+}
+
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  Objects_Name_index *name_index;
+
+  if ( !_Objects_Name_index_has_name( information, the_object ) ) {
+    return;
+  }
+
+  name_index = information->name_index;
+  _Objects_Name_index_modify_begin( name_index );
+  _Objects_Name_index_do_insert(
+    name_index,
+    _Objects_Name_index_hash_object( information, the_object ),
+    _Objects_Get_index( the_object->id )
+  );
+  _Objects_Name_index_modify_end( name_index );
+}
+
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  Objects_Name_index *name_index;
+  Objects_Maximum     index;
+  uint32_t            hash;
+  uint32_t            hole;
+  uint32_t            slot;
+
+  if ( !_Objects_Name_index_has_name( information, the_object ) ) {
+    return;
+  }
+
+  name_index = information->name_index;
+  index = _Objects_Get_index( the_object->id );
+  hash = _Objects_Name_index_hash_object( information, the_object );
+  hole = _Objects_Name_index_home( name_index, hash );
+
+  while ( name_index->slots[ hole ].index != index ) {
+    if ( name_index->slots[ hole ].index == 0 ) {
+      return;
+    }
+
+    hole = _Objects_Name_index_next( name_index, hole );
+  }
+
+  _Objects_Name_index_modify_begin( name_index );
+
+  /*
+   * Move the following entries of the cluster to the hole, so that no entry is
+   * separated from its home slot by an empty slot.
+   */
+  slot = hole;
+
+  while ( true ) {
+    uint32_t home;
+
+    slot = _Objects_Name_index_next( name_index, slot );
+
+    if ( name_index->slots[ slot ].index == 0 ) {
+      break;
+    }
+
+    home = _Objects_Name_index_home(
+      name_index,
+      name_index->slots[ slot ].hash
+    );
+
+    if (
+      hole <= slot ? ( hole < home && home <= slot )
+        : ( hole < home || home <= slot )
+    ) {
+      continue;
+    }
+
+    name_index->slots[ hole ] = name_index->slots[ slot ];
+    hole = slot;
+  }
+
+  name_index->slots[ hole ].index = 0;
+  _Objects_Name_index_modify_end( name_index );
+}
+
+static bool _Objects_Name_index_do_find_u32(
+  const Objects_Information  *information,
+  const Objects_Name_index   *name_index,
+  uint32_t                    name,
+  Objects_Control           **the_object
+)
+{
+  Objects_Control *found;
+  Objects_Maximum  maximum;
+  unsigned int     sequence;
+  uint32_t         hash;
+  uint32_t         slot;
+  uint32_t         count;
+
+  sequence = _Atomic_Load_uint( &name_index->sequence, ATOMIC_ORDER_ACQUIRE );
+
+  if ( ( sequence & 1 ) != 0 ) {
+    return false;
+  }
+
+  found = NULL;
+  maximum = _Objects_Get_maximum_index( information );
+  hash = _Objects_Name_index_hash_u32( name );
+  slot = _Objects_Name_index_home( name_index, hash );
+
+  /*
+   * The count limits the search in case of concurrent modifications.  We have
+   * to search the entire cluster to get the object with the lowest index.
+   */
+  for ( count = 0; count < name_index->size; ++count ) {
+    Objects_Maximum index;
+
+    index = name_index->slots[ slot ].index;
+
+    if ( index == 0 ) {
+      break;
+    }
+
+    if ( name_index->slots[ slot ].hash == hash && index <= maximum ) {
+      Objects_Control *candidate;
+
+      candidate = information->local_table[ index - OBJECTS_INDEX_MINIMUM ];
+
+      if (
+        candidate != NULL
+          && candidate->name.name_u32 == name
+          && ( found == NULL || candidate->id < found->id )
+      ) {
+        found = candidate;
+      }
+    }
+
+    slot = _Objects_Name_index_next( name_index, slot );
+  }
+
+  _Atomic_Fence( ATOMIC_ORDER_ACQUIRE );
+
+  if (
+    _Atomic_Load_uint( &name_index->sequence, ATOMIC_ORDER_RELAXED )
+      != sequence
+  ) {
+    return false;
+  }
+
+  *the_object = found;
+  return true;
+}
+
+bool _Objects_Name_index_find_u32(
+  const Objects_Information  *information,
+  uint32_t                    name,
+  Objects_Control           **the_object
+)
+{
+  Per_CPU_Control *cpu_self;
+  bool             valid;
+#if defined(RTEMS_SMP)
+  Atomic_Uint     *readers;
+
+  readers = &RTEMS_DECONST(
+    Objects_Information *,
+    information
+  )->name_index_readers;
+#endif
+
+  /* Pin the name index, see _Objects_Name_index_replace() */
+  cpu_self = _Thread_Dispatch_disable();
+#if defined(RTEMS_SMP)
+  _Atomic_Fetch_add_uint( readers, 1, ATOMIC_ORDER_RELAXED );
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+#endif
+
+  valid = _Objects_Name_index_do_find_u32(
+    information,
+    information->name_index,
+    name,
+    the_object
+  );
+
+#if defined(RTEMS_SMP)
+  _Atomic_Fetch_sub_uint( readers, 1, ATOMIC_ORDER_RELEASE );
+#endif
+  _Thread_Dispatch_enable( cpu_self );
+
+  return valid;
+}
+
+Objects_Control *_Objects_Name_index_find_string(
+  const Objects_Information *information,
+  const char                *name,
+  size_t                     name_length
+)
+{
+  const Objects_Name_index *name_index;
+  Objects_Control          *found;
+  uint32_t                  hash;
+  uint32_t                  slot;
+
+  _Assert( _Objects_Allocator_is_owner() );
+
+  name_index = information->name_index;
+  found = NULL;
+  hash = _Objects_Name_index_hash_string( name, name_length );
+  slot = _Objects_Name_index_home( name_index, hash );
+
+  while ( true ) {
+    Objects_Maximum index;
+
+    index = name_index->slots[ slot ].index;
+
+    if ( index == 0 ) {
+      break;
+    }
+
+    if ( name_index->slots[ slot ].hash == hash ) {
+      Objects_Control *candidate;
+
+      candidate = information->local_table[ index - OBJECTS_INDEX_MINIMUM ];
+
+      if (
+        candidate != NULL
+          && candidate->name.name_p != NULL
+          && strncmp(
+            name,
+            candidate->name.name_p,
+            information->name_length
+          ) == 0
+          && ( found == NULL || candidate->id < found->id )
+      ) {
+        found = candidate;
+      }
+    }
+
+    slot = _Objects_Name_index_next( name_index, slot );
+  }
+
+  return found;
+}
@@ -46,6 +46,37 @@ static bool _Objects_Is_local_node_search( uint32_t node )
   return node == OBJECTS_SEARCH_LOCAL_NODE || _Objects_Is_local_node( node );
 }
 
+static const Objects_Control *_Objects_Search_local_u32(
+  uint32_t                   name,
+  const Objects_Information *information
+)
+{
+  Objects_Maximum maximum;
+  Objects_Maximum index;
+
+  if ( information->name_index != NULL ) {
+    Objects_Control *the_object;
+
+    if ( _Objects_Name_index_find_u32( information, name, &the_object ) ) {
+      return the_object;
+    }
+  }
+
+  maximum = _Objects_Get_maximum_index( information );
+
+  for ( index = 0; index < maximum; ++index ) {
+    const Objects_Control *the_object;
+
+    the_object = information->local_table[ index ];
+
+    if ( the_object != NULL && name == the_object->name.name_u32 ) {
+      return the_object;
+    }
+  }
+
+  return NULL;
+}
+
 Status_Control _Objects_Name_to_id_u32(
   uint32_t                   name,
   uint32_t                   node,
@@ -67,21 +98,14 @@ Status_Control _Objects_Name_to_id_u32(
     node == OBJECTS_SEARCH_ALL_NODES ||
     _Objects_Is_local_node_search( node )
   ) {
-    Objects_Maximum maximum;
-    Objects_Maximum index;
-
-    maximum = _Objects_Get_maximum_index( information );
-
-    for ( index = 0; index < maximum; ++index ) {
-      const Objects_Control *the_object;
+    const Objects_Control *the_object;
 
-      the_object = information->local_table[ index ];
+    the_object = _Objects_Search_local_u32( name, information );
 
-      if ( the_object != NULL && name == the_object->name.name_u32 ) {
-        *id = the_object->id;
-        _Assert( name != 0 );
-        return STATUS_SUCCESSFUL;
-      }
+    if ( the_object != NULL ) {
+      *id = the_object->id;
+      _Assert( name != 0 );
+      return STATUS_SUCCESSFUL;
     }
   }
 
@@ -50,6 +50,17 @@ Status_Control _Objects_Set_name(
   const char                *name
 )
 {
+  bool is_indexed;
+
+  /*
+   * Only objects in the local table are in the name index, see
+   * _Objects_Open_u32() and _Objects_Open_string().
+   */
+  is_indexed = information->name_index != NULL
+    && information->local_table[
+      _Objects_Get_index( the_object->id ) - OBJECTS_INDEX_MINIMUM
+    ] == the_object;
+
   if ( _Objects_Has_string_name( information ) ) {
     size_t  length;
     char   *dup;
@@ -60,6 +71,10 @@ Status_Control _Objects_Set_name(
       return STATUS_NO_MEMORY;
     }
 
+    if ( is_indexed ) {
+      _Objects_Name_index_remove( information, the_object );
+    }
+
     _Workspace_Free( RTEMS_DECONST( char *, the_object->name.name_p ) );
     the_object->name.name_p = dup;
   } else {
@@ -76,9 +91,17 @@ Status_Control _Objects_Set_name(
       c[ i ] = name[ i ];
     }
 
+    if ( is_indexed ) {
+      _Objects_Name_index_remove( information, the_object );
+    }
+
     the_object->name.name_u32 =
       _Objects_Build_name( c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ] );
   }
 
+  if ( is_indexed ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
+
   return STATUS_SUCCESSFUL;
 }
@@ -6,8 +6,9 @@
  * @ingroup RTEMSScorePerCPU
  *
  * @brief This source file contains the implementation of _Per_CPU_Add_job(),
- *   _Per_CPU_Perform_jobs(), _Per_CPU_Submit_job(), and
- *   _Per_CPU_Wait_for_job().
+ *   _Per_CPU_Add_job_to_batch(), _Per_CPU_Initialize_job_batch(),
+ *   _Per_CPU_Perform_jobs(), _Per_CPU_Submit_job(),
+ *   _Per_CPU_Submit_job_batch(), and _Per_CPU_Wait_for_job().
  */
 
 /*
@@ -71,6 +72,21 @@ void _Per_CPU_Perform_jobs( Per_CPU_Control *cpu )
   }
 }
 
+static void _Per_CPU_Append_jobs(
+  Per_CPU_Control  *cpu,
+  Per_CPU_Job      *head,
+  Per_CPU_Job     **tail
+)
+{
+  if ( cpu->Jobs.head == NULL ) {
+    cpu->Jobs.head = head;
+  } else {
+    *cpu->Jobs.tail = head;
+  }
+
+  cpu->Jobs.tail = tail;
+}
+
 void _Per_CPU_Add_job( Per_CPU_Control *cpu, Per_CPU_Job *job )
 {
   ISR_lock_Context lock_context;
@@ -81,15 +97,7 @@ void _Per_CPU_Add_job( Per_CPU_Control *cpu, Per_CPU_Job *job )
   _Assert( job->next == NULL );
 
   _Per_CPU_Jobs_ISR_disable_and_acquire( cpu, &lock_context );
-
-  if ( cpu->Jobs.head == NULL ) {
-    cpu->Jobs.head = job;
-  } else {
-    *cpu->Jobs.tail = job;
-  }
-
-  cpu->Jobs.tail = &job->next;
-
+  _Per_CPU_Append_jobs( cpu, job, &job->next );
   _Per_CPU_Jobs_release_and_ISR_enable( cpu, &lock_context );
 }
 
@@ -99,15 +107,78 @@ void _Per_CPU_Submit_job( Per_CPU_Control *cpu, Per_CPU_Job *job )
   _SMP_Send_message( cpu, SMP_MESSAGE_PERFORM_JOBS );
 }
 
+void _Per_CPU_Initialize_job_batch( Per_CPU_Job_batch *batch )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+  _Assert( cpu_max <= RTEMS_ARRAY_SIZE( batch->Jobs ) );
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    batch->Jobs[ cpu_index ].head = NULL;
+  }
+}
+
+void _Per_CPU_Add_job_to_batch(
+  Per_CPU_Job_batch     *batch,
+  const Per_CPU_Control *cpu,
+  Per_CPU_Job           *job
+)
+{
+  uint32_t cpu_index;
+
+  _Assert( job->context != NULL && job->context->handler != NULL );
+
+  _Atomic_Store_ulong( &job->done, 0, ATOMIC_ORDER_RELAXED );
+  _Assert( job->next == NULL );
+
+  cpu_index = _Per_CPU_Get_index( cpu );
+  _Assert( cpu_index < _SMP_Get_processor_maximum() );
+
+  if ( batch->Jobs[ cpu_index ].head == NULL ) {
+    batch->Jobs[ cpu_index ].head = job;
+  } else {
+    *batch->Jobs[ cpu_index ].tail = job;
+  }
+
+  batch->Jobs[ cpu_index ].tail = &job->next;
+}
+
+void _Per_CPU_Submit_job_batch( Per_CPU_Job_batch *batch )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Job *head;
+
+    head = batch->Jobs[ cpu_index ].head;
+
+    if ( head != NULL ) {
+      Per_CPU_Control  *cpu;
+      ISR_lock_Context  lock_context;
+
+      batch->Jobs[ cpu_index ].head = NULL;
+      cpu = _Per_CPU_Get_by_index( cpu_index );
+
+      _Per_CPU_Jobs_ISR_disable_and_acquire( cpu, &lock_context );
+      _Per_CPU_Append_jobs( cpu, head, batch->Jobs[ cpu_index ].tail );
+      _Per_CPU_Jobs_release_and_ISR_enable( cpu, &lock_context );
+
+      _SMP_Send_message( cpu, SMP_MESSAGE_PERFORM_JOBS );
+    }
+  }
+}
+
 void _Per_CPU_Wait_for_job(
   const Per_CPU_Control *cpu,
   const Per_CPU_Job     *job
 )
 {
-  while (
-    _Atomic_Load_ulong( &job->done, ATOMIC_ORDER_ACQUIRE )
-      != PER_CPU_JOB_DONE
-  ) {
+  while ( !_Per_CPU_Is_job_done( job ) ) {
     Per_CPU_Control *cpu_self;
 
     switch ( _Per_CPU_Get_state( cpu ) ) {
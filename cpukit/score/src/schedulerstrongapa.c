@@ -9,6 +9,7 @@
  *   _Scheduler_strong_APA_Add_processor(),
  *   _Scheduler_strong_APA_Allocate_processor(),
  *   _Scheduler_strong_APA_Ask_for_help(), _Scheduler_strong_APA_Block(),
+ *   _Scheduler_strong_APA_Count_ready(),
  *   _Scheduler_strong_APA_Do_ask_for_help(),
  *   _Scheduler_strong_APA_Do_enqueue(),
  *   _Scheduler_strong_APA_Do_set_affinity(),
@@ -17,6 +18,7 @@
  *   _Scheduler_strong_APA_Extract_from_ready(),
  *   _Scheduler_strong_APA_Extract_from_scheduled(),
  *   _Scheduler_strong_APA_Find_highest_ready(),
+ *   _Scheduler_strong_APA_First_ready(),
  *   _Scheduler_strong_APA_Get_highest_ready(),
  *   _Scheduler_strong_APA_Get_lowest_reachable(),
  *   _Scheduler_strong_APA_Get_lowest_scheduled(),
@@ -24,11 +26,15 @@
  *   _Scheduler_strong_APA_Initialize(), _Scheduler_strong_APA_Insert_ready(),
  *   _Scheduler_strong_APA_Move_from_ready_to_scheduled(),
  *   _Scheduler_strong_APA_Move_from_scheduled_to_ready(),
+ *   _Scheduler_strong_APA_Next_priority(),
  *   _Scheduler_strong_APA_Node_initialize(),
+ *   _Scheduler_strong_APA_Ready_append(),
+ *   _Scheduler_strong_APA_Ready_extract(),
  *   _Scheduler_strong_APA_Reconsider_help_request(),
  *   _Scheduler_strong_APA_Register_idle(),
  *   _Scheduler_strong_APA_Remove_processor(),
  *   _Scheduler_strong_APA_Set_affinity(),
+ *   _Scheduler_strong_APA_Set_node_affinity(),
  *   _Scheduler_strong_APA_Set_scheduled(), _Scheduler_strong_APA_Start_idle(),
  *   _Scheduler_strong_APA_Unblock(), _Scheduler_strong_APA_Update_priority(),
  *   _Scheduler_strong_APA_Withdraw_node(),
@@ -68,6 +74,7 @@
 
 #include <rtems/score/schedulerstrongapa.h>
 #include <rtems/score/schedulersmpimpl.h>
+#include <rtems/score/prioritybitmapimpl.h>
 #include <rtems/score/assert.h>
 
 #define STRONG_SCHEDULER_NODE_OF_CHAIN( node ) \
@@ -105,38 +112,231 @@ static inline void _Scheduler_strong_APA_Do_update(
 }
 
 /*
- * Returns true if the Strong APA scheduler has ready nodes
- * available for scheduling.
+ * Updates the per-CPU ready counts and bit maps for all processors in the
+ * affinity set of the node.
  */
-static inline bool _Scheduler_strong_APA_Has_ready(
-  Scheduler_Context *context
+static inline void _Scheduler_strong_APA_Count_ready(
+  Scheduler_strong_APA_Context *self,
+  Scheduler_strong_APA_Node    *node,
+  bool                          add
 )
 {
-  Scheduler_strong_APA_Context *self;
-  const Chain_Node             *tail;
-  Chain_Node                   *next;
-  Scheduler_strong_APA_Node    *node;
+  uint32_t     cpu_max;
+  uint32_t     cpu_index;
+  unsigned int priority;
 
-  self = _Scheduler_strong_APA_Get_self( context );
-  tail = _Chain_Immutable_tail( &self->Ready );
-  next = _Chain_First( &self->Ready );
+  cpu_max = _SMP_Get_processor_maximum();
+  priority = node->ready_priority;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &node->Affinity, cpu_index ) ) {
+      Scheduler_strong_APA_CPU     *CPU;
+      Priority_bit_map_Information  bit_map_info;
+
+      CPU = &self->CPU[ cpu_index ];
+      _Priority_bit_map_Initialize_information(
+        &CPU->Ready_bit_map,
+        &bit_map_info,
+        priority
+      );
+
+      if ( add ) {
+        if ( CPU->ready_count[ priority ]++ == 0 ) {
+          _Priority_bit_map_Add( &CPU->Ready_bit_map, &bit_map_info );
+        }
+      } else {
+        _Assert( CPU->ready_count[ priority ] > 0 );
+
+        if ( --CPU->ready_count[ priority ] == 0 ) {
+          _Priority_bit_map_Remove( &CPU->Ready_bit_map, &bit_map_info );
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Appends the node to the Ready chain of its priority.
+ */
+static inline void _Scheduler_strong_APA_Ready_append(
+  Scheduler_strong_APA_Context *self,
+  Scheduler_strong_APA_Node    *node,
+  Priority_Control              insert_priority
+)
+{
+  unsigned int                 priority;
+  Chain_Control               *ready;
+  Priority_bit_map_Information bit_map_info;
+
+  priority = (unsigned int) SCHEDULER_PRIORITY_UNMAP( insert_priority );
+  _Assert( priority <= SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY );
+
+  node->ready_priority = priority;
+  ready = &self->Ready[ priority ];
+
+  if ( _Chain_Is_empty( ready ) ) {
+    _Priority_bit_map_Initialize_information(
+      &self->Bit_map,
+      &bit_map_info,
+      priority
+    );
+    _Priority_bit_map_Add( &self->Bit_map, &bit_map_info );
+  }
+
+  _Chain_Append_unprotected( ready, &node->Ready_node );
+  _Scheduler_strong_APA_Count_ready( self, node, true );
+}
+
+/*
+ * Extracts the node from the Ready chain of its priority.
+ */
+static inline void _Scheduler_strong_APA_Ready_extract(
+  Scheduler_strong_APA_Context *self,
+  Scheduler_strong_APA_Node    *node
+)
+{
+  unsigned int                 priority;
+  Priority_bit_map_Information bit_map_info;
+
+  priority = node->ready_priority;
+
+  _Chain_Extract_unprotected( &node->Ready_node );
+  _Chain_Set_off_chain( &node->Ready_node );
+
+  if ( _Chain_Is_empty( &self->Ready[ priority ] ) ) {
+    _Priority_bit_map_Initialize_information(
+      &self->Bit_map,
+      &bit_map_info,
+      priority
+    );
+    _Priority_bit_map_Remove( &self->Bit_map, &bit_map_info );
+  }
+
+  _Scheduler_strong_APA_Count_ready( self, node, false );
+}
+
+/*
+ * Removes the highest priority from the bit map and returns it.  Returns
+ * false if the bit map is empty.
+ */
+static inline bool _Scheduler_strong_APA_Next_priority(
+  Priority_bit_map_Control *bit_map,
+  unsigned int             *priority
+)
+{
+  Priority_bit_map_Information bit_map_info;
+
+  if ( _Priority_bit_map_Is_empty( bit_map ) ) {
+    return false;
+  }
+
+  *priority = _Priority_bit_map_Get_highest( bit_map );
+  _Priority_bit_map_Initialize_information( bit_map, &bit_map_info, *priority );
+  _Priority_bit_map_Remove( bit_map, &bit_map_info );
+  return true;
+}
+
+/*
+ * Returns the first ready node of the priority which has the CPU in its
+ * affinity set, or NULL if there is no such node.
+ */
+static inline Scheduler_strong_APA_Node *_Scheduler_strong_APA_First_ready(
+  Scheduler_strong_APA_Context *self,
+  unsigned int                  priority,
+  uint32_t                      cpu_index
+)
+{
+  const Chain_Node          *tail;
+  Chain_Node                *next;
+  Scheduler_strong_APA_Node *node;
+
+  tail = _Chain_Immutable_tail( &self->Ready[ priority ] );
+  next = _Chain_First( &self->Ready[ priority ] );
 
   while ( next != tail ) {
     node = (Scheduler_strong_APA_Node *)STRONG_SCHEDULER_NODE_OF_CHAIN( next );
 
     if (
       _Scheduler_SMP_Node_state( &node->Base.Base ) ==
-      SCHEDULER_SMP_NODE_READY
+        SCHEDULER_SMP_NODE_READY &&
+      _Processor_mask_Is_set( &node->Affinity, cpu_index )
     ) {
-      return true;
+      return node;
     }
 
     next = _Chain_Next( next );
   }
 
+  return NULL;
+}
+
+/*
+ * Returns true if the Strong APA scheduler has ready nodes
+ * available for scheduling.  The Ready chains contain at most one scheduled
+ * node for each processor, so the search is bounded by the processor count.
+ */
+static inline bool _Scheduler_strong_APA_Has_ready(
+  Scheduler_Context *context
+)
+{
+  Scheduler_strong_APA_Context *self;
+  Priority_bit_map_Control      bit_map;
+  unsigned int                  priority;
+
+  self = _Scheduler_strong_APA_Get_self( context );
+  bit_map = self->Bit_map;
+
+  while ( _Scheduler_strong_APA_Next_priority( &bit_map, &priority ) ) {
+    const Chain_Node *tail;
+    Chain_Node       *next;
+
+    tail = _Chain_Immutable_tail( &self->Ready[ priority ] );
+    next = _Chain_First( &self->Ready[ priority ] );
+
+    while ( next != tail ) {
+      Scheduler_strong_APA_Node *node;
+
+      node = (Scheduler_strong_APA_Node *)STRONG_SCHEDULER_NODE_OF_CHAIN( next );
+
+      if (
+        _Scheduler_SMP_Node_state( &node->Base.Base ) ==
+        SCHEDULER_SMP_NODE_READY
+      ) {
+        return true;
+      }
+
+      next = _Chain_Next( next );
+    }
+  }
+
   return false;
 }
 
+/*
+ * Updates the affinity set of the node and the per-CPU ready counts if the
+ * node is in a Ready chain.
+ */
+static inline void _Scheduler_strong_APA_Set_node_affinity(
+  Scheduler_strong_APA_Context *self,
+  Scheduler_strong_APA_Node    *node,
+  const Processor_mask         *affinity
+)
+{
+  bool is_ready;
+
+  is_ready = !_Chain_Is_node_off_chain( &node->Ready_node );
+
+  if ( is_ready ) {
+    _Scheduler_strong_APA_Count_ready( self, node, false );
+  }
+
+  _Processor_mask_Assign( &node->Affinity, affinity );
+
+  if ( is_ready ) {
+    _Scheduler_strong_APA_Count_ready( self, node, true );
+  }
+}
+
 static inline void _Scheduler_strong_APA_Set_scheduled(
   Scheduler_strong_APA_Context *self,
   Scheduler_Node                *executing,
@@ -178,6 +378,12 @@ static inline void _Scheduler_strong_APA_Allocate_processor(
 /*
  * Finds and returns the highest ready node present by accessing the
  * _Strong_APA_Context->CPU with front and rear values.
+ *
+ * First, the queue is extended by the processors of the scheduled nodes (at
+ * most one for each processor) which can move to a processor in the queue.
+ * Second, the priorities which have a node with a processor of the queue in
+ * its affinity set are visited in order.  At the first such priority with a
+ * ready node, the node of the first processor in the queue order is selected.
  */
 static inline Scheduler_Node * _Scheduler_strong_APA_Find_highest_ready(
   Scheduler_strong_APA_Context *self,
@@ -185,124 +391,147 @@ static inline Scheduler_Node * _Scheduler_strong_APA_Find_highest_ready(
   uint32_t                      rear
 )
 {
-  Scheduler_Node              *highest_ready = NULL;
   Scheduler_strong_APA_CPU    *CPU;
+  Scheduler_strong_APA_Node   *node;
+  Priority_bit_map_Control     bit_map;
   const Chain_Node            *tail;
   Chain_Node                  *next;
-  Scheduler_strong_APA_Node   *node;
-  Priority_Control             min_priority_num;
-  Priority_Control             curr_priority;
   Per_CPU_Control             *assigned_cpu;
-  Scheduler_SMP_Node_state     curr_state;
   Per_CPU_Control             *curr_CPU;
+  uint32_t                     curr_index;
+  uint32_t                     queue_index;
+  unsigned int                 priority;
+  unsigned int                 word;
 
   CPU = self->CPU;
-  /*
-   * When the first task accessed has nothing to compare its priority against.
-   * So, it is the task with the highest priority witnessed so far.
-   */
-  min_priority_num = UINT64_MAX;
+  _Priority_bit_map_Initialize( &bit_map );
 
-  while ( front <= rear ) {
-    curr_CPU = CPU[ front++ ].cpu;
+  for ( queue_index = front; queue_index <= rear; ++queue_index ) {
+    curr_CPU = CPU[ queue_index ].cpu;
+    curr_index = _Per_CPU_Get_index( curr_CPU );
 
-    tail = _Chain_Immutable_tail( &self->Ready );
-    next = _Chain_First( &self->Ready );
+    tail = _Chain_Immutable_tail( &self->Base.Scheduled );
+    next = _Chain_First( &self->Base.Scheduled );
 
     while ( next != tail ) {
-      node = (Scheduler_strong_APA_Node*) STRONG_SCHEDULER_NODE_OF_CHAIN( next );
+      Scheduler_Node *scheduled;
+
+      scheduled = (Scheduler_Node *) next;
+      next = _Chain_Next( next );
+      node = _Scheduler_strong_APA_Node_downcast( scheduled );
+
       /*
-       * Check if the curr_CPU is in the affinity set of the node.
+       * Check if the curr_CPU is in the affinity set of the scheduled node.
        */
       if (
-        _Processor_mask_Is_set( &node->Affinity, _Per_CPU_Get_index( curr_CPU ) )
+        _Chain_Is_node_off_chain( &node->Ready_node ) ||
+        _Scheduler_SMP_Node_state( scheduled ) !=
+          SCHEDULER_SMP_NODE_SCHEDULED ||
+        !_Processor_mask_Is_set( &node->Affinity, curr_index )
       ) {
-        curr_state = _Scheduler_SMP_Node_state( &node->Base.Base );
-
-        if ( curr_state == SCHEDULER_SMP_NODE_SCHEDULED ) {
-          assigned_cpu = _Thread_Get_CPU( node->Base.Base.user );
-
-          if ( CPU[ _Per_CPU_Get_index( assigned_cpu ) ].visited == false ) {
-            CPU[ ++rear ].cpu = assigned_cpu;
-            CPU[ _Per_CPU_Get_index( assigned_cpu ) ].visited = true;
-            /*
-             * The curr CPU of the queue invoked this node to add its CPU
-             * that it is executing on to the queue. So this node might get
-             * preempted because of the invoker curr_CPU and this curr_CPU
-             * is the CPU that node should preempt in case this node
-             * gets preempted.
-             */
-            node->cpu_to_preempt = curr_CPU;
-          }
-        } else if ( curr_state == SCHEDULER_SMP_NODE_READY ) {
-          curr_priority = _Scheduler_Node_get_priority( &node->Base.Base );
-          curr_priority = SCHEDULER_PRIORITY_PURIFY( curr_priority );
+        continue;
+      }
 
-          if (
-            min_priority_num == UINT64_MAX ||
-            curr_priority < min_priority_num
-          ) {
-            min_priority_num = curr_priority;
-            highest_ready = &node->Base.Base;
-            /*
-             * In case curr_CPU is filter_CPU, we need to store the
-             * cpu_to_preempt value so that we go back to SMP_*
-             * function, rather than preempting the node ourselves.
-             */
-            node->cpu_to_preempt = curr_CPU;
-          }
-        }
+      assigned_cpu = _Thread_Get_CPU( scheduled->user );
+
+      if ( CPU[ _Per_CPU_Get_index( assigned_cpu ) ].visited == false ) {
+        CPU[ ++rear ].cpu = assigned_cpu;
+        CPU[ _Per_CPU_Get_index( assigned_cpu ) ].visited = true;
+        /*
+         * The curr CPU of the queue invoked this node to add its CPU
+         * that it is executing on to the queue. So this node might get
+         * preempted because of the invoker curr_CPU and this curr_CPU
+         * is the CPU that node should preempt in case this node
+         * gets preempted.
+         */
+        node->cpu_to_preempt = curr_CPU;
+      }
+    }
+
+    /*
+     * Merge the priorities of the nodes which may run on the curr_CPU.
+     */
+    bit_map.major_bit_map |= CPU[ curr_index ].Ready_bit_map.major_bit_map;
+
+    for ( word = 0 ; word < RTEMS_ARRAY_SIZE( bit_map.bit_map ) ; ++word ) {
+      bit_map.bit_map[ word ] |= CPU[ curr_index ].Ready_bit_map.bit_map[ word ];
+    }
+  }
+
+  while ( _Scheduler_strong_APA_Next_priority( &bit_map, &priority ) ) {
+    for ( queue_index = front; queue_index <= rear; ++queue_index ) {
+      curr_CPU = CPU[ queue_index ].cpu;
+      curr_index = _Per_CPU_Get_index( curr_CPU );
+
+      if ( CPU[ curr_index ].ready_count[ priority ] == 0 ) {
+        continue;
+      }
+
+      node = _Scheduler_strong_APA_First_ready( self, priority, curr_index );
+
+      if ( node != NULL ) {
+        /*
+         * In case curr_CPU is filter_CPU, we need to store the
+         * cpu_to_preempt value so that we go back to SMP_*
+         * function, rather than preempting the node ourselves.
+         */
+        node->cpu_to_preempt = curr_CPU;
+        return &node->Base.Base;
       }
-    next = _Chain_Next( next );
     }
   }
 
   /*
    * By definition, the system would always have a ready node,
-   * hence highest_ready would not be NULL.
+   * hence this point would not be reached.
    */
-  _Assert( highest_ready != NULL );
+  _Assert( false );
 
-  return highest_ready;
+  return NULL;
 }
 
+/*
+ * Returns the lowest priority ready node.  The idle nodes have the lowest
+ * priority, so the search usually ends at the first visited priority.
+ */
 static inline Scheduler_Node *_Scheduler_strong_APA_Get_idle( void *arg )
 {
   Scheduler_strong_APA_Context *self;
   Scheduler_strong_APA_Node    *lowest_ready = NULL;
-  Priority_Control              max_priority_num;
-  const Chain_Node             *tail;
-  Chain_Node                   *next;
+  int                           priority;
 
   self = _Scheduler_strong_APA_Get_self( arg );
-  tail = _Chain_Immutable_tail( &self->Ready );
-  next = _Chain_First( &self->Ready );
-  max_priority_num = 0;
 
-  while ( next != tail ) {
-    Scheduler_strong_APA_Node *node;
-    Scheduler_SMP_Node_state   curr_state;
+  for (
+    priority = SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY;
+    priority >= 0 && lowest_ready == NULL;
+    --priority
+  ) {
+    const Chain_Node *tail;
+    Chain_Node       *next;
 
-    node = (Scheduler_strong_APA_Node*) STRONG_SCHEDULER_NODE_OF_CHAIN( next );
-    curr_state = _Scheduler_SMP_Node_state( &node->Base.Base );
+    tail = _Chain_Immutable_tail( &self->Ready[ priority ] );
+    next = _Chain_First( &self->Ready[ priority ] );
 
-    if ( curr_state == SCHEDULER_SMP_NODE_READY ) {
-      Priority_Control curr_priority;
+    while ( next != tail ) {
+      Scheduler_strong_APA_Node *node;
 
-      curr_priority = _Scheduler_Node_get_priority( &node->Base.Base );
+      node = (Scheduler_strong_APA_Node*) STRONG_SCHEDULER_NODE_OF_CHAIN( next );
 
-      if ( curr_priority > max_priority_num ) {
-        max_priority_num = curr_priority;
+      if (
+        _Scheduler_SMP_Node_state( &node->Base.Base ) ==
+        SCHEDULER_SMP_NODE_READY
+      ) {
         lowest_ready = node;
+        break;
       }
-    }
 
-    next = _Chain_Next( next );
+      next = _Chain_Next( next );
+    }
   }
 
   _Assert( lowest_ready != NULL );
-  _Chain_Extract_unprotected( &lowest_ready->Ready_node );
-  _Chain_Set_off_chain( &lowest_ready->Ready_node );
+  _Scheduler_strong_APA_Ready_extract( self, lowest_ready );
 
   return &lowest_ready->Base.Base;
 }
@@ -319,7 +548,11 @@ static inline void _Scheduler_strong_APA_Release_idle(
   node = _Scheduler_strong_APA_Node_downcast( node_base );
 
   if ( _Chain_Is_node_off_chain( &node->Ready_node ) ) {
-    _Chain_Append_unprotected( &self->Ready, &node->Ready_node );
+    _Scheduler_strong_APA_Ready_append(
+      self,
+      node,
+      _Scheduler_SMP_Node_priority( node_base )
+    );
   }
 }
 
@@ -351,13 +584,11 @@ static inline void _Scheduler_strong_APA_Insert_ready(
   self = _Scheduler_strong_APA_Get_self( context );
   node = _Scheduler_strong_APA_Node_downcast( node_base );
 
-  if( _Chain_Is_node_off_chain( &node->Ready_node ) ) {
-    _Chain_Append_unprotected( &self->Ready, &node->Ready_node );
-  }  else {
-    _Chain_Extract_unprotected( &node->Ready_node );
-    _Chain_Set_off_chain( &node->Ready_node );
-    _Chain_Append_unprotected( &self->Ready, &node->Ready_node );
+  if( !_Chain_Is_node_off_chain( &node->Ready_node ) ) {
+    _Scheduler_strong_APA_Ready_extract( self, node );
   }
+
+  _Scheduler_strong_APA_Ready_append( self, node, insert_priority );
 }
 
 static inline void _Scheduler_strong_APA_Move_from_scheduled_to_ready(
@@ -545,15 +776,15 @@ static inline void _Scheduler_strong_APA_Extract_from_ready(
   Scheduler_Node    *node_to_extract
 )
 {
+  Scheduler_strong_APA_Context *self;
   Scheduler_strong_APA_Node    *node;
 
+  self = _Scheduler_strong_APA_Get_self( context );
   node = _Scheduler_strong_APA_Node_downcast( node_to_extract );
 
   if( !_Chain_Is_node_off_chain( &node->Ready_node ) ) {
-    _Chain_Extract_unprotected( &node->Ready_node );
-    _Chain_Set_off_chain( &node->Ready_node );
+    _Scheduler_strong_APA_Ready_extract( self, node );
   }
-
 }
 
 static inline Scheduler_Node* _Scheduler_strong_APA_Get_lowest_reachable(
@@ -864,7 +1095,11 @@ static inline  void  _Scheduler_strong_APA_Do_set_affinity(
   Scheduler_strong_APA_Node *node;
 
   node = _Scheduler_strong_APA_Node_downcast( node_base );
-  node->Affinity = *( (const Processor_mask *) arg );
+  _Scheduler_strong_APA_Set_node_affinity(
+    _Scheduler_strong_APA_Get_self( context ),
+    node,
+    arg
+  );
 }
 
 void _Scheduler_strong_APA_Initialize( const Scheduler_Control *scheduler )
@@ -872,8 +1107,18 @@ void _Scheduler_strong_APA_Initialize( const Scheduler_Control *scheduler )
   Scheduler_strong_APA_Context *self =
       _Scheduler_strong_APA_Get_context( scheduler );
 
+  unsigned int priority;
+
   _Scheduler_SMP_Initialize( &self->Base );
-  _Chain_Initialize_empty( &self->Ready );
+  _Priority_bit_map_Initialize( &self->Bit_map );
+
+  for (
+    priority = 0 ;
+    priority <= SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY ;
+    ++priority
+  ) {
+    _Chain_Initialize_empty( &self->Ready[ priority ] );
+  }
 }
 
 void _Scheduler_strong_APA_Yield(
@@ -1160,7 +1405,11 @@ Status_Control _Scheduler_strong_APA_Set_affinity(
   if ( _Processor_mask_Is_equal( &node->Affinity, affinity ) )
     return STATUS_SUCCESSFUL;	/* Nothing to do. Return true. */
 
- _Processor_mask_Assign( &node->Affinity, &local_affinity );
+ _Scheduler_strong_APA_Set_node_affinity(
+   _Scheduler_strong_APA_Get_self( context ),
+   node,
+   &local_affinity
+ );
 
  _Scheduler_SMP_Set_affinity(
    context,
@@ -0,0 +1,986 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerWSSMP
+ *
+ * @brief This source file contains the implementation of
+ *   _Scheduler_WS_SMP_Add_processor(), _Scheduler_WS_SMP_Ask_for_help(),
+ *   _Scheduler_WS_SMP_Block(), _Scheduler_WS_SMP_Clean_sticky(),
+ *   _Scheduler_WS_SMP_Initialize(), _Scheduler_WS_SMP_Make_sticky(),
+ *   _Scheduler_WS_SMP_Node_initialize(),
+ *   _Scheduler_WS_SMP_Reconsider_help_request(),
+ *   _Scheduler_WS_SMP_Remove_processor(), _Scheduler_WS_SMP_Set_affinity(),
+ *   _Scheduler_WS_SMP_Start_idle(), _Scheduler_WS_SMP_Unblock(),
+ *   _Scheduler_WS_SMP_Update_priority(), _Scheduler_WS_SMP_Withdraw_node(),
+ *   and _Scheduler_WS_SMP_Yield().
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/schedulerwssmp.h>
+#include <rtems/score/schedulerpriorityimpl.h>
+#include <rtems/score/schedulersmpimpl.h>
+#include <rtems/score/assert.h>
+
+static inline Scheduler_WS_SMP_Context *
+_Scheduler_WS_SMP_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_WS_SMP_Context *) _Scheduler_Get_context( scheduler );
+}
+
+static inline Scheduler_WS_SMP_Context *
+_Scheduler_WS_SMP_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_WS_SMP_Context *) context;
+}
+
+static inline Scheduler_WS_SMP_Node *
+_Scheduler_WS_SMP_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_WS_SMP_Node *) node;
+}
+
+/*
+ * The idle nodes are kept in a separate chain.  They never wait in the ready
+ * queue of a processor.
+ */
+static inline bool _Scheduler_WS_SMP_Is_idle( const Scheduler_Node *node )
+{
+  return _Scheduler_Node_get_owner( node )->is_idle;
+}
+
+static inline Scheduler_WS_SMP_Node *_Scheduler_WS_SMP_First_ready(
+  Scheduler_WS_SMP_CPU *cpu
+)
+{
+  return (Scheduler_WS_SMP_Node *) _Scheduler_priority_Ready_queue_first(
+    &cpu->Bit_map,
+    cpu->Ready
+  );
+}
+
+/*
+ * Returns the index of the processor which should run the node or in which
+ * ready queue the node should wait.  This is the processor the node was
+ * allocated to most recently, if it is still in the affinity set of the node
+ * and owned by the scheduler.
+ */
+static inline uint32_t _Scheduler_WS_SMP_Get_home(
+  const Scheduler_WS_SMP_Context *self,
+  const Scheduler_WS_SMP_Node    *node
+)
+{
+  Processor_mask eligible;
+  uint32_t       home_index;
+
+  home_index = node->home_index;
+  _Processor_mask_And(
+    &eligible,
+    &self->Base.Base.Processors,
+    &node->Affinity
+  );
+
+  if ( _Processor_mask_Is_set( &eligible, home_index ) ) {
+    return home_index;
+  }
+
+  if ( _Processor_mask_Is_zero( &eligible ) ) {
+    _Processor_mask_Assign( &eligible, &self->Base.Base.Processors );
+  }
+
+  return _Processor_mask_Find_last_set( &eligible ) - 1;
+}
+
+static inline void _Scheduler_WS_SMP_Enqueue_ready(
+  Scheduler_WS_SMP_Context *self,
+  Scheduler_WS_SMP_Node    *node,
+  Priority_Control          priority,
+  bool                      append
+)
+{
+  Scheduler_WS_SMP_CPU *cpu;
+
+  if ( _Scheduler_WS_SMP_Is_idle( &node->Base.Base ) ) {
+    _Chain_Append_unprotected( &self->Idle, &node->Base.Base.Node.Chain );
+    return;
+  }
+
+  node->ready_index = node->home_index;
+  cpu = &self->CPU[ node->ready_index ];
+  _Scheduler_priority_Ready_queue_update(
+    &node->Ready_queue,
+    SCHEDULER_PRIORITY_UNMAP( priority ),
+    &cpu->Bit_map,
+    cpu->Ready
+  );
+
+  if ( append ) {
+    _Scheduler_priority_Ready_queue_enqueue(
+      &node->Base.Base.Node.Chain,
+      &node->Ready_queue,
+      &cpu->Bit_map
+    );
+  } else {
+    _Scheduler_priority_Ready_queue_enqueue_first(
+      &node->Base.Base.Node.Chain,
+      &node->Ready_queue,
+      &cpu->Bit_map
+    );
+  }
+}
+
+void _Scheduler_WS_SMP_Initialize( const Scheduler_Control *scheduler )
+{
+  Scheduler_WS_SMP_Context *self;
+  Chain_Control            *ready;
+  uint32_t                  cpu_index;
+
+  self = _Scheduler_WS_SMP_Get_context( scheduler );
+  _Scheduler_SMP_Initialize( &self->Base );
+  _Chain_Initialize_empty( &self->Idle );
+
+  /* The ready chains follow the processor-specific data */
+  ready = (Chain_Control *) &self->CPU[ _SMP_Processor_configured_maximum ];
+
+  for (
+    cpu_index = 0 ;
+    cpu_index < _SMP_Processor_configured_maximum ;
+    ++cpu_index
+  ) {
+    Scheduler_WS_SMP_CPU *cpu;
+
+    cpu = &self->CPU[ cpu_index ];
+    cpu->Ready = ready;
+    _Priority_bit_map_Initialize( &cpu->Bit_map );
+    _Scheduler_priority_Ready_queue_initialize(
+      ready,
+      scheduler->maximum_priority
+    );
+    ready += scheduler->maximum_priority + 1;
+  }
+}
+
+void _Scheduler_WS_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+)
+{
+  Scheduler_WS_SMP_Node *the_node;
+
+  the_node = _Scheduler_WS_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_initialize(
+    scheduler,
+    &the_node->Base,
+    the_thread,
+    priority
+  );
+  _Processor_mask_Assign( &the_node->Affinity, _SMP_Get_online_processors() );
+}
+
+static inline void _Scheduler_WS_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   new_priority
+)
+{
+  (void) context;
+
+  /* The ready queue of the node is updated when it is inserted */
+  _Scheduler_SMP_Node_update_priority(
+    _Scheduler_SMP_Node_downcast( node ),
+    new_priority
+  );
+}
+
+static inline bool _Scheduler_WS_SMP_Has_ready( Scheduler_Context *context )
+{
+  Scheduler_WS_SMP_Context *self;
+  uint32_t                  cpu_max;
+  uint32_t                  cpu_index;
+
+  self = _Scheduler_WS_SMP_Get_self( context );
+
+  if ( !_Chain_Is_empty( &self->Idle ) ) {
+    return true;
+  }
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if ( !_Priority_bit_map_Is_empty( &self->CPU[ cpu_index ].Bit_map ) ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*
+ * Returns the first node of the ready queue with a priority higher than the
+ * priority limit which may execute on the processor, otherwise NULL.
+ */
+static inline Scheduler_WS_SMP_Node *_Scheduler_WS_SMP_Find_affine(
+  Scheduler_WS_SMP_CPU *other,
+  uint32_t              cpu_index,
+  Priority_Control      limit
+)
+{
+  Priority_bit_map_Control bit_map;
+
+  bit_map = other->Bit_map;
+
+  while ( !_Priority_bit_map_Is_empty( &bit_map ) ) {
+    Priority_bit_map_Information  bit_map_info;
+    unsigned int                  priority;
+    const Chain_Node             *tail;
+    Chain_Node                   *next;
+
+    priority = _Priority_bit_map_Get_highest( &bit_map );
+
+    if ( SCHEDULER_PRIORITY_MAP( priority ) >= limit ) {
+      break;
+    }
+
+    tail = _Chain_Immutable_tail( &other->Ready[ priority ] );
+    next = _Chain_First( &other->Ready[ priority ] );
+
+    while ( next != tail ) {
+      Scheduler_WS_SMP_Node *node;
+
+      node = (Scheduler_WS_SMP_Node *) next;
+
+      if ( _Processor_mask_Is_set( &node->Affinity, cpu_index ) ) {
+        return node;
+      }
+
+      next = _Chain_Next( next );
+    }
+
+    _Priority_bit_map_Initialize_information(
+      &bit_map,
+      &bit_map_info,
+      priority
+    );
+    _Priority_bit_map_Remove( &bit_map, &bit_map_info );
+  }
+
+  return NULL;
+}
+
+/*
+ * Steals a node from the ready queues of the other processors which has a
+ * higher priority than the highest ready node.  If the processor would
+ * become idle, then all nodes of the other ready queues are considered,
+ * otherwise only the first node of each ready queue is considered.
+ */
+static inline Scheduler_WS_SMP_Node *_Scheduler_WS_SMP_Steal(
+  Scheduler_WS_SMP_Context *self,
+  uint32_t                  cpu_index,
+  Scheduler_WS_SMP_Node    *highest_ready
+)
+{
+  Priority_Control highest_priority;
+  uint32_t         cpu_max;
+  uint32_t         other_index;
+  bool             is_idle;
+
+  is_idle = ( highest_ready == NULL );
+
+  if ( is_idle ) {
+    highest_priority = UINT64_MAX;
+  } else {
+    highest_priority =
+      _Scheduler_SMP_Node_priority( &highest_ready->Base.Base );
+  }
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( other_index = 0 ; other_index < cpu_max ; ++other_index ) {
+    Scheduler_WS_SMP_CPU  *other;
+    Scheduler_WS_SMP_Node *candidate;
+
+    other = &self->CPU[ other_index ];
+
+    if (
+      other_index == cpu_index ||
+      !_Processor_mask_Is_set( &self->Base.Base.Processors, other_index ) ||
+      _Priority_bit_map_Is_empty( &other->Bit_map )
+    ) {
+      continue;
+    }
+
+    if ( is_idle ) {
+      candidate = _Scheduler_WS_SMP_Find_affine(
+        other,
+        cpu_index,
+        highest_priority
+      );
+    } else {
+      candidate = _Scheduler_WS_SMP_First_ready( other );
+
+      if (
+        _Scheduler_SMP_Node_priority( &candidate->Base.Base ) >=
+          highest_priority ||
+        !_Processor_mask_Is_set( &candidate->Affinity, cpu_index )
+      ) {
+        candidate = NULL;
+      }
+    }
+
+    if ( candidate != NULL ) {
+      highest_ready = candidate;
+      highest_priority = _Scheduler_SMP_Node_priority( &candidate->Base.Base );
+    }
+  }
+
+  return highest_ready;
+}
+
+/*
+ * The filter node is the node which leaves its processor.  The processor
+ * selects the highest priority node of its own ready queue.  It steals a node
+ * from another ready queue if its ready queue is empty or if it is time for a
+ * load balancing step.
+ */
+static inline Scheduler_Node *_Scheduler_WS_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_WS_SMP_Context *self;
+  Scheduler_WS_SMP_Node    *highest_ready;
+  Scheduler_WS_SMP_CPU     *cpu;
+  uint32_t                  cpu_index;
+
+  self = _Scheduler_WS_SMP_Get_self( context );
+  cpu_index = _Scheduler_WS_SMP_Node_downcast( filter )->home_index;
+  cpu = &self->CPU[ cpu_index ];
+  ++cpu->selections;
+
+  if ( _Priority_bit_map_Is_empty( &cpu->Bit_map ) ) {
+    highest_ready = _Scheduler_WS_SMP_Steal( self, cpu_index, NULL );
+  } else {
+    highest_ready = _Scheduler_WS_SMP_First_ready( cpu );
+
+    if ( cpu->selections % SCHEDULER_WS_SMP_BALANCE_INTERVAL == 0 ) {
+      highest_ready = _Scheduler_WS_SMP_Steal( self, cpu_index, highest_ready );
+    }
+  }
+
+  if ( highest_ready == NULL ) {
+    _Assert( !_Chain_Is_empty( &self->Idle ) );
+    return (Scheduler_Node *) _Chain_First( &self->Idle );
+  }
+
+  return &highest_ready->Base.Base;
+}
+
+static inline void _Scheduler_WS_SMP_Set_allocated(
+  Scheduler_WS_SMP_Context *self,
+  Scheduler_Node           *node_base,
+  const Per_CPU_Control    *cpu
+)
+{
+  Scheduler_WS_SMP_Node *node;
+  uint32_t               cpu_index;
+
+  node = _Scheduler_WS_SMP_Node_downcast( node_base );
+  cpu_index = _Per_CPU_Get_index( cpu );
+  node->home_index = cpu_index;
+  self->CPU[ cpu_index ].allocated = node;
+
+  if ( _Scheduler_WS_SMP_Is_idle( node_base ) ) {
+    _Processor_mask_Set( &self->Idle_processors, cpu_index );
+  } else {
+    _Processor_mask_Clear( &self->Idle_processors, cpu_index );
+  }
+}
+
+/*
+ * The node to enqueue preempts the node of its home processor if it has a
+ * higher priority.  Otherwise, it is scheduled on an idle processor of its
+ * affinity set, if one exists.  Otherwise, the lowest priority node scheduled
+ * on a processor of its affinity set is returned.  The node preempts this
+ * node if it has a higher priority, otherwise it waits in the ready queue of
+ * its home processor.  So, an unblocked node never waits while a lower
+ * priority node executes on a processor of its affinity set.
+ */
+static inline Scheduler_Node *_Scheduler_WS_SMP_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_WS_SMP_Context *self;
+  Scheduler_WS_SMP_Node    *node;
+  Scheduler_WS_SMP_Node    *victim;
+  Priority_Control          victim_priority;
+  Processor_mask            eligible;
+  Processor_mask            idle;
+  uint32_t                  cpu_max;
+  uint32_t                  cpu_index;
+
+  self = _Scheduler_WS_SMP_Get_self( context );
+  node = _Scheduler_WS_SMP_Node_downcast( filter );
+  node->home_index = _Scheduler_WS_SMP_Get_home( self, node );
+  victim = self->CPU[ node->home_index ].allocated;
+  _Assert( victim != NULL );
+  victim_priority = _Scheduler_SMP_Node_priority( &victim->Base.Base );
+
+  if ( _Scheduler_SMP_Node_priority( filter ) < victim_priority ) {
+    return &victim->Base.Base;
+  }
+
+  _Processor_mask_And( &idle, &self->Idle_processors, &node->Affinity );
+
+  if ( !_Processor_mask_Is_zero( &idle ) ) {
+    victim = self->CPU[ _Processor_mask_Find_last_set( &idle ) - 1 ].allocated;
+    return &victim->Base.Base;
+  }
+
+  _Processor_mask_And(
+    &eligible,
+    &self->Base.Base.Processors,
+    &node->Affinity
+  );
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    Scheduler_WS_SMP_Node *other;
+    Priority_Control       other_priority;
+
+    if ( !_Processor_mask_Is_set( &eligible, cpu_index ) ) {
+      continue;
+    }
+
+    other = self->CPU[ cpu_index ].allocated;
+    _Assert( other != NULL );
+    other_priority = _Scheduler_SMP_Node_priority( &other->Base.Base );
+
+    if ( other_priority > victim_priority ) {
+      victim = other;
+      victim_priority = other_priority;
+    }
+  }
+
+  return &victim->Base.Base;
+}
+
+static inline void _Scheduler_WS_SMP_Insert_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  Priority_Control   insert_priority
+)
+{
+  _Scheduler_WS_SMP_Enqueue_ready(
+    _Scheduler_WS_SMP_Get_self( context ),
+    _Scheduler_WS_SMP_Node_downcast( node_base ),
+    insert_priority,
+    SCHEDULER_PRIORITY_IS_APPEND( insert_priority )
+  );
+}
+
+static inline void _Scheduler_WS_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  Scheduler_WS_SMP_Context *self;
+  Scheduler_WS_SMP_Node    *node;
+
+  self = _Scheduler_WS_SMP_Get_self( context );
+  node = _Scheduler_WS_SMP_Node_downcast( node_to_extract );
+
+  if ( _Scheduler_WS_SMP_Is_idle( node_to_extract ) ) {
+    _Chain_Extract_unprotected( &node->Base.Base.Node.Chain );
+    return;
+  }
+
+  _Scheduler_priority_Ready_queue_extract(
+    &node->Base.Base.Node.Chain,
+    &node->Ready_queue,
+    &self->CPU[ node->ready_index ].Bit_map
+  );
+}
+
+static inline void _Scheduler_WS_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  _Chain_Extract_unprotected( &scheduled_to_ready->Node.Chain );
+  _Scheduler_WS_SMP_Enqueue_ready(
+    _Scheduler_WS_SMP_Get_self( context ),
+    _Scheduler_WS_SMP_Node_downcast( scheduled_to_ready ),
+    _Scheduler_SMP_Node_priority( scheduled_to_ready ),
+    false
+  );
+}
+
+static inline void _Scheduler_WS_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  Priority_Control insert_priority;
+
+  _Scheduler_WS_SMP_Extract_from_ready( context, ready_to_scheduled );
+  insert_priority = _Scheduler_SMP_Node_priority( ready_to_scheduled );
+  insert_priority = SCHEDULER_PRIORITY_APPEND( insert_priority );
+  _Scheduler_SMP_Insert_scheduled(
+    context,
+    ready_to_scheduled,
+    insert_priority
+  );
+}
+
+static inline Scheduler_Node *_Scheduler_WS_SMP_Get_idle( void *arg )
+{
+  Scheduler_WS_SMP_Context *self;
+
+  self = _Scheduler_WS_SMP_Get_self( arg );
+  _Assert( !_Chain_Is_empty( &self->Idle ) );
+
+  return (Scheduler_Node *) _Chain_Get_first_unprotected( &self->Idle );
+}
+
+static inline void _Scheduler_WS_SMP_Release_idle(
+  Scheduler_Node *node,
+  void           *arg
+)
+{
+  Scheduler_WS_SMP_Context *self;
+
+  self = _Scheduler_WS_SMP_Get_self( arg );
+  _Chain_Append_unprotected( &self->Idle, &node->Node.Chain );
+}
+
+static inline void _Scheduler_WS_SMP_Allocate_processor(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled,
+  Per_CPU_Control   *cpu
+)
+{
+  _Scheduler_WS_SMP_Set_allocated(
+    _Scheduler_WS_SMP_Get_self( context ),
+    scheduled,
+    cpu
+  );
+  _Scheduler_SMP_Allocate_processor_exact( context, scheduled, cpu );
+}
+
+static inline void _Scheduler_WS_SMP_Register_idle(
+  Scheduler_Context *context,
+  Scheduler_Node    *idle,
+  Per_CPU_Control   *cpu
+)
+{
+  _Scheduler_WS_SMP_Set_allocated(
+    _Scheduler_WS_SMP_Get_self( context ),
+    idle,
+    cpu
+  );
+}
+
+void _Scheduler_WS_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_WS_SMP_Extract_from_ready,
+    _Scheduler_WS_SMP_Get_highest_ready,
+    _Scheduler_WS_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_WS_SMP_Allocate_processor,
+    _Scheduler_WS_SMP_Get_idle
+  );
+}
+
+static inline bool _Scheduler_WS_SMP_Enqueue(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  return _Scheduler_SMP_Enqueue(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_WS_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_WS_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_WS_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_WS_SMP_Get_lowest_scheduled,
+    _Scheduler_WS_SMP_Allocate_processor,
+    _Scheduler_WS_SMP_Get_idle,
+    _Scheduler_WS_SMP_Release_idle
+  );
+}
+
+static inline void _Scheduler_WS_SMP_Enqueue_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  _Scheduler_SMP_Enqueue_scheduled(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_WS_SMP_Extract_from_ready,
+    _Scheduler_WS_SMP_Get_highest_ready,
+    _Scheduler_WS_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_WS_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_WS_SMP_Allocate_processor,
+    _Scheduler_WS_SMP_Get_idle,
+    _Scheduler_WS_SMP_Release_idle
+  );
+}
+
+void _Scheduler_WS_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    thread,
+    node,
+    _Scheduler_WS_SMP_Do_update,
+    _Scheduler_WS_SMP_Enqueue,
+    _Scheduler_WS_SMP_Release_idle
+  );
+}
+
+static inline bool _Scheduler_WS_SMP_Do_ask_for_help(
+  Scheduler_Context *context,
+  Thread_Control    *the_thread,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_SMP_Ask_for_help(
+    context,
+    the_thread,
+    node,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_WS_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_WS_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_WS_SMP_Get_lowest_scheduled,
+    _Scheduler_WS_SMP_Allocate_processor,
+    _Scheduler_WS_SMP_Release_idle
+  );
+}
+
+void _Scheduler_WS_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Update_priority(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_WS_SMP_Extract_from_ready,
+    _Scheduler_WS_SMP_Do_update,
+    _Scheduler_WS_SMP_Enqueue,
+    _Scheduler_WS_SMP_Enqueue_scheduled,
+    _Scheduler_WS_SMP_Do_ask_for_help
+  );
+}
+
+bool _Scheduler_WS_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_WS_SMP_Do_ask_for_help( context, the_thread, node );
+}
+
+void _Scheduler_WS_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Reconsider_help_request(
+    context,
+    the_thread,
+    node,
+    _Scheduler_WS_SMP_Extract_from_ready
+  );
+}
+
+void _Scheduler_WS_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Withdraw_node(
+    context,
+    the_thread,
+    node,
+    next_state,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_WS_SMP_Extract_from_ready,
+    _Scheduler_WS_SMP_Get_highest_ready,
+    _Scheduler_WS_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_WS_SMP_Allocate_processor,
+    _Scheduler_WS_SMP_Get_idle
+  );
+}
+
+void _Scheduler_WS_SMP_Make_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  _Scheduler_SMP_Make_sticky(
+    scheduler,
+    the_thread,
+    node,
+    _Scheduler_WS_SMP_Do_update,
+    _Scheduler_WS_SMP_Enqueue
+  );
+}
+
+void _Scheduler_WS_SMP_Clean_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  _Scheduler_SMP_Clean_sticky(
+    scheduler,
+    the_thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_WS_SMP_Extract_from_ready,
+    _Scheduler_WS_SMP_Get_highest_ready,
+    _Scheduler_WS_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_WS_SMP_Allocate_processor,
+    _Scheduler_WS_SMP_Get_idle,
+    _Scheduler_WS_SMP_Release_idle
+  );
+}
+
+void _Scheduler_WS_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Add_processor(
+    context,
+    idle,
+    _Scheduler_WS_SMP_Has_ready,
+    _Scheduler_WS_SMP_Enqueue_scheduled,
+    _Scheduler_WS_SMP_Register_idle
+  );
+}
+
+Thread_Control *_Scheduler_WS_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context        *context;
+  Scheduler_WS_SMP_Context *self;
+  Scheduler_WS_SMP_CPU     *removed;
+  Thread_Control           *idle;
+  uint32_t                  cpu_index;
+
+  context = _Scheduler_Get_context( scheduler );
+  self = _Scheduler_WS_SMP_Get_self( context );
+  cpu_index = _Per_CPU_Get_index( cpu );
+  removed = &self->CPU[ cpu_index ];
+  removed->allocated = NULL;
+  _Processor_mask_Clear( &self->Idle_processors, cpu_index );
+
+  idle = _Scheduler_SMP_Remove_processor(
+    context,
+    cpu,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_WS_SMP_Extract_from_ready,
+    _Scheduler_WS_SMP_Enqueue,
+    _Scheduler_WS_SMP_Get_idle,
+    _Scheduler_WS_SMP_Release_idle
+  );
+
+  /*
+   * Move the nodes waiting in the ready queue of the removed processor to the
+   * remaining processors.
+   */
+  while ( !_Priority_bit_map_Is_empty( &removed->Bit_map ) ) {
+    Scheduler_WS_SMP_Node *node;
+    Priority_Control       insert_priority;
+
+    node = _Scheduler_WS_SMP_First_ready( removed );
+    _Scheduler_WS_SMP_Extract_from_ready( context, &node->Base.Base );
+    insert_priority = _Scheduler_SMP_Node_priority( &node->Base.Base );
+    insert_priority = SCHEDULER_PRIORITY_APPEND( insert_priority );
+    (void) _Scheduler_WS_SMP_Enqueue(
+      context,
+      &node->Base.Base,
+      insert_priority
+    );
+  }
+
+  return idle;
+}
+
+void _Scheduler_WS_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_WS_SMP_Extract_from_ready,
+    _Scheduler_WS_SMP_Enqueue,
+    _Scheduler_WS_SMP_Enqueue_scheduled
+  );
+}
+
+void _Scheduler_WS_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Do_start_idle(
+    context,
+    idle,
+    cpu,
+    _Scheduler_WS_SMP_Register_idle
+  );
+}
+
+static inline void _Scheduler_WS_SMP_Do_set_affinity(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  void              *arg
+)
+{
+  Scheduler_WS_SMP_Node *node;
+
+  (void) context;
+
+  node = _Scheduler_WS_SMP_Node_downcast( node_base );
+  _Processor_mask_Assign( &node->Affinity, arg );
+}
+
+Status_Control _Scheduler_WS_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node_base,
+  const Processor_mask    *affinity
+)
+{
+  Scheduler_Context     *context;
+  Scheduler_WS_SMP_Node *node;
+  Processor_mask         local_affinity;
+
+  context = _Scheduler_Get_context( scheduler );
+  _Processor_mask_And( &local_affinity, &context->Processors, affinity );
+
+  if ( _Processor_mask_Is_zero( &local_affinity ) ) {
+    return STATUS_INVALID_NUMBER;
+  }
+
+  node = _Scheduler_WS_SMP_Node_downcast( node_base );
+
+  if ( _Processor_mask_Is_equal( &node->Affinity, affinity ) ) {
+    return STATUS_SUCCESSFUL;
+  }
+
+  /*
+   * Keep the processors not owned by the scheduler in the affinity set, so
+   * that they can be used if they are added to the scheduler.
+   */
+  _Processor_mask_Assign( &local_affinity, affinity );
+
+  _Scheduler_SMP_Set_affinity(
+    context,
+    thread,
+    node_base,
+    &local_affinity,
+    _Scheduler_WS_SMP_Do_set_affinity,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_WS_SMP_Extract_from_ready,
+    _Scheduler_WS_SMP_Get_highest_ready,
+    _Scheduler_WS_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_WS_SMP_Enqueue,
+    _Scheduler_WS_SMP_Allocate_processor,
+    _Scheduler_WS_SMP_Get_idle,
+    _Scheduler_WS_SMP_Release_idle
+  );
+
+  return STATUS_SUCCESSFUL;
+}
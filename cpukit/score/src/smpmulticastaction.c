@@ -6,7 +6,9 @@
  * @ingroup RTEMSScoreSMP
  *
  * @brief This source file contains the implementation of
- *   _SMP_Multicast_action().
+ *   _SMP_Multicast_action(), _SMP_Multicast_action_add_to_batch(),
+ *   _SMP_Multicast_action_async(), _SMP_Multicast_action_is_done(), and
+ *   _SMP_Multicast_action_wait().
  */
 
 /*
@@ -41,26 +43,33 @@
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/assert.h>
 
-typedef struct {
-  Per_CPU_Job_context Context;
-  Per_CPU_Job         Jobs[ CPU_MAXIMUM_PROCESSORS ];
-} SMP_Multicast_jobs;
-
-static void _SMP_Issue_action_jobs(
-  const Processor_mask *targets,
-  SMP_Multicast_jobs   *jobs,
-  uint32_t              cpu_max
+static void _SMP_Prepare_action_jobs(
+  SMP_Multicast_request *request,
+  const Processor_mask  *targets,
+  SMP_Action_handler     handler,
+  void                  *arg
 )
 {
+  request->Context.handler = handler;
+  request->Context.arg = arg;
+  _Processor_mask_Assign( &request->Targets, targets );
+}
+
+static void _SMP_Issue_action_jobs( SMP_Multicast_request *request )
+{
+  uint32_t cpu_max;
   uint32_t cpu_index;
 
+  cpu_max = _SMP_Get_processor_maximum();
+  _Assert( cpu_max <= RTEMS_ARRAY_SIZE( request->Jobs ) );
+
   for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
-    if ( _Processor_mask_Is_set( targets, cpu_index ) ) {
+    if ( _Processor_mask_Is_set( &request->Targets, cpu_index ) ) {
       Per_CPU_Job     *job;
       Per_CPU_Control *cpu;
 
-      job = &jobs->Jobs[ cpu_index ];
-      job->context = &jobs->Context;
+      job = &request->Jobs[ cpu_index ];
+      job->context = &request->Context;
       cpu = _Per_CPU_Get_by_index( cpu_index );
 
       _Per_CPU_Submit_job( cpu, job );
@@ -68,21 +77,82 @@ static void _SMP_Issue_action_jobs(
   }
 }
 
-static void _SMP_Wait_for_action_jobs(
-  const Processor_mask     *targets,
-  const SMP_Multicast_jobs *jobs,
-  uint32_t                  cpu_max
+void _SMP_Multicast_action_async(
+  SMP_Multicast_request *request,
+  const Processor_mask  *targets,
+  SMP_Action_handler     handler,
+  void                  *arg
+)
+{
+  _SMP_Prepare_action_jobs( request, targets, handler, arg );
+  _SMP_Issue_action_jobs( request );
+}
+
+void _SMP_Multicast_action_add_to_batch(
+  Per_CPU_Job_batch     *batch,
+  SMP_Multicast_request *request,
+  const Processor_mask  *targets,
+  SMP_Action_handler     handler,
+  void                  *arg
 )
 {
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  _SMP_Prepare_action_jobs( request, targets, handler, arg );
+
+  cpu_max = _SMP_Get_processor_maximum();
+  _Assert( cpu_max <= RTEMS_ARRAY_SIZE( request->Jobs ) );
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &request->Targets, cpu_index ) ) {
+      Per_CPU_Job *job;
+
+      job = &request->Jobs[ cpu_index ];
+      job->context = &request->Context;
+
+      _Per_CPU_Add_job_to_batch(
+        batch,
+        _Per_CPU_Get_by_index( cpu_index ),
+        job
+      );
+    }
+  }
+}
+
+bool _SMP_Multicast_action_is_done( const SMP_Multicast_request *request )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if (
+      _Processor_mask_Is_set( &request->Targets, cpu_index ) &&
+        !_Per_CPU_Is_job_done( &request->Jobs[ cpu_index ] )
+    ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void _SMP_Multicast_action_wait( const SMP_Multicast_request *request )
+{
+  uint32_t cpu_max;
   uint32_t cpu_index;
 
+  cpu_max = _SMP_Get_processor_maximum();
+
   for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
-    if ( _Processor_mask_Is_set( targets, cpu_index ) ) {
+    if ( _Processor_mask_Is_set( &request->Targets, cpu_index ) ) {
       const Per_CPU_Control *cpu;
       const Per_CPU_Job     *job;
 
       cpu = _Per_CPU_Get_by_index( cpu_index );
-      job = &jobs->Jobs[ cpu_index ];
+      job = &request->Jobs[ cpu_index ];
       _Per_CPU_Wait_for_job( cpu, job );
     }
   }
@@ -94,15 +164,8 @@ void _SMP_Multicast_action(
   void                 *arg
 )
 {
-  SMP_Multicast_jobs jobs;
-  uint32_t           cpu_max;
-
-  cpu_max = _SMP_Get_processor_maximum();
-  _Assert( cpu_max <= RTEMS_ARRAY_SIZE( jobs.Jobs ) );
-
-  jobs.Context.handler = handler;
-  jobs.Context.arg = arg;
+  SMP_Multicast_request request;
 
-  _SMP_Issue_action_jobs( targets, &jobs, cpu_max );
-  _SMP_Wait_for_action_jobs( targets, &jobs, cpu_max );
+  _SMP_Multicast_action_async( &request, targets, handler, arg );
+  _SMP_Multicast_action_wait( &request );
 }
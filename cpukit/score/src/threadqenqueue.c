@@ -10,7 +10,7 @@
  *   _Thread_queue_Do_dequeue(), _Thread_queue_Enqueue(),
  *   _Thread_queue_Enqueue_do_nothing_extra(), _Thread_queue_Enqueue_sticky(),
  *   _Thread_queue_Extract_locked(), _Thread_queue_Path_acquire(),
- *   _Thread_queue_Path_release(),
+ *   _Thread_queue_Path_release(), _Thread_queue_Requeue_locked(),
  *   _Thread_queue_Resume(),_Thread_queue_Surrender(),
  *   _Thread_queue_Surrender_no_priority(), _Thread_queue_Surrender_sticky().
  */
@@ -270,12 +270,16 @@ static void _Thread_queue_Path_append_deadlock_thread(
 }
 #endif
 
-#if !defined(RTEMS_SMP)
-static
-#endif
-Thread_queue_Deadlock_status _Thread_queue_Path_acquire(
+/*
+ * The thread queue path walk stops at the stop thread queue, if it is not
+ * NULL.  The caller owns the lock of this thread queue, so acquiring it again
+ * would hang the processor.  The stop thread queue is not in the link
+ * registry, so this is reported as a deadlock.
+ */
+static Thread_queue_Deadlock_status _Thread_queue_Path_do_acquire(
   Thread_queue_Queue   *queue,
   Thread_Control       *the_thread,
+  Thread_queue_Queue   *stop,
   Thread_queue_Context *queue_context
 )
 {
@@ -322,6 +326,12 @@ Thread_queue_Deadlock_status _Thread_queue_Path_acquire(
     );
 
     target = owner->Wait.queue;
+
+    if ( target != NULL && target == stop ) {
+      link->Lock_context.Wait.queue = NULL;
+      return THREAD_QUEUE_DEADLOCK_DETECTED;
+    }
+
     link->Lock_context.Wait.queue = target;
 
     if ( target != NULL ) {
@@ -365,6 +375,8 @@ Thread_queue_Deadlock_status _Thread_queue_Path_acquire(
     owner = queue->owner;
   } while ( owner != NULL );
 #else
+  (void) stop;
+
   do {
     owner = queue->owner;
 
@@ -383,6 +395,23 @@ Thread_queue_Deadlock_status _Thread_queue_Path_acquire(
   return THREAD_QUEUE_NO_DEADLOCK;
 }
 
+#if !defined(RTEMS_SMP)
+static
+#endif
+Thread_queue_Deadlock_status _Thread_queue_Path_acquire(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context
+)
+{
+  return _Thread_queue_Path_do_acquire(
+    queue,
+    the_thread,
+    NULL,
+    queue_context
+  );
+}
+
 void _Thread_queue_Enqueue_do_nothing_extra(
   Thread_queue_Queue   *queue,
   Thread_Control       *the_thread,
@@ -660,6 +689,76 @@ bool _Thread_queue_Extract_locked(
   return _Thread_queue_Make_ready_again( the_thread );
 }
 
+bool _Thread_queue_Requeue_locked(
+  Thread_queue_Queue            *queue,
+  const Thread_queue_Operations *operations,
+  Thread_queue_Queue            *target,
+  const Thread_queue_Operations *target_operations,
+  Thread_Control                *the_thread,
+  Thread_queue_Context          *queue_context
+)
+{
+  Thread_queue_Deadlock_status deadlock_status;
+#if defined(RTEMS_SMP)
+  ISR_lock_Context             lock_context;
+#endif
+
+  _Assert( queue->owner == NULL );
+  _Assert( queue != target );
+
+#if defined(RTEMS_SMP)
+  /*
+   * Pending requests for the thread wait lock were issued with respect to the
+   * current thread queue.  We must not move the thread behind their back.
+   * Keep the thread wait default lock until the new thread queue is set, so
+   * that no new requests can show up in the meantime.
+   */
+  _Thread_Wait_acquire_default_critical( the_thread, &lock_context );
+
+  if ( !_Chain_Is_empty( &the_thread->Wait.Lock.Pending_requests ) ) {
+    _Thread_Wait_release_default_critical( the_thread, &lock_context );
+    return _Thread_queue_Extract_locked(
+      queue,
+      operations,
+      the_thread,
+      queue_context
+    );
+  }
+#endif
+
+  _Assert( the_thread->Wait.queue == queue );
+  ( *operations->extract )( queue, the_thread, queue_context );
+  the_thread->Wait.queue = target;
+
+#if defined(RTEMS_SMP)
+  _Thread_Wait_release_default_critical( the_thread, &lock_context );
+#endif
+
+  /*
+   * The caller owns the lock of the actual thread queue.  An owner on the
+   * thread queue path of the target may wait on the actual thread queue, so
+   * the path walk must stop there.  In this case, the thread is extracted
+   * instead of moved.
+   */
+  deadlock_status = _Thread_queue_Path_do_acquire(
+    target,
+    the_thread,
+    queue,
+    queue_context
+  );
+
+  if ( deadlock_status == THREAD_QUEUE_DEADLOCK_DETECTED ) {
+    _Thread_queue_Path_release( queue_context );
+    return _Thread_queue_Make_ready_again( the_thread );
+  }
+
+  _Thread_Wait_claim_finalize( the_thread, target_operations );
+  ( *target_operations->enqueue )( target, the_thread, queue_context );
+  _Thread_queue_Path_release( queue_context );
+
+  return false;
+}
+
 void _Thread_queue_Resume(
   Thread_queue_Queue   *queue,
   Thread_Control       *the_thread,
@@ -8,8 +8,8 @@
  * @brief This source file contains the implementation of
  *   _Thread_queue_Flush_default_filter(),
  *   _Thread_queue_Flush_status_object_was_deleted(),
- *   _Thread_queue_Flush_status_unavailable(), and
- *   _Thread_queue_Flush_critical().
+ *   _Thread_queue_Flush_status_unavailable(), _Thread_queue_Flush_critical(),
+ *   and _Thread_queue_Requeue_critical().
  */
 
 /*
@@ -83,6 +83,61 @@ Thread_Control *_Thread_queue_Flush_status_unavailable(
   return the_thread;
 }
 
+static void _Thread_queue_Unblock_removed(
+  Thread_queue_Queue   *queue,
+  Chain_Control        *unblock,
+  Thread_queue_Context *queue_context
+)
+{
+  Chain_Node *node;
+  Chain_Node *tail;
+
+  node = _Chain_First( unblock );
+  tail = _Chain_Tail( unblock );
+
+  if (
+    node != tail
+      || _Thread_queue_Context_get_priority_updates( queue_context ) != 0
+  ) {
+    Per_CPU_Control *cpu_self;
+
+    cpu_self = _Thread_queue_Dispatch_disable( queue_context );
+    _Thread_queue_Queue_release( queue, &queue_context->Lock_context.Lock_context );
+
+    while ( node != tail ) {
+      Scheduler_Node *scheduler_node;
+      Thread_Control *the_thread;
+      Chain_Node     *next;
+
+      next = _Chain_Next( node );
+      scheduler_node = SCHEDULER_NODE_OF_WAIT_PRIORITY_NODE( node );
+      the_thread = _Scheduler_Node_get_owner( scheduler_node );
+      _Thread_Remove_timer_and_unblock( the_thread, queue );
+
+      node = next;
+    }
+
+    _Thread_Priority_update( queue_context );
+    _Thread_Dispatch_enable( cpu_self );
+  } else {
+    _Thread_queue_Queue_release( queue, &queue_context->Lock_context.Lock_context );
+  }
+}
+
+static void _Thread_queue_Add_to_unblock(
+  Chain_Control  *unblock,
+  Thread_Control *the_thread
+)
+{
+  Scheduler_Node *scheduler_node;
+
+  scheduler_node = _Thread_Scheduler_get_home_node( the_thread );
+  _Chain_Append_unprotected(
+    unblock,
+    &scheduler_node->Wait.Priority.Node.Node.Chain
+  );
+}
+
 size_t _Thread_queue_Flush_critical(
   Thread_queue_Queue            *queue,
   const Thread_queue_Operations *operations,
@@ -93,8 +148,6 @@ size_t _Thread_queue_Flush_critical(
   size_t        flushed;
   size_t        priority_updates;
   Chain_Control unblock;
-  Chain_Node   *node;
-  Chain_Node   *tail;
 
   flushed = 0;
   priority_updates = 0;
@@ -129,13 +182,7 @@ size_t _Thread_queue_Flush_critical(
       queue_context
     );
     if ( do_unblock ) {
-      Scheduler_Node *scheduler_node;
-
-      scheduler_node = _Thread_Scheduler_get_home_node( first );
-      _Chain_Append_unprotected(
-        &unblock,
-        &scheduler_node->Wait.Priority.Node.Node.Chain
-      );
+      _Thread_queue_Add_to_unblock( &unblock, first );
     }
 
     priority_updates +=
@@ -143,43 +190,135 @@ size_t _Thread_queue_Flush_critical(
     ++flushed;
   }
 
-  node = _Chain_First( &unblock );
-  tail = _Chain_Tail( &unblock );
+  _Thread_queue_Context_clear_priority_updates( queue_context );
 
-  if ( node != tail ) {
-    Per_CPU_Control *cpu_self;
+  if ( priority_updates != 0 && !_Chain_Is_empty( &unblock ) ) {
+    _Assert( queue->owner != NULL );
+    _Thread_queue_Context_add_priority_update( queue_context, queue->owner );
+  }
 
-    cpu_self = _Thread_queue_Dispatch_disable( queue_context );
-    _Thread_queue_Queue_release( queue, &queue_context->Lock_context.Lock_context );
+  _Thread_queue_Unblock_removed( queue, &unblock, queue_context );
 
-    do {
-      Scheduler_Node *scheduler_node;
-      Thread_Control *the_thread;
-      Chain_Node     *next;
+  return flushed;
+}
 
-      next = _Chain_Next( node );
-      scheduler_node = SCHEDULER_NODE_OF_WAIT_PRIORITY_NODE( node );
-      the_thread = _Scheduler_Node_get_owner( scheduler_node );
-      _Thread_Remove_timer_and_unblock( the_thread, queue );
+static void _Thread_queue_Remove_duplicate_priority_updates(
+  Thread_queue_Context *queue_context,
+  size_t                update_count
+)
+{
+  size_t n;
+  size_t i;
 
-      node = next;
-    } while ( node != tail );
+  n = _Thread_queue_Context_get_priority_updates( queue_context );
+
+  for ( i = update_count; i < n; ++i ) {
+    Thread_Control *the_thread;
+    size_t          j;
 
-    if ( priority_updates != 0 ) {
-      Thread_Control  *owner;
-      ISR_lock_Context lock_context;
+    the_thread = queue_context->Priority.update[ i ];
 
-      owner = queue->owner;
-      _Assert( owner != NULL );
-      _Thread_State_acquire( owner, &lock_context );
-      _Scheduler_Update_priority( owner );
-      _Thread_State_release( owner, &lock_context );
+    for ( j = 0; j < update_count; ++j ) {
+      if ( queue_context->Priority.update[ j ] == the_thread ) {
+        break;
+      }
     }
 
-    _Thread_Dispatch_enable( cpu_self );
-  } else {
-    _Thread_queue_Queue_release( queue, &queue_context->Lock_context.Lock_context );
+    if ( j == update_count ) {
+      queue_context->Priority.update[ update_count ] = the_thread;
+      ++update_count;
+    }
   }
 
-  return flushed;
+  _Thread_queue_Context_restore_priority_updates( queue_context, update_count );
+}
+
+size_t _Thread_queue_Requeue_critical(
+  Thread_queue_Queue            *queue,
+  const Thread_queue_Operations *operations,
+  Thread_queue_Queue            *target,
+  const Thread_queue_Operations *target_operations,
+  ISR_lock_Context              *target_lock_context,
+  size_t                         wake_count,
+  Thread_queue_Flush_filter      filter,
+  Thread_queue_Context          *queue_context
+)
+{
+  size_t        removed;
+  Chain_Control unblock;
+
+  _Assert( queue->owner == NULL );
+
+  removed = 0;
+  _Chain_Initialize_empty( &unblock );
+  _Thread_queue_Context_clear_priority_updates( queue_context );
+
+  while ( true ) {
+    Thread_queue_Heads *heads;
+    Thread_Control     *first;
+    size_t              update_count;
+    bool                do_unblock;
+
+    heads = queue->heads;
+    if ( heads == NULL ) {
+      break;
+    }
+
+    first = ( *operations->first )( heads );
+    first = ( *filter )( first, queue, queue_context );
+    if ( first == NULL ) {
+      break;
+    }
+
+    /*
+     * Each thread moved to the target thread queue may change the priority of
+     * the thread at the end of the thread queue path of the target, for
+     * example through priority inheritance.  These threads are collected in
+     * the queue context without duplicates.  The queue context has only space
+     * for a few of them.  If it is full, then the remaining threads are woken
+     * up instead of moved.  The source thread queue has no owner, so an
+     * extract does not add priority updates.
+     */
+    update_count = _Thread_queue_Context_get_priority_updates( queue_context );
+
+    if (
+      removed < wake_count
+        || update_count == RTEMS_ARRAY_SIZE( queue_context->Priority.update )
+    ) {
+      do_unblock = _Thread_queue_Extract_locked(
+        queue,
+        operations,
+        first,
+        queue_context
+      );
+      _Assert(
+        _Thread_queue_Context_get_priority_updates( queue_context )
+          == update_count
+      );
+    } else {
+      do_unblock = _Thread_queue_Requeue_locked(
+        queue,
+        operations,
+        target,
+        target_operations,
+        first,
+        queue_context
+      );
+      _Thread_queue_Remove_duplicate_priority_updates(
+        queue_context,
+        update_count
+      );
+    }
+
+    if ( do_unblock ) {
+      _Thread_queue_Add_to_unblock( &unblock, first );
+    }
+
+    ++removed;
+  }
+
+  _Thread_queue_Queue_release_critical( target, target_lock_context );
+  _Thread_queue_Unblock_removed( queue, &unblock, queue_context );
+
+  return removed;
 }
@@ -7,8 +7,8 @@
  *
  * @brief This source file contains the definition of
  *   ::_Thread_queue_Operations_default, ::_Thread_queue_Operations_FIFO,
- *   ::_Thread_queue_Operations_priority, and
- *   ::_Thread_queue_Operations_priority_inherit.
+ *   and ::_Thread_queue_Operations_priority_inherit and the implementation of
+ *   the priority and priority bucket thread queue operations.
  */
 
 /*
@@ -44,6 +44,7 @@
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/assert.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/prioritybitmapimpl.h>
 #include <rtems/score/rbtreeimpl.h>
 #include <rtems/score/schedulerimpl.h>
 
@@ -361,7 +362,7 @@ static void _Thread_queue_Priority_queue_extract(
 }
 #endif
 
-static void _Thread_queue_Priority_priority_actions(
+void _Thread_queue_Priority_priority_actions(
   Thread_queue_Queue *queue,
   Priority_Actions   *priority_actions
 )
@@ -595,7 +596,7 @@ static void _Thread_queue_Priority_do_surrender(
   );
 }
 
-static void _Thread_queue_Priority_enqueue(
+void _Thread_queue_Priority_enqueue(
   Thread_queue_Queue   *queue,
   Thread_Control       *the_thread,
   Thread_queue_Context *queue_context
@@ -610,7 +611,7 @@ static void _Thread_queue_Priority_enqueue(
   );
 }
 
-static void _Thread_queue_Priority_extract(
+void _Thread_queue_Priority_extract(
   Thread_queue_Queue   *queue,
   Thread_Control       *the_thread,
   Thread_queue_Context *queue_context
@@ -626,7 +627,7 @@ static void _Thread_queue_Priority_extract(
   );
 }
 
-static Thread_Control *_Thread_queue_Priority_first(
+Thread_Control *_Thread_queue_Priority_first(
   const Thread_queue_Heads *heads
 )
 {
@@ -649,7 +650,7 @@ static Thread_Control *_Thread_queue_Priority_first(
   return _Scheduler_Node_get_owner( scheduler_node );
 }
 
-static Thread_Control *_Thread_queue_Priority_surrender(
+Thread_Control *_Thread_queue_Priority_surrender(
   Thread_queue_Queue   *queue,
   Thread_queue_Heads   *heads,
   Thread_Control       *previous_owner,
@@ -671,6 +672,241 @@ static Thread_Control *_Thread_queue_Priority_surrender(
   return first;
 }
 
+static Thread_queue_Priority_buckets *_Thread_queue_Priority_buckets(
+  Thread_queue_Heads *heads
+)
+{
+#if defined(RTEMS_SMP)
+  /* The buckets are only available in configurations with one scheduler */
+  _Assert( _Scheduler_Count == 1 );
+  return (Thread_queue_Priority_buckets *) &heads->Priority[ 1 ];
+#else
+  return (Thread_queue_Priority_buckets *) &heads[ 1 ];
+#endif
+}
+
+static void _Thread_queue_Priority_bucket_add(
+  Thread_queue_Priority_buckets *buckets,
+  Scheduler_Node                *scheduler_node
+)
+{
+  Priority_bit_map_Information  bit_map_info;
+  Chain_Node                   *node;
+  unsigned int                  priority;
+
+  node = &scheduler_node->Wait.Priority.Node.Node.Chain;
+  priority = (unsigned int) SCHEDULER_PRIORITY_UNMAP(
+    _Priority_Get_priority( &scheduler_node->Wait.Priority )
+  );
+  _Assert( priority <= _Scheduler_Table[ 0 ].maximum_priority );
+
+  _Priority_bit_map_Initialize_information(
+    &buckets->Bit_map,
+    &bit_map_info,
+    priority
+  );
+
+  if ( ( *bit_map_info.minor & bit_map_info.ready_minor ) == 0 ) {
+    _Chain_Initialize_one( &buckets->Fifo[ priority ], node );
+    _Priority_bit_map_Add( &buckets->Bit_map, &bit_map_info );
+  } else {
+    _Chain_Append_unprotected( &buckets->Fifo[ priority ], node );
+  }
+}
+
+static void _Thread_queue_Priority_bucket_remove(
+  Thread_queue_Priority_buckets *buckets,
+  Scheduler_Node                *scheduler_node
+)
+{
+  Chain_Node *node;
+
+  node = &scheduler_node->Wait.Priority.Node.Node.Chain;
+
+  /*
+   * The priority of the thread may have changed since it was added to the
+   * bucket.  A node which is the first and last node of its FIFO is the only
+   * node of the FIFO, so the FIFO can be determined through its head.
+   */
+  if ( _Chain_Is_first( node ) && _Chain_Is_last( node ) ) {
+    Priority_bit_map_Information  bit_map_info;
+    Chain_Control                *fifo;
+
+    fifo = RTEMS_CONTAINER_OF(
+      _Chain_Previous( node ),
+      Chain_Control,
+      Head.Node
+    );
+    _Priority_bit_map_Initialize_information(
+      &buckets->Bit_map,
+      &bit_map_info,
+      (unsigned int) ( fifo - &buckets->Fifo[ 0 ] )
+    );
+    _Priority_bit_map_Remove( &buckets->Bit_map, &bit_map_info );
+  }
+
+  _Chain_Extract_unprotected( node );
+}
+
+void _Thread_queue_Priority_bucket_priority_actions(
+  Thread_queue_Queue *queue,
+  Priority_Actions   *priority_actions
+)
+{
+  Thread_queue_Priority_buckets *buckets;
+  Priority_Aggregation          *priority_aggregation;
+  Scheduler_Node                *scheduler_node;
+
+  _Assert( queue->heads != NULL );
+  buckets = _Thread_queue_Priority_buckets( queue->heads );
+
+  _Assert( !_Priority_Actions_is_empty( priority_actions ) );
+  priority_aggregation = _Priority_Actions_move( priority_actions );
+
+  /*
+   * With one scheduler, each thread has exactly one scheduler node which may
+   * wait on the thread queue, so only priority changes are possible.
+   */
+  _Assert( priority_aggregation->Action.type == PRIORITY_ACTION_CHANGE );
+#if defined(RTEMS_SMP)
+  _Assert( _Priority_Get_next_action( priority_aggregation ) == NULL );
+#endif
+
+  scheduler_node = SCHEDULER_NODE_OF_WAIT_PRIORITY( priority_aggregation );
+  _Thread_queue_Priority_bucket_remove( buckets, scheduler_node );
+  _Thread_queue_Priority_bucket_add( buckets, scheduler_node );
+}
+
+static void _Thread_queue_Priority_bucket_do_initialize(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context,
+  Thread_queue_Heads   *heads
+)
+{
+  Thread_queue_Priority_buckets *buckets;
+
+  (void) queue;
+  (void) queue_context;
+
+  buckets = _Thread_queue_Priority_buckets( heads );
+  _Priority_bit_map_Initialize( &buckets->Bit_map );
+  _Thread_queue_Priority_bucket_add(
+    buckets,
+    _Thread_Scheduler_get_home_node( the_thread )
+  );
+}
+
+static void _Thread_queue_Priority_bucket_do_enqueue(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context,
+  Thread_queue_Heads   *heads
+)
+{
+  (void) queue;
+  (void) queue_context;
+
+  _Thread_queue_Priority_bucket_add(
+    _Thread_queue_Priority_buckets( heads ),
+    _Thread_Scheduler_get_home_node( the_thread )
+  );
+}
+
+static void _Thread_queue_Priority_bucket_do_extract(
+  Thread_queue_Queue   *queue,
+  Thread_queue_Heads   *heads,
+  Thread_Control       *current_or_previous_owner,
+  Thread_queue_Context *queue_context,
+  Thread_Control       *the_thread
+)
+{
+  (void) queue;
+  (void) current_or_previous_owner;
+  (void) queue_context;
+
+  _Thread_queue_Priority_bucket_remove(
+    _Thread_queue_Priority_buckets( heads ),
+    _Thread_Scheduler_get_home_node( the_thread )
+  );
+}
+
+void _Thread_queue_Priority_bucket_enqueue(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Queue_enqueue(
+    queue,
+    the_thread,
+    queue_context,
+    _Thread_queue_Priority_bucket_do_initialize,
+    _Thread_queue_Priority_bucket_do_enqueue
+  );
+}
+
+void _Thread_queue_Priority_bucket_extract(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Queue_extract(
+    queue,
+    queue->heads,
+    NULL,
+    queue_context,
+    the_thread,
+    _Thread_queue_Priority_bucket_do_extract
+  );
+}
+
+Thread_Control *_Thread_queue_Priority_bucket_first(
+  const Thread_queue_Heads *heads
+)
+{
+  const Thread_queue_Priority_buckets *buckets;
+  const Chain_Node                    *first;
+  const Scheduler_Node                *scheduler_node;
+  unsigned int                         priority;
+
+  buckets = _Thread_queue_Priority_buckets( RTEMS_DECONST(
+    Thread_queue_Heads *,
+    heads
+  ) );
+  _Assert( !_Priority_bit_map_Is_empty( &buckets->Bit_map ) );
+  priority = _Priority_bit_map_Get_highest( &buckets->Bit_map );
+  first = _Chain_Immutable_first( &buckets->Fifo[ priority ] );
+  scheduler_node = SCHEDULER_NODE_OF_WAIT_PRIORITY_NODE( first );
+
+  return _Scheduler_Node_get_owner( scheduler_node );
+}
+
+Thread_Control *_Thread_queue_Priority_bucket_surrender(
+  Thread_queue_Queue   *queue,
+  Thread_queue_Heads   *heads,
+  Thread_Control       *previous_owner,
+  Thread_queue_Context *queue_context
+)
+{
+  Thread_Control *first;
+
+  (void) previous_owner;
+
+  first = _Thread_queue_Priority_bucket_first( heads );
+  _Thread_queue_Queue_extract(
+    queue,
+    heads,
+    NULL,
+    queue_context,
+    first,
+    _Thread_queue_Priority_bucket_do_extract
+  );
+
+  return first;
+}
+
 static void _Thread_queue_Priority_inherit_do_priority_actions_action(
   Priority_Aggregation *priority_aggregation,
   Priority_Actions     *priority_actions,
@@ -1514,14 +1750,6 @@ const Thread_queue_Operations _Thread_queue_Operations_FIFO = {
   .first = _Thread_queue_FIFO_first
 };
 
-const Thread_queue_Operations _Thread_queue_Operations_priority = {
-  .priority_actions = _Thread_queue_Priority_priority_actions,
-  .enqueue = _Thread_queue_Priority_enqueue,
-  .extract = _Thread_queue_Priority_extract,
-  .surrender = _Thread_queue_Priority_surrender,
-  .first = _Thread_queue_Priority_first
-};
-
 const Thread_queue_Operations _Thread_queue_Operations_priority_inherit = {
   .priority_actions = _Thread_queue_Priority_inherit_priority_actions,
   .enqueue = _Thread_queue_Priority_inherit_enqueue,
@@ -46,6 +46,11 @@ void _Watchdog_Remove(
 )
 {
   if ( _Watchdog_Is_scheduled( the_watchdog ) ) {
+    if ( _Watchdog_Header_has_wheel( header ) ) {
+      _Watchdog_Wheel_remove( header, the_watchdog );
+      return;
+    }
+
     if ( header->first == &the_watchdog->Node.RBTree ) {
       _Watchdog_Next_first( header, the_watchdog );
     }
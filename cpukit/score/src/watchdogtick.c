@@ -99,16 +99,26 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
   cpu->Watchdog.ticks = ticks;
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
-  first = _Watchdog_Header_first( header );
 
-  if ( first != NULL ) {
-    _Watchdog_Tickle(
+  if ( _Watchdog_Header_has_wheel( header ) ) {
+    _Watchdog_Tickle_wheel(
       header,
-      first,
       ticks,
       &cpu->Watchdog.Lock,
       &lock_context
     );
+  } else {
+    first = _Watchdog_Header_first( header );
+
+    if ( first != NULL ) {
+      _Watchdog_Tickle(
+        header,
+        first,
+        ticks,
+        &cpu->Watchdog.Lock,
+        &lock_context
+      );
+    }
   }
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
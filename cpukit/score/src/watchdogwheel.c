@@ -0,0 +1,321 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Header_initialize_wheel(), _Watchdog_Wheel_insert(),
+ *   _Watchdog_Wheel_remove(), and _Watchdog_Do_tickle_wheel().
+ */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
+
+/*
+ * The timing wheel node shall not overlap with the red-black tree node color
+ * which is used to store the watchdog state.
+ */
+RTEMS_STATIC_ASSERT(
+  offsetof( Watchdog_Control, Node.Wheel.slot ) + sizeof( Chain_Control * )
+    <= offsetof( Watchdog_Control, Node.RBTree.Node.rbe_color ),
+  WATCHDOG_WHEEL_NODE
+);
+
+#define WATCHDOG_WHEEL_SLOT_MASK ( WATCHDOG_WHEEL_SLOTS - 1 )
+
+static unsigned int _Watchdog_Wheel_index(
+  uint64_t     tick,
+  unsigned int level
+)
+{
+  return (unsigned int) ( tick >> ( level * WATCHDOG_WHEEL_SLOT_BITS ) )
+    & WATCHDOG_WHEEL_SLOT_MASK;
+}
+
+static void _Watchdog_Wheel_enqueue(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  uint64_t       tick;
+  uint64_t       delta;
+  Chain_Control *slot;
+  unsigned int   level;
+
+  /*
+   * Watchdogs which expired already are placed in the slot processed next.
+   * During a tickle, this is the slot currently processed.
+   */
+  tick = the_watchdog->expire;
+
+  if ( tick < wheel->due ) {
+    tick = wheel->due;
+  }
+
+  delta = tick - wheel->due;
+  slot = &wheel->overflow;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+    if ( ( delta >> ( ( level + 1 ) * WATCHDOG_WHEEL_SLOT_BITS ) ) == 0 ) {
+      unsigned int index;
+
+      index = _Watchdog_Wheel_index( tick, level );
+      slot = &wheel->slots[ level ][ index ];
+      wheel->occupied[ level ] |= (uint64_t) 1 << index;
+      break;
+    }
+  }
+
+  the_watchdog->Node.Wheel.slot = slot;
+  _Chain_Append_unprotected( slot, &the_watchdog->Node.Wheel.Node );
+}
+
+static RBTree_Node *_Watchdog_Wheel_any( Watchdog_Wheel *wheel )
+{
+  Watchdog_Control *the_watchdog;
+  unsigned int      level;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+    uint64_t occupied;
+
+    occupied = wheel->occupied[ level ];
+
+    if ( occupied != 0 ) {
+      unsigned int index;
+
+      index = (unsigned int) __builtin_ctzll( occupied );
+      the_watchdog =
+        (Watchdog_Control *) _Chain_First( &wheel->slots[ level ][ index ] );
+
+      return &the_watchdog->Node.RBTree;
+    }
+  }
+
+  if ( _Chain_Is_empty( &wheel->overflow ) ) {
+    return NULL;
+  }
+
+  the_watchdog = (Watchdog_Control *) _Chain_First( &wheel->overflow );
+  return &the_watchdog->Node.RBTree;
+}
+
+static void _Watchdog_Wheel_extract(
+  Watchdog_Header  *header,
+  Watchdog_Control *the_watchdog
+)
+{
+  Watchdog_Wheel *wheel;
+  Chain_Control  *slot;
+
+  wheel = header->wheel;
+  slot = the_watchdog->Node.Wheel.slot;
+  _Chain_Extract_unprotected( &the_watchdog->Node.Wheel.Node );
+
+  if ( slot != &wheel->overflow && _Chain_Is_empty( slot ) ) {
+    size_t i;
+
+    i = (size_t) ( slot - &wheel->slots[ 0 ][ 0 ] );
+    wheel->occupied[ i / WATCHDOG_WHEEL_SLOTS ] &=
+      ~( (uint64_t) 1 << ( i % WATCHDOG_WHEEL_SLOTS ) );
+  }
+
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+
+  if ( header->first == &the_watchdog->Node.RBTree ) {
+    header->first = _Watchdog_Wheel_any( wheel );
+  }
+}
+
+static void _Watchdog_Wheel_cascade(
+  Watchdog_Wheel *wheel,
+  Chain_Control  *slot
+)
+{
+  Chain_Node       *node;
+  const Chain_Node *tail;
+
+  /*
+   * Detach the watchdogs from the slot.  Watchdogs of the overflow chain may
+   * be placed on it again.  The next node is obtained before the node is
+   * enqueued, so the enqueue does not disturb the iteration.
+   */
+  node = _Chain_First( slot );
+  tail = _Chain_Immutable_tail( slot );
+  _Chain_Initialize_empty( slot );
+
+  while ( node != tail ) {
+    Chain_Node *next;
+
+    next = _Chain_Next( node );
+    _Watchdog_Wheel_enqueue( wheel, (Watchdog_Control *) node );
+    node = next;
+  }
+}
+
+static void _Watchdog_Wheel_cascade_levels( Watchdog_Wheel *wheel )
+{
+  uint64_t     due;
+  unsigned int top;
+  unsigned int level;
+
+  due = wheel->due;
+
+  if ( ( due & WATCHDOG_WHEEL_SLOT_MASK ) != 0 ) {
+    return;
+  }
+
+  top = 1;
+
+  while (
+    top < WATCHDOG_WHEEL_LEVELS
+      && _Watchdog_Wheel_index( due, top ) == 0
+  ) {
+    ++top;
+  }
+
+  /*
+   * Cascade the higher levels first.  This keeps watchdogs with equal
+   * expiration times in insertion order.
+   */
+  if ( top == WATCHDOG_WHEEL_LEVELS ) {
+    _Watchdog_Wheel_cascade( wheel, &wheel->overflow );
+    --top;
+  }
+
+  for ( level = top; level > 0; --level ) {
+    unsigned int index;
+    uint64_t     bit;
+
+    index = _Watchdog_Wheel_index( due, level );
+    bit = (uint64_t) 1 << index;
+
+    if ( ( wheel->occupied[ level ] & bit ) != 0 ) {
+      wheel->occupied[ level ] &= ~bit;
+      _Watchdog_Wheel_cascade( wheel, &wheel->slots[ level ][ index ] );
+    }
+  }
+}
+
+void _Watchdog_Header_initialize_wheel(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+)
+{
+  unsigned int level;
+
+  wheel->due = now + 1;
+  _Chain_Initialize_empty( &wheel->overflow );
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+    unsigned int index;
+
+    wheel->occupied[ level ] = 0;
+
+    for ( index = 0; index < WATCHDOG_WHEEL_SLOTS; ++index ) {
+      _Chain_Initialize_empty( &wheel->slots[ level ][ index ] );
+    }
+  }
+
+  _Watchdog_Header_initialize( header );
+  header->wheel = wheel;
+}
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Header  *header,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
+
+  the_watchdog->expire = expire;
+  _Watchdog_Wheel_enqueue( header->wheel, the_watchdog );
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_BLACK );
+
+  if ( header->first == NULL ) {
+    header->first = &the_watchdog->Node.RBTree;
+  }
+}
+
+void _Watchdog_Wheel_remove(
+  Watchdog_Header  *header,
+  Watchdog_Control *the_watchdog
+)
+{
+  _Assert( _Watchdog_Is_scheduled( the_watchdog ) );
+  _Watchdog_Wheel_extract( header, the_watchdog );
+}
+
+void _Watchdog_Do_tickle_wheel(
+  Watchdog_Header  *header,
+  uint64_t          now,
+#ifdef RTEMS_SMP
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  Watchdog_Wheel *wheel;
+
+  wheel = header->wheel;
+
+  if ( header->first == NULL ) {
+    wheel->due = now + 1;
+    return;
+  }
+
+  while ( wheel->due <= now ) {
+    Chain_Control *slot;
+
+    _Watchdog_Wheel_cascade_levels( wheel );
+    slot = &wheel->slots[ 0 ][ _Watchdog_Wheel_index( wheel->due, 0 ) ];
+
+    while ( !_Chain_Is_empty( slot ) ) {
+      Watchdog_Control               *first;
+      Watchdog_Service_routine_entry  routine;
+
+      first = (Watchdog_Control *) _Chain_First( slot );
+      _Assert( first->expire <= wheel->due );
+      _Watchdog_Wheel_extract( header, first );
+      routine = first->routine;
+
+      _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+      ( *routine )( first );
+      _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+    }
+
+    ++wheel->due;
+  }
+}
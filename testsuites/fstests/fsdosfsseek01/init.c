@@ -0,0 +1,266 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/dosfs.h>
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSDOSFSSEEK 1";
+
+#define CLUSTER_SIZE 512
+
+#define FILE_COUNT 2
+
+#define FILE_SIZE (256 * CLUSTER_SIZE)
+
+#define READ_COUNT 500
+
+static uint8_t buf[4 * CLUSTER_SIZE];
+
+static uint32_t seed = 1;
+
+static uint32_t next_random(void)
+{
+  seed = seed * 1103515245 + 12345;
+
+  return seed >> 16;
+}
+
+static uint8_t pattern(int f, off_t off)
+{
+  return (uint8_t) (off * 7 + (off >> 9) + f * 13);
+}
+
+static void fill(int f, off_t off, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    buf[i] = pattern(f, off + (off_t) i);
+  }
+}
+
+static void write_at(int fd, int f, off_t off, size_t n)
+{
+  off_t pos;
+  ssize_t m;
+
+  fill(f, off, n);
+
+  pos = lseek(fd, off, SEEK_SET);
+  rtems_test_assert(pos == off);
+
+  m = write(fd, buf, n);
+  rtems_test_assert(m == (ssize_t) n);
+}
+
+static void check_random_reads(int fd, int f, off_t size, off_t zero_begin)
+{
+  int i;
+
+  for (i = 0; i < READ_COUNT; ++i) {
+    off_t off = (off_t) (next_random() % (uint32_t) (size + CLUSTER_SIZE));
+    size_t n = next_random() % sizeof(buf);
+    size_t expected;
+    size_t j;
+    off_t pos;
+    ssize_t m;
+
+    if (off >= size) {
+      expected = 0;
+    } else if (size - off < (off_t) n) {
+      expected = (size_t) (size - off);
+    } else {
+      expected = n;
+    }
+
+    pos = lseek(fd, off, SEEK_SET);
+    rtems_test_assert(pos == off);
+
+    m = read(fd, buf, n);
+    rtems_test_assert(m == (ssize_t) expected);
+
+    for (j = 0; j < expected; ++j) {
+      off_t k = off + (off_t) j;
+
+      if (k >= zero_begin) {
+        rtems_test_assert(buf[j] == 0);
+      } else {
+        rtems_test_assert(buf[j] == pattern(f, k));
+      }
+    }
+  }
+}
+
+static void test(const char *rda, const char *mnt)
+{
+  static const msdos_format_request_param_t rqdata = {
+    .sectors_per_cluster = 1,
+    .quick_format = true
+  };
+
+  int fd[FILE_COUNT];
+  off_t size[FILE_COUNT];
+  off_t pos;
+  int f;
+  int rv;
+
+  rv = msdos_format(rda, &rqdata);
+  rtems_test_assert(rv == 0);
+
+  rv = mount_and_make_target_path(
+    rda,
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  for (f = 0; f < FILE_COUNT; ++f) {
+    char path[32];
+
+    snprintf(path, sizeof(path), "%s/file%i", mnt, f);
+    fd[f] = open(path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(fd[f] >= 0);
+    size[f] = 0;
+  }
+
+  /* Interleave the writes to get fragmented cluster chains */
+  while (size[0] < FILE_SIZE || size[1] < FILE_SIZE) {
+    for (f = 0; f < FILE_COUNT; ++f) {
+      size_t n = CLUSTER_SIZE * (1 + next_random() % 4);
+
+      if (size[f] + (off_t) n > FILE_SIZE) {
+        n = (size_t) (FILE_SIZE - size[f]);
+      }
+
+      write_at(fd[f], f, size[f], n);
+      size[f] += (off_t) n;
+    }
+  }
+
+  for (f = 0; f < FILE_COUNT; ++f) {
+    pos = lseek(fd[f], 0, SEEK_END);
+    rtems_test_assert(pos == FILE_SIZE);
+    check_random_reads(fd[f], f, size[f], size[f]);
+  }
+
+  /* Shrink the files and let them grow again in a different order */
+  for (f = 0; f < FILE_COUNT; ++f) {
+    size[f] = FILE_SIZE / (f + 3) + 100;
+    rv = ftruncate(fd[f], size[f]);
+    rtems_test_assert(rv == 0);
+    check_random_reads(fd[f], f, size[f], size[f]);
+  }
+
+  for (f = FILE_COUNT - 1; f >= 0; --f) {
+    while (size[f] < FILE_SIZE) {
+      size_t n = CLUSTER_SIZE * (1 + next_random() % 4);
+
+      if (size[f] + (off_t) n > FILE_SIZE) {
+        n = (size_t) (FILE_SIZE - size[f]);
+      }
+
+      write_at(fd[f], f, size[f], n);
+      size[f] += (off_t) n;
+    }
+
+    check_random_reads(fd[f], f, size[f], size[f]);
+  }
+
+  /* Extend with zeros and truncate the file to zero */
+  rv = ftruncate(fd[0], FILE_SIZE + 5 * CLUSTER_SIZE);
+  rtems_test_assert(rv == 0);
+  check_random_reads(fd[0], 0, FILE_SIZE + 5 * CLUSTER_SIZE, FILE_SIZE);
+
+  rv = ftruncate(fd[0], 0);
+  rtems_test_assert(rv == 0);
+  check_random_reads(fd[0], 0, 0, 0);
+
+  write_at(fd[0], 0, 0, sizeof(buf));
+  check_random_reads(fd[0], 0, sizeof(buf), sizeof(buf));
+
+  for (f = 0; f < FILE_COUNT; ++f) {
+    rv = close(fd[f]);
+    rtems_test_assert(rv == 0);
+  }
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test("/dev/rda", "/mnt");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -228,7 +228,7 @@ static void test_fat12_root_directory_write( const char *dev_name,
   const char                                            *file_name )
 {
   static const rtems_blkdev_stats fat12_root_dir_stats = {
-    .read_hits            = 11,
+    .read_hits            = 1,
     .read_misses          = 2,
     .read_ahead_transfers = 0,
     .read_blocks          = 2,
@@ -0,0 +1,357 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/imfs.h>
+#include <rtems/libcsupport.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSEXTFILE 1";
+
+#define MEMFILE_MOUNT_POINT "/mem"
+
+#define FILE_SIZE ( 256 * 1024 )
+
+#define IO_SIZE_MAX ( 64 * 1024 )
+
+typedef struct {
+  const char *name;
+  const char *path;
+} backend;
+
+static const backend backends[] = {
+  { "memfile", MEMFILE_MOUNT_POINT "/file" },
+  { "extfile", "/file" }
+};
+
+static const uint32_t io_sizes[] = { 64, 4096, IO_SIZE_MAX };
+
+static uint8_t io_buffer[ IO_SIZE_MAX ];
+
+static uint8_t check_buffer[ 2 ][ IO_SIZE_MAX ];
+
+static uintptr_t heap_used( void )
+{
+  Heap_Information_block info;
+  int                    rv;
+
+  rv = malloc_info( &info );
+  rtems_test_assert( rv == 0 );
+
+  return info.Used.total;
+}
+
+static uint64_t transfer( const char *path, uint32_t io_size, bool do_write )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t            done;
+  int                 fd;
+  int                 rv;
+
+  if ( do_write ) {
+    fd = open( path, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU );
+  } else {
+    fd = open( path, O_RDONLY );
+  }
+  rtems_test_assert( fd >= 0 );
+
+  a = rtems_counter_read();
+
+  for ( done = 0; done < FILE_SIZE; done += io_size ) {
+    ssize_t n;
+
+    if ( do_write ) {
+      n = write( fd, io_buffer, io_size );
+    } else {
+      n = read( fd, io_buffer, io_size );
+    }
+
+    rtems_test_assert( n == (ssize_t) io_size );
+  }
+
+  b = rtems_counter_read();
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static void throughput_print( const char *name, uint64_t ns, const char *end )
+{
+  uint64_t kb_per_s;
+
+  if ( ns == 0 ) {
+    ns = 1;
+  }
+
+  kb_per_s = ( (uint64_t) FILE_SIZE * 1000000 ) / ns;
+
+  printf(
+    "          \"%s\": %" PRIu64 ".%03" PRIu64 "%s\n",
+    name,
+    kb_per_s / 1000,
+    kb_per_s % 1000,
+    end
+  );
+}
+
+static void measure( const backend *be, const char *end )
+{
+  size_t i;
+
+  printf(
+    "    {\n"
+    "      \"backend\": \"%s\",\n"
+    "      \"samples\": [\n",
+    be->name
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( io_sizes ); ++i ) {
+    uintptr_t used;
+    uint64_t  write_ns;
+    uint64_t  read_ns;
+    int       rv;
+
+    used = heap_used();
+    write_ns = transfer( be->path, io_sizes[ i ], true );
+    used = heap_used() - used;
+    read_ns = transfer( be->path, io_sizes[ i ], false );
+
+    rv = unlink( be->path );
+    rtems_test_assert( rv == 0 );
+
+    printf(
+      "        {\n"
+      "          \"io-size\": %" PRIu32 ",\n"
+      "          \"heap-used\": %" PRIuPTR ",\n",
+      io_sizes[ i ],
+      used
+    );
+    throughput_print( "write-mb-per-s", write_ns, "," );
+    throughput_print( "read-mb-per-s", read_ns, "" );
+    printf(
+      "        }%s\n",
+      i + 1 < RTEMS_ARRAY_SIZE( io_sizes ) ? "," : ""
+    );
+  }
+
+  printf( "      ]\n    }%s\n", end );
+}
+
+static void fill( uint32_t seed, size_t n )
+{
+  size_t i;
+
+  for ( i = 0; i < n; ++i ) {
+    seed = seed * 1103515245 + 12345;
+    io_buffer[ i ] = (uint8_t) ( seed >> 16 );
+  }
+}
+
+static void check_equal( const int *fd )
+{
+  off_t size[ 2 ];
+  off_t done;
+  int   i;
+
+  for ( i = 0; i < 2; ++i ) {
+    size[ i ] = lseek( fd[ i ], 0, SEEK_END );
+    rtems_test_assert( size[ i ] >= 0 );
+  }
+
+  rtems_test_assert( size[ 0 ] == size[ 1 ] );
+
+  for ( done = 0; done < size[ 0 ]; done += IO_SIZE_MAX ) {
+    size_t n = IO_SIZE_MAX;
+
+    if ( size[ 0 ] - done < IO_SIZE_MAX ) {
+      n = (size_t) ( size[ 0 ] - done );
+    }
+
+    for ( i = 0; i < 2; ++i ) {
+      ssize_t m;
+
+      rtems_test_assert( lseek( fd[ i ], done, SEEK_SET ) == done );
+      m = read( fd[ i ], check_buffer[ i ], n );
+      rtems_test_assert( m == (ssize_t) n );
+    }
+
+    rtems_test_assert( memcmp( check_buffer[ 0 ], check_buffer[ 1 ], n ) == 0 );
+  }
+}
+
+/*
+ * Apply the same random writes, seeks beyond the end of file and
+ * truncations to both backends and check that the file contents agree.
+ */
+static void check_backends( void )
+{
+  uint32_t seed = 1;
+  int      fd[ 2 ];
+  int      step;
+  int      i;
+  int      rv;
+
+  for ( i = 0; i < 2; ++i ) {
+    fd[ i ] = open( backends[ i ].path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+    rtems_test_assert( fd[ i ] >= 0 );
+  }
+
+  for ( step = 0; step < 200; ++step ) {
+    off_t  off;
+    size_t n;
+
+    seed = seed * 1103515245 + 12345;
+    off = (off_t) ( ( seed >> 8 ) % ( 3 * FILE_SIZE / 2 ) );
+    seed = seed * 1103515245 + 12345;
+    n = ( seed >> 8 ) % IO_SIZE_MAX;
+
+    if ( step % 10 == 9 ) {
+      off_t length = off / 2;
+
+      for ( i = 0; i < 2; ++i ) {
+        rv = ftruncate( fd[ i ], length );
+        rtems_test_assert( rv == 0 );
+      }
+    } else {
+      fill( seed, n );
+
+      for ( i = 0; i < 2; ++i ) {
+        ssize_t m;
+
+        rtems_test_assert( lseek( fd[ i ], off, SEEK_SET ) == off );
+        m = write( fd[ i ], io_buffer, n );
+        rtems_test_assert( m == (ssize_t) n );
+      }
+    }
+
+    if ( step % 20 == 0 ) {
+      check_equal( fd );
+    }
+  }
+
+  check_equal( fd );
+
+  for ( i = 0; i < 2; ++i ) {
+    rv = close( fd[ i ] );
+    rtems_test_assert( rv == 0 );
+
+    rv = unlink( backends[ i ].path );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+static void test( void )
+{
+  size_t i;
+  int    rv;
+
+  rv = mount_and_make_target_path(
+    "",
+    MEMFILE_MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+
+  check_backends();
+
+  memset( io_buffer, 0x5a, sizeof( io_buffer ) );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"file-size\": %" PRIu32 ",\n"
+    "  \"backends\": [\n",
+    (uint32_t) FILE_SIZE
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( backends ); ++i ) {
+    measure(
+      &backends[ i ],
+      i + 1 < RTEMS_ARRAY_SIZE( backends ) ? "," : ""
+    );
+  }
+
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
+
+  rv = unmount( MEMFILE_MOUNT_POINT );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,261 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 19";
+
+#define BLOCK_SIZE 16
+
+#define CACHE_BUFFERS 1024
+
+#define HOT_BLOCKS 64
+
+#define COLD_BLOCKS 1000
+
+#define ROUNDS 10
+
+#define BLOCK_COUNT (HOT_BLOCKS + ROUNDS * COLD_BLOCKS)
+
+#define RANDOM_ACCESSES 50000
+
+#define DISK_PATH "/disk"
+
+static uint32_t read_counts [BLOCK_COUNT];
+
+static uint32_t read_total;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_sg_buffer *sg = &breq->bufs [i];
+
+      rtems_test_assert(sg->block < BLOCK_COUNT);
+      rtems_test_assert(sg->length == BLOCK_SIZE);
+
+      memset(sg->buffer, 0, sg->length);
+      memcpy(sg->buffer, &sg->block, sizeof(sg->block));
+      ++read_counts [sg->block];
+      ++read_total;
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void access_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  rtems_blkdev_bnum content;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(bd->block == block);
+
+  memcpy(&content, bd->buffer, sizeof(content));
+  rtems_test_assert(content == block);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static uint32_t hot_reads(void)
+{
+  uint32_t reads = 0;
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < HOT_BLOCKS; ++block) {
+    reads += read_counts [block];
+  }
+
+  return reads;
+}
+
+static void test_scan_resistance(rtems_disk_device *dd)
+{
+  rtems_blkdev_bnum cold = HOT_BLOCKS;
+  int round;
+
+  /*
+   * Each round accesses the hot blocks twice and then reads a sequence of
+   * cold blocks.  The hot and cold blocks of one round do not fit into the
+   * cache.  The hot blocks are referenced, so the recycle scan passes them
+   * and they stay in the cache.  A plain LRU replacement would read a part of
+   * the hot blocks in each round again.
+   */
+  for (round = 0; round < ROUNDS; ++round) {
+    rtems_blkdev_bnum block;
+    int i;
+
+    for (i = 0; i < 2; ++i) {
+      for (block = 0; block < HOT_BLOCKS; ++block) {
+        access_block(dd, block);
+      }
+    }
+
+    for (i = 0; i < COLD_BLOCKS; ++i) {
+      access_block(dd, cold);
+      ++cold;
+    }
+
+    rtems_test_assert(hot_reads() == HOT_BLOCKS);
+  }
+
+  printf(
+    "scan: reads %" PRIu32 ", hits %" PRIu32 ", misses %" PRIu32 "\n",
+    read_total,
+    dd->stats.read_hits,
+    dd->stats.read_misses
+  );
+}
+
+static void test_random_access(rtems_disk_device *dd)
+{
+  uint32_t seed = 123;
+  uint32_t reads = read_total;
+  uint32_t misses = dd->stats.read_misses;
+  int i;
+
+  /*
+   * Stress the look-up with a random access pattern across all blocks of the
+   * device.  Each miss must lead to exactly one read of the block.
+   */
+  for (i = 0; i < RANDOM_ACCESSES; ++i) {
+    seed = seed * UINT32_C(1103515245) + UINT32_C(12345);
+    access_block(dd, (seed >> 8) % BLOCK_COUNT);
+  }
+
+  rtems_test_assert(
+    read_total - reads == dd->stats.read_misses - misses
+  );
+}
+
+static void test_purge(rtems_disk_device *dd)
+{
+  uint32_t reads;
+
+  access_block(dd, 0);
+  reads = read_total;
+  access_block(dd, 0);
+  rtems_test_assert(read_total == reads);
+
+  rtems_bdbuf_purge_dev(dd);
+
+  access_block(dd, 0);
+  rtems_test_assert(read_total == reads + 1);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DISK_PATH, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_scan_resistance(dd);
+  test_random_access(dd);
+  test_purge(dd);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (CACHE_BUFFERS * BLOCK_SIZE)
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
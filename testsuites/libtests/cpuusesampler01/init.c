@@ -0,0 +1,269 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/cpuuse.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "CPUUSESAMPLER 1";
+
+#define ROUNDS 5
+
+#define HISTORY 4
+
+#define WORKER_BUSY_NS 20000000
+
+#define INIT_BUSY_NS 5000000
+
+typedef struct {
+  rtems_id init;
+  rtems_id worker;
+} test_context;
+
+static test_context test_instance;
+
+static void busy( uint64_t ns )
+{
+  uint64_t end;
+
+  end = rtems_clock_get_uptime_nanoseconds() + ns;
+
+  while ( rtems_clock_get_uptime_nanoseconds() < end ) {
+    /* Wait */
+  }
+}
+
+static void worker_task( rtems_task_argument arg )
+{
+  (void) arg;
+
+  while ( true ) {
+    rtems_event_set   events;
+    rtems_status_code sc;
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    busy( WORKER_BUSY_NS );
+  }
+}
+
+static void check_stats( const rtems_cpu_usage_thread_stats *stats )
+{
+  rtems_test_assert( stats->current <= 100000 );
+  rtems_test_assert( stats->average <= stats->maximum );
+  rtems_test_assert( stats->percentile <= stats->maximum );
+}
+
+static void test_manual( test_context *ctx )
+{
+  rtems_cpu_usage_sampler_config config;
+  rtems_cpu_usage_sampler       *sampler;
+  rtems_cpu_usage_thread_stats   top[ 2 ];
+  rtems_cpu_usage_thread_stats   stats;
+  rtems_status_code              sc;
+  size_t                         n;
+  int                            i;
+
+  memset( &config, 0, sizeof( config ) );
+  config.history = HISTORY;
+  config.batch = 1;
+
+  sc = rtems_cpu_usage_sampler_create( &config, &sampler );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /*
+   * In each period the worker runs for four times as long as the Init task.
+   */
+  for ( i = 0; i < ROUNDS; ++i ) {
+    sc = rtems_event_send( ctx->worker, RTEMS_EVENT_0 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    busy( INIT_BUSY_NS );
+    rtems_cpu_usage_sampler_sample( sampler );
+  }
+
+  n = rtems_cpu_usage_sampler_top(
+    sampler,
+    RTEMS_CPU_USAGE_SAMPLER_ORDER_CURRENT,
+    50,
+    top,
+    RTEMS_ARRAY_SIZE( top )
+  );
+  rtems_test_assert( n == 2 );
+  rtems_test_assert( top[ 0 ].id == ctx->worker );
+  rtems_test_assert( top[ 0 ].samples == HISTORY );
+  rtems_test_assert( top[ 0 ].current > 50000 );
+  rtems_test_assert( top[ 1 ].id == ctx->init );
+  rtems_test_assert( top[ 1 ].current < top[ 0 ].current );
+  check_stats( &top[ 0 ] );
+  check_stats( &top[ 1 ] );
+
+  n = rtems_cpu_usage_sampler_top(
+    sampler,
+    RTEMS_CPU_USAGE_SAMPLER_ORDER_AVERAGE,
+    100,
+    top,
+    1
+  );
+  rtems_test_assert( n == 1 );
+  rtems_test_assert( top[ 0 ].id == ctx->worker );
+  rtems_test_assert( top[ 0 ].percentile == top[ 0 ].maximum );
+
+  n = rtems_cpu_usage_sampler_top(
+    sampler,
+    RTEMS_CPU_USAGE_SAMPLER_ORDER_AVERAGE,
+    100,
+    top,
+    0
+  );
+  rtems_test_assert( n == 0 );
+
+  sc = rtems_cpu_usage_sampler_get( sampler, ctx->worker, 0, &stats );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( stats.id == ctx->worker );
+  rtems_test_assert( stats.samples == HISTORY );
+  rtems_test_assert( stats.maximum == top[ 0 ].maximum );
+  rtems_test_assert( stats.percentile <= stats.average );
+
+  sc = rtems_cpu_usage_sampler_get( sampler, 0, 0, &stats );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  /* A deleted thread is dropped by the next sample */
+  sc = rtems_task_delete( ctx->worker );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_cpu_usage_sampler_sample( sampler );
+
+  sc = rtems_cpu_usage_sampler_get( sampler, ctx->worker, 0, &stats );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  rtems_cpu_usage_sampler_delete( sampler );
+}
+
+static void test_task( test_context *ctx )
+{
+  rtems_cpu_usage_sampler_config config;
+  rtems_cpu_usage_sampler       *sampler;
+  rtems_cpu_usage_thread_stats   stats;
+  rtems_status_code              sc;
+
+  memset( &config, 0, sizeof( config ) );
+  config.period = 1;
+  config.priority = 1;
+
+  sc = rtems_cpu_usage_sampler_create( &config, &sampler );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  busy( 10 * rtems_configuration_get_nanoseconds_per_tick() );
+  sc = rtems_task_wake_after( 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_cpu_usage_sampler_get( sampler, ctx->init, 90, &stats );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( stats.samples > 0 );
+  rtems_test_assert( stats.maximum > 0 );
+  check_stats( &stats );
+
+  rtems_cpu_usage_sampler_delete( sampler );
+}
+
+static void test_invalid( void )
+{
+  rtems_cpu_usage_sampler_config config;
+  rtems_cpu_usage_sampler       *sampler;
+  rtems_status_code              sc;
+
+  memset( &config, 0, sizeof( config ) );
+
+  sc = rtems_cpu_usage_sampler_create( NULL, &sampler );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_cpu_usage_sampler_create( &config, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  rtems_cpu_usage_sampler_delete( NULL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context      *ctx;
+  rtems_status_code  sc;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  ctx->init = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( ctx->worker, worker_task, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_manual( ctx );
+  test_task( ctx );
+  test_invalid();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
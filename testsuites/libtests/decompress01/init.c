@@ -0,0 +1,264 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+
+/*
+ * Note on the used compressed images: The uncompressed content consists of
+ * lines with a six digit decimal line number starting with zero and is
+ * truncated to 32KiB.  The images were generated with the following commands:
+ *
+ * head -c 20000 plain | xz -6 --check=crc32 --block-size=4096 > s1.xz
+ * tail -c +20001 plain | xz -6 --check=crc32 --block-size=4096 > s2.xz
+ * cat s1.xz <(head -c 4 /dev/zero) s2.xz > decompress01.xz
+ *
+ * split -b 8192 plain part. && for f in part.*; do gzip -n -c $f; done \
+ *   > decompress01.gz
+ *
+ * python3 -c 'import sys, zlib; \
+ *   sys.stdout.buffer.write(zlib.compress(sys.stdin.buffer.read(), 9))' \
+ *   < plain > decompress01.zlib
+ *
+ * This gives two concatenated xz streams with stream padding and nine blocks
+ * in total, a gzip file with four members, and a single zlib stream.
+ */
+
+#include <rtems/decompress.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+#include "decompress01-xz.h"
+#include "decompress01-gz.h"
+#include "decompress01-zlib.h"
+
+const char rtems_test_name[] = "DECOMPRESS 1";
+
+#define PLAIN_SIZE 32768
+
+#define WORKER_COUNT_MAX 2
+
+static unsigned char plain[ PLAIN_SIZE ];
+
+static unsigned char output[ PLAIN_SIZE + 1 ];
+
+static void init_plain( void )
+{
+  char   line[ 8 ];
+  size_t i;
+
+  for ( i = 0; i < PLAIN_SIZE; ++i ) {
+    if ( i % 7 == 0 ) {
+      snprintf( line, sizeof( line ), "%06u\n", (unsigned int) ( i / 7 ) );
+    }
+
+    plain[ i ] = (unsigned char) line[ i % 7 ];
+  }
+}
+
+static rtems_status_code decompress(
+  const unsigned char *image,
+  size_t               image_size,
+  uint32_t             worker_count,
+  size_t               window,
+  size_t               chunk_size,
+  size_t              *output_size
+)
+{
+  rtems_decompress_config   config;
+  rtems_decompress_context *ctx;
+  rtems_status_code         sc;
+  size_t                    done;
+
+  memset( &config, 0, sizeof( config ) );
+  config.worker_count = worker_count;
+  config.window = window;
+
+  sc = rtems_decompress_create( image, image_size, &config, &ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  done = 0;
+
+  while ( true ) {
+    size_t n;
+
+    n = sizeof( output ) - done;
+
+    if ( n > chunk_size ) {
+      n = chunk_size;
+    }
+
+    sc = rtems_decompress_read( ctx, &output[ done ], n, &n );
+
+    if ( sc != RTEMS_SUCCESSFUL || n == 0 ) {
+      break;
+    }
+
+    done += n;
+  }
+
+  rtems_decompress_destroy( ctx );
+  *output_size = done;
+
+  return sc;
+}
+
+static void test_image(
+  const char          *name,
+  const unsigned char *image,
+  size_t               image_size
+)
+{
+  uint32_t worker_count;
+
+  for ( worker_count = 0; worker_count <= WORKER_COUNT_MAX; ++worker_count ) {
+    static const size_t chunk_sizes[] = { 1, 1000, sizeof( output ) };
+    size_t              i;
+
+    for ( i = 0; i < RTEMS_ARRAY_SIZE( chunk_sizes ); ++i ) {
+      rtems_status_code sc;
+      size_t            output_size;
+
+      memset( output, 0, sizeof( output ) );
+      sc = decompress(
+        image,
+        image_size,
+        worker_count,
+        i + 1,
+        chunk_sizes[ i ],
+        &output_size
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      rtems_test_assert( output_size == PLAIN_SIZE );
+      rtems_test_assert( memcmp( output, plain, PLAIN_SIZE ) == 0 );
+    }
+  }
+
+  printf( "%s: successful\n", name );
+}
+
+static void test_corrupt_image(
+  const char          *name,
+  const unsigned char *image,
+  size_t               image_size
+)
+{
+  unsigned char     *corrupt;
+  rtems_status_code  sc;
+  size_t             output_size;
+
+  corrupt = malloc( image_size );
+  rtems_test_assert( corrupt != NULL );
+  memcpy( corrupt, image, image_size );
+  corrupt[ image_size / 2 ] ^= 0x55;
+
+  sc = decompress(
+    corrupt,
+    image_size,
+    WORKER_COUNT_MAX,
+    0,
+    sizeof( output ),
+    &output_size
+  );
+  rtems_test_assert( sc == RTEMS_IO_ERROR );
+  rtems_test_assert( output_size < PLAIN_SIZE );
+  rtems_test_assert( memcmp( output, plain, output_size ) == 0 );
+
+  free( corrupt );
+  printf( "%s: corrupt image detected\n", name );
+}
+
+static void test_invalid( void )
+{
+  static const unsigned char unknown[] = "unknown format";
+  rtems_decompress_config    config;
+  rtems_decompress_context  *ctx;
+  rtems_status_code          sc;
+
+  memset( &config, 0, sizeof( config ) );
+
+  sc = rtems_decompress_create( NULL, 0, &config, &ctx );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_decompress_create( unknown, sizeof( unknown ), NULL, &ctx );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_decompress_create( unknown, sizeof( unknown ), &config, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_decompress_create( unknown, sizeof( unknown ), &config, &ctx );
+  rtems_test_assert( sc == RTEMS_NOT_IMPLEMENTED );
+
+  /* The truncated xz stream has no valid stream footer */
+  sc = rtems_decompress_create(
+    decompress01_xz,
+    decompress01_xz_size - 1,
+    &config,
+    &ctx
+  );
+  rtems_test_assert( sc == RTEMS_IO_ERROR );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  init_plain();
+  test_image( "xz", decompress01_xz, decompress01_xz_size );
+  test_image( "gzip", decompress01_gz, decompress01_gz_size );
+  test_image( "zlib", decompress01_zlib, decompress01_zlib_size );
+  test_corrupt_image( "xz", decompress01_xz, decompress01_xz_size );
+  test_corrupt_image( "gzip", decompress01_gz, decompress01_gz_size );
+  test_invalid();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS ( 1 + WORKER_COUNT_MAX )
+
+#define CONFIGURE_EXTRA_TASK_STACKS \
+  ( WORKER_COUNT_MAX * 2 * RTEMS_MINIMUM_STACK_SIZE )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
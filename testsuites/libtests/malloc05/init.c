@@ -0,0 +1,219 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <rtems/libcsupport.h>
+#include <rtems/malloc.h>
+#include <rtems/score/threaddispatch.h>
+
+const char rtems_test_name[] = "MALLOC 5";
+
+#define OBJECT_COUNT 64
+
+/*
+ * Use volatile to prevent compiler optimizations due to the malloc() and
+ * free() builtins.
+ */
+static void * volatile objects[ OBJECT_COUNT ];
+
+static Heap_Cache_information get_cache_information( void )
+{
+  Heap_Information_block info;
+  int                    rv;
+
+  rv = malloc_info( &info );
+  rtems_test_assert( rv == 0 );
+
+  return info.Cache;
+}
+
+static void test_reuse( void )
+{
+  Heap_Cache_information before;
+  Heap_Cache_information after;
+  void                  *p;
+
+  puts( "malloc/free/malloc of small object reuses the cached object" );
+  before = get_cache_information();
+
+  objects[ 0 ] = malloc( 24 );
+  rtems_test_assert( objects[ 0 ] != NULL );
+  p = objects[ 0 ];
+  free( objects[ 0 ] );
+  objects[ 0 ] = malloc( 17 );
+  rtems_test_assert( objects[ 0 ] == p );
+  free( objects[ 0 ] );
+
+  after = get_cache_information();
+  rtems_test_assert( after.allocs == before.allocs + 2 );
+  rtems_test_assert( after.frees == before.frees + 2 );
+}
+
+static void test_bypass( void )
+{
+  Heap_Cache_information before;
+  Heap_Cache_information after;
+
+  puts( "large and aligned allocations bypass the cache" );
+  before = get_cache_information();
+
+  objects[ 0 ] = malloc( 1000 );
+  rtems_test_assert( objects[ 0 ] != NULL );
+  free( objects[ 0 ] );
+
+  objects[ 0 ] = rtems_heap_allocate_aligned_with_boundary( 32, 64, 0 );
+  rtems_test_assert( objects[ 0 ] != NULL );
+  rtems_test_assert( ( (uintptr_t) objects[ 0 ] % 64 ) == 0 );
+
+  after = get_cache_information();
+  rtems_test_assert( after.allocs == before.allocs );
+  rtems_test_assert( after.frees == before.frees );
+
+  /* The freed area of an aligned allocation may enter the cache */
+  free( objects[ 0 ] );
+}
+
+static void test_refill_and_drain( void )
+{
+  Heap_Cache_information before;
+  Heap_Cache_information after;
+  size_t                 i;
+
+  puts( "refill and drain the cache in batches" );
+  before = get_cache_information();
+
+  for ( i = 0; i < OBJECT_COUNT; ++i ) {
+    objects[ i ] = malloc( 100 );
+    rtems_test_assert( objects[ i ] != NULL );
+  }
+
+  after = get_cache_information();
+  rtems_test_assert( after.allocs == before.allocs + OBJECT_COUNT );
+  rtems_test_assert( after.refills > before.refills );
+  rtems_test_assert( after.refills < before.refills + OBJECT_COUNT );
+
+  for ( i = 0; i < OBJECT_COUNT; ++i ) {
+    free( objects[ i ] );
+  }
+
+  after = get_cache_information();
+  rtems_test_assert( after.frees == before.frees + OBJECT_COUNT );
+  rtems_test_assert( after.drains > before.drains );
+  rtems_test_assert( after.blocks < before.blocks + OBJECT_COUNT );
+  rtems_test_assert( malloc_walk( 0, false ) );
+}
+
+static void test_deferred_free( void )
+{
+  Heap_Cache_information before;
+  Heap_Cache_information after;
+  Per_CPU_Control       *cpu_self;
+  void                  *p;
+
+  puts( "deferred free ends up in the cache" );
+  objects[ 0 ] = malloc( 40 );
+  rtems_test_assert( objects[ 0 ] != NULL );
+  p = objects[ 0 ];
+
+  before = get_cache_information();
+  cpu_self = _Thread_Dispatch_disable();
+  free( objects[ 0 ] );
+  _Thread_Dispatch_enable( cpu_self );
+  after = get_cache_information();
+  rtems_test_assert( after.frees == before.frees );
+
+  /* The heap allocation path processes the deferred frees */
+  objects[ 0 ] = malloc( 1000 );
+  rtems_test_assert( objects[ 0 ] != NULL );
+  free( objects[ 0 ] );
+
+  after = get_cache_information();
+  rtems_test_assert( after.frees == before.frees + 1 );
+
+  objects[ 0 ] = malloc( 40 );
+  rtems_test_assert( objects[ 0 ] == p );
+  free( objects[ 0 ] );
+}
+
+static void test_tag_in_user_data( void )
+{
+  Heap_Cache_information  before;
+  Heap_Cache_information  after;
+  volatile uintptr_t     *words;
+  void                   *p;
+
+  puts( "free of object with user data equal to the cache tag" );
+  objects[ 0 ] = malloc( 24 );
+  rtems_test_assert( objects[ 0 ] != NULL );
+  p = objects[ 0 ];
+
+  /* This is the tag used by the cache to detect a double free */
+  words = p;
+  words[ 1 ] = ~(uintptr_t) p ^ (uintptr_t) 0x6d63616cU;
+
+  before = get_cache_information();
+  free( objects[ 0 ] );
+  after = get_cache_information();
+  rtems_test_assert( after.frees == before.frees + 1 );
+
+  objects[ 0 ] = malloc( 24 );
+  rtems_test_assert( objects[ 0 ] == p );
+  free( objects[ 0 ] );
+}
+
+static rtems_task Init( rtems_task_argument argument )
+{
+  TEST_BEGIN();
+
+  test_reuse();
+  test_bypass();
+  test_refill_and_drain();
+  test_deferred_free();
+  test_tag_in_user_data();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
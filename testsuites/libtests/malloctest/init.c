@@ -1109,6 +1109,132 @@ static void test_heap_no_extend(void)
   rtems_test_assert( extended_space == 0 );
 }
 
+#define SEGREGATED_AREA_SIZE 16384
+
+#define SEGREGATED_SEGMENT_COUNT 32
+
+static uint8_t SegregatedHeapMemory[ 4 * SEGREGATED_AREA_SIZE ]
+  RTEMS_ALIGNED( CPU_HEAP_ALIGNMENT );
+
+static uint32_t segregated_random( uint32_t *seed )
+{
+  /* Simple linear congruential generator to get reproducible results */
+  *seed = *seed * 1103515245 + 12345;
+
+  return *seed >> 8;
+}
+
+static void test_heap_segregated_operations(
+  Heap_Control *heap,
+  void **segments,
+  uint32_t *seed,
+  int count
+)
+{
+  int i;
+
+  for ( i = 0; i < count; ++i ) {
+    uint32_t r = segregated_random( seed );
+    size_t j = r % SEGREGATED_SEGMENT_COUNT;
+    uintptr_t size = 1 + ( r >> 8 ) % 512;
+
+    if ( segments[ j ] == NULL ) {
+      if ( ( r & 0x80 ) != 0 ) {
+        segments[ j ] = _Heap_Allocate_aligned( heap, size, 64 );
+        rtems_test_assert( ( (uintptr_t) segments[ j ] & 63 ) == 0 );
+      } else {
+        segments[ j ] = _Heap_Allocate( heap, size );
+      }
+    } else if ( ( r & 0x80 ) != 0 ) {
+      Heap_Resize_status status;
+      uintptr_t old_size;
+      uintptr_t new_size;
+
+      status = _Heap_Resize_block(
+        heap,
+        segments[ j ],
+        size,
+        &old_size,
+        &new_size
+      );
+      rtems_test_assert(
+        status == HEAP_RESIZE_SUCCESSFUL
+          || status == HEAP_RESIZE_UNSATISFIED
+      );
+    } else {
+      rtems_test_assert( _Heap_Free( heap, segments[ j ] ) );
+      segments[ j ] = NULL;
+    }
+
+    rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+  }
+}
+
+static void test_heap_segregated_fit(void)
+{
+  Heap_Control *heap = &TestHeap;
+  uint8_t *area_begin = SegregatedHeapMemory;
+  void *segments[ SEGREGATED_SEGMENT_COUNT ];
+  uint32_t seed = 123;
+  uintptr_t rv;
+  bool ret;
+  size_t i;
+  void *p;
+
+  memset( segments, 0, sizeof( segments ) );
+
+  rv = _Heap_Initialize( heap, area_begin, SEGREGATED_AREA_SIZE, 0 );
+  rtems_test_assert( rv > 0 );
+  rtems_test_assert( heap->segregated == NULL );
+
+  ret = _Heap_Enable_segregated_fit( heap );
+  rtems_test_assert( ret );
+  rtems_test_assert( heap->segregated != NULL );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+
+  /* Enabling it again has no effect */
+  p = heap->segregated;
+  ret = _Heap_Enable_segregated_fit( heap );
+  rtems_test_assert( ret );
+  rtems_test_assert( heap->segregated == p );
+
+  test_heap_segregated_operations( heap, segments, &seed, 1000 );
+
+  /* Merge above */
+  ret = _Protected_heap_Extend(
+    heap,
+    area_begin + SEGREGATED_AREA_SIZE,
+    SEGREGATED_AREA_SIZE
+  );
+  test_heap_assert( ret, true );
+
+  test_heap_segregated_operations( heap, segments, &seed, 1000 );
+
+  /* Link above */
+  ret = _Protected_heap_Extend(
+    heap,
+    area_begin + 3 * SEGREGATED_AREA_SIZE,
+    SEGREGATED_AREA_SIZE
+  );
+  test_heap_assert( ret, true );
+
+  test_heap_segregated_operations( heap, segments, &seed, 1000 );
+
+  for ( i = 0; i < SEGREGATED_SEGMENT_COUNT; ++i ) {
+    if ( segments[ i ] != NULL ) {
+      rtems_test_assert( _Heap_Free( heap, segments[ i ] ) );
+      rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+    }
+  }
+
+  /* The first two areas form one free block */
+  p = _Heap_Allocate( heap, SEGREGATED_AREA_SIZE );
+  rtems_test_assert( p != NULL );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+  rtems_test_assert( _Heap_Free( heap, p ) );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+}
+
 static void free_all_delayed_blocks( void )
 {
   rtems_resource_snapshot unused;
@@ -1451,6 +1577,7 @@ rtems_task Init(
   test_heap_extend_allocation_order();
   test_heap_extend_allocation_order_with_empty_heap();
   test_heap_no_extend();
+  test_heap_segregated_fit();
   test_heap_info();
   test_heap_size_with_overhead();
   test_protected_heap_info();
@@ -0,0 +1,263 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+
+#include <rtems/recordclient.h>
+#include <rtems/recorddrain.h>
+#include <rtems.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <zlib.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "RECORD 5";
+
+#define TRACE_FILE "/trace"
+
+#define SEQUENCE_COUNT 2000
+
+#define BURST_COUNT 1000
+
+#define STREAM_SIZE_MAX ( 256 * 1024 )
+
+typedef struct {
+  rtems_record_client_context client;
+  rtems_record_drain_control  drain;
+  unsigned char               stream[ STREAM_SIZE_MAX ];
+  unsigned char               raw[ STREAM_SIZE_MAX ];
+  uint64_t                    next_sequence;
+  uint64_t                    burst_count;
+  uint64_t                    client_overflow;
+} test_context;
+
+static test_context test_instance;
+
+static rtems_record_client_status client_handler(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  test_context *ctx;
+
+  (void) bt;
+  (void) cpu;
+  ctx = arg;
+
+  switch ( event ) {
+    case RTEMS_RECORD_USER_0:
+      rtems_test_assert( data == ctx->next_sequence );
+      ++ctx->next_sequence;
+      break;
+    case RTEMS_RECORD_USER_1:
+      ++ctx->burst_count;
+      break;
+    case RTEMS_RECORD_PER_CPU_OVERFLOW:
+      ctx->client_overflow += data;
+      break;
+    default:
+      break;
+  }
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static size_t read_stream( test_context *ctx )
+{
+  ssize_t n;
+  int     fd;
+  int     rv;
+
+  fd = open( TRACE_FILE, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  n = read( fd, ctx->stream, sizeof( ctx->stream ) );
+  rtems_test_assert( n > 0 );
+  rtems_test_assert( n < (ssize_t) sizeof( ctx->stream ) );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( TRACE_FILE );
+  rtems_test_assert( rv == 0 );
+
+  return (size_t) n;
+}
+
+static size_t uncompress_stream( test_context *ctx, size_t size )
+{
+  z_stream stream;
+  int      err;
+
+  memset( &stream, 0, sizeof( stream ) );
+  err = inflateInit( &stream );
+  rtems_test_assert( err == Z_OK );
+
+  stream.next_in = ctx->stream;
+  stream.avail_in = size;
+  stream.next_out = ctx->raw;
+  stream.avail_out = sizeof( ctx->raw );
+
+  err = inflate( &stream, Z_FINISH );
+  rtems_test_assert( err == Z_STREAM_END );
+  size = sizeof( ctx->raw ) - stream.avail_out;
+
+  err = inflateEnd( &stream );
+  rtems_test_assert( err == Z_OK );
+
+  return size;
+}
+
+static void test_drain( test_context *ctx, bool compress )
+{
+  rtems_record_drain_config     config;
+  rtems_record_drain_statistics stats;
+  rtems_record_client_status    cs;
+  rtems_status_code             sc;
+  const unsigned char          *data;
+  size_t                        size;
+  int                           fd;
+  int                           i;
+  int                           rv;
+
+  fd = open( TRACE_FILE, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  memset( &config, 0, sizeof( config ) );
+  config.fd = fd;
+  config.priority = 2;
+  config.period = 1;
+  config.buffer_size = 512;
+  config.compress = compress;
+
+  sc = rtems_record_drain_start( &ctx->drain, &config );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* A slow producer, the drain keeps up */
+  for ( i = 0; i < SEQUENCE_COUNT; ++i ) {
+    rtems_record_produce( RTEMS_RECORD_USER_0, (rtems_record_data) i );
+
+    if ( i % 50 == 49 ) {
+      sc = rtems_task_wake_after( 1 );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    }
+  }
+
+  sc = rtems_task_wake_after( 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( rtems_record_drain_get_overflow( &ctx->drain, 0 ) == 0 );
+
+  /* A burst which overflows the record buffer */
+  for ( i = 0; i < BURST_COUNT; ++i ) {
+    rtems_record_produce( RTEMS_RECORD_USER_1, (rtems_record_data) i );
+  }
+
+  rtems_record_drain_stop( &ctx->drain );
+  rtems_record_drain_get_statistics( &ctx->drain, &stats );
+  rtems_test_assert( stats.write_error == 0 );
+  rtems_test_assert( stats.item_count >= SEQUENCE_COUNT );
+  rtems_test_assert( rtems_record_drain_get_overflow( &ctx->drain, 0 ) > 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  size = read_stream( ctx );
+  rtems_test_assert( stats.byte_count == size );
+
+  if ( compress ) {
+    size = uncompress_stream( ctx, size );
+    data = ctx->raw;
+  } else {
+    data = ctx->stream;
+  }
+
+  ctx->next_sequence = 0;
+  ctx->burst_count = 0;
+  ctx->client_overflow = 0;
+  cs = rtems_record_client_init( &ctx->client, client_handler, ctx );
+  rtems_test_assert( cs == RTEMS_RECORD_CLIENT_SUCCESS );
+  cs = rtems_record_client_run( &ctx->client, data, size );
+  rtems_test_assert( cs == RTEMS_RECORD_CLIENT_SUCCESS );
+  rtems_record_client_destroy( &ctx->client );
+
+  rtems_test_assert( ctx->next_sequence == SEQUENCE_COUNT );
+  rtems_test_assert( ctx->burst_count < BURST_COUNT );
+  rtems_test_assert(
+    ctx->client_overflow == rtems_record_drain_get_overflow( &ctx->drain, 0 )
+  );
+  rtems_test_assert( ctx->burst_count + ctx->client_overflow >= BURST_COUNT );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  test_drain( ctx, false );
+  test_drain( ctx, true );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS 128
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,263 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/stackchk.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "STACKCHK05";
+
+#define SCAN_WORDS 16
+
+#define FRAME_SIZE 256
+
+#define DEPTH 8
+
+typedef struct {
+  rtems_id init;
+  rtems_id worker;
+  rtems_id visited_id;
+  uintptr_t visited_used;
+} test_context;
+
+static test_context test_instance;
+
+static void wait_for_event( rtems_id init )
+{
+  rtems_event_set   events;
+  rtems_status_code sc;
+
+  sc = rtems_event_send( init, RTEMS_EVENT_0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_event_receive(
+    RTEMS_EVENT_0,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void RTEMS_NO_INLINE use_stack( rtems_id init, int depth )
+{
+  volatile char frame[ FRAME_SIZE ];
+
+  memset( RTEMS_DEVOLATILE( char *, frame ), 0, sizeof( frame ) );
+
+  if ( depth > 1 ) {
+    use_stack( init, depth - 1 );
+  } else {
+    wait_for_event( init );
+  }
+
+  frame[ 0 ] = frame[ 1 ];
+}
+
+static void worker_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+  wait_for_event( ctx->init );
+  use_stack( ctx->init, DEPTH );
+
+  while ( true ) {
+    wait_for_event( ctx->init );
+  }
+}
+
+static void wait_for_worker( void )
+{
+  rtems_event_set   events;
+  rtems_status_code sc;
+
+  sc = rtems_event_receive(
+    RTEMS_EVENT_0,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void wake_worker( test_context *ctx )
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_send( ctx->worker, RTEMS_EVENT_0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  wait_for_worker();
+}
+
+static void visit( const rtems_stack_checker_info *info, void *arg )
+{
+  test_context *ctx;
+
+  ctx = arg;
+
+  if ( info->id == ctx->worker ) {
+    ctx->visited_id = info->id;
+    ctx->visited_used = info->used;
+  }
+}
+
+static uintptr_t converge( test_context *ctx, uintptr_t used )
+{
+  rtems_stack_checker_info info;
+  rtems_status_code        sc;
+  uintptr_t                steps;
+  uintptr_t                i;
+
+  sc = rtems_stack_checker_get_usage( ctx->worker, &info );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( info.id == ctx->worker );
+  rtems_test_assert( info.name == NULL );
+  rtems_test_assert( info.used >= used );
+  rtems_test_assert( info.used <= info.size );
+
+  /* Each invocation examines at most SCAN_WORDS stack words */
+  steps = info.size / ( 4 * SCAN_WORDS ) + 2;
+
+  for ( i = 0; i < steps; ++i ) {
+    used = info.used;
+    sc = rtems_stack_checker_get_usage( ctx->worker, &info );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_assert( info.used >= used );
+  }
+
+  /* The full scan of the usage report yields the same high water mark */
+  ctx->visited_id = 0;
+  rtems_stack_checker_iterate( visit, ctx );
+  rtems_test_assert( ctx->visited_id == ctx->worker );
+  rtems_test_assert( ctx->visited_used == info.used );
+
+  return info.used;
+}
+
+static void test_usage( test_context *ctx )
+{
+  uintptr_t used;
+  uintptr_t deep;
+
+  /* The worker waits in its task body */
+  wait_for_worker();
+  used = converge( ctx, 0 );
+  rtems_test_assert( used > 0 );
+
+  /* The worker waits in the deepest frame of use_stack() */
+  wake_worker( ctx );
+  deep = converge( ctx, used );
+  rtems_test_assert( deep > used + DEPTH * FRAME_SIZE / 2 );
+
+  /* The worker waits in its task body again, the high water mark stays */
+  wake_worker( ctx );
+  (void) converge( ctx, deep );
+}
+
+static void test_invalid( void )
+{
+  rtems_stack_checker_info info;
+  rtems_status_code        sc;
+
+  sc = rtems_stack_checker_get_usage( RTEMS_SELF, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_stack_checker_get_usage( 0, &info );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_stack_checker_get_usage( RTEMS_SELF, &info );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( info.id == rtems_task_self() );
+  rtems_test_assert( info.used > 0 );
+  rtems_test_assert( info.used <= info.size );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context      *ctx;
+  rtems_status_code  sc;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  ctx->init = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE + DEPTH * FRAME_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start(
+    ctx->worker,
+    worker_task,
+    (rtems_task_argument) ctx
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_usage( ctx );
+  test_invalid();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_STACK_CHECKER_ENABLED
+
+#define CONFIGURE_STACK_CHECKER_SWITCH_SAMPLING
+
+#define CONFIGURE_STACK_CHECKER_SCAN_WORDS SCAN_WORDS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
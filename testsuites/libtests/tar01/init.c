@@ -64,6 +64,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -84,6 +85,7 @@ void test_untar_from_file(void);
 void test_untar_chunks_from_memory(void);
 void test_untar_unzip_tgz(void);
 void test_untar_unzip_txz(void);
+void test_untar_pipelined(void);
 
 #define TARFILE_START    tar01_tar
 #define TARFILE_SIZE     tar01_tar_size
@@ -501,6 +503,76 @@ void test_untar_unzip_txz(void)
 #endif
 }
 
+void test_untar_pipelined(void)
+{
+  int status;
+  int rv;
+  Untar_PipelineConfig config;
+  Untar_PipelineStatistics stats;
+  Untar_Pipeline *pipeline;
+  Untar_GzChunkContext ctx;
+  size_t i = 0;
+  char *buffer = (char *)TARFILE_GZ_START;
+  size_t buflen = TARFILE_GZ_SIZE;
+  char inflate_buffer[100];
+
+  puts( "" );
+
+  /*
+   * Use small write buffers, so that the writers run out of buffers.
+   */
+  memset( &config, 0, sizeof( config ) );
+  config.buffer_size = 1;
+  config.buffer_count = 2;
+  config.worker_count = 2;
+
+  /* make a directory to untar it into */
+  rv = mkdir( "/dest5", 0777 );
+  rtems_test_assert( rv == 0 );
+
+  rv = chdir( "/dest5" );
+  rtems_test_assert( rv == 0 );
+
+  printf( "Untaring pipelined from file - " );
+  rv = Untar_FromFile_Pipelined_Print( "/test.tar", &config, NULL );
+  rtems_test_assert( rv == UNTAR_SUCCESSFUL );
+  assert_content_like_expected();
+  printf( "successful\n" );
+  test_untar_check_mode("/dest5/home/abc/def/test_script", 0755);
+
+  /* make a directory to untar it into */
+  rv = mkdir( "/dest6", 0777 );
+  rtems_test_assert( rv == 0 );
+
+  rv = chdir( "/dest6" );
+  rtems_test_assert( rv == 0 );
+
+  printf( "Untaring pipelined chunks from tgz - " );
+
+  pipeline = Untar_Pipeline_Create( &config );
+  rtems_test_assert( pipeline != NULL );
+
+  status = Untar_GzChunkContext_Init(
+    &ctx,
+    &inflate_buffer[0],
+    sizeof(inflate_buffer)
+  );
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+  Untar_ChunkContext_Set_pipeline(&ctx.base, pipeline);
+  for(i = 0; i < buflen; i++) {
+    status = Untar_FromGzChunk_Print(&ctx, &buffer[i], 1, NULL);
+    rtems_test_assert(status == UNTAR_SUCCESSFUL);
+  }
+
+  status = Untar_Pipeline_Destroy( pipeline, &stats, NULL );
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+  rtems_test_assert( stats.files == 3 );
+  rtems_test_assert( stats.input_bytes == TARFILE_SIZE );
+  rtems_test_assert( stats.write_bytes == 21 + 73 + 12 );
+  assert_content_like_expected();
+  printf( "successful\n" );
+}
+
 rtems_task Init(
   rtems_task_argument ignored
 )
@@ -512,6 +584,7 @@ rtems_task Init(
   test_untar_chunks_from_memory();
   test_untar_unzip_tgz();
   test_untar_unzip_txz();
+  test_untar_pipelined();
 
   TEST_END();
   exit( 0 );
@@ -522,8 +595,10 @@ rtems_task Init(
 #define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
 #define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
 
-#define CONFIGURE_MAXIMUM_TASKS            1
-#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+#define CONFIGURE_MAXIMUM_TASKS            3
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_EXTRA_TASK_STACKS (2 * 2 * RTEMS_MINIMUM_STACK_SIZE)
 
 #define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
 
@@ -0,0 +1,257 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+#include "tmtests_sample.h"
+
+#include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/thread.h>
+
+const char rtems_test_name[] = "PSXTMCOND 11";
+
+#define WAITER_MAX 256
+
+#define SAMPLE_COUNT 100
+
+#define PRIO_WAITER 20
+
+#define PRIO_INIT 40
+
+typedef struct {
+  rtems_mutex              mutex;
+  rtems_condition_variable condition;
+  uint32_t                 waiter_count;
+  uint32_t                 resumed;
+  rtems_counter_ticks      t2;
+} test_context;
+
+static test_context test_instance = {
+  .mutex = RTEMS_MUTEX_INITIALIZER( "Mutex" ),
+  .condition = RTEMS_CONDITION_VARIABLE_INITIALIZER( "Condition" )
+};
+
+static const uint32_t waiter_counts[] = {
+  1,
+  16,
+  64,
+  WAITER_MAX
+};
+
+static void set_self_priority( int priority )
+{
+  struct sched_param param;
+  int                eno;
+
+  param.sched_priority = priority;
+  eno = pthread_setschedparam( pthread_self(), SCHED_FIFO, &param );
+  rtems_test_assert( eno == 0 );
+}
+
+static void create_thread(
+  pthread_t *thread,
+  int        priority,
+  void    *( *entry )( void * )
+)
+{
+  pthread_attr_t     attr;
+  struct sched_param param;
+  int                eno;
+
+  eno = pthread_attr_init( &attr );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_attr_setinheritsched( &attr, PTHREAD_EXPLICIT_SCHED );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_attr_setschedpolicy( &attr, SCHED_FIFO );
+  rtems_test_assert( eno == 0 );
+
+  param.sched_priority = priority;
+  eno = pthread_attr_setschedparam( &attr, &param );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_attr_setstacksize( &attr, PTHREAD_STACK_MIN );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_create( thread, &attr, entry, &test_instance );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_attr_destroy( &attr );
+  rtems_test_assert( eno == 0 );
+}
+
+/*
+ * Each waiter passes the critical section once per broadcast and then waits
+ * again on the condition variable.  The last waiter records the time.
+ */
+static void *waiter( void *arg )
+{
+  test_context *ctx;
+
+  ctx = arg;
+  rtems_mutex_lock( &ctx->mutex );
+
+  while ( true ) {
+    rtems_condition_variable_wait( &ctx->condition, &ctx->mutex );
+
+    ++ctx->resumed;
+
+    if ( ctx->resumed == ctx->waiter_count ) {
+      ctx->t2 = rtems_counter_read();
+    }
+  }
+
+  return NULL;
+}
+
+static void let_waiters_run( void )
+{
+  /* Let the waiters with a priority lower than ours run until they block */
+  set_self_priority( 1 );
+  set_self_priority( PRIO_INIT );
+}
+
+static void add_waiters( test_context *ctx, uint32_t count )
+{
+  while ( ctx->waiter_count < count ) {
+    pthread_t thread;
+
+    create_thread( &thread, PRIO_WAITER, waiter );
+    ++ctx->waiter_count;
+  }
+
+  let_waiters_run();
+}
+
+static void measure( test_context *ctx, const char *end )
+{
+  rtems_test_sample broadcast_sample;
+  rtems_test_sample resume_sample;
+  uint32_t          i;
+
+  rtems_test_sample_init( &broadcast_sample );
+  rtems_test_sample_init( &resume_sample );
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_counter_ticks t0;
+    rtems_counter_ticks t1;
+
+    ctx->resumed = 0;
+
+    rtems_mutex_lock( &ctx->mutex );
+    t0 = rtems_counter_read();
+    rtems_condition_variable_broadcast( &ctx->condition );
+    t1 = rtems_counter_read();
+    rtems_mutex_unlock( &ctx->mutex );
+
+    let_waiters_run();
+    rtems_test_assert( ctx->resumed == ctx->waiter_count );
+
+    rtems_test_sample_add(
+      &broadcast_sample,
+      rtems_counter_difference( t1, t0 )
+    );
+    rtems_test_sample_add(
+      &resume_sample,
+      rtems_counter_difference( ctx->t2, t1 )
+    );
+  }
+
+  printf(
+    "    {\n"
+    "      \"waiters\": %" PRIu32 ",\n",
+    ctx->waiter_count
+  );
+  rtems_test_sample_print(
+    &broadcast_sample,
+    6,
+    "rtems_condition_variable_broadcast",
+    ","
+  );
+  rtems_test_sample_print( &resume_sample, 6, "all-waiters-resumed", "" );
+  printf( "    }%s\n", end );
+}
+
+static void test( void )
+{
+  test_context *ctx;
+  size_t        i;
+
+  ctx = &test_instance;
+  set_self_priority( PRIO_INIT );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": [\n"
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( waiter_counts ); ++i ) {
+    add_waiters( ctx, waiter_counts[ i ] );
+    measure( ctx, i + 1 < RTEMS_ARRAY_SIZE( waiter_counts ) ? "," : "" );
+  }
+
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
+}
+
+static void *POSIX_Init( void *arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS ( 1 + WAITER_MAX )
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
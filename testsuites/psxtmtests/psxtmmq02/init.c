@@ -0,0 +1,254 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+
+#include "tmacros.h"
+#include "tmtests_sample.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <mqueue.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "PSXTMMQ 2";
+
+#define DEPTH_MAX 4096
+
+#define SAMPLE_COUNT 1000
+
+typedef struct {
+  uint32_t priority;
+  uint32_t sequence;
+} message;
+
+typedef struct {
+  mqd_t    queue;
+  uint32_t depth;
+  uint32_t sequence;
+  uint32_t random;
+} test_context;
+
+static test_context test_instance;
+
+static const uint32_t depths[] = {
+  16,
+  256,
+  1024,
+  DEPTH_MAX
+};
+
+static uint32_t random_priority( test_context *ctx )
+{
+  ctx->random = ctx->random * 1103515245 + 12345;
+
+  return ( ctx->random >> 8 ) % ( MQ_PRIO_MAX + 1 );
+}
+
+static void send_message( test_context *ctx, uint32_t priority )
+{
+  message msg;
+  int     rv;
+
+  msg.priority = priority;
+  msg.sequence = ctx->sequence;
+  ++ctx->sequence;
+
+  rv = mq_send( ctx->queue, (const char *) &msg, sizeof( msg ), priority );
+  rtems_test_assert( rv == 0 );
+}
+
+static void receive_message( test_context *ctx, message *msg )
+{
+  unsigned int priority;
+  ssize_t      n;
+
+  n = mq_receive( ctx->queue, (char *) msg, sizeof( *msg ), &priority );
+  rtems_test_assert( n == (ssize_t) sizeof( *msg ) );
+  rtems_test_assert( priority == msg->priority );
+}
+
+static void fill( test_context *ctx, uint32_t depth )
+{
+  while ( ctx->depth < depth ) {
+    send_message( ctx, random_priority( ctx ) );
+    ++ctx->depth;
+  }
+}
+
+/*
+ * Receive all pending messages and check that they arrive in priority order
+ * and in FIFO order within a priority.
+ */
+static void drain( test_context *ctx )
+{
+  message previous;
+
+  previous.priority = UINT32_MAX;
+  previous.sequence = 0;
+
+  while ( ctx->depth > 0 ) {
+    message msg;
+
+    receive_message( ctx, &msg );
+    rtems_test_assert( msg.priority <= previous.priority );
+
+    if ( msg.priority == previous.priority ) {
+      rtems_test_assert( msg.sequence > previous.sequence );
+    }
+
+    previous = msg;
+    --ctx->depth;
+  }
+}
+
+static void measure(
+  test_context *ctx,
+  const char   *name,
+  bool          lowest,
+  const char   *end
+)
+{
+  rtems_test_sample send_sample;
+  rtems_test_sample receive_sample;
+  uint32_t          i;
+
+  rtems_test_sample_init( &send_sample );
+  rtems_test_sample_init( &receive_sample );
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks c;
+    uint32_t            priority;
+    message             msg;
+
+    /*
+     * The lowest priority message is enqueued behind all other pending
+     * messages.  The receive keeps the queue depth constant.
+     */
+    priority = lowest ? 0 : random_priority( ctx );
+
+    a = rtems_counter_read();
+    send_message( ctx, priority );
+    b = rtems_counter_read();
+    receive_message( ctx, &msg );
+    c = rtems_counter_read();
+
+    rtems_test_sample_add( &send_sample, rtems_counter_difference( b, a ) );
+    rtems_test_sample_add( &receive_sample, rtems_counter_difference( c, b ) );
+  }
+
+  printf( "      \"%s\": {\n", name );
+  rtems_test_sample_print( &send_sample, 8, "mq_send", "," );
+  rtems_test_sample_print( &receive_sample, 8, "mq_receive", "" );
+  printf( "      }%s\n", end );
+}
+
+static void test( void )
+{
+  test_context   *ctx;
+  struct mq_attr  attr;
+  size_t          i;
+  int             rv;
+
+  ctx = &test_instance;
+  ctx->random = 1;
+
+  attr.mq_maxmsg = DEPTH_MAX + 1;
+  attr.mq_msgsize = sizeof( message );
+  ctx->queue = mq_open( "queue", O_CREAT | O_RDWR, 0777, &attr );
+  rtems_test_assert( ctx->queue != (mqd_t) -1 );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": [\n"
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( depths ); ++i ) {
+    printf(
+      "    {\n"
+      "      \"depth\": %" PRIu32 ",\n",
+      depths[ i ]
+    );
+
+    fill( ctx, depths[ i ] );
+    measure( ctx, "random-priority", false, "," );
+    measure( ctx, "lowest-priority", true, "" );
+    drain( ctx );
+
+    printf(
+      "    }%s\n",
+      i + 1 < RTEMS_ARRAY_SIZE( depths ) ? "," : ""
+    );
+  }
+
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
+
+  rv = mq_close( ctx->queue );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_unlink( "queue" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void *POSIX_Init( void *arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS 1
+
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
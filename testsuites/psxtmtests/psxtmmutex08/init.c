@@ -0,0 +1,312 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+#include "tmtests_sample.h"
+
+#include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "PSXTMMUTEX 8";
+
+#define WAITER_MAX 256
+
+#define SAMPLE_COUNT 100
+
+#define PRIO_FILLER( i ) ( 2 + ( i ) % 32 )
+
+#define PRIO_INIT 40
+
+#define PRIO_B 50
+
+#define PRIO_A 60
+
+typedef struct {
+  pthread_mutex_t     mutex;
+  sem_t               a_go;
+  pthread_t           a;
+  pthread_t           b;
+  uint32_t            filler_count;
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  rtems_counter_ticks t2;
+} test_context;
+
+static test_context test_instance;
+
+static const uint32_t waiter_counts[] = {
+  0,
+  16,
+  64,
+  WAITER_MAX
+};
+
+static void set_self_priority( int priority )
+{
+  struct sched_param param;
+  int                eno;
+
+  param.sched_priority = priority;
+  eno = pthread_setschedparam( pthread_self(), SCHED_FIFO, &param );
+  rtems_test_assert( eno == 0 );
+}
+
+static void create_thread(
+  pthread_t *thread,
+  int        priority,
+  void    *( *entry )( void * )
+)
+{
+  pthread_attr_t     attr;
+  struct sched_param param;
+  int                eno;
+
+  eno = pthread_attr_init( &attr );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_attr_setinheritsched( &attr, PTHREAD_EXPLICIT_SCHED );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_attr_setschedpolicy( &attr, SCHED_FIFO );
+  rtems_test_assert( eno == 0 );
+
+  param.sched_priority = priority;
+  eno = pthread_attr_setschedparam( &attr, &param );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_attr_setstacksize( &attr, PTHREAD_STACK_MIN );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_create( thread, &attr, entry, &test_instance );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_attr_destroy( &attr );
+  rtems_test_assert( eno == 0 );
+}
+
+static void *filler( void *arg )
+{
+  test_context *ctx;
+
+  ctx = arg;
+
+  /* The fillers wait forever */
+  (void) pthread_mutex_lock( &ctx->mutex );
+  rtems_test_assert( 0 );
+
+  return NULL;
+}
+
+/*
+ * Thread A has the highest priority which is equal to the priority ceiling
+ * of the mutex.  Each round, it unlocks the mutex which makes thread B, the
+ * highest priority waiter, the new owner.  Thread B inherits the priority
+ * ceiling, so thread A is not preempted.  Thread A then waits for the mutex
+ * in front of the fillers with lower priorities.  Thread B unlocks the mutex
+ * to give it back to thread A.
+ */
+static void *thread_a( void *arg )
+{
+  test_context *ctx;
+  int           eno;
+  int           rv;
+
+  ctx = arg;
+
+  eno = pthread_mutex_lock( &ctx->mutex );
+  rtems_test_assert( eno == 0 );
+
+  while ( true ) {
+    rv = sem_wait( &ctx->a_go );
+    rtems_test_assert( rv == 0 );
+
+    ctx->t0 = rtems_counter_read();
+    eno = pthread_mutex_unlock( &ctx->mutex );
+    ctx->t1 = rtems_counter_read();
+    rtems_test_assert( eno == 0 );
+
+    eno = pthread_mutex_lock( &ctx->mutex );
+    rtems_test_assert( eno == 0 );
+  }
+
+  return NULL;
+}
+
+static void *thread_b( void *arg )
+{
+  test_context *ctx;
+  int           eno;
+
+  ctx = arg;
+
+  while ( true ) {
+    eno = pthread_mutex_lock( &ctx->mutex );
+    ctx->t2 = rtems_counter_read();
+    rtems_test_assert( eno == 0 );
+
+    eno = pthread_mutex_unlock( &ctx->mutex );
+    rtems_test_assert( eno == 0 );
+  }
+
+  return NULL;
+}
+
+static void add_fillers( test_context *ctx, uint32_t count )
+{
+  while ( ctx->filler_count < count ) {
+    pthread_t thread;
+
+    create_thread( &thread, PRIO_FILLER( ctx->filler_count ), filler );
+    ++ctx->filler_count;
+  }
+
+  /* Let the fillers with a priority lower than ours wait for the mutex */
+  set_self_priority( 1 );
+  set_self_priority( PRIO_INIT );
+}
+
+static void measure( test_context *ctx, const char *end )
+{
+  rtems_test_sample unlock_sample;
+  rtems_test_sample lock_sample;
+  uint32_t          i;
+
+  rtems_test_sample_init( &unlock_sample );
+  rtems_test_sample_init( &lock_sample );
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    int rv;
+
+    rv = sem_post( &ctx->a_go );
+    rtems_test_assert( rv == 0 );
+
+    rtems_test_sample_add(
+      &unlock_sample,
+      rtems_counter_difference( ctx->t1, ctx->t0 )
+    );
+    rtems_test_sample_add(
+      &lock_sample,
+      rtems_counter_difference( ctx->t2, ctx->t1 )
+    );
+  }
+
+  printf(
+    "    {\n"
+    "      \"waiters\": %" PRIu32 ",\n",
+    ctx->filler_count + 1
+  );
+  rtems_test_sample_print( &unlock_sample, 6, "pthread_mutex_unlock", "," );
+  rtems_test_sample_print( &lock_sample, 6, "pthread_mutex_lock-blocking", "" );
+  printf( "    }%s\n", end );
+}
+
+static void test( void )
+{
+  test_context        *ctx;
+  pthread_mutexattr_t  attr;
+  size_t               i;
+  int                  eno;
+  int                  rv;
+
+  ctx = &test_instance;
+  set_self_priority( PRIO_INIT );
+
+  eno = pthread_mutexattr_init( &attr );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutexattr_setprotocol( &attr, PTHREAD_PRIO_PROTECT );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutexattr_setprioceiling( &attr, PRIO_A );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_init( &ctx->mutex, &attr );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutexattr_destroy( &attr );
+  rtems_test_assert( eno == 0 );
+
+  rv = sem_init( &ctx->a_go, 0, 0 );
+  rtems_test_assert( rv == 0 );
+
+  create_thread( &ctx->a, PRIO_A, thread_a );
+  create_thread( &ctx->b, PRIO_B, thread_b );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": [\n"
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( waiter_counts ); ++i ) {
+    add_fillers( ctx, waiter_counts[ i ] );
+    measure( ctx, i + 1 < RTEMS_ARRAY_SIZE( waiter_counts ) ? "," : "" );
+  }
+
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
+}
+
+static void *POSIX_Init( void *arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS ( 3 + WAITER_MAX )
+
+/* Use the priority bucket thread queue operations */
+#define CONFIGURE_MAXIMUM_PRIORITY 63
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
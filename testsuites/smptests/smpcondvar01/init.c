@@ -0,0 +1,203 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/lock.h>
+
+#include <tmacros.h>
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "SMPCONDVAR 1";
+
+#define PRIO_INIT 3
+
+#define PRIO_WORKER 2
+
+typedef struct {
+  struct _Mutex_Control mtx;
+  struct _Mutex_Control mtx_2;
+  struct _Mutex_Control mtx_3;
+  struct _Condition_Control cond;
+  volatile bool waiter_done;
+  volatile bool owner_done;
+  volatile bool owner_2_done;
+} test_context;
+
+static test_context test_instance = {
+  .mtx = _MUTEX_INITIALIZER,
+  .mtx_2 = _MUTEX_INITIALIZER,
+  .mtx_3 = _MUTEX_INITIALIZER,
+  .cond = _CONDITION_INITIALIZER
+};
+
+static void suspend_self(void)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void waiter_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  _Mutex_Acquire(&ctx->mtx);
+  _Condition_Wait(&ctx->cond, &ctx->mtx);
+  _Mutex_Release(&ctx->mtx);
+
+  ctx->waiter_done = true;
+  suspend_self();
+}
+
+static void owner_2_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  _Mutex_Acquire(&ctx->mtx_2);
+  _Mutex_Acquire(&ctx->mtx_3);
+  _Condition_Wait(&ctx->cond, &ctx->mtx_2);
+  _Mutex_Release(&ctx->mtx_3);
+  _Mutex_Release(&ctx->mtx_2);
+
+  ctx->owner_2_done = true;
+  suspend_self();
+}
+
+static void owner_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  _Mutex_Acquire(&ctx->mtx);
+  _Mutex_Acquire(&ctx->mtx_3);
+  _Mutex_Release(&ctx->mtx_3);
+  _Mutex_Release(&ctx->mtx);
+
+  ctx->owner_done = true;
+  suspend_self();
+}
+
+static rtems_id start_task(test_context *ctx, rtems_task_entry entry)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    PRIO_WORKER,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, entry, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void delete_task(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+/*
+ * The waiter is the first thread on the condition variable.  The mutex of the
+ * waiter is owned by a thread which waits for a mutex owned by the second
+ * thread on the condition variable.  The broadcast cannot move the waiter to
+ * the thread queue of its mutex, since the thread queue path of the mutex
+ * leads to the condition variable.  The broadcast must not try to acquire the
+ * lock of the condition variable again.
+ */
+static void test_broadcast_path_to_condition(test_context *ctx)
+{
+  rtems_id waiter;
+  rtems_id owner;
+  rtems_id owner_2;
+
+  waiter = start_task(ctx, waiter_task);
+  owner_2 = start_task(ctx, owner_2_task);
+  owner = start_task(ctx, owner_task);
+
+  rtems_test_assert(!ctx->waiter_done);
+  rtems_test_assert(!ctx->owner_done);
+  rtems_test_assert(!ctx->owner_2_done);
+
+  _Condition_Broadcast(&ctx->cond);
+
+  rtems_test_assert(ctx->waiter_done);
+  rtems_test_assert(ctx->owner_done);
+  rtems_test_assert(ctx->owner_2_done);
+
+  delete_task(waiter);
+  delete_task(owner);
+  delete_task(owner_2);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test_broadcast_path_to_condition(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+/*
+ * Use one processor, so that the worker tasks run in a deterministic order
+ * with respect to the lower priority Init task.
+ */
+#define CONFIGURE_MAXIMUM_PROCESSORS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_INIT
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
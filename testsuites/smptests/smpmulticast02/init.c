@@ -0,0 +1,263 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <tmacros.h>
+#include "tmtests_sample.h"
+
+const char rtems_test_name[] = "SMPMULTICAST 2";
+
+#define CPU_COUNT 32
+
+#define ACTION_COUNT 4
+
+#define SAMPLE_COUNT 100
+
+typedef struct {
+  Processor_mask targets;
+  SMP_Multicast_request requests[ACTION_COUNT];
+  Per_CPU_Job_batch batch;
+  uint32_t calls[CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static void action(void *arg)
+{
+  test_context *ctx;
+
+  ctx = arg;
+  ++ctx->calls[_SMP_Get_current_processor()];
+}
+
+/*
+ * Each target processor shall call the action handler exactly the expected
+ * count of times and the other processors shall not call it.
+ */
+static void check_calls(test_context *ctx, uint32_t expected)
+{
+  uint32_t cpu_index;
+
+  for (cpu_index = 0; cpu_index < CPU_COUNT; ++cpu_index) {
+    if (_Processor_mask_Is_set(&ctx->targets, cpu_index)) {
+      rtems_test_assert(ctx->calls[cpu_index] == expected);
+    } else {
+      rtems_test_assert(ctx->calls[cpu_index] == 0);
+    }
+
+    ctx->calls[cpu_index] = 0;
+  }
+}
+
+static rtems_counter_ticks measure_sync(test_context *ctx)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+
+  t0 = rtems_counter_read();
+  _SMP_Multicast_action(&ctx->targets, action, ctx);
+  t1 = rtems_counter_read();
+
+  check_calls(ctx, 1);
+  return rtems_counter_difference(t1, t0);
+}
+
+static rtems_counter_ticks measure_sequential(test_context *ctx)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  size_t i;
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < ACTION_COUNT; ++i) {
+    _SMP_Multicast_action(&ctx->targets, action, ctx);
+  }
+
+  t1 = rtems_counter_read();
+
+  check_calls(ctx, ACTION_COUNT);
+  return rtems_counter_difference(t1, t0);
+}
+
+static rtems_counter_ticks measure_batch(test_context *ctx)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  size_t i;
+
+  t0 = rtems_counter_read();
+  _Per_CPU_Initialize_job_batch(&ctx->batch);
+
+  for (i = 0; i < ACTION_COUNT; ++i) {
+    _SMP_Multicast_action_add_to_batch(
+      &ctx->batch,
+      &ctx->requests[i],
+      &ctx->targets,
+      action,
+      ctx
+    );
+  }
+
+  _Per_CPU_Submit_job_batch(&ctx->batch);
+
+  for (i = 0; i < ACTION_COUNT; ++i) {
+    _SMP_Multicast_action_wait(&ctx->requests[i]);
+  }
+
+  t1 = rtems_counter_read();
+
+  check_calls(ctx, ACTION_COUNT);
+  return rtems_counter_difference(t1, t0);
+}
+
+static rtems_counter_ticks measure_async_issue(test_context *ctx)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+
+  t0 = rtems_counter_read();
+  _SMP_Multicast_action_async(&ctx->requests[0], &ctx->targets, action, ctx);
+  t1 = rtems_counter_read();
+  _SMP_Multicast_action_wait(&ctx->requests[0]);
+
+  rtems_test_assert(_SMP_Multicast_action_is_done(&ctx->requests[0]));
+  check_calls(ctx, 1);
+  return rtems_counter_difference(t1, t0);
+}
+
+static void measure(test_context *ctx, uint32_t target_count, const char *end)
+{
+  rtems_test_sample sync_sample;
+  rtems_test_sample sequential_sample;
+  rtems_test_sample batch_sample;
+  rtems_test_sample async_sample;
+  uint32_t i;
+
+  rtems_test_sample_init(&sync_sample);
+  rtems_test_sample_init(&sequential_sample);
+  rtems_test_sample_init(&batch_sample);
+  rtems_test_sample_init(&async_sample);
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    Per_CPU_Control *cpu_self;
+
+    cpu_self = _Thread_Dispatch_disable();
+    rtems_test_sample_add(&sync_sample, measure_sync(ctx));
+    rtems_test_sample_add(&sequential_sample, measure_sequential(ctx));
+    rtems_test_sample_add(&batch_sample, measure_batch(ctx));
+    rtems_test_sample_add(&async_sample, measure_async_issue(ctx));
+    _Thread_Dispatch_enable(cpu_self);
+  }
+
+  printf(
+    "    {\n"
+    "      \"targets\": %" PRIu32 ",\n",
+    target_count
+  );
+  rtems_test_sample_print(&sync_sample, 6, "multicast", ",");
+  rtems_test_sample_print(&sequential_sample, 6, "multicast-sequential", ",");
+  rtems_test_sample_print(&batch_sample, 6, "multicast-batch", ",");
+  rtems_test_sample_print(&async_sample, 6, "multicast-async-issue", "");
+  printf("    }%s\n", end);
+}
+
+/*
+ * The processors are added one by one to the set of target processors, so
+ * that the multicast action latency can be compared for different processor
+ * counts.  The sequential and batch variants carry out ACTION_COUNT actions.
+ */
+static void test(test_context *ctx)
+{
+  const Processor_mask *online;
+  uint32_t online_count;
+  uint32_t target_count;
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  online = _SMP_Get_online_processors();
+  online_count = _Processor_mask_Count(online);
+  cpu_max = rtems_scheduler_get_processor_maximum();
+  _Processor_mask_Zero(&ctx->targets);
+  target_count = 0;
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"actions-per-batch\": %i,\n"
+    "  \"samples\": [\n",
+    ACTION_COUNT
+  );
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+    if (_Processor_mask_Is_set(online, cpu_index)) {
+      _Processor_mask_Set(&ctx->targets, cpu_index);
+      ++target_count;
+      measure(ctx, target_count, target_count < online_count ? "," : "");
+    }
+  }
+
+  printf(
+    "  ]\n"
+    "}\n"
+    "*** END OF JSON DATA ***\n"
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
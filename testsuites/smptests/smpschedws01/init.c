@@ -0,0 +1,310 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "SMPSCHEDWS 1";
+
+#define CPU_COUNT 4
+
+#define SCHED_COUNT 2
+
+#define PAIR_COUNT 8
+
+#define PRIO_INIT 1
+
+#define PRIO_WORKER(i) (UINT32_C(2) + (i) % 4)
+
+#define PING RTEMS_EVENT_0
+
+#define PONG RTEMS_EVENT_1
+
+typedef struct {
+  rtems_id ping_id;
+  rtems_id pong_id;
+  volatile uint32_t rounds;
+} test_pair;
+
+typedef struct {
+  rtems_id scheduler_ids[SCHED_COUNT];
+  test_pair pairs[PAIR_COUNT];
+  uint32_t duration;
+} test_context;
+
+static test_context test_instance;
+
+static const rtems_name scheduler_names[SCHED_COUNT] = {
+  rtems_build_name('P', 'R', 'I', 'O'),
+  rtems_build_name('W', 'S', ' ', ' ')
+};
+
+static const char * const scheduler_labels[SCHED_COUNT] = {
+  "priority-smp",
+  "ws-smp"
+};
+
+static void ping_task(rtems_task_argument arg)
+{
+  test_pair *pair;
+
+  pair = (test_pair *) arg;
+
+  while (true) {
+    rtems_event_set events;
+    rtems_status_code sc;
+
+    sc = rtems_event_send(pair->pong_id, PING);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_receive(
+      PONG,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++pair->rounds;
+  }
+}
+
+static void pong_task(rtems_task_argument arg)
+{
+  test_pair *pair;
+
+  pair = (test_pair *) arg;
+
+  while (true) {
+    rtems_event_set events;
+    rtems_status_code sc;
+
+    sc = rtems_event_receive(
+      PING,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_send(pair->ping_id, PONG);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static rtems_id create_task(
+  rtems_name name,
+  rtems_task_priority priority,
+  rtems_id scheduler_id
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    name,
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_scheduler(id, scheduler_id, priority);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+/*
+ * There are more worker tasks than processors, so that the ready queues are
+ * not empty and the scheduler has to decide which task runs next.
+ */
+static uint32_t measure(test_context *ctx, rtems_id scheduler_id)
+{
+  rtems_status_code sc;
+  uint32_t rounds;
+  uint32_t i;
+
+  for (i = 0; i < PAIR_COUNT; ++i) {
+    test_pair *pair;
+
+    pair = &ctx->pairs[i];
+    pair->rounds = 0;
+    pair->ping_id = create_task(
+      rtems_build_name('P', 'I', 'N', 'G'),
+      PRIO_WORKER(i),
+      scheduler_id
+    );
+    pair->pong_id = create_task(
+      rtems_build_name('P', 'O', 'N', 'G'),
+      PRIO_WORKER(i),
+      scheduler_id
+    );
+  }
+
+  for (i = 0; i < PAIR_COUNT; ++i) {
+    test_pair *pair;
+
+    pair = &ctx->pairs[i];
+
+    sc = rtems_task_start(pair->pong_id, pong_task, (rtems_task_argument) pair);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(pair->ping_id, ping_task, (rtems_task_argument) pair);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_wake_after(ctx->duration);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rounds = 0;
+
+  for (i = 0; i < PAIR_COUNT; ++i) {
+    test_pair *pair;
+
+    pair = &ctx->pairs[i];
+
+    sc = rtems_task_delete(pair->ping_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_delete(pair->pong_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    rounds += pair->rounds;
+  }
+
+  return rounds;
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t s;
+
+  for (s = 0; s < SCHED_COUNT; ++s) {
+    sc = rtems_scheduler_ident(scheduler_names[s], &ctx->scheduler_ids[s]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  ctx->duration = rtems_clock_get_ticks_per_second();
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"processors-per-scheduler\": %i,\n"
+    "  \"task-pairs\": %i,\n"
+    "  \"duration-ticks\": %" PRIu32 ",\n"
+    "  \"schedulers\": [\n",
+    CPU_COUNT / SCHED_COUNT,
+    PAIR_COUNT,
+    ctx->duration
+  );
+
+  for (s = 0; s < SCHED_COUNT; ++s) {
+    uint32_t rounds;
+
+    rounds = measure(ctx, ctx->scheduler_ids[s]);
+
+    printf(
+      "    {\n"
+      "      \"scheduler\": \"%s\",\n"
+      "      \"rounds\": %" PRIu32 "\n"
+      "    }%s\n",
+      scheduler_labels[s],
+      rounds,
+      s + 1 < SCHED_COUNT ? "," : ""
+    );
+  }
+
+  printf(
+    "  ]\n"
+    "}\n"
+    "*** END OF JSON DATA ***\n"
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  if (rtems_scheduler_get_processor_maximum() == CPU_COUNT) {
+    test(&test_instance);
+  } else {
+    puts("warning: wrong processor count to run the test");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + 2 * PAIR_COUNT)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+#define CONFIGURE_SCHEDULER_WS_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_PRIORITY_SMP(a, 8);
+
+RTEMS_SCHEDULER_WS_SMP(b, 8);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(a, rtems_build_name('P', 'R', 'I', 'O')), \
+  RTEMS_SCHEDULER_TABLE_WS_SMP(b, rtems_build_name('W', 'S', ' ', ' '))
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_INIT
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
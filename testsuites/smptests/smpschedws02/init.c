@@ -0,0 +1,331 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "SMPSCHEDWS 2";
+
+#define CPU_COUNT 4
+
+#define WORKER_COUNT 4
+
+#define PRIO_INIT 1
+
+#define PRIO_HIGH 5
+
+#define PRIO_MID 6
+
+#define PRIO_LOW 7
+
+#define PRIO_IDLE 10
+
+typedef struct {
+  rtems_id id;
+  volatile uint32_t cpu;
+  volatile uint32_t counter;
+} test_worker;
+
+typedef struct {
+  rtems_id scheduler_id;
+  test_worker workers[WORKER_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_worker *worker;
+
+  worker = (test_worker *) arg;
+
+  while (true) {
+    worker->cpu = rtems_scheduler_get_processor();
+    ++worker->counter;
+  }
+}
+
+static void set_affinity(rtems_id id, uint32_t cpus)
+{
+  rtems_status_code sc;
+  cpu_set_t set;
+  uint32_t cpu_index;
+
+  CPU_ZERO(&set);
+
+  for (cpu_index = 0; cpu_index < CPU_COUNT; ++cpu_index) {
+    if ((cpus & (UINT32_C(1) << cpu_index)) != 0) {
+      CPU_SET((int) cpu_index, &set);
+    }
+  }
+
+  sc = rtems_task_set_affinity(id, sizeof(set), &set);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void start_worker(
+  test_context *ctx,
+  size_t index,
+  rtems_task_priority priority,
+  uint32_t cpus
+)
+{
+  rtems_status_code sc;
+  test_worker *worker;
+
+  worker = &ctx->workers[index];
+  worker->cpu = UINT32_MAX;
+  worker->counter = 0;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &worker->id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_affinity(worker->id, cpus);
+
+  sc = rtems_task_start(
+    worker->id,
+    worker_task,
+    (rtems_task_argument) worker
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_worker(test_context *ctx, size_t index)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete(ctx->workers[index].id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void suspend_worker(test_context *ctx, size_t index)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_suspend(ctx->workers[index].id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_for_processor(const test_worker *worker, uint32_t cpu_index)
+{
+  while (worker->cpu != cpu_index) {
+    /* Wait */
+  }
+}
+
+static void wait_for_run(const test_worker *worker)
+{
+  while (worker->counter == 0) {
+    /* Wait */
+  }
+}
+
+static bool is_not_running(const test_worker *worker)
+{
+  uint32_t counter;
+
+  counter = worker->counter;
+  rtems_counter_delay_nanoseconds(1000000);
+  return worker->counter == counter;
+}
+
+/*
+ * A task moves to the processor selected by its affinity set.
+ */
+static void test_affinity(test_context *ctx)
+{
+  start_worker(ctx, 0, PRIO_HIGH, UINT32_C(1) << 2);
+  wait_for_run(&ctx->workers[0]);
+  rtems_test_assert(ctx->workers[0].cpu == 2);
+
+  set_affinity(ctx->workers[0].id, UINT32_C(1) << 3);
+  wait_for_processor(&ctx->workers[0], 3);
+
+  delete_worker(ctx, 0);
+}
+
+/*
+ * The home processor of the task runs a task of higher priority and all other
+ * processors run tasks which never block.  The task must preempt one of the
+ * lower priority tasks on another processor of its affinity set.
+ */
+static void test_preemption(test_context *ctx)
+{
+  uint32_t cpu_index;
+
+  for (cpu_index = 1; cpu_index < CPU_COUNT; ++cpu_index) {
+    start_worker(ctx, cpu_index, PRIO_IDLE, UINT32_C(1) << cpu_index);
+    wait_for_processor(&ctx->workers[cpu_index], cpu_index);
+  }
+
+  start_worker(ctx, 0, PRIO_HIGH, UINT32_C(1) << 0);
+  rtems_test_assert(is_not_running(&ctx->workers[0]));
+
+  set_affinity(ctx->workers[0].id, (UINT32_C(1) << CPU_COUNT) - 1);
+  wait_for_run(&ctx->workers[0]);
+  rtems_test_assert(ctx->workers[0].cpu != 0);
+
+  for (cpu_index = 0; cpu_index < CPU_COUNT; ++cpu_index) {
+    delete_worker(ctx, cpu_index);
+  }
+}
+
+/*
+ * Worker 0 and 1 run on processor 2 and 3.  Worker 2 and 3 wait in the ready
+ * queue of processor 2 and 3.
+ */
+static void test_stealing(test_context *ctx)
+{
+  start_worker(ctx, 0, PRIO_HIGH, UINT32_C(1) << 2);
+  wait_for_processor(&ctx->workers[0], 2);
+
+  start_worker(ctx, 1, PRIO_HIGH, UINT32_C(1) << 3);
+  wait_for_processor(&ctx->workers[1], 3);
+
+  start_worker(ctx, 2, PRIO_MID, UINT32_C(1) << 2);
+  set_affinity(ctx->workers[2].id, (UINT32_C(1) << 2) | (UINT32_C(1) << 3));
+  rtems_test_assert(is_not_running(&ctx->workers[2]));
+
+  /* Processor 3 has to steal worker 2 from the ready queue of processor 2 */
+  suspend_worker(ctx, 1);
+  wait_for_processor(&ctx->workers[2], 3);
+
+  start_worker(ctx, 3, PRIO_LOW, UINT32_C(1) << 3);
+  set_affinity(ctx->workers[3].id, (UINT32_C(1) << 2) | (UINT32_C(1) << 3));
+  rtems_test_assert(is_not_running(&ctx->workers[3]));
+}
+
+/*
+ * Processor 3 runs worker 2 and has worker 3 in its ready queue.  Both must
+ * move to processor 2 if processor 3 is removed from the scheduler.
+ */
+static void test_remove_processor(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  delete_worker(ctx, 1);
+
+  sc = rtems_scheduler_remove_processor(ctx->scheduler_id, 3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(is_not_running(&ctx->workers[2]));
+  rtems_test_assert(is_not_running(&ctx->workers[3]));
+
+  suspend_worker(ctx, 0);
+  wait_for_processor(&ctx->workers[2], 2);
+  rtems_test_assert(is_not_running(&ctx->workers[3]));
+
+  suspend_worker(ctx, 2);
+  wait_for_processor(&ctx->workers[3], 2);
+
+  sc = rtems_scheduler_add_processor(ctx->scheduler_id, 3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  delete_worker(ctx, 0);
+  delete_worker(ctx, 2);
+  delete_worker(ctx, 3);
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_scheduler_ident(
+    rtems_build_name('W', 'S', ' ', ' '),
+    &ctx->scheduler_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_affinity(RTEMS_SELF, UINT32_C(1) << 0);
+  rtems_test_assert(rtems_scheduler_get_processor() == 0);
+
+  test_affinity(ctx);
+  test_preemption(ctx);
+  test_stealing(ctx);
+  test_remove_processor(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  if (rtems_scheduler_get_processor_maximum() == CPU_COUNT) {
+    test(&test_instance);
+  } else {
+    puts("warning: wrong processor count to run the test");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WORKER_COUNT)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_WS_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_WS_SMP(a, 16);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_WS_SMP(a, rtems_build_name('W', 'S', ' ', ' '))
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_INIT
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,283 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include "tmtests_sample.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "SMPSTRONGAPA 2";
+
+#define CPU_MAX 32
+
+#define FILLER_MAX 128
+
+#define SAMPLE_COUNT 100
+
+#define PRIO_INIT 1
+
+#define PRIO_PROBE 2
+
+#define PRIO_FILLER(i) (UINT32_C(3) + (i) % 64)
+
+typedef struct {
+  rtems_id probe_id;
+  rtems_id filler_ids[FILLER_MAX];
+  uint32_t filler_count;
+  uint32_t cpu_count;
+} test_context;
+
+static test_context test_instance;
+
+static const uint32_t stage_filler_counts[] = { 0, 8, 32, FILLER_MAX };
+
+static void busy_task(rtems_task_argument arg)
+{
+  (void) arg;
+
+  while (true) {
+    /* Do nothing */
+  }
+}
+
+static void set_affinity(rtems_id id, const cpu_set_t *cpu_set)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_set_affinity(id, sizeof(*cpu_set), cpu_set);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+/*
+ * The fillers have a mix of affinity sets with one, two, and all processors,
+ * so that the ready nodes are spread over the per-processor indices.
+ */
+static void add_filler(test_context *ctx)
+{
+  rtems_status_code sc;
+  cpu_set_t cpu_set;
+  uint32_t i;
+  rtems_id id;
+
+  i = ctx->filler_count;
+
+  sc = rtems_task_create(
+    rtems_build_name('F', 'I', 'L', 'L'),
+    PRIO_FILLER(i),
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  CPU_ZERO(&cpu_set);
+
+  switch (i % 3) {
+    case 0:
+      CPU_SET(i % ctx->cpu_count, &cpu_set);
+      break;
+    case 1:
+      CPU_SET(i % ctx->cpu_count, &cpu_set);
+      CPU_SET((i + 1) % ctx->cpu_count, &cpu_set);
+      break;
+    default:
+      CPU_FILL(&cpu_set);
+      break;
+  }
+
+  set_affinity(id, &cpu_set);
+
+  sc = rtems_task_start(id, busy_task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->filler_ids[i] = id;
+  ctx->filler_count = i + 1;
+}
+
+/*
+ * Blocking the probe task selects the highest ready node reachable from its
+ * processor.  Unblocking it selects the lowest priority scheduled node
+ * reachable from its affinity set.
+ */
+static void measure(
+  test_context *ctx,
+  rtems_test_sample *block,
+  rtems_test_sample *unblock
+)
+{
+  uint32_t i;
+
+  rtems_test_sample_init(block);
+  rtems_test_sample_init(unblock);
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks c;
+    rtems_status_code sc;
+
+    a = rtems_counter_read();
+    sc = rtems_task_suspend(ctx->probe_id);
+    b = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_resume(ctx->probe_id);
+    c = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    rtems_test_sample_add(block, rtems_counter_difference(b, a));
+    rtems_test_sample_add(unblock, rtems_counter_difference(c, b));
+  }
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+  cpu_set_t cpu_set;
+  size_t stage;
+  uint32_t i;
+
+  CPU_ZERO(&cpu_set);
+  CPU_SET(0, &cpu_set);
+  set_affinity(RTEMS_SELF, &cpu_set);
+
+  sc = rtems_task_create(
+    rtems_build_name('P', 'R', 'O', 'B'),
+    PRIO_PROBE,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->probe_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  CPU_FILL(&cpu_set);
+  CPU_CLR(0, &cpu_set);
+  set_affinity(ctx->probe_id, &cpu_set);
+
+  sc = rtems_task_start(ctx->probe_id, busy_task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"processor-count\": %" PRIu32 ",\n"
+    "  \"sample-count\": %i,\n"
+    "  \"stages\": [\n",
+    ctx->cpu_count,
+    SAMPLE_COUNT
+  );
+
+  for (stage = 0; stage < RTEMS_ARRAY_SIZE(stage_filler_counts); ++stage) {
+    rtems_test_sample block;
+    rtems_test_sample unblock;
+
+    while (ctx->filler_count < stage_filler_counts[stage]) {
+      add_filler(ctx);
+    }
+
+    /* Warm up */
+    measure(ctx, &block, &unblock);
+
+    measure(ctx, &block, &unblock);
+
+    printf(
+      "    {\n"
+      "      \"filler-threads\": %" PRIu32 ",\n",
+      ctx->filler_count
+    );
+    rtems_test_sample_print(&block, 6, "block", ",");
+    rtems_test_sample_print(&unblock, 6, "unblock", "");
+    printf(
+      "    }%s\n",
+      stage + 1 < RTEMS_ARRAY_SIZE(stage_filler_counts) ? "," : ""
+    );
+  }
+
+  printf(
+    "  ]\n"
+    "}\n"
+    "*** END OF JSON DATA ***\n"
+  );
+
+  for (i = 0; i < ctx->filler_count; ++i) {
+    sc = rtems_task_delete(ctx->filler_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_delete(ctx->probe_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  ctx->cpu_count = rtems_scheduler_get_processor_maximum();
+
+  if (ctx->cpu_count >= 2) {
+    test(ctx);
+  } else {
+    puts("warning: wrong processor count to run the test");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + FILLER_MAX)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_MAX
+
+#define CONFIGURE_SCHEDULER_STRONG_APA
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_INIT
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -32,6 +32,7 @@
 #include "tmacros.h"
 
 #include <sys/lock.h>
+#include <rtems/score/futex.h>
 #include <errno.h>
 #include <limits.h>
 #include <setjmp.h>
@@ -71,6 +72,7 @@ typedef struct {
   struct _Condition_Control cond;
   struct _Semaphore_Control sem;
   struct _Futex_Control futex;
+  struct _Futex_Control futex2;
   int val;
   int eno[2];
   int generation[2];
@@ -174,6 +176,7 @@ static void test_initialization(test_context *ctx)
   _Condition_Initialize(&ctx->cond);
   _Semaphore_Initialize(&ctx->sem, 1);
   _Futex_Initialize(&ctx->futex);
+  _Futex_Initialize(&ctx->futex2);
 
   rtems_test_assert(eq_mtx(&mtx, &ctx->mtx));
   rtems_test_assert(eq_rec_mtx(&rec_mtx, &ctx->rec_mtx));
@@ -552,6 +555,101 @@ static void test_futex(test_context *ctx)
   rtems_test_assert(ctx->eno[b] == 0);
 }
 
+static void test_futex_requeue(test_context *ctx)
+{
+  struct _Futex_Control *futex = &ctx->futex;
+  struct _Futex_Control *futex2 = &ctx->futex2;
+  size_t a = 0;
+  size_t b = 1;
+  int val2;
+  int woken;
+  int eno;
+
+  ctx->val = 1;
+
+  ctx->eno[a] = -1;
+  ctx->eno[b] = -1;
+  send_event(ctx, a, EVENT_FUTEX_WAIT);
+  send_event(ctx, b, EVENT_FUTEX_WAIT);
+  rtems_test_assert(ctx->eno[a] == -1);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  woken = -1;
+  eno = _Futex_Cmp_requeue(futex, futex2, &ctx->val, 0, 1, INT_MAX, &woken);
+  rtems_test_assert(eno == EAGAIN);
+  rtems_test_assert(woken == -1);
+  rtems_test_assert(ctx->eno[a] == -1);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  woken = _Futex_Requeue(futex, futex2, 1, INT_MAX);
+  rtems_test_assert(woken == 1);
+  rtems_test_assert(ctx->eno[a] == 0);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  woken = _Futex_Wake(futex, INT_MAX);
+  rtems_test_assert(woken == 0);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  woken = _Futex_Wake(futex2, INT_MAX);
+  rtems_test_assert(woken == 1);
+  rtems_test_assert(ctx->eno[b] == 0);
+
+  ctx->eno[a] = -1;
+  ctx->eno[b] = -1;
+  send_event(ctx, a, EVENT_FUTEX_WAIT);
+  send_event(ctx, b, EVENT_FUTEX_WAIT);
+
+  eno = _Futex_Cmp_requeue(futex, futex2, &ctx->val, 1, 0, 1, &woken);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(woken == 1);
+  rtems_test_assert(ctx->eno[a] == -1);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  val2 = 0;
+  woken = -1;
+  eno = _Futex_Wake_op(
+    futex,
+    futex2,
+    &val2,
+    1,
+    1,
+    FUTEX_OP(15, 0, 0, 0),
+    &woken
+  );
+  rtems_test_assert(eno == ENOSYS);
+  rtems_test_assert(woken == -1);
+  rtems_test_assert(val2 == 0);
+
+  eno = _Futex_Wake_op(
+    futex,
+    futex2,
+    &val2,
+    1,
+    1,
+    FUTEX_OP(FUTEX_OP_ADD, 1, FUTEX_OP_CMP_NE, 0),
+    &woken
+  );
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(woken == 1);
+  rtems_test_assert(val2 == 1);
+  rtems_test_assert(ctx->eno[a] == -1);
+  rtems_test_assert(ctx->eno[b] == 0);
+
+  eno = _Futex_Wake_op(
+    futex,
+    futex2,
+    &val2,
+    1,
+    1,
+    FUTEX_OP(FUTEX_OP_SET, 0, FUTEX_OP_CMP_EQ, 1),
+    &woken
+  );
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(woken == 1);
+  rtems_test_assert(val2 == 0);
+  rtems_test_assert(ctx->eno[a] == 0);
+}
+
 static void test_sched(void)
 {
   rtems_test_assert(_Sched_Index() == 0);
@@ -723,6 +821,7 @@ static void test(void)
   test_sem(ctx);
   test_sem_prio_wait_order(ctx);
   test_futex(ctx);
+  test_futex_requeue(ctx);
   test_sched();
 
   sc = rtems_task_delete(ctx->mid);
@@ -739,6 +838,7 @@ static void test(void)
   _Condition_Destroy(&ctx->cond);
   _Semaphore_Destroy(&ctx->sem);
   _Futex_Destroy(&ctx->futex);
+  _Futex_Destroy(&ctx->futex2);
 }
 
 static void Init(rtems_task_argument arg)
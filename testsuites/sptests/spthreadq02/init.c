@@ -0,0 +1,227 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/threadqops.h>
+#include <rtems/score/threadqimpl.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SPTHREADQ 2";
+
+#define WORKER_COUNT 5
+
+#define INIT_PRIO 30
+
+typedef struct {
+  rtems_id sem;
+  rtems_id workers[ WORKER_COUNT ];
+  size_t order[ WORKER_COUNT ];
+  size_t order_count;
+} test_context;
+
+static test_context test_instance;
+
+static rtems_task worker( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  ctx = &test_instance;
+
+  sc = rtems_semaphore_obtain( ctx->sem, RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( ctx->order_count < WORKER_COUNT );
+  ctx->order[ ctx->order_count ] = arg;
+  ++ctx->order_count;
+
+  sc = rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void start_worker(
+  test_context       *ctx,
+  size_t              idx,
+  rtems_task_priority prio
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    prio,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->workers[ idx ]
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The worker has a higher priority and blocks on the semaphore at once */
+  sc = rtems_task_start( ctx->workers[ idx ], worker, idx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void set_priority(
+  test_context       *ctx,
+  size_t              idx,
+  rtems_task_priority prio
+)
+{
+  rtems_status_code   sc;
+  rtems_task_priority old;
+
+  sc = rtems_task_set_priority( ctx->workers[ idx ], prio, &old );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void release_and_check(
+  test_context *ctx,
+  const size_t *expected_order,
+  size_t        count
+)
+{
+  rtems_status_code sc;
+  size_t            i;
+
+  ctx->order_count = 0;
+
+  for ( i = 0; i < count; ++i ) {
+    sc = rtems_semaphore_release( ctx->sem );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_assert( ctx->order_count == i + 1 );
+    rtems_test_assert( ctx->order[ i ] == expected_order[ i ] );
+  }
+
+  for ( i = 0; i < count; ++i ) {
+    sc = rtems_task_delete( ctx->workers[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void test_operations_selected( void )
+{
+  /*
+   * The application uses the default scheduler with a maximum priority of
+   * 31, so <rtems/confdefs.h> selects the priority bucket operations.
+   */
+  rtems_test_assert(
+    _Thread_queue_Operations_priority.enqueue ==
+      _Thread_queue_Priority_bucket_enqueue
+  );
+  rtems_test_assert(
+    _Thread_queue_Operations_priority.priority_actions ==
+      _Thread_queue_Priority_bucket_priority_actions
+  );
+}
+
+static void test_fifo_order_within_priority( test_context *ctx )
+{
+  static const size_t expected_order[] = { 3, 0, 1, 2, 4 };
+
+  start_worker( ctx, 0, 10 );
+  start_worker( ctx, 1, 10 );
+  start_worker( ctx, 2, 10 );
+  start_worker( ctx, 3, 5 );
+  start_worker( ctx, 4, 10 );
+
+  release_and_check( ctx, expected_order, RTEMS_ARRAY_SIZE( expected_order ) );
+}
+
+static void test_priority_change_while_waiting( test_context *ctx )
+{
+  static const size_t expected_order[] = { 2, 1, 3, 4, 0 };
+
+  start_worker( ctx, 0, 10 );
+  start_worker( ctx, 1, 10 );
+  start_worker( ctx, 2, 10 );
+  start_worker( ctx, 3, 10 );
+  start_worker( ctx, 4, 15 );
+
+  /* Move a waiter in the middle of a FIFO to an empty higher priority */
+  set_priority( ctx, 2, 5 );
+
+  /* Append a waiter to an already non-empty priority */
+  set_priority( ctx, 1, 5 );
+
+  /* Move the first waiter of a priority to the end of a lower priority */
+  set_priority( ctx, 0, 15 );
+
+  release_and_check( ctx, expected_order, RTEMS_ARRAY_SIZE( expected_order ) );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'S', 'E', 'M', 'A' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &ctx->sem
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_operations_selected();
+  test_fifo_order_within_priority( ctx );
+  test_priority_change_while_waiting( ctx );
+
+  sc = rtems_semaphore_delete( ctx->sem );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS ( 1 + WORKER_COUNT )
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_PRIORITY 31
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIO
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -252,6 +252,120 @@ static void test_watchdog_operations( void )
   _Watchdog_Header_destroy( &header );
 }
 
+static uint64_t test_watchdog_tick_wheel(
+  Watchdog_Header *header,
+  uint64_t         now
+)
+{
+#if ISR_LOCK_NEEDS_OBJECT
+  ISR_lock_Control lock = ISR_LOCK_INITIALIZER( "Test" );
+#endif
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &lock, &lock_context );
+
+  ++now;
+  _Watchdog_Tickle_wheel( header, now, &lock, &lock_context );
+
+  _ISR_lock_Release_and_ISR_enable( &lock, &lock_context );
+  _ISR_lock_Destroy( &lock );
+
+  return now;
+}
+
+static Watchdog_Wheel test_wheel;
+
+static void test_watchdog_wheel_operations( void )
+{
+  Watchdog_Header header;
+  uint64_t now;
+  test_watchdog a;
+  test_watchdog b;
+  test_watchdog c;
+
+  now = 0;
+  _Watchdog_Header_initialize_wheel( &header, &test_wheel, now );
+  rtems_test_assert( _Watchdog_Header_has_wheel( &header ) );
+  rtems_test_assert( header.first == NULL );
+
+  test_watchdog_init( &a, 10 );
+  test_watchdog_init( &b, 20 );
+  test_watchdog_init( &c, 30 );
+
+  now = test_watchdog_tick_wheel( &header, now );
+  rtems_test_assert( header.first == NULL );
+
+  _Watchdog_Insert( &header, &a.Base, now + 1 );
+  rtems_test_assert( header.first == &a.Base.Node.RBTree );
+  rtems_test_assert( !test_watchdog_is_inactive( &a ) ) ;
+  rtems_test_assert( a.Base.expire == 2 );
+
+  _Watchdog_Remove( &header, &a.Base );
+  rtems_test_assert( header.first == NULL );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) ) ;
+
+  _Watchdog_Remove( &header, &a.Base );
+  rtems_test_assert( header.first == NULL );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) ) ;
+
+  /* Watchdogs on level zero, one, and two of the wheel */
+  _Watchdog_Insert( &header, &a.Base, now + 1 );
+  _Watchdog_Insert( &header, &b.Base, now + 100 );
+  _Watchdog_Insert( &header, &c.Base, now + 5000 );
+  rtems_test_assert( header.first == &a.Base.Node.RBTree );
+
+  _Watchdog_Remove( &header, &a.Base );
+  rtems_test_assert( header.first == &b.Base.Node.RBTree );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) ) ;
+
+  _Watchdog_Insert( &header, &a.Base, now + 1 );
+  now = test_watchdog_tick_wheel( &header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) ) ;
+  rtems_test_assert( a.counter == 11 );
+  rtems_test_assert( header.first == &b.Base.Node.RBTree );
+
+  while ( now < b.Base.expire - 1 ) {
+    now = test_watchdog_tick_wheel( &header, now );
+  }
+
+  rtems_test_assert( !test_watchdog_is_inactive( &b ) ) ;
+  rtems_test_assert( b.counter == 20 );
+
+  now = test_watchdog_tick_wheel( &header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &b ) ) ;
+  rtems_test_assert( b.counter == 21 );
+  rtems_test_assert( header.first == &c.Base.Node.RBTree );
+
+  while ( now < c.Base.expire - 1 ) {
+    now = test_watchdog_tick_wheel( &header, now );
+  }
+
+  rtems_test_assert( !test_watchdog_is_inactive( &c ) ) ;
+  rtems_test_assert( c.counter == 30 );
+
+  now = test_watchdog_tick_wheel( &header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &c ) ) ;
+  rtems_test_assert( c.counter == 31 );
+  rtems_test_assert( header.first == NULL );
+
+  /* An already expired watchdog expires with the next tick */
+  _Watchdog_Insert( &header, &a.Base, now - 1 );
+  rtems_test_assert( header.first == &a.Base.Node.RBTree );
+  now = test_watchdog_tick_wheel( &header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) ) ;
+  rtems_test_assert( a.counter == 12 );
+
+  /* A watchdog beyond the last level of the wheel */
+  _Watchdog_Insert( &header, &a.Base, now + 20000000 );
+  rtems_test_assert( header.first == &a.Base.Node.RBTree );
+  _Watchdog_Remove( &header, &a.Base );
+  rtems_test_assert( header.first == NULL );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) ) ;
+  rtems_test_assert( a.counter == 12 );
+
+  _Watchdog_Header_destroy( &header );
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
@@ -262,6 +376,7 @@ rtems_task Init(
   TEST_BEGIN();
 
   test_watchdog_operations();
+  test_watchdog_wheel_operations();
   test_watchdog_static_init();
   test_watchdog_config();
 
@@ -0,0 +1,77 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  Minimum, mean, and maximum of time samples used by the RTEMS Timing Tests
+ *  to report the results in JSON format.
+ */
+
+#ifndef __TMTESTS_SAMPLE_h
+#define __TMTESTS_SAMPLE_h
+
+#include <stdint.h>
+
+#include <rtems/counter.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;
+  uint32_t count;
+} rtems_test_sample;
+
+/*
+ *  Clear the samples.
+ */
+void rtems_test_sample_init( rtems_test_sample *s );
+
+/*
+ *  Add the time interval in CPU counter ticks to the samples.
+ */
+void rtems_test_sample_add( rtems_test_sample *s, rtems_counter_ticks d );
+
+/*
+ *  Print the minimum, mean, and maximum in nanoseconds as a JSON object
+ *  member with the name.  The lines are indented by the count of spaces.  The
+ *  end string is printed after the closing brace of the object.
+ */
+void rtems_test_sample_print(
+  const rtems_test_sample *s,
+  int                      indent,
+  const char              *name,
+  const char              *end
+);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "tmtests_sample.h"
+
+void rtems_test_sample_init( rtems_test_sample *s )
+{
+  s->min = UINT64_MAX;
+  s->max = 0;
+  s->sum = 0;
+  s->count = 0;
+}
+
+void rtems_test_sample_add( rtems_test_sample *s, rtems_counter_ticks d )
+{
+  uint64_t ns = rtems_counter_ticks_to_nanoseconds( d );
+
+  if ( ns < s->min ) {
+    s->min = ns;
+  }
+
+  if ( ns > s->max ) {
+    s->max = ns;
+  }
+
+  s->sum += ns;
+  ++s->count;
+}
+
+void rtems_test_sample_print(
+  const rtems_test_sample *s,
+  int                      indent,
+  const char              *name,
+  const char              *end
+)
+{
+  printf(
+    "%*s\"%s\": {\n"
+    "%*s  \"min\": %" PRIu64 ",\n"
+    "%*s  \"mean\": %" PRIu64 ",\n"
+    "%*s  \"max\": %" PRIu64 "\n"
+    "%*s}%s\n",
+    indent,
+    "",
+    name,
+    indent,
+    "",
+    s->count > 0 ? s->min : 0,
+    indent,
+    "",
+    s->count > 0 ? s->sum / s->count : 0,
+    indent,
+    "",
+    s->max,
+    indent,
+    "",
+    end
+  );
+}
@@ -0,0 +1,293 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/captureimpl.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMCAPTURE 1";
+
+#define SAMPLE_COUNT 1000
+
+#define BUFFER_SIZE ( 256 * 1024 )
+
+#define SPAN_COUNT 16
+
+#define WORKER_NAME rtems_build_name( 'W', 'O', 'R', 'K' )
+
+typedef struct {
+  rtems_id worker;
+  rtems_id init;
+} test_context;
+
+static test_context test_instance;
+
+static void worker_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    rtems_event_set   events;
+    rtems_status_code sc;
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_event_send( ctx->init, RTEMS_EVENT_0 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+/*
+ * Each round trip switches from the Init task to the worker and back.
+ */
+static uint64_t measure_switches( test_context *ctx )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t            i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_event_set   events;
+    rtems_status_code sc;
+
+    sc = rtems_event_send( ctx->worker, RTEMS_EVENT_0 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static uint64_t measure_read_batch( uint32_t *records )
+{
+  rtems_capture_record_span spans[ SPAN_COUNT ];
+  rtems_capture_time        last_time;
+  rtems_counter_ticks       a;
+  rtems_counter_ticks       b;
+
+  *records = 0;
+  last_time = 0;
+  a = rtems_counter_read();
+
+  while ( true ) {
+    rtems_status_code sc;
+    size_t            count;
+    size_t            i;
+
+    sc = rtems_capture_read_batch( spans, RTEMS_ARRAY_SIZE( spans ), &count );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    for ( i = 0; i < count; ++i ) {
+      const uint8_t *recs;
+      uint32_t       j;
+
+      recs = spans[ i ].records;
+
+      for ( j = 0; j < spans[ i ].count; ++j ) {
+        rtems_capture_record rec;
+
+        rtems_capture_record_extract( recs, &rec, sizeof( rec ) );
+        rtems_test_assert( rec.time >= last_time );
+        last_time = rec.time;
+        recs += rec.size;
+      }
+
+      rtems_test_assert( recs == (const uint8_t *) spans[ i ].records +
+        spans[ i ].size );
+      *records += spans[ i ].count;
+    }
+
+    sc = rtems_capture_release_batch( spans, count );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    if ( count == 0 ) {
+      break;
+    }
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static void print_switches( const char *name, uint64_t ns, const char *end )
+{
+  printf(
+    "    \"%s\": {\n"
+    "      \"ns-per-switch\": %" PRIu64 "\n"
+    "    }%s\n",
+    name,
+    ns / ( 2 * SAMPLE_COUNT ),
+    end
+  );
+}
+
+static void test( void )
+{
+  test_context      *ctx;
+  rtems_status_code  sc;
+  uint64_t           ns_none;
+  uint64_t           ns_off;
+  uint64_t           ns_on;
+  uint64_t           ns_read;
+  uint32_t           records;
+
+  ctx = &test_instance;
+  ctx->init = rtems_task_self();
+
+  sc = rtems_task_create(
+    WORKER_NAME,
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( ctx->worker, worker_task, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Warm up */
+  measure_switches( ctx );
+
+  ns_none = measure_switches( ctx );
+
+  sc = rtems_capture_open( BUFFER_SIZE, NULL );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_capture_watch_global( true );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_capture_set_trigger(
+    0,
+    0,
+    WORKER_NAME,
+    0,
+    rtems_capture_from_any,
+    rtems_capture_switch
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  ns_off = measure_switches( ctx );
+
+  sc = rtems_capture_set_control( true );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  ns_on = measure_switches( ctx );
+
+  sc = rtems_capture_set_control( false );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  ns_read = measure_read_batch( &records );
+  rtems_test_assert( records >= 4 * SAMPLE_COUNT );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"switch-count\": %" PRIu32 ",\n",
+    2 * SAMPLE_COUNT
+  );
+  print_switches( "no-capture", ns_none, "," );
+  print_switches( "capture-off", ns_off, "," );
+  print_switches( "capture-on", ns_on, "," );
+  printf(
+    "  \"ns-overhead-per-switch\": %" PRIu64 ",\n"
+    "  \"read-batch\": {\n"
+    "    \"records\": %" PRIu32 ",\n"
+    "    \"ns-per-record\": %" PRIu64 "\n"
+    "  }\n"
+    "}\n"
+    "*** END OF JSON DATA ***\n",
+    ns_on > ns_none ? ( ns_on - ns_none ) / ( 2 * SAMPLE_COUNT ) : 0,
+    records,
+    records > 0 ? ns_read / records : 0
+  );
+
+  sc = rtems_capture_close();
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_delete( ctx->worker );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
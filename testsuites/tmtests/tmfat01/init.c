@@ -0,0 +1,291 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/counter.h>
+#include <rtems/dosfs.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "TMFAT 1";
+
+#define DISK "/dev/rda"
+
+#define MOUNT_POINT "/mnt"
+
+#define FILE_PATH MOUNT_POINT "/file"
+
+#define MEDIA_BLOCK_SIZE 512
+
+#define MEDIA_BLOCK_COUNT 4096
+
+#define FILE_SIZE ( 512 * 1024 )
+
+#define IO_SIZE_MAX ( 64 * 1024 )
+
+static const uint8_t sectors_per_cluster[] = { 1, 8, 64 };
+
+static const uint32_t io_sizes[] = { 512, 4096, IO_SIZE_MAX };
+
+static uint8_t io_buffer[ IO_SIZE_MAX ];
+
+static void format_and_mount( uint8_t spc )
+{
+  msdos_format_request_param_t rqdata;
+  int                          rv;
+
+  memset( &rqdata, 0, sizeof( rqdata ) );
+  rqdata.sectors_per_cluster = spc;
+  rqdata.quick_format = true;
+
+  rv = msdos_format( DISK, &rqdata );
+  rtems_test_assert( rv == 0 );
+
+  rv = mount(
+    DISK,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+}
+
+static void purge_disk( void )
+{
+  int fd;
+  int rv;
+
+  fd = open( DISK, O_RDWR );
+  rtems_test_assert( fd >= 0 );
+
+  rv = rtems_disk_fd_sync( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = rtems_disk_fd_purge( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static uint64_t transfer( uint32_t io_size, bool do_write )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t            done;
+  int                 fd;
+  int                 rv;
+
+  if ( do_write ) {
+    fd = open( FILE_PATH, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU );
+  } else {
+    fd = open( FILE_PATH, O_RDONLY );
+  }
+  rtems_test_assert( fd >= 0 );
+
+  a = rtems_counter_read();
+
+  for ( done = 0; done < FILE_SIZE; done += io_size ) {
+    ssize_t n;
+
+    if ( do_write ) {
+      n = write( fd, io_buffer, io_size );
+    } else {
+      n = read( fd, io_buffer, io_size );
+    }
+
+    rtems_test_assert( n == (ssize_t) io_size );
+  }
+
+  if ( do_write ) {
+    rv = fsync( fd );
+    rtems_test_assert( rv == 0 );
+  }
+
+  b = rtems_counter_read();
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static void throughput_print( const char *name, uint64_t ns, const char *end )
+{
+  uint64_t kb_per_s;
+
+  if ( ns == 0 ) {
+    ns = 1;
+  }
+
+  kb_per_s = ( (uint64_t) FILE_SIZE * 1000000 ) / ns;
+
+  printf(
+    "          \"%s\": %" PRIu64 ".%03" PRIu64 "%s\n",
+    name,
+    kb_per_s / 1000,
+    kb_per_s % 1000,
+    end
+  );
+}
+
+static void measure( uint8_t spc, const char *end )
+{
+  size_t i;
+
+  format_and_mount( spc );
+
+  printf(
+    "    {\n"
+    "      \"cluster-size\": %" PRIu32 ",\n"
+    "      \"samples\": [\n",
+    (uint32_t) spc * MEDIA_BLOCK_SIZE
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( io_sizes ); ++i ) {
+    uint64_t write_ns;
+    uint64_t read_ns;
+
+    write_ns = transfer( io_sizes[ i ], true );
+    purge_disk();
+    read_ns = transfer( io_sizes[ i ], false );
+
+    printf(
+      "        {\n"
+      "          \"io-size\": %" PRIu32 ",\n",
+      io_sizes[ i ]
+    );
+    throughput_print( "write-mb-per-s", write_ns, "," );
+    throughput_print( "read-mb-per-s", read_ns, "" );
+    printf(
+      "        }%s\n",
+      i + 1 < RTEMS_ARRAY_SIZE( io_sizes ) ? "," : ""
+    );
+  }
+
+  printf( "      ]\n    }%s\n", end );
+
+  rtems_test_assert( unmount( MOUNT_POINT ) == 0 );
+}
+
+static void test( void )
+{
+  rtems_status_code sc;
+  ramdisk          *rd;
+  size_t            i;
+  int               rv;
+
+  memset( io_buffer, 0x5a, sizeof( io_buffer ) );
+
+  rv = mkdir( MOUNT_POINT, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  rd = ramdisk_allocate( NULL, MEDIA_BLOCK_SIZE, MEDIA_BLOCK_COUNT, false );
+  rtems_test_assert( rd != NULL );
+
+  sc = rtems_blkdev_create(
+    DISK,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    ramdisk_ioctl,
+    rd
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"file-size\": %" PRIu32 ",\n"
+    "  \"volumes\": [\n",
+    (uint32_t) FILE_SIZE
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( sectors_per_cluster ); ++i ) {
+    measure(
+      sectors_per_cluster[ i ],
+      i + 1 < RTEMS_ARRAY_SIZE( sectors_per_cluster ) ? "," : ""
+    );
+  }
+
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
+
+  rv = unlink( DISK );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE ( 256 * 1024 )
+
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
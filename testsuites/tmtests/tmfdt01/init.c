@@ -0,0 +1,356 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <libfdt.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/rtems-fdt.h>
+
+const char rtems_test_name[] = "TMFDT 1";
+
+#define BUS_COUNT 32
+
+#define DEVICES_PER_BUS 32
+
+#define NODE_COUNT ( BUS_COUNT * ( DEVICES_PER_BUS + 1 ) )
+
+#define COMPATIBLE_COUNT 16
+
+#define BLOB_SIZE ( 256 * 1024 )
+
+static uint64_t blob[ BLOB_SIZE / sizeof( uint64_t ) ];
+
+static int offsets[ NODE_COUNT ];
+
+static char paths[ NODE_COUNT ][ 32 ];
+
+static uint32_t phandles[ NODE_COUNT ];
+
+/*
+ * Build a device tree with buses of devices.  Each node has a phandle and
+ * each device is compatible with one of a few drivers.
+ */
+static void build_blob( void )
+{
+  uint32_t phandle;
+  int      bus;
+  int      dev;
+  int      rv;
+
+  rv = fdt_create( blob, sizeof( blob ) );
+  rtems_test_assert( rv == 0 );
+  rv = fdt_finish_reservemap( blob );
+  rtems_test_assert( rv == 0 );
+  rv = fdt_begin_node( blob, "" );
+  rtems_test_assert( rv == 0 );
+  rv = fdt_property_string( blob, "compatible", "rtems,tmfdt01" );
+  rtems_test_assert( rv == 0 );
+
+  phandle = 1;
+
+  for ( bus = 0; bus < BUS_COUNT; ++bus ) {
+    char name[ 16 ];
+
+    snprintf( name, sizeof( name ), "bus@%x", bus );
+    rv = fdt_begin_node( blob, name );
+    rtems_test_assert( rv == 0 );
+    rv = fdt_property_string( blob, "compatible", "simple-bus" );
+    rtems_test_assert( rv == 0 );
+    rv = fdt_property_u32( blob, "phandle", phandle++ );
+    rtems_test_assert( rv == 0 );
+
+    for ( dev = 0; dev < DEVICES_PER_BUS; ++dev ) {
+      char compatible[ 32 ];
+
+      snprintf( name, sizeof( name ), "dev@%x", dev );
+      snprintf(
+        compatible,
+        sizeof( compatible ),
+        "rtems,dev%d",
+        ( bus * DEVICES_PER_BUS + dev ) % COMPATIBLE_COUNT
+      );
+      rv = fdt_begin_node( blob, name );
+      rtems_test_assert( rv == 0 );
+      rv = fdt_property_string( blob, "compatible", compatible );
+      rtems_test_assert( rv == 0 );
+      rv = fdt_property_u32( blob, "phandle", phandle++ );
+      rtems_test_assert( rv == 0 );
+      rv = fdt_end_node( blob );
+      rtems_test_assert( rv == 0 );
+    }
+
+    rv = fdt_end_node( blob );
+    rtems_test_assert( rv == 0 );
+  }
+
+  rv = fdt_end_node( blob );
+  rtems_test_assert( rv == 0 );
+  rv = fdt_finish( blob );
+  rtems_test_assert( rv == 0 );
+}
+
+static void collect_nodes( void )
+{
+  int offset;
+  int depth;
+  int i;
+
+  offset = 0;
+  depth = 0;
+  i = 0;
+
+  while ( true ) {
+    int rv;
+
+    offset = fdt_next_node( blob, offset, &depth );
+
+    if ( depth <= 0 ) {
+      break;
+    }
+
+    rtems_test_assert( i < NODE_COUNT );
+    offsets[ i ] = offset;
+    phandles[ i ] = fdt_get_phandle( blob, offset );
+    rv = fdt_get_path( blob, offset, paths[ i ], sizeof( paths[ i ] ) );
+    rtems_test_assert( rv == 0 );
+    ++i;
+  }
+
+  rtems_test_assert( i == NODE_COUNT );
+}
+
+static uint64_t measure_paths( rtems_fdt_handle *handle )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  int                 i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < NODE_COUNT; ++i ) {
+    int offset;
+
+    if ( handle != NULL ) {
+      offset = rtems_fdt_path_offset( handle, paths[ i ] );
+    } else {
+      offset = fdt_path_offset( blob, paths[ i ] );
+    }
+
+    rtems_test_assert( offset == offsets[ i ] );
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static uint64_t measure_phandles( rtems_fdt_handle *handle )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  int                 i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < NODE_COUNT; ++i ) {
+    int offset;
+
+    if ( handle != NULL ) {
+      offset = rtems_fdt_node_offset_by_phandle( handle, phandles[ i ] );
+    } else {
+      offset = fdt_node_offset_by_phandle( blob, phandles[ i ] );
+    }
+
+    rtems_test_assert( offset == offsets[ i ] );
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+/*
+ * Probe all devices like a driver framework which walks the matches of each
+ * driver.
+ */
+static uint64_t measure_compatibles( rtems_fdt_handle *handle )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  int                 matches;
+  int                 i;
+
+  matches = 0;
+  a = rtems_counter_read();
+
+  for ( i = 0; i < COMPATIBLE_COUNT; ++i ) {
+    char compatible[ 32 ];
+    int  offset;
+
+    snprintf( compatible, sizeof( compatible ), "rtems,dev%d", i );
+    offset = -1;
+
+    while ( true ) {
+      if ( handle != NULL ) {
+        offset =
+          rtems_fdt_node_offset_by_compatible( handle, offset, compatible );
+      } else {
+        offset = fdt_node_offset_by_compatible( blob, offset, compatible );
+      }
+
+      if ( offset < 0 ) {
+        break;
+      }
+
+      ++matches;
+    }
+
+    rtems_test_assert( offset == -FDT_ERR_NOTFOUND );
+  }
+
+  b = rtems_counter_read();
+
+  rtems_test_assert( matches == BUS_COUNT * DEVICES_PER_BUS );
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static void print_lookups(
+  const char *name,
+  uint64_t    ns_libfdt,
+  uint64_t    ns_index,
+  uint32_t    count,
+  const char *end
+)
+{
+  printf(
+    "  \"%s\": {\n"
+    "    \"count\": %" PRIu32 ",\n"
+    "    \"libfdt-ns-per-lookup\": %" PRIu64 ",\n"
+    "    \"index-ns-per-lookup\": %" PRIu64 "\n"
+    "  }%s\n",
+    name,
+    count,
+    ns_libfdt / count,
+    ns_index / count,
+    end
+  );
+}
+
+static void test( void )
+{
+  rtems_fdt_handle    handle;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint64_t            ns_register;
+  uint64_t            ns_paths[ 2 ];
+  uint64_t            ns_phandles[ 2 ];
+  uint64_t            ns_compatibles[ 2 ];
+  int                 rv;
+
+  build_blob();
+  collect_nodes();
+
+  rtems_fdt_init_handle( &handle );
+
+  a = rtems_counter_read();
+  rv = rtems_fdt_register( blob, &handle );
+  b = rtems_counter_read();
+  rtems_test_assert( rv == 0 );
+  ns_register =
+    rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+
+  ns_paths[ 0 ] = measure_paths( NULL );
+  ns_paths[ 1 ] = measure_paths( &handle );
+  ns_phandles[ 0 ] = measure_phandles( NULL );
+  ns_phandles[ 1 ] = measure_phandles( &handle );
+  ns_compatibles[ 0 ] = measure_compatibles( NULL );
+  ns_compatibles[ 1 ] = measure_compatibles( &handle );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"node-count\": %d,\n"
+    "  \"blob-size\": %" PRIu32 ",\n"
+    "  \"register-ns\": %" PRIu64 ",\n",
+    NODE_COUNT,
+    fdt_totalsize( blob ),
+    ns_register
+  );
+  print_lookups( "path", ns_paths[ 0 ], ns_paths[ 1 ], NODE_COUNT, "," );
+  print_lookups(
+    "phandle",
+    ns_phandles[ 0 ],
+    ns_phandles[ 1 ],
+    NODE_COUNT,
+    ","
+  );
+  print_lookups(
+    "compatible",
+    ns_compatibles[ 0 ],
+    ns_compatibles[ 1 ],
+    BUS_COUNT * DEVICES_PER_BUS + COMPATIBLE_COUNT,
+    ""
+  );
+  printf( "}\n*** END OF JSON DATA ***\n" );
+
+  rv = rtems_fdt_unload( &handle );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
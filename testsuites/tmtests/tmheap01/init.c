@@ -0,0 +1,244 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+#include "tmtests_sample.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMHEAP 1";
+
+#define AREA_SIZE ( 512 * 1024 )
+
+#define SEGMENT_COUNT 1024
+
+#define OPERATION_COUNT 20000
+
+typedef struct {
+  uint32_t seed;
+  void *segments[ SEGMENT_COUNT ];
+  rtems_test_sample get;
+  rtems_test_sample ret;
+  uint32_t failed;
+} test_context;
+
+static test_context test_instance;
+
+static char area[ 2 ][ AREA_SIZE ] RTEMS_ALIGNED( CPU_HEAP_ALIGNMENT );
+
+static uint32_t next_random( test_context *ctx )
+{
+  /* Simple linear congruential generator to get reproducible results */
+  ctx->seed = ctx->seed * 1103515245 + 12345;
+
+  return ctx->seed >> 8;
+}
+
+static uintptr_t segment_size( test_context *ctx )
+{
+  uint32_t r = next_random( ctx );
+
+  /* Mostly small segments with some larger ones to cause fragmentation */
+  if ( ( r % 8 ) == 0 ) {
+    return 256 + ( r >> 3 ) % 4096;
+  }
+
+  return 8 + ( r >> 3 ) % 120;
+}
+
+static void get_segment( test_context *ctx, rtems_id id, size_t i )
+{
+  rtems_status_code sc;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uintptr_t size;
+
+  size = segment_size( ctx );
+  a = rtems_counter_read();
+  sc = rtems_region_get_segment(
+    id,
+    size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &ctx->segments[ i ]
+  );
+  b = rtems_counter_read();
+
+  if ( sc == RTEMS_SUCCESSFUL ) {
+    rtems_test_sample_add( &ctx->get, rtems_counter_difference( b, a ) );
+  } else {
+    rtems_test_assert( sc == RTEMS_UNSATISFIED );
+    ctx->segments[ i ] = NULL;
+    ++ctx->failed;
+  }
+}
+
+static void return_segment( test_context *ctx, rtems_id id, size_t i )
+{
+  rtems_status_code sc;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+
+  a = rtems_counter_read();
+  sc = rtems_region_return_segment( id, ctx->segments[ i ] );
+  b = rtems_counter_read();
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_sample_add( &ctx->ret, rtems_counter_difference( b, a ) );
+  ctx->segments[ i ] = NULL;
+}
+
+static void test_region(
+  test_context *ctx,
+  void *begin,
+  rtems_attribute attributes,
+  const char *name,
+  const char *end
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  Heap_Information_block info;
+  size_t i;
+
+  sc = rtems_region_create(
+    rtems_build_name( 'H', 'E', 'A', 'P' ),
+    begin,
+    AREA_SIZE,
+    CPU_HEAP_ALIGNMENT,
+    attributes,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  ctx->seed = 123;
+  ctx->failed = 0;
+  rtems_test_sample_init( &ctx->get );
+  rtems_test_sample_init( &ctx->ret );
+
+  for ( i = 0; i < SEGMENT_COUNT; ++i ) {
+    ctx->segments[ i ] = NULL;
+  }
+
+  for ( i = 0; i < OPERATION_COUNT; ++i ) {
+    size_t j = next_random( ctx ) % SEGMENT_COUNT;
+
+    if ( ctx->segments[ j ] != NULL ) {
+      return_segment( ctx, id, j );
+    } else {
+      get_segment( ctx, id, j );
+    }
+  }
+
+  sc = rtems_region_get_information( id, &info );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  printf(
+    "    \"%s\": {\n"
+    "      \"free-blocks\": %" PRIuPTR ",\n"
+    "      \"used-blocks\": %" PRIuPTR ",\n"
+    "      \"failed-allocations\": %" PRIu32 ",\n",
+    name,
+    info.Free.number,
+    info.Used.number,
+    ctx->failed
+  );
+  rtems_test_sample_print( &ctx->get, 6, "get-segment", "," );
+  rtems_test_sample_print( &ctx->ret, 6, "return-segment", "" );
+  printf( "    }%s\n", end );
+
+  for ( i = 0; i < SEGMENT_COUNT; ++i ) {
+    if ( ctx->segments[ i ] != NULL ) {
+      return_segment( ctx, id, i );
+    }
+  }
+
+  sc = rtems_region_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test( void )
+{
+  test_context *ctx = &test_instance;
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"operations\": %d,\n"
+    "  \"samples\": {\n",
+    OPERATION_COUNT
+  );
+
+  test_region(
+    ctx,
+    &area[ 0 ][ 0 ],
+    RTEMS_DEFAULT_ATTRIBUTES,
+    "first-fit",
+    ","
+  );
+  test_region(
+    ctx,
+    &area[ 1 ][ 0 ],
+    RTEMS_SEGREGATED_FIT,
+    "segregated-fit",
+    ""
+  );
+
+  printf( "  }\n}\n*** END OF JSON DATA ***\n" );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_REGIONS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
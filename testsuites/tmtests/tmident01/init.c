@@ -0,0 +1,214 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+#include "tmtests_sample.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/rtems/semdata.h>
+
+const char rtems_test_name[] = "TMIDENT 1";
+
+#define OBJECT_COUNT_MAX 2048
+
+#define SAMPLE_COUNT 100
+
+typedef struct {
+  rtems_id semaphores[ OBJECT_COUNT_MAX ];
+  uint32_t semaphore_count;
+} test_context;
+
+static test_context test_instance;
+
+static const uint32_t object_counts[] = { 16, 64, 256, 1024, OBJECT_COUNT_MAX };
+
+static rtems_name object_name( uint32_t i )
+{
+  return rtems_build_name( 'S', 'M', 0, 0 ) | i;
+}
+
+static void create_semaphores( test_context *ctx, uint32_t count )
+{
+  while ( ctx->semaphore_count < count ) {
+    rtems_status_code sc;
+    uint32_t i;
+
+    i = ctx->semaphore_count;
+    sc = rtems_semaphore_create(
+      object_name( i ),
+      0,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      0,
+      &ctx->semaphores[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    ++ctx->semaphore_count;
+  }
+}
+
+static void delete_semaphores( test_context *ctx )
+{
+  while ( ctx->semaphore_count > 0 ) {
+    rtems_status_code sc;
+
+    --ctx->semaphore_count;
+    sc = rtems_semaphore_delete( ctx->semaphores[ ctx->semaphore_count ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void measure_ident(
+  test_context *ctx,
+  const char   *name,
+  const char   *end
+)
+{
+  rtems_test_sample hit;
+  rtems_test_sample miss;
+  uint32_t          last;
+  uint32_t          i;
+
+  rtems_test_sample_init( &hit );
+  rtems_test_sample_init( &miss );
+  last = ctx->semaphore_count - 1;
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_status_code   sc;
+    rtems_id            id;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+
+    /* The most recently created object is the worst case of a linear search */
+    a = rtems_counter_read();
+    sc = rtems_semaphore_ident(
+      object_name( last ),
+      RTEMS_SEARCH_LOCAL_NODE,
+      &id
+    );
+    b = rtems_counter_read();
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_assert( id == ctx->semaphores[ last ] );
+    rtems_test_sample_add( &hit, rtems_counter_difference( b, a ) );
+
+    a = rtems_counter_read();
+    sc = rtems_semaphore_ident(
+      object_name( OBJECT_COUNT_MAX ),
+      RTEMS_SEARCH_LOCAL_NODE,
+      &id
+    );
+    b = rtems_counter_read();
+    rtems_test_assert( sc == RTEMS_INVALID_NAME );
+    rtems_test_sample_add( &miss, rtems_counter_difference( b, a ) );
+  }
+
+  printf( "      \"%s\": {\n", name );
+  rtems_test_sample_print( &hit, 8, "hit", "," );
+  rtems_test_sample_print( &miss, 8, "miss", "" );
+  printf( "      }%s\n", end );
+}
+
+static void test( void )
+{
+  test_context       *ctx;
+  Objects_Name_index *name_index;
+  size_t              i;
+
+  ctx = &test_instance;
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": [\n"
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( object_counts ); ++i ) {
+    create_semaphores( ctx, object_counts[ i ] );
+    name_index = _Semaphore_Information.name_index;
+    rtems_test_assert( name_index != NULL );
+
+    printf(
+      "    {\n"
+      "      \"objects\": %" PRIu32 ",\n",
+      ctx->semaphore_count
+    );
+
+    measure_ident( ctx, "indexed", "," );
+
+    /*
+     * Temporarily remove the name index to measure the linear search.  No
+     * object is created or deleted meanwhile.
+     */
+    _Semaphore_Information.name_index = NULL;
+    measure_ident( ctx, "linear", "" );
+    _Semaphore_Information.name_index = name_index;
+
+    printf(
+      "    }%s\n",
+      i + 1 < RTEMS_ARRAY_SIZE( object_counts ) ? "," : ""
+    );
+  }
+
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
+
+  delete_semaphores( ctx );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_SEMAPHORES rtems_resource_unlimited( 256 )
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_OBJECTS_NAME_INDEX
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,425 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMMSGQ 1";
+
+#define MESSAGE_SIZE_MAX 16384
+
+#define MESSAGE_COUNT 4
+
+#define SAMPLE_COUNT 1000
+
+#define EVENT_RECEIVE RTEMS_EVENT_0
+
+#define EVENT_RECEIVE_BUFFER RTEMS_EVENT_1
+
+typedef struct {
+  rtems_id    queue;
+  rtems_id    init;
+  rtems_id    worker;
+  void       *received;
+  size_t      received_size;
+  uint8_t     message[ MESSAGE_SIZE_MAX ];
+  uint8_t     copy[ MESSAGE_SIZE_MAX ];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t message_sizes[] = {
+  16,
+  256,
+  1024,
+  4096,
+  MESSAGE_SIZE_MAX
+};
+
+static void worker_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    rtems_event_set   events;
+    rtems_status_code sc;
+
+    sc = rtems_event_receive(
+      EVENT_RECEIVE | EVENT_RECEIVE_BUFFER,
+      RTEMS_EVENT_ANY | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    if ( ( events & EVENT_RECEIVE ) != 0 ) {
+      sc = rtems_message_queue_receive(
+        ctx->queue,
+        ctx->copy,
+        &ctx->received_size,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      ctx->received = ctx->copy;
+    } else {
+      sc = rtems_message_queue_receive_buffer(
+        ctx->queue,
+        &ctx->received,
+        &ctx->received_size,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    }
+  }
+}
+
+static void create_queue( test_context *ctx, size_t size )
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'M', 'S', 'G', 'Q' ),
+    MESSAGE_COUNT,
+    size,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void delete_queue( test_context *ctx )
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_delete( ctx->queue );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void wake_worker( test_context *ctx, rtems_event_set event )
+{
+  rtems_status_code sc;
+
+  ctx->received = NULL;
+  sc = rtems_event_send( ctx->worker, event );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void check_buffers( test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *buffers[ MESSAGE_COUNT ];
+  void             *buffer;
+  size_t            size;
+  size_t            i;
+
+  create_queue( ctx, sizeof( uint32_t ) );
+
+  /* Hand over the message buffer to a waiting receiver */
+  wake_worker( ctx, EVENT_RECEIVE_BUFFER );
+  sc = rtems_message_queue_get_buffer( ctx->queue, &buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  memcpy( buffer, "abc", 4 );
+  sc = rtems_message_queue_send_buffer( ctx->queue, buffer, 4 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->received == buffer );
+  rtems_test_assert( ctx->received_size == 4 );
+
+  /* The received message buffer may be sent again */
+  sc = rtems_message_queue_send_buffer( ctx->queue, buffer, 3 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( buffer == ctx->received );
+  rtems_test_assert( size == 3 );
+  sc = rtems_message_queue_return_buffer( ctx->queue, buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  sc = rtems_message_queue_return_buffer( ctx->queue, buffer );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  /* Copy the message buffer content to a waiting receiver */
+  wake_worker( ctx, EVENT_RECEIVE );
+  sc = rtems_message_queue_get_buffer( ctx->queue, &buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  memcpy( buffer, "def", 4 );
+  sc = rtems_message_queue_send_buffer( ctx->queue, buffer, 4 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->received == ctx->copy );
+  rtems_test_assert( memcmp( ctx->copy, "def", 4 ) == 0 );
+
+  /* Copy a message into a free message buffer for a waiting receiver */
+  wake_worker( ctx, EVENT_RECEIVE_BUFFER );
+  sc = rtems_message_queue_send( ctx->queue, "ghi", 4 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->received != NULL );
+  rtems_test_assert( memcmp( ctx->received, "ghi", 4 ) == 0 );
+  buffer = ctx->received;
+
+  /* Exhaust the message buffers */
+  wake_worker( ctx, EVENT_RECEIVE_BUFFER );
+
+  for ( i = 0; i < MESSAGE_COUNT - 1; ++i ) {
+    sc = rtems_message_queue_get_buffer( ctx->queue, &buffers[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_message_queue_get_buffer( ctx->queue, &buffers[ i ] );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+  sc = rtems_message_queue_send( ctx->queue, "jkl", 4 );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+  rtems_test_assert( ctx->received == NULL );
+
+  sc = rtems_message_queue_return_buffer( ctx->queue, buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  sc = rtems_message_queue_send( ctx->queue, "jkl", 4 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->received == buffer );
+
+  sc = rtems_message_queue_send_buffer(
+    ctx->queue,
+    buffers[ 0 ],
+    sizeof( uint32_t ) + 1
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+  sc = rtems_message_queue_return_buffer(
+    ctx->queue,
+    (char *) buffers[ 0 ] + 1
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+  sc = rtems_message_queue_return_buffer( ctx->queue, ctx->message );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  for ( i = 0; i < MESSAGE_COUNT - 1; ++i ) {
+    sc = rtems_message_queue_return_buffer( ctx->queue, buffers[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_message_queue_return_buffer( ctx->queue, ctx->received );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  delete_queue( ctx );
+}
+
+static uint64_t measure_copy( test_context *ctx, size_t size )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t            i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_status_code sc;
+    size_t            n;
+
+    memset( ctx->message, (int) i, size );
+    sc = rtems_message_queue_send( ctx->queue, ctx->message, size );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_message_queue_receive(
+      ctx->queue,
+      ctx->copy,
+      &n,
+      RTEMS_NO_WAIT,
+      0
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_assert( n == size );
+    rtems_test_assert( ctx->copy[ size - 1 ] == (uint8_t) i );
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static uint64_t measure_buffer( test_context *ctx, size_t size )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t            i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_status_code  sc;
+    void              *buffer;
+    size_t             n;
+
+    sc = rtems_message_queue_get_buffer( ctx->queue, &buffer );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    memset( buffer, (int) i, size );
+    sc = rtems_message_queue_send_buffer( ctx->queue, buffer, size );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_message_queue_receive_buffer(
+      ctx->queue,
+      &buffer,
+      &n,
+      RTEMS_NO_WAIT,
+      0
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_assert( n == size );
+    rtems_test_assert( ( (uint8_t *) buffer )[ size - 1 ] == (uint8_t) i );
+    sc = rtems_message_queue_return_buffer( ctx->queue, buffer );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static void print_result(
+  const char *name,
+  size_t      size,
+  uint64_t    ns,
+  const char *end
+)
+{
+  uint64_t bytes;
+
+  bytes = (uint64_t) size * SAMPLE_COUNT;
+
+  printf(
+    "      \"%s\": {\n"
+    "        \"ns-per-message\": %" PRIu64 ",\n"
+    "        \"mib-per-second\": %" PRIu64 "\n"
+    "      }%s\n",
+    name,
+    ns / SAMPLE_COUNT,
+    ns > 0 ? ( bytes * 1000000000 / ns ) >> 20 : 0,
+    end
+  );
+}
+
+static void test( void )
+{
+  test_context      *ctx;
+  rtems_status_code  sc;
+  size_t             i;
+
+  ctx = &test_instance;
+  ctx->init = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( ctx->worker, worker_task, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  check_buffers( ctx );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": [\n"
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( message_sizes ); ++i ) {
+    size_t size;
+
+    size = message_sizes[ i ];
+    create_queue( ctx, size );
+
+    printf(
+      "    {\n"
+      "      \"message-size\": %zu,\n",
+      size
+    );
+    print_result( "copy", size, measure_copy( ctx, size ), "," );
+    print_result( "buffer", size, measure_buffer( ctx, size ), "" );
+    printf(
+      "    }%s\n",
+      i + 1 < RTEMS_ARRAY_SIZE( message_sizes ) ? "," : ""
+    );
+
+    delete_queue( ctx );
+  }
+
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
+
+  sc = rtems_task_delete( ctx->worker );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
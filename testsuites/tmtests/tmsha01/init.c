@@ -0,0 +1,264 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <sys/param.h>
+
+#include <sha256.h>
+#include <sha512.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMSHA 1";
+
+#define DATA_SIZE_MAX 65536
+
+#define SAMPLE_BYTES ( 4 * DATA_SIZE_MAX )
+
+static uint8_t data[ DATA_SIZE_MAX ];
+
+static const size_t data_sizes[] = {
+  64,
+  1024,
+  4096,
+  DATA_SIZE_MAX
+};
+
+static const uint8_t sha256_abc[ SHA256_DIGEST_LENGTH ] = {
+  0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+  0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+  0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+  0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+};
+
+static const uint8_t sha512_abc[ SHA512_DIGEST_LENGTH ] = {
+  0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba,
+  0xcc, 0x41, 0x73, 0x49, 0xae, 0x20, 0x41, 0x31,
+  0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2,
+  0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a,
+  0x21, 0x92, 0x99, 0x2a, 0x27, 0x4f, 0xc1, 0xa8,
+  0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd,
+  0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e,
+  0x2a, 0x9a, 0xc9, 0x4f, 0xa5, 0x4c, 0xa4, 0x9f
+};
+
+static void fill_data( void )
+{
+  uint32_t x;
+  size_t   i;
+
+  x = 1;
+
+  for ( i = 0; i < sizeof( data ); ++i ) {
+    x = x * 1664525 + 1013904223;
+    data[ i ] = (uint8_t) ( x >> 24 );
+  }
+}
+
+/*
+ * The block compression function is selected by processor features.  Make
+ * sure the selected function produces the reference digests and that
+ * updates with sizes which are no multiple of the block size produce the
+ * digest of a single update.
+ */
+static void check_digests( void )
+{
+  SHA256_CTX    ctx256;
+  SHA512_CTX    ctx512;
+  unsigned char r[ SHA512_DIGEST_LENGTH ];
+  unsigned char s[ SHA512_DIGEST_LENGTH ];
+  size_t        i;
+
+  SHA256_Init( &ctx256 );
+  SHA256_Update( &ctx256, "abc", 3 );
+  SHA256_Final( r, &ctx256 );
+  rtems_test_assert( memcmp( r, sha256_abc, SHA256_DIGEST_LENGTH ) == 0 );
+
+  SHA512_Init( &ctx512 );
+  SHA512_Update( &ctx512, "abc", 3 );
+  SHA512_Final( r, &ctx512 );
+  rtems_test_assert( memcmp( r, sha512_abc, SHA512_DIGEST_LENGTH ) == 0 );
+
+  SHA256_Init( &ctx256 );
+  SHA256_Update( &ctx256, data, DATA_SIZE_MAX );
+  SHA256_Final( r, &ctx256 );
+
+  SHA256_Init( &ctx256 );
+
+  for ( i = 0; i < DATA_SIZE_MAX; i += 777 ) {
+    SHA256_Update( &ctx256, &data[ i ], MIN( 777, DATA_SIZE_MAX - i ) );
+  }
+
+  SHA256_Final( s, &ctx256 );
+  rtems_test_assert( memcmp( r, s, SHA256_DIGEST_LENGTH ) == 0 );
+
+  SHA512_Init( &ctx512 );
+  SHA512_Update( &ctx512, data, DATA_SIZE_MAX );
+  SHA512_Final( r, &ctx512 );
+
+  SHA512_Init( &ctx512 );
+
+  for ( i = 0; i < DATA_SIZE_MAX; i += 777 ) {
+    SHA512_Update( &ctx512, &data[ i ], MIN( 777, DATA_SIZE_MAX - i ) );
+  }
+
+  SHA512_Final( s, &ctx512 );
+  rtems_test_assert( memcmp( r, s, SHA512_DIGEST_LENGTH ) == 0 );
+}
+
+static uint64_t measure_sha256( size_t size )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  unsigned char       r[ SHA256_DIGEST_LENGTH ];
+  size_t              i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_BYTES; i += size ) {
+    SHA256_CTX ctx;
+
+    SHA256_Init( &ctx );
+    SHA256_Update( &ctx, data, size );
+    SHA256_Final( r, &ctx );
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static uint64_t measure_sha512( size_t size )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  unsigned char       r[ SHA512_DIGEST_LENGTH ];
+  size_t              i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_BYTES; i += size ) {
+    SHA512_CTX ctx;
+
+    SHA512_Init( &ctx );
+    SHA512_Update( &ctx, data, size );
+    SHA512_Final( r, &ctx );
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds( rtems_counter_difference( b, a ) );
+}
+
+static void print_result(
+  const char *name,
+  size_t      size,
+  uint64_t    ns,
+  const char *end
+)
+{
+  uint64_t count;
+
+  count = SAMPLE_BYTES / size;
+
+  printf(
+    "      \"%s\": {\n"
+    "        \"ns-per-digest\": %" PRIu64 ",\n"
+    "        \"mib-per-second\": %" PRIu64 "\n"
+    "      }%s\n",
+    name,
+    ns / count,
+    ns > 0 ? ( (uint64_t) SAMPLE_BYTES * 1000000000 / ns ) >> 20 : 0,
+    end
+  );
+}
+
+static void test( void )
+{
+  size_t i;
+
+  fill_data();
+  check_digests();
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": [\n"
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( data_sizes ); ++i ) {
+    size_t size;
+
+    size = data_sizes[ i ];
+
+    printf(
+      "    {\n"
+      "      \"data-size\": %zu,\n",
+      size
+    );
+    print_result( "sha256", size, measure_sha256( size ), "," );
+    print_result( "sha512", size, measure_sha512( size ), "" );
+    printf(
+      "    }%s\n",
+      i + 1 < RTEMS_ARRAY_SIZE( data_sizes ) ? "," : ""
+    );
+  }
+
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
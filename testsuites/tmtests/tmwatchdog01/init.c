@@ -0,0 +1,282 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 Fidelitas Defense
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+#include "tmtests_sample.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/watchdogimpl.h>
+
+const char rtems_test_name[] = "TMWATCHDOG 1";
+
+#define WATCHDOG_COUNT_MAX 10000
+
+#define SAMPLE_COUNT 1000
+
+#define INTERVAL_MAX 4000
+
+typedef struct {
+  Watchdog_Control *watchdogs;
+  Watchdog_Control  probe;
+  uint32_t          armed;
+  bool              rearm;
+  uint32_t          random;
+} test_context;
+
+static test_context test_instance;
+
+static const uint32_t watchdog_counts[] = {
+  16,
+  256,
+  1024,
+  WATCHDOG_COUNT_MAX
+};
+
+static Watchdog_Interval random_interval( test_context *ctx )
+{
+  ctx->random = ctx->random * 1103515245 + 12345;
+
+  return ( ( ctx->random >> 8 ) % INTERVAL_MAX ) + 1;
+}
+
+static void expire( Watchdog_Control *watchdog )
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+
+  /* Keep the count of armed watchdogs constant */
+  if ( ctx->rearm ) {
+    _Watchdog_Per_CPU_insert_ticks(
+      watchdog,
+      _Watchdog_Get_CPU( watchdog ),
+      random_interval( ctx )
+    );
+  }
+}
+
+static void arm_watchdogs( test_context *ctx, uint32_t count )
+{
+  Per_CPU_Control *cpu;
+
+  cpu = _Per_CPU_Get_snapshot();
+  ctx->rearm = true;
+
+  while ( ctx->armed < count ) {
+    Watchdog_Control *watchdog;
+
+    watchdog = &ctx->watchdogs[ ctx->armed ];
+    _Watchdog_Preinitialize( watchdog, cpu );
+    _Watchdog_Initialize( watchdog, expire );
+    _Watchdog_Per_CPU_insert_ticks( watchdog, cpu, random_interval( ctx ) );
+    ++ctx->armed;
+  }
+}
+
+static void disarm_watchdogs( test_context *ctx )
+{
+  ctx->rearm = false;
+
+  while ( ctx->armed > 0 ) {
+    --ctx->armed;
+    _Watchdog_Per_CPU_remove_ticks( &ctx->watchdogs[ ctx->armed ] );
+  }
+}
+
+static void measure(
+  test_context *ctx,
+  const char   *name,
+  const char   *end
+)
+{
+  Per_CPU_Control  *cpu;
+  rtems_test_sample insert;
+  rtems_test_sample remove;
+  rtems_test_sample tick;
+  uint32_t          i;
+
+  cpu = _Per_CPU_Get_snapshot();
+  rtems_test_sample_init( &insert );
+  rtems_test_sample_init( &remove );
+  rtems_test_sample_init( &tick );
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_interrupt_level level;
+    rtems_counter_ticks   a;
+    rtems_counter_ticks   b;
+    rtems_counter_ticks   c;
+    rtems_status_code     sc;
+
+    rtems_interrupt_local_disable( level );
+    a = rtems_counter_read();
+    _Watchdog_Per_CPU_insert_ticks(
+      &ctx->probe,
+      cpu,
+      random_interval( ctx )
+    );
+    b = rtems_counter_read();
+    _Watchdog_Per_CPU_remove_ticks( &ctx->probe );
+    c = rtems_counter_read();
+    rtems_interrupt_local_enable( level );
+
+    rtems_test_sample_add( &insert, rtems_counter_difference( b, a ) );
+    rtems_test_sample_add( &remove, rtems_counter_difference( c, b ) );
+
+    /*
+     * This measures the clock tick service including the routines of the
+     * expired watchdogs which insert their watchdog again.
+     */
+    a = rtems_counter_read();
+    sc = rtems_clock_tick();
+    b = rtems_counter_read();
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_sample_add( &tick, rtems_counter_difference( b, a ) );
+  }
+
+  printf( "      \"%s\": {\n", name );
+  rtems_test_sample_print( &insert, 8, "insert", "," );
+  rtems_test_sample_print( &remove, 8, "remove", "," );
+  rtems_test_sample_print( &tick, 8, "tick", "" );
+  printf( "      }%s\n", end );
+}
+
+static void use_red_black_tree( Watchdog_Header *header )
+{
+  rtems_interrupt_level level;
+
+  rtems_interrupt_local_disable( level );
+  rtems_test_assert( header->first == NULL );
+  header->wheel = NULL;
+  rtems_interrupt_local_enable( level );
+}
+
+static void use_timing_wheel( Watchdog_Header *header, Watchdog_Wheel *wheel )
+{
+  rtems_interrupt_level level;
+
+  rtems_interrupt_local_disable( level );
+  rtems_test_assert( header->first == NULL );
+  _Watchdog_Header_initialize_wheel(
+    header,
+    wheel,
+    _Per_CPU_Get()->Watchdog.ticks
+  );
+  rtems_interrupt_local_enable( level );
+}
+
+static void test( void )
+{
+  test_context    *ctx;
+  Watchdog_Header *header;
+  Watchdog_Wheel  *wheel;
+  size_t           i;
+
+  ctx = &test_instance;
+  ctx->random = 1;
+  ctx->watchdogs = calloc( WATCHDOG_COUNT_MAX, sizeof( *ctx->watchdogs ) );
+  rtems_test_assert( ctx->watchdogs != NULL );
+
+  header = &_Per_CPU_Get_snapshot()->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+  wheel = header->wheel;
+  rtems_test_assert( wheel != NULL );
+
+  _Watchdog_Preinitialize( &ctx->probe, _Per_CPU_Get_snapshot() );
+  _Watchdog_Initialize( &ctx->probe, expire );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": [\n"
+  );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( watchdog_counts ); ++i ) {
+    printf(
+      "    {\n"
+      "      \"watchdogs\": %" PRIu32 ",\n",
+      watchdog_counts[ i ]
+    );
+
+    arm_watchdogs( ctx, watchdog_counts[ i ] );
+    measure( ctx, "timing-wheel", "," );
+    disarm_watchdogs( ctx );
+
+    /*
+     * Temporarily use the red-black tree to measure the default watchdog
+     * implementation.  No watchdog is scheduled during the switch.
+     */
+    use_red_black_tree( header );
+    arm_watchdogs( ctx, watchdog_counts[ i ] );
+    measure( ctx, "red-black-tree", "" );
+    disarm_watchdogs( ctx );
+    use_timing_wheel( header, wheel );
+
+    printf(
+      "    }%s\n",
+      i + 1 < RTEMS_ARRAY_SIZE( watchdog_counts ) ? "," : ""
+    );
+  }
+
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
+
+  free( ctx->watchdogs );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_WATCHDOG_TIMING_WHEEL
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -33,6 +33,8 @@
 
 #include <rtems/crc.h>
 
+#include <inttypes.h>
+
 #include <rtems/test.h>
 
 T_TEST_CASE(CRC24Q) {
@@ -46,3 +48,203 @@ T_TEST_CASE(CRC24Q) {
   state = _CRC24Q_Sequence_update(CRC24Q_SEED, &bytes[0], sizeof(bytes));
   T_eq_u32(state & CRC24Q_MASK, 0x2c3045);
 }
+
+static const char crc_check_input[] = "123456789";
+
+T_TEST_CASE(CRC8) {
+  uint8_t state = _CRC8_Update(CRC8_SEED, 0);
+  T_eq_u8(state, 0);
+  state = _CRC8_Sequence_update(CRC8_SEED, crc_check_input, 9);
+  T_eq_u8(state, 0xf4);
+}
+
+T_TEST_CASE(CRC16) {
+  uint16_t state = _CRC16_Sequence_update(CRC16_SEED, crc_check_input, 9);
+  T_eq_u16(state, 0x29b1);
+  state = _CRC16_Sequence_update(0, crc_check_input, 9);
+  T_eq_u16(state, 0x31c3);
+}
+
+T_TEST_CASE(CRC32) {
+  uint32_t state = _CRC32_Sequence_update(CRC32_SEED, crc_check_input, 9);
+  T_eq_u32(state ^ CRC32_FINAL_XOR, 0xcbf43926);
+  state = _CRC32_Sequence_update(CRC32_SEED, crc_check_input, 4);
+  state = _CRC32_Sequence_update(state, &crc_check_input[4], 5);
+  T_eq_u32(state ^ CRC32_FINAL_XOR, 0xcbf43926);
+}
+
+T_TEST_CASE(CRC32C) {
+  uint32_t state = _CRC32C_Sequence_update(CRC32C_SEED, crc_check_input, 9);
+  T_eq_u32(state ^ CRC32C_FINAL_XOR, 0xe3069283);
+}
+
+T_TEST_CASE(CRC64) {
+  uint64_t state = _CRC64_Sequence_update(CRC64_SEED, crc_check_input, 9);
+  T_eq_u64(state ^ CRC64_FINAL_XOR, UINT64_C(0x995dc9bbdf1939fa));
+}
+
+typedef struct {
+  const char *name;
+  uint64_t seed;
+  uint64_t (*update)(uint64_t, uint8_t);
+  uint64_t (*sequence_update)(uint64_t, const void *, size_t);
+} crc_variant;
+
+static uint64_t crc8_update(uint64_t crc, uint8_t byte) {
+  return _CRC8_Update((uint8_t)crc, byte);
+}
+
+static uint64_t crc8_sequence_update(uint64_t crc, const void *bytes,
+                                     size_t size_in_bytes) {
+  return _CRC8_Sequence_update((uint8_t)crc, bytes, size_in_bytes);
+}
+
+static uint64_t crc16_update(uint64_t crc, uint8_t byte) {
+  return _CRC16_Update((uint16_t)crc, byte);
+}
+
+static uint64_t crc16_sequence_update(uint64_t crc, const void *bytes,
+                                      size_t size_in_bytes) {
+  return _CRC16_Sequence_update((uint16_t)crc, bytes, size_in_bytes);
+}
+
+static uint64_t crc24q_update(uint64_t crc, uint8_t byte) {
+  return _CRC24Q_Update((uint32_t)crc, byte) & CRC24Q_MASK;
+}
+
+static uint64_t crc24q_sequence_update(uint64_t crc, const void *bytes,
+                                       size_t size_in_bytes) {
+  return _CRC24Q_Sequence_update((uint32_t)crc, bytes, size_in_bytes) &
+         CRC24Q_MASK;
+}
+
+static uint64_t crc32_update(uint64_t crc, uint8_t byte) {
+  return _CRC32_Update((uint32_t)crc, byte);
+}
+
+static uint64_t crc32_sequence_update(uint64_t crc, const void *bytes,
+                                      size_t size_in_bytes) {
+  return _CRC32_Sequence_update((uint32_t)crc, bytes, size_in_bytes);
+}
+
+static uint64_t crc32c_update(uint64_t crc, uint8_t byte) {
+  return _CRC32C_Update((uint32_t)crc, byte);
+}
+
+static uint64_t crc32c_sequence_update(uint64_t crc, const void *bytes,
+                                       size_t size_in_bytes) {
+  return _CRC32C_Sequence_update((uint32_t)crc, bytes, size_in_bytes);
+}
+
+static uint64_t crc64_update(uint64_t crc, uint8_t byte) {
+  return _CRC64_Update(crc, byte);
+}
+
+static uint64_t crc64_sequence_update(uint64_t crc, const void *bytes,
+                                      size_t size_in_bytes) {
+  return _CRC64_Sequence_update(crc, bytes, size_in_bytes);
+}
+
+static const crc_variant crc_variants[] = {
+    {"CRC-8", CRC8_SEED, crc8_update, crc8_sequence_update},
+    {"CRC-16", CRC16_SEED, crc16_update, crc16_sequence_update},
+    {"CRC-24Q", CRC24Q_SEED, crc24q_update, crc24q_sequence_update},
+    {"CRC-32", CRC32_SEED, crc32_update, crc32_sequence_update},
+    {"CRC-32C", CRC32C_SEED, crc32c_update, crc32c_sequence_update},
+    {"CRC-64", CRC64_SEED, crc64_update, crc64_sequence_update}};
+
+#define CRC_BUFFER_SIZE 4096
+
+static uint8_t crc_buffer[CRC_BUFFER_SIZE + 8];
+
+static void crc_fill_buffer(void) {
+  uint32_t x = 1;
+  size_t i;
+
+  for (i = 0; i < sizeof(crc_buffer); ++i) {
+    x = x * 1664525 + 1013904223;
+    crc_buffer[i] = (uint8_t)(x >> 24);
+  }
+}
+
+static uint64_t crc_byte_wise(const crc_variant *variant, uint64_t crc,
+                              const uint8_t *bytes, size_t size_in_bytes) {
+  size_t i;
+
+  for (i = 0; i < size_in_bytes; ++i) {
+    crc = (*variant->update)(crc, bytes[i]);
+  }
+
+  return crc;
+}
+
+/*
+ * The sequence update functions use multi-byte kernels.  Check them against
+ * the byte-wise update for all sizes of the multi-byte step and the unaligned
+ * start addresses.
+ */
+T_TEST_CASE(CRCSequenceUpdate) {
+  size_t v;
+
+  crc_fill_buffer();
+
+  for (v = 0; v < RTEMS_ARRAY_SIZE(crc_variants); ++v) {
+    const crc_variant *variant = &crc_variants[v];
+    size_t offset;
+
+    for (offset = 0; offset < 8; ++offset) {
+      size_t size;
+
+      for (size = 0; size <= 67; ++size) {
+        const uint8_t *bytes = &crc_buffer[offset];
+        uint64_t expected;
+        uint64_t actual;
+
+        expected = crc_byte_wise(variant, variant->seed, bytes, size);
+        actual = (*variant->sequence_update)(variant->seed, bytes, size);
+        T_quiet_eq_u64(actual, expected);
+      }
+    }
+
+    T_eq_u64((*variant->sequence_update)(variant->seed, crc_buffer,
+                                         CRC_BUFFER_SIZE),
+             crc_byte_wise(variant, variant->seed, crc_buffer,
+                           CRC_BUFFER_SIZE));
+  }
+}
+
+/*
+ * Report the throughput of the byte-wise and sequence update functions in
+ * bytes per 1000 CPU counter ticks.
+ */
+T_TEST_CASE(CRCPerformance) {
+  size_t v;
+
+  crc_fill_buffer();
+
+  for (v = 0; v < RTEMS_ARRAY_SIZE(crc_variants); ++v) {
+    const crc_variant *variant = &crc_variants[v];
+    T_ticks t0;
+    T_ticks t1;
+    T_ticks t2;
+    uint64_t a;
+    uint64_t b;
+
+    t0 = T_tick();
+    a = crc_byte_wise(variant, variant->seed, crc_buffer, CRC_BUFFER_SIZE);
+    t1 = T_tick();
+    b = (*variant->sequence_update)(variant->seed, crc_buffer,
+                                    CRC_BUFFER_SIZE);
+    t2 = T_tick();
+    T_eq_u64(a, b);
+
+    if (t1 != t0 && t2 != t1) {
+      T_log(T_NORMAL,
+            "%s: byte-wise %" PRIu64 ", sequence %" PRIu64
+            " bytes per 1000 ticks",
+            variant->name,
+            (uint64_t)CRC_BUFFER_SIZE * 1000 / (uint64_t)(t1 - t0),
+            (uint64_t)CRC_BUFFER_SIZE * 1000 / (uint64_t)(t2 - t1));
+    }
+  }
+}